@@ -0,0 +1,96 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+#include <stddef.h>
+
+namespace db {
+
+/**
+ * @brief Bump allocator for objects which all die together.
+ *
+ * @detail Memory is only given back in bulk with @ref rewind or @ref reset,
+ * the arena never runs destructors. The chunks are kept for the next
+ * allocations, so that an arena reused across queries stops allocating once
+ * it has grown to the size of the largest query.
+ *
+ * Marks can be nested: an arena shared by several owners must be rewound
+ * in the reverse order of the marks.
+ */
+class Arena {
+public:
+    static constexpr size_t CHUNK_SIZE = 64 * 1024;
+    static constexpr size_t ALIGNMENT = alignof(max_align_t);
+
+    struct Mark {
+        size_t _chunk {0};
+        size_t _offset {0};
+    };
+
+    Arena() = default;
+    ~Arena() = default;
+
+    Arena(const Arena&) = delete;
+    Arena(Arena&&) = delete;
+    Arena& operator=(const Arena&) = delete;
+    Arena& operator=(Arena&&) = delete;
+
+    // Returns memory aligned for any fundamental type
+    void* alloc(size_t size) {
+        const size_t offset = (_offset + ALIGNMENT - 1) & ~(ALIGNMENT - 1);
+        if (_chunk < _chunks.size() && offset + size <= _chunks[_chunk]._size) {
+            _offset = offset + size;
+            return _chunks[_chunk]._data.get() + offset;
+        }
+
+        return allocInNextChunk(size);
+    }
+
+    Mark mark() const { return Mark {_chunk, _offset}; }
+
+    // Frees everything allocated since the mark
+    void rewind(Mark mark) {
+        _chunk = mark._chunk;
+        _offset = mark._offset;
+    }
+
+    void reset() { rewind(Mark {}); }
+
+    size_t getCapacity() const {
+        size_t capacity = 0;
+        for (const Chunk& chunk : _chunks) {
+            capacity += chunk._size;
+        }
+        return capacity;
+    }
+
+private:
+    struct Chunk {
+        std::unique_ptr<char[]> _data;
+        size_t _size {0};
+    };
+
+    std::vector<Chunk> _chunks;
+    size_t _chunk {0};
+    size_t _offset {0};
+
+    void* allocInNextChunk(size_t size) {
+        // Chunks too small for the allocation are skipped until the next
+        // rewind, new chunks are appended so that the marks stay valid
+        size_t next = _chunk < _chunks.size() ? _chunk + 1 : _chunk;
+        while (next < _chunks.size() && _chunks[next]._size < size) {
+            next++;
+        }
+
+        if (next == _chunks.size()) {
+            const size_t chunkSize = size > CHUNK_SIZE ? size : CHUNK_SIZE;
+            _chunks.push_back(Chunk {std::unique_ptr<char[]>(new char[chunkSize]), chunkSize});
+        }
+
+        _chunk = next;
+        _offset = size;
+        return _chunks[_chunk]._data.get();
+    }
+};
+
+}
@@ -0,0 +1,70 @@
+#pragma once
+
+#include <array>
+#include <chrono>
+
+#include "ThreadCounters.h"
+#include "TuringTime.h"
+
+namespace db {
+
+/**
+ * @brief Histogram of durations with fixed buckets, recorded without contention.
+ *
+ * @detail The bucket bounds follow the Prometheus defaults, from 1ms to 10s.
+ * The counts returned by getBucketCount are cumulative, as exposed by Prometheus.
+ */
+class DurationHistogram {
+public:
+    static constexpr size_t BUCKET_COUNT = 11;
+
+    // Upper bounds of the buckets in seconds, the last bucket is unbounded
+    static constexpr std::array<double, BUCKET_COUNT> BUCKET_BOUNDS = {
+        0.001, 0.0025, 0.005, 0.01, 0.025, 0.05, 0.1, 0.25, 0.5, 1.0, 10.0,
+    };
+
+    DurationHistogram() = default;
+    ~DurationHistogram() = default;
+
+    DurationHistogram(const DurationHistogram&) = delete;
+    DurationHistogram(DurationHistogram&&) = delete;
+    DurationHistogram& operator=(const DurationHistogram&) = delete;
+    DurationHistogram& operator=(DurationHistogram&&) = delete;
+
+    void record(Milliseconds duration) {
+        const double seconds = duration.count() / 1000.0;
+
+        size_t bucket = 0;
+        while (bucket < BUCKET_COUNT && seconds > BUCKET_BOUNDS[bucket]) {
+            bucket++;
+        }
+
+        const auto micros = std::chrono::duration_cast<std::chrono::microseconds>(duration);
+
+        _counters.add(bucket);
+        _counters.add(SUM_COUNTER, micros.count() > 0 ? micros.count() : 0);
+    }
+
+    // Number of durations below or equal to BUCKET_BOUNDS[bucket],
+    // all the durations for bucket == BUCKET_COUNT
+    uint64_t getBucketCount(size_t bucket) const {
+        uint64_t count = 0;
+        for (size_t i = 0; i <= bucket; i++) {
+            count += _counters.get(i);
+        }
+
+        return count;
+    }
+
+    uint64_t getCount() const { return getBucketCount(BUCKET_COUNT); }
+
+    double getSumSeconds() const { return _counters.get(SUM_COUNTER) / 1e6; }
+
+private:
+    // One counter per bucket, the unbounded bucket, and the sum in microseconds
+    static constexpr size_t SUM_COUNTER = BUCKET_COUNT + 1;
+
+    ThreadCounters<BUCKET_COUNT + 2> _counters;
+};
+
+}
@@ -0,0 +1,57 @@
+#pragma once
+
+#include <map>
+#include <string>
+#include <string_view>
+#include <variant>
+#include <vector>
+#include <stdint.h>
+
+namespace db {
+
+/**
+ * @brief Values bound to the $parameters of a query.
+ *
+ * @detail Parameters are resolved after the plan of the query is built, so that
+ * the same plan can be reused with different values. The types of the values
+ * are part of the plan though, see @ref appendSignature.
+ */
+class QueryParams {
+public:
+    using Null = std::monostate;
+
+    // Embeddings, only accepted as arguments of procedures
+    using Vector = std::vector<float>;
+
+    using Value = std::variant<Null, bool, int64_t, double, std::string, Vector>;
+
+    QueryParams() = default;
+    ~QueryParams() = default;
+
+    void set(std::string_view name, Value value) {
+        _values.insert_or_assign(std::string(name), std::move(value));
+    }
+
+    const Value* get(std::string_view name) const {
+        const auto it = _values.find(name);
+        return it == _values.end() ? nullptr : &it->second;
+    }
+
+    bool empty() const { return _values.empty(); }
+    size_t size() const { return _values.size(); }
+
+    // Appends the names and the types of the parameters to out
+    void appendSignature(std::string& out) const {
+        for (const auto& [name, value] : _values) {
+            out += name;
+            out += ':';
+            out += (char)('0' + value.index());
+            out += ';';
+        }
+    }
+
+private:
+    std::map<std::string, Value, std::less<>> _values;
+};
+
+}
@@ -0,0 +1,66 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <stddef.h>
+
+#include "TuringTime.h"
+
+namespace db {
+
+/**
+ * @brief Operators of an executed or explained query pipeline.
+ *
+ * @detail The operators are stored in depth first order from the sinks of the
+ * pipeline, each operator is followed by the operators producing its inputs.
+ * A processor feeding several others appears only once, under its first consumer.
+ *
+ * The runtime counters are only filled for PROFILE, EXPLAIN only has the
+ * operators and the rows estimated by the planner.
+ */
+class QueryProfile {
+public:
+    struct Operator {
+        std::string _name;
+        size_t _depth {0};
+        std::vector<size_t> _children;
+
+        // Rows estimated by the planner, negative if unknown
+        double _estimatedRows {-1};
+
+        size_t _rowsIn {0};
+        size_t _rowsOut {0};
+        size_t _chunks {0};
+        size_t _executions {0};
+        Milliseconds _time {0};
+        size_t _memoryBytes {0};
+        size_t _dataparts {0};
+    };
+
+    using Operators = std::vector<Operator>;
+
+    QueryProfile() = default;
+    explicit QueryProfile(bool executed)
+        : _executed(executed)
+    {
+    }
+
+    ~QueryProfile() = default;
+
+    // False for EXPLAIN, the counters are then all zero
+    bool isExecuted() const { return _executed; }
+
+    const Operators& operators() const { return _operators; }
+    Operators& operators() { return _operators; }
+
+    // Indices of the operators that have no consumer
+    const std::vector<size_t>& roots() const { return _roots; }
+    std::vector<size_t>& roots() { return _roots; }
+
+private:
+    bool _executed {false};
+    Operators _operators;
+    std::vector<size_t> _roots;
+};
+
+}
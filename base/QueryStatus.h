@@ -1,9 +1,12 @@
 #pragma once
 
+#include <memory>
 #include <string>
+#include <stddef.h>
 
 #include "EnumToString.h"
 #include "TuringTime.h"
+#include "QueryProfile.h"
 
 namespace db {
 
@@ -43,10 +46,31 @@ public:
     void setTotalTime(Milliseconds totalTime) { _totalTime = totalTime; }
     Milliseconds getTotalTime() const { return _totalTime; }
 
+    // Bytes used by the columns of the query and bytes reserved for them,
+    // the difference is lost to fragmentation or kept from previous queries.
+    // The peak is the highest usage seen during the query
+    void setMemoryUsage(size_t usedBytes, size_t reservedBytes, size_t peakUsedBytes) {
+        _memUsed = usedBytes;
+        _memReserved = reservedBytes;
+        _memPeak = peakUsedBytes;
+    }
+
+    size_t getMemoryUsed() const { return _memUsed; }
+    size_t getMemoryReserved() const { return _memReserved; }
+    size_t getMemoryPeak() const { return _memPeak; }
+
+    // Operators of the pipeline, only set for EXPLAIN and PROFILE queries
+    void setProfile(std::shared_ptr<QueryProfile> profile) { _profile = std::move(profile); }
+    const QueryProfile* getProfile() const { return _profile.get(); }
+
 private:
     Status _status {Status::OK};
     std::string _errorMsg;
     Milliseconds _totalTime {0};
+    size_t _memUsed {0};
+    size_t _memReserved {0};
+    size_t _memPeak {0};
+    std::shared_ptr<QueryProfile> _profile;
 };
 
 using QueryStatusDescription = EnumToString<QueryStatus::Status>::Create<
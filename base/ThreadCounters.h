@@ -0,0 +1,154 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+#include <stddef.h>
+#include <stdint.h>
+
+namespace db {
+
+/**
+ * @brief Counters incremented by many threads without contention.
+ *
+ * @detail Each thread increments the counters of its own slot, on its own cache
+ * line, and the slots are only summed when the counters are read. Increments are
+ * lock-free, only the first increment of a thread takes a lock to create its slot.
+ *
+ * Reads are not synchronised with the increments, a read concurrent to increments
+ * can see some of them only. Slots are kept until the counters are destroyed, the
+ * threads drop the slots of destroyed counters from their cache on their next
+ * first increment of a counter.
+ */
+template <size_t Count>
+class ThreadCounters {
+public:
+    ThreadCounters()
+        : _id(registerCounters())
+    {
+    }
+
+    ~ThreadCounters() {
+        unregisterCounters(_id);
+    }
+
+    ThreadCounters(const ThreadCounters&) = delete;
+    ThreadCounters(ThreadCounters&&) = delete;
+    ThreadCounters& operator=(const ThreadCounters&) = delete;
+    ThreadCounters& operator=(ThreadCounters&&) = delete;
+
+    void add(size_t counter, uint64_t value = 1) {
+        // Only the owner thread writes to its slot
+        std::atomic<uint64_t>& slotValue = getSlot()._values[counter];
+        slotValue.store(slotValue.load(std::memory_order_relaxed) + value,
+                        std::memory_order_relaxed);
+    }
+
+    uint64_t get(size_t counter) const {
+        std::scoped_lock lock {_mutex};
+
+        uint64_t sum = 0;
+        for (const auto& slot : _slots) {
+            sum += slot->_values[counter].load(std::memory_order_relaxed);
+        }
+
+        return sum;
+    }
+
+    // Number of counters whose slot is cached by the calling thread
+    static size_t getThreadSlotCount() { return threadSlots()._slots.size(); }
+
+private:
+    struct alignas(64) Slot {
+        std::array<std::atomic<uint64_t>, Count> _values {};
+    };
+
+    // Identifies the counters in the slot caches of the threads,
+    // never reused so that a new instance can not get a stale slot
+    const uint64_t _id;
+
+    mutable std::mutex _mutex;
+    std::vector<std::unique_ptr<Slot>> _slots;
+
+    // Slots of the counters used by a thread
+    struct ThreadSlots {
+        std::vector<std::pair<uint64_t, Slot*>> _slots;
+        uint64_t _destroyedCount {0};
+    };
+
+    // IDs of the live counters, the slot caches of the threads are pruned
+    // when counters were destroyed since their last pruning
+    struct Registry {
+        std::mutex _mutex;
+        uint64_t _nextID {0};
+        std::unordered_set<uint64_t> _liveIDs;
+        std::atomic<uint64_t> _destroyedCount {0};
+    };
+
+    Slot& getSlot() {
+        ThreadSlots& cache = threadSlots();
+
+        for (const auto& [id, slot] : cache._slots) {
+            if (id == _id) {
+                return *slot;
+            }
+        }
+
+        pruneThreadSlots(cache);
+
+        std::scoped_lock lock {_mutex};
+        Slot* slot = _slots.emplace_back(std::make_unique<Slot>()).get();
+        cache._slots.emplace_back(_id, slot);
+
+        return *slot;
+    }
+
+    static ThreadSlots& threadSlots() {
+        thread_local ThreadSlots slots;
+        return slots;
+    }
+
+    static Registry& registry() {
+        static Registry registry;
+        return registry;
+    }
+
+    static uint64_t registerCounters() {
+        Registry& reg = registry();
+        std::scoped_lock lock {reg._mutex};
+
+        const uint64_t id = reg._nextID++;
+        reg._liveIDs.insert(id);
+
+        return id;
+    }
+
+    static void unregisterCounters(uint64_t id) {
+        Registry& reg = registry();
+        std::scoped_lock lock {reg._mutex};
+
+        reg._liveIDs.erase(id);
+        reg._destroyedCount.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    static void pruneThreadSlots(ThreadSlots& cache) {
+        Registry& reg = registry();
+        const uint64_t destroyedCount = reg._destroyedCount.load(std::memory_order_relaxed);
+        if (destroyedCount == cache._destroyedCount) {
+            return;
+        }
+
+        std::scoped_lock lock {reg._mutex};
+        std::erase_if(cache._slots, [&](const auto& entry) {
+            return !reg._liveIDs.contains(entry.first);
+        });
+
+        cache._destroyedCount = destroyedCount;
+    }
+};
+
+}
@@ -6,6 +6,7 @@
 #include "JobSystem.h"
 #include "QueryInterpreterV2.h"
 #include "InterpreterContext.h"
+#include "PlanCache.h"
 #include "procedures/ProcedureBlueprintMap.h"
 
 #include "Panic.h"
@@ -17,7 +18,8 @@ TuringDB::TuringDB(const TuringConfig* config)
     : _config(config),
     _systemManager(std::make_unique<SystemManager>(config)),
     _jobSystem(JobSystem::create()),
-    _procedures(ProcedureBlueprintMap::create())
+    _procedures(ProcedureBlueprintMap::create()),
+    _planCache(std::make_unique<PlanCache>())
 {
 }
 
@@ -79,10 +81,13 @@ QueryStatus TuringDB::query(std::string_view query,
                             LocalMemory* mem,
                             QueryCallbackV2 callback,
                             CommitHash commit,
-                            ChangeID change) {
-    QueryInterpreterV2 interp(_systemManager.get(), _jobSystem.get());
+                            ChangeID change,
+                            const QueryParams* params) {
+    QueryInterpreterV2 interp(_systemManager.get(), _jobSystem.get(), _planCache.get());
 
     InterpreterContext ctxt(mem, callback, _procedures.get(), commit, change);
+    ctxt.setParameters(params);
+    ctxt.setChunkSize(_config->getChunkSize());
     return interp.execute(ctxt, query, graphName);
 }
 
@@ -91,10 +96,11 @@ QueryStatus TuringDB::query(std::string_view query,
                             LocalMemory* mem,
                             CommitHash commit,
                             ChangeID change) {
-    QueryInterpreterV2 interp(_systemManager.get(), _jobSystem.get());
+    QueryInterpreterV2 interp(_systemManager.get(), _jobSystem.get(), _planCache.get());
 
     QueryCallbackV2 callback = [](const Dataframe*){};
 
     InterpreterContext ctxt(mem, callback, _procedures.get(), commit, change);
+    ctxt.setChunkSize(_config->getChunkSize());
     return interp.execute(ctxt, query, graphName);
 }
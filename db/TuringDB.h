@@ -15,6 +15,8 @@ class LocalMemory;
 class JobSystem;
 class Block;
 class ProcedureBlueprintMap;
+class PlanCache;
+class QueryParams;
 
 class TuringDB {
 public:
@@ -28,7 +30,8 @@ public:
                       LocalMemory* mem,
                       QueryCallbackV2 callback,
                       CommitHash hash = CommitHash::head(),
-                      ChangeID change = ChangeID::head());
+                      ChangeID change = ChangeID::head(),
+                      const QueryParams* params = nullptr);
 
     QueryStatus query(std::string_view query,
                       std::string_view graphName,
@@ -48,11 +51,16 @@ public:
         return *_procedures;
     }
 
+    const PlanCache& getPlanCache() const {
+        return *_planCache;
+    }
+
 private:
     const TuringConfig* _config;
     std::unique_ptr<SystemManager> _systemManager;
     std::unique_ptr<JobSystem> _jobSystem;
     std::unique_ptr<ProcedureBlueprintMap> _procedures;
+    std::unique_ptr<PlanCache> _planCache;
 };
 
 }
@@ -1,9 +1,14 @@
 #include "FileCache.h"
 
+#include <filesystem>
+#include <mutex>
+
 #include <spdlog/spdlog.h>
 
 #include "AwsS3ClientWrapper.h"
 #include "MockS3Client.h"
+#include "JobSystem.h"
+#include "JobGroup.h"
 
 using namespace db;
 
@@ -44,13 +49,64 @@ FileCacheResult<void> FileCache<ClientType>::listGraphs(std::vector<std::string>
 template <typename ClientType>
 FileCacheResult<void> FileCache<ClientType>::loadGraph(std::string_view graphName) {
     const bool exists = (_graphsDir / graphName).exists();
-    if (exists) {
-        return {};
-    }
 
     std::string graphDirectory = fmt::format("{}/{}/", _graphsDir.c_str(), graphName);
     std::string s3Prefix = fmt::format("{}/graphs/{}/", _userId, graphName);
-    if (auto res = _s3Client.downloadDirectory(graphDirectory, _bucketName, s3Prefix); !res) {
+
+    GraphManifest remoteManifest;
+    if (auto res = getRemoteManifest(remoteManifest, s3Prefix); !res) {
+        // The local copy is used as is if the remote storage is unreachable
+        if (exists) {
+            return {};
+        }
+
+        // Graphs saved without manifest are downloaded entirely
+        if (res.error().getType() != S3::S3ClientErrorType::INVALID_KEY_NAME) {
+            return FileCacheError::result(FileCacheErrorType::GRAPH_LOAD_FAILED, res.error());
+        }
+
+        if (auto downloadRes = _s3Client.downloadDirectory(graphDirectory, _bucketName, s3Prefix); !downloadRes) {
+            return FileCacheError::result(FileCacheErrorType::GRAPH_LOAD_FAILED, downloadRes.error());
+        }
+
+        return {};
+    }
+
+    // Only the files missing or different from the remote manifest,
+    // typically the commits made since the last load, are downloaded
+    GraphManifest localManifest;
+    if (exists) {
+        GraphManifest::build(localManifest, graphDirectory, &remoteManifest);
+    }
+
+    std::vector<const GraphManifest::Entry*> missingFiles;
+    for (const GraphManifest::Entry& entry : remoteManifest.entries()) {
+        const GraphManifest::Entry* localEntry = localManifest.find(entry._path);
+        if (!localEntry || !GraphManifest::isSameFile(*localEntry, entry)) {
+            missingFiles.push_back(&entry);
+        }
+    }
+
+    std::error_code ec;
+    std::filesystem::create_directories(graphDirectory, ec);
+    if (ec) {
+        return FileCacheError::result(FileCacheErrorType::GRAPH_LOAD_FAILED,
+                                      S3::S3ClientError(S3::S3ClientErrorType::FILE_SYSTEM_ERROR));
+    }
+
+    const auto res = transferFiles(missingFiles, [&](const GraphManifest::Entry& entry) -> S3::S3ClientResult<void> {
+        const std::filesystem::path filePath = std::filesystem::path(graphDirectory) / entry._path;
+
+        std::error_code ec;
+        std::filesystem::create_directories(filePath.parent_path(), ec);
+        if (ec) {
+            return S3::S3ClientError::result(S3::S3ClientErrorType::FILE_SYSTEM_ERROR);
+        }
+
+        return _s3Client.downloadFile(filePath.string(), _bucketName, s3Prefix + entry._path, entry._size);
+    });
+
+    if (!res) {
         return FileCacheError::result(FileCacheErrorType::GRAPH_LOAD_FAILED, res.error());
     }
 
@@ -66,13 +122,131 @@ FileCacheResult<void> FileCache<ClientType>::saveGraph(std::string_view graphNam
 
     std::string graphDirectory = fmt::format("{}/{}/", _graphsDir.c_str(), graphName);
     std::string s3Prefix = fmt::format("{}/graphs/{}/", _userId, graphName);
-    if (auto res = _s3Client.uploadDirectory(graphDirectory, _bucketName, s3Prefix); !res) {
+
+    // Without remote manifest, all the files are uploaded
+    GraphManifest remoteManifest;
+    const bool hasRemoteManifest = (bool)getRemoteManifest(remoteManifest, s3Prefix);
+    if (!hasRemoteManifest) {
+        remoteManifest = GraphManifest();
+    }
+
+    GraphManifest localManifest;
+    if (!GraphManifest::build(localManifest, graphDirectory, &remoteManifest)) {
+        return FileCacheError::result(FileCacheErrorType::GRAPH_SAVE_FAILED,
+                                      S3::S3ClientError(S3::S3ClientErrorType::FILE_SYSTEM_ERROR));
+    }
+
+    std::vector<const GraphManifest::Entry*> changedFiles;
+    for (const GraphManifest::Entry& entry : localManifest.entries()) {
+        const GraphManifest::Entry* remoteEntry = remoteManifest.find(entry._path);
+        if (!remoteEntry || !GraphManifest::isSameFile(*remoteEntry, entry)) {
+            changedFiles.push_back(&entry);
+        }
+    }
+
+    const auto res = transferFiles(changedFiles, [&](const GraphManifest::Entry& entry) -> S3::S3ClientResult<void> {
+        const std::string filePath = graphDirectory + entry._path;
+        const std::string key = s3Prefix + entry._path;
+
+        // The commit files are never modified, if one already exists
+        // remotely it was uploaded by a save which did not complete
+        if (GraphManifest::isImmutable(entry._path)) {
+            auto res = _s3Client.uploadFile(filePath, _bucketName, key);
+            if (!res && res.error().getType() == S3::S3ClientErrorType::FILE_EXISTS) {
+                return {};
+            }
+            return res;
+        }
+
+        return _s3Client.uploadFile(filePath, _bucketName, key, true);
+    });
+
+    if (!res) {
+        return FileCacheError::result(FileCacheErrorType::GRAPH_SAVE_FAILED, res.error());
+    }
+
+    // The manifest is uploaded last so that it never lists missing files
+    std::string manifestData;
+    localManifest.serialize(manifestData);
+
+    if (hasRemoteManifest) {
+        std::string remoteManifestData;
+        remoteManifest.serialize(remoteManifestData);
+        if (manifestData == remoteManifestData) {
+            return {};
+        }
+    }
+
+    const std::string manifestKey = fmt::format("{}{}", s3Prefix, GraphManifest::FILE_NAME);
+    if (auto res = _s3Client.putObject(manifestData, _bucketName, manifestKey); !res) {
         return FileCacheError::result(FileCacheErrorType::GRAPH_SAVE_FAILED, res.error());
     }
 
     return {};
 }
 
+template <typename ClientType>
+S3::S3ClientResult<void> FileCache<ClientType>::getRemoteManifest(GraphManifest& manifest,
+                                                                  const std::string& s3Prefix) {
+    const std::string manifestKey = fmt::format("{}{}", s3Prefix, GraphManifest::FILE_NAME);
+
+    std::string manifestData;
+    if (auto res = _s3Client.getObject(manifestData, _bucketName, manifestKey); !res) {
+        return res;
+    }
+
+    if (!GraphManifest::parse(manifest, manifestData)) {
+        spdlog::warn("The manifest {} is corrupted", manifestKey);
+        return S3::S3ClientError::result(S3::S3ClientErrorType::CANNOT_DOWNLOAD_FILE);
+    }
+
+    return {};
+}
+
+template <typename ClientType>
+S3::S3ClientResult<void> FileCache<ClientType>::transferFiles(const std::vector<const GraphManifest::Entry*>& files,
+                                                              const TransferFunc& transfer) {
+    JobSystem* jobSystem = _s3Client.getJobSystem();
+
+    // Large files are transferred one after the other, their parts are
+    // transferred concurrently by the client. Small files are transferred
+    // concurrently with each other
+    std::vector<const GraphManifest::Entry*> smallFiles;
+    for (const GraphManifest::Entry* entry : files) {
+        if (jobSystem && entry->_size <= _s3Client.getPartSize()) {
+            smallFiles.push_back(entry);
+            continue;
+        }
+
+        if (auto res = transfer(*entry); !res) {
+            return res;
+        }
+    }
+
+    if (smallFiles.empty()) {
+        return {};
+    }
+
+    std::mutex errorMutex;
+    S3::S3ClientResult<void> result;
+
+    JobGroup group = jobSystem->newGroup();
+    for (const GraphManifest::Entry* entry : smallFiles) {
+        group.submit<void>([&, entry](Promise*) {
+            auto res = transfer(*entry);
+            if (!res) {
+                std::scoped_lock lock(errorMutex);
+                if (result) {
+                    result = res;
+                }
+            }
+        });
+    }
+    group.wait();
+
+    return result;
+}
+
 template <typename ClientType>
 FileCacheResult<void> FileCache<ClientType>::listData(std::vector<std::string>& files,
                                                       std::vector<std::string>& folders,
@@ -1,8 +1,10 @@
 #pragma once
 
+#include <functional>
 #include <string_view>
 
 #include "FileCacheResult.h"
+#include "GraphManifest.h"
 #include "TuringS3Client.h"
 #include "Path.h"
 
@@ -17,6 +19,8 @@ public:
               const fs::Path& dataDir,
               S3::TuringS3Client<ClientType>& clientWrapper);
 
+    // Graphs are synchronised with the manifest stored next to them in
+    // remote storage, only the files which differ are transferred
     FileCacheResult<void> saveGraph(std::string_view graphName);
     FileCacheResult<void> loadGraph(std::string_view graphName);
 
@@ -46,5 +50,12 @@ private:
     S3::TuringS3Client<ClientType>& _s3Client;
     std::string _userId = "turingDefault";
     std::string _bucketName = "turing-disk-test";
+
+    using TransferFunc = std::function<S3::S3ClientResult<void>(const GraphManifest::Entry&)>;
+
+    S3::S3ClientResult<void> getRemoteManifest(GraphManifest& manifest,
+                                               const std::string& s3Prefix);
+    S3::S3ClientResult<void> transferFiles(const std::vector<const GraphManifest::Entry*>& files,
+                                           const TransferFunc& transfer);
 };
 }
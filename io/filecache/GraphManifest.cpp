@@ -0,0 +1,189 @@
+#include "GraphManifest.h"
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <stdlib.h>
+
+#include <spdlog/fmt/bundled/format.h>
+
+using namespace db;
+
+namespace {
+
+constexpr std::string_view COMMIT_FOLDER_PREFIX = "commit-";
+constexpr std::string_view GRAPH_FILE_NAMES[] = {"info", "type"};
+constexpr uint64_t FNV_OFFSET_BASIS = 14695981039346656037ull;
+constexpr uint64_t FNV_PRIME = 1099511628211ull;
+
+}
+
+bool GraphManifest::build(GraphManifest& manifest,
+                          const std::string& graphDir,
+                          const GraphManifest* previous) {
+    namespace stdfs = std::filesystem;
+
+    manifest._entries.clear();
+
+    std::error_code ec;
+    stdfs::recursive_directory_iterator it(graphDir, ec);
+    if (ec) {
+        return false;
+    }
+
+    for (; it != stdfs::recursive_directory_iterator(); it.increment(ec)) {
+        if (ec) {
+            return false;
+        }
+
+        // Only the commit folders belong to the dump, the write-ahead log
+        // and other local state are not transferred
+        if (it->is_directory(ec)) {
+            if (it.depth() == 0
+                && !it->path().filename().string().starts_with(COMMIT_FOLDER_PREFIX)) {
+                it.disable_recursion_pending();
+            }
+            continue;
+        }
+
+        if (!it->is_regular_file(ec)) {
+            continue;
+        }
+
+        Entry entry;
+        entry._path = stdfs::relative(it->path(), graphDir, ec).generic_string();
+        if (ec) {
+            return false;
+        }
+
+        // Skips the manifest itself and the local files of the graph directory
+        if (!isDumpFile(entry._path)) {
+            continue;
+        }
+
+        entry._size = it->file_size(ec);
+        if (ec) {
+            return false;
+        }
+
+        const Entry* prevEntry = previous ? previous->find(entry._path) : nullptr;
+        if (prevEntry && isImmutable(entry._path) && prevEntry->_size == entry._size) {
+            entry._hash = prevEntry->_hash;
+        } else if (!hashFile(it->path().string(), entry._hash)) {
+            return false;
+        }
+
+        manifest._entries.push_back(std::move(entry));
+    }
+
+    std::sort(manifest._entries.begin(), manifest._entries.end(),
+              [](const Entry& lhs, const Entry& rhs) { return lhs._path < rhs._path; });
+
+    return true;
+}
+
+bool GraphManifest::parse(GraphManifest& manifest, std::string_view data) {
+    manifest._entries.clear();
+
+    while (!data.empty()) {
+        const size_t end = data.find('\n');
+        const std::string_view line = data.substr(0, end);
+        data = end == std::string_view::npos ? std::string_view {} : data.substr(end + 1);
+
+        if (line.empty()) {
+            continue;
+        }
+
+        // path \t size \t hash
+        const size_t sizePos = line.find('\t');
+        const size_t hashPos = line.find('\t', sizePos + 1);
+        if (sizePos == std::string_view::npos || hashPos == std::string_view::npos) {
+            return false;
+        }
+
+        Entry entry;
+        entry._path = line.substr(0, sizePos);
+
+        const std::string size {line.substr(sizePos + 1, hashPos - sizePos - 1)};
+        const std::string hash {line.substr(hashPos + 1)};
+
+        char* sizeEnd = nullptr;
+        char* hashEnd = nullptr;
+        entry._size = std::strtoull(size.c_str(), &sizeEnd, 10);
+        entry._hash = std::strtoull(hash.c_str(), &hashEnd, 16);
+        if (size.empty() || hash.empty() || *sizeEnd != '\0' || *hashEnd != '\0') {
+            return false;
+        }
+
+        manifest._entries.push_back(std::move(entry));
+    }
+
+    std::sort(manifest._entries.begin(), manifest._entries.end(),
+              [](const Entry& lhs, const Entry& rhs) { return lhs._path < rhs._path; });
+
+    return true;
+}
+
+void GraphManifest::serialize(std::string& data) const {
+    data.clear();
+    for (const Entry& entry : _entries) {
+        fmt::format_to(std::back_inserter(data), "{}\t{}\t{:016x}\n",
+                       entry._path, entry._size, entry._hash);
+    }
+}
+
+const GraphManifest::Entry* GraphManifest::find(std::string_view path) const {
+    const auto it = std::lower_bound(_entries.begin(), _entries.end(), path,
+                                     [](const Entry& entry, std::string_view path) {
+                                         return entry._path < path;
+                                     });
+    if (it == _entries.end() || it->_path != path) {
+        return nullptr;
+    }
+
+    return &*it;
+}
+
+bool GraphManifest::isSameFile(const Entry& lhs, const Entry& rhs) {
+    if (lhs._size != rhs._size) {
+        return false;
+    }
+
+    return isImmutable(lhs._path) || lhs._hash == rhs._hash;
+}
+
+bool GraphManifest::isImmutable(std::string_view path) {
+    const size_t slash = path.find('/');
+    return slash != std::string_view::npos && path.starts_with(COMMIT_FOLDER_PREFIX);
+}
+
+bool GraphManifest::isDumpFile(std::string_view path) {
+    if (isImmutable(path)) {
+        return true;
+    }
+
+    return std::ranges::find(GRAPH_FILE_NAMES, path) != std::end(GRAPH_FILE_NAMES);
+}
+
+bool GraphManifest::hashFile(const std::string& filePath, uint64_t& hash) {
+    std::ifstream file(filePath, std::ios_base::in | std::ios_base::binary);
+    if (!file) {
+        return false;
+    }
+
+    // FNV-1a
+    std::vector<char> buffer(1024 * 1024);
+    hash = FNV_OFFSET_BASIS;
+
+    while (file) {
+        file.read(buffer.data(), buffer.size());
+        const size_t count = file.gcount();
+        for (size_t i = 0; i < count; i++) {
+            hash ^= (unsigned char)buffer[i];
+            hash *= FNV_PRIME;
+        }
+    }
+
+    return file.eof();
+}
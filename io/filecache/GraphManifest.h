@@ -0,0 +1,62 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include <stdint.h>
+
+namespace db {
+
+/**
+ * @brief List of the files of a graph dump, with their sizes and hashes.
+ *
+ * @detail The manifest is stored next to the graph in remote storage, so that
+ * saving and loading a graph only transfers the files which differ. The files
+ * of the commit folders are never modified once dumped: they are compared by
+ * size only and their hashes are carried over from the previous manifest.
+ * Only the files of the dump are listed, the write-ahead log and other local
+ * files of the graph directory stay local.
+ */
+class GraphManifest {
+public:
+    static constexpr std::string_view FILE_NAME = "manifest";
+
+    struct Entry {
+        // Relative to the graph directory
+        std::string _path;
+        size_t _size {0};
+        uint64_t _hash {0};
+    };
+
+    GraphManifest() = default;
+
+    // Scans the graph directory, previous provides the hashes of the files
+    // of the commit folders
+    static bool build(GraphManifest& manifest,
+                      const std::string& graphDir,
+                      const GraphManifest* previous = nullptr);
+
+    static bool parse(GraphManifest& manifest, std::string_view data);
+    void serialize(std::string& data) const;
+
+    const std::vector<Entry>& entries() const { return _entries; }
+    const Entry* find(std::string_view path) const;
+
+    // True if both entries describe the same file
+    static bool isSameFile(const Entry& lhs, const Entry& rhs);
+
+    // True for the files of the commit folders
+    static bool isImmutable(std::string_view path);
+
+    // True for the files written by a graph dump: the commit folders and
+    // the graph info and type files
+    static bool isDumpFile(std::string_view path);
+
+    static bool hashFile(const std::string& filePath, uint64_t& hash);
+
+private:
+    // Sorted by path
+    std::vector<Entry> _entries;
+};
+
+}
@@ -130,6 +130,22 @@ Result<void> File::clearContent() {
     return refreshInfo();
 }
 
+Result<void> File::truncate(size_t size) {
+    if (::ftruncate(_fd, size) < 0) {
+        return Error::result(ErrorType::CLEAR_FILE, errno);
+    }
+
+    return refreshInfo();
+}
+
+Result<void> File::sync() {
+    if (::fdatasync(_fd) != 0) {
+        return Error::result(ErrorType::SYNC_FILE, errno);
+    }
+
+    return {};
+}
+
 Result<void> File::refreshInfo() {
     struct ::stat s {};
     if (::fstat(_fd, &s) != 0) {
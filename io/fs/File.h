@@ -39,6 +39,8 @@ public:
     Result<void> read(void* buf, size_t size) const;
     Result<void> write(void* data, size_t size);
     Result<void> clearContent();
+    Result<void> truncate(size_t size);
+    Result<void> sync();
     Result<void> refreshInfo();
     Result<void> close();
 
@@ -1,5 +1,6 @@
 #include "Path.h"
 
+#include <fcntl.h>
 #include <sys/stat.h>
 #include <dirent.h>
 #include <unistd.h>
@@ -209,6 +210,23 @@ Result<void> Path::mkdir() const {
     return {};
 }
 
+Result<void> Path::syncDir() const {
+    const int fd = ::open(_path.c_str(), O_RDONLY | O_DIRECTORY);
+    if (fd < 0) {
+        return Error::result(ErrorType::OPEN_DIRECTORY, errno);
+    }
+
+    const int res = ::fsync(fd);
+    const int err = errno;
+    ::close(fd);
+
+    if (res != 0) {
+        return Error::result(ErrorType::SYNC_FILE, err);
+    }
+
+    return {};
+}
+
 Result<void> Path::rm() const {
     std::error_code err {};
     std::filesystem::remove_all(_path, err);
@@ -86,6 +86,9 @@ public:
     Result<void> mkdir() const;
     Result<void> rm() const;
 
+    // Syncs the entries of the directory, so that created files survive a crash
+    Result<void> syncDir() const;
+
 private:
     std::string _path;
 };
@@ -7,6 +7,10 @@
 #include <aws/s3-crt/model/GetObjectRequest.h>
 #include <aws/s3-crt/model/PutObjectRequest.h>
 #include <aws/s3-crt/model/ListObjectsV2Request.h>
+#include <aws/s3-crt/model/CreateMultipartUploadRequest.h>
+#include <aws/s3-crt/model/UploadPartRequest.h>
+#include <aws/s3-crt/model/CompleteMultipartUploadRequest.h>
+#include <aws/s3-crt/model/AbortMultipartUploadRequest.h>
 #include <aws/core/Aws.h>
 
 #include "AwsManager.h"
@@ -43,6 +47,22 @@ public:
         return _client->ListObjectsV2(request);
     }
 
+    Aws::S3Crt::Model::CreateMultipartUploadOutcome CreateMultipartUpload(Aws::S3Crt::Model::CreateMultipartUploadRequest& request) {
+        return _client->CreateMultipartUpload(request);
+    }
+
+    Aws::S3Crt::Model::UploadPartOutcome UploadPart(Aws::S3Crt::Model::UploadPartRequest& request) {
+        return _client->UploadPart(request);
+    }
+
+    Aws::S3Crt::Model::CompleteMultipartUploadOutcome CompleteMultipartUpload(Aws::S3Crt::Model::CompleteMultipartUploadRequest& request) {
+        return _client->CompleteMultipartUpload(request);
+    }
+
+    Aws::S3Crt::Model::AbortMultipartUploadOutcome AbortMultipartUpload(Aws::S3Crt::Model::AbortMultipartUploadRequest& request) {
+        return _client->AbortMultipartUpload(request);
+    }
+
 private:
     void init() {
         AWSManager::getInstance();
@@ -90,6 +110,22 @@ public:
         return _client.ListObjectsV2(request);
     }
 
+    Aws::S3Crt::Model::CreateMultipartUploadOutcome CreateMultipartUpload(Aws::S3Crt::Model::CreateMultipartUploadRequest& request) {
+        return _client.CreateMultipartUpload(request);
+    }
+
+    Aws::S3Crt::Model::UploadPartOutcome UploadPart(Aws::S3Crt::Model::UploadPartRequest& request) {
+        return _client.UploadPart(request);
+    }
+
+    Aws::S3Crt::Model::CompleteMultipartUploadOutcome CompleteMultipartUpload(Aws::S3Crt::Model::CompleteMultipartUploadRequest& request) {
+        return _client.CompleteMultipartUpload(request);
+    }
+
+    Aws::S3Crt::Model::AbortMultipartUploadOutcome AbortMultipartUpload(Aws::S3Crt::Model::AbortMultipartUploadRequest& request) {
+        return _client.AbortMultipartUpload(request);
+    }
+
 private:
     MockS3Client& _client;
 };
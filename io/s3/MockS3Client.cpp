@@ -1,28 +1,268 @@
 #include "MockS3Client.h"
 
+#include <iterator>
+#include <limits>
+
+#include <aws/s3-crt/S3CrtErrors.h>
 #include <aws/s3-crt/model/PutObjectRequest.h>
 #include <aws/s3-crt/model/GetObjectRequest.h>
 #include <aws/s3-crt/model/ListObjectsV2Request.h>
+#include <aws/s3-crt/model/CreateMultipartUploadRequest.h>
+#include <aws/s3-crt/model/UploadPartRequest.h>
+#include <aws/s3-crt/model/CompleteMultipartUploadRequest.h>
+#include <aws/s3-crt/model/AbortMultipartUploadRequest.h>
 
 using namespace S3;
 
+namespace {
+
+Aws::S3Crt::S3CrtError makeError(Aws::S3Crt::S3CrtErrors type, Aws::Http::HttpResponseCode responseCode) {
+    Aws::Client::AWSError<Aws::S3Crt::S3CrtErrors> error(type, false);
+    error.SetResponseCode(responseCode);
+    return Aws::S3Crt::S3CrtError(error);
+}
+
+std::string readBody(const std::shared_ptr<Aws::IOStream>& body) {
+    if (!body) {
+        return {};
+    }
+
+    std::string data;
+    body->seekg(0, std::ios_base::beg);
+    data.assign(std::istreambuf_iterator<char>(*body), std::istreambuf_iterator<char>());
+
+    return data;
+}
+
+// Parses a range of the form "bytes=first-last"
+bool parseRange(const Aws::String& range, size_t& first, size_t& last) {
+    constexpr std::string_view unit = "bytes=";
+    if (!range.starts_with(unit)) {
+        return false;
+    }
+
+    const size_t dash = range.find('-', unit.size());
+    if (dash == Aws::String::npos) {
+        return false;
+    }
+
+    first = std::stoull(range.substr(unit.size(), dash - unit.size()));
+    last = dash + 1 < range.size()
+             ? std::stoull(range.substr(dash + 1))
+             : std::numeric_limits<size_t>::max();
+
+    return first <= last;
+}
+
+}
+
+MockS3Client::MockS3Client()
+{
+}
+
 MockS3Client::MockS3Client(Aws::S3Crt::Model::PutObjectOutcome& putOutcome,
                            Aws::S3Crt::Model::GetObjectOutcome& getOutcome,
                            Aws::S3Crt::Model::ListObjectsV2Outcome& listOutcome)
-    :_putOutcome(putOutcome),
-    _getOutcome(getOutcome),
-    _listOutcome(listOutcome)
+    :_putOutcome(&putOutcome),
+    _getOutcome(&getOutcome),
+    _listOutcome(&listOutcome)
 {
 }
 
-Aws::S3Crt::Model::PutObjectOutcome& MockS3Client::PutObject(Aws::S3Crt::Model::PutObjectRequest& request) {
-    return _putOutcome;
+Aws::S3Crt::Model::PutObjectOutcome MockS3Client::PutObject(Aws::S3Crt::Model::PutObjectRequest& request) {
+    if (!isInMemory()) {
+        return *_putOutcome;
+    }
+
+    std::string data = readBody(request.GetBody());
+
+    std::scoped_lock lock(_mutex);
+    _putCount++;
+
+    if (request.IfNoneMatchHasBeenSet() && request.GetIfNoneMatch() == "*"
+        && _objects.contains(request.GetKey())) {
+        return makeError(Aws::S3Crt::S3CrtErrors::UNKNOWN,
+                         Aws::Http::HttpResponseCode::PRECONDITION_FAILED);
+    }
+
+    _objects[request.GetKey()] = std::move(data);
+
+    return Aws::S3Crt::Model::PutObjectResult {};
 }
 
 Aws::S3Crt::Model::GetObjectOutcome MockS3Client::GetObject(Aws::S3Crt::Model::GetObjectRequest& request) {
-    return std::move(_getOutcome);
+    if (!isInMemory()) {
+        return std::move(*_getOutcome);
+    }
+
+    std::scoped_lock lock(_mutex);
+    _getCount++;
+
+    const auto it = _objects.find(request.GetKey());
+    if (it == _objects.end()) {
+        return makeError(Aws::S3Crt::S3CrtErrors::NO_SUCH_KEY,
+                         Aws::Http::HttpResponseCode::NOT_FOUND);
+    }
+
+    const std::string& data = it->second;
+    size_t first = 0;
+    size_t last = data.empty() ? 0 : data.size() - 1;
+
+    if (request.RangeHasBeenSet()) {
+        size_t rangeLast = 0;
+        if (!parseRange(request.GetRange(), first, rangeLast) || first >= data.size()) {
+            return makeError(Aws::S3Crt::S3CrtErrors::UNKNOWN,
+                             Aws::Http::HttpResponseCode::REQUESTED_RANGE_NOT_SATISFIABLE);
+        }
+        last = std::min(rangeLast, data.size() - 1);
+    }
+
+    const size_t length = data.empty() ? 0 : last - first + 1;
+
+    Aws::S3Crt::Model::GetObjectResult result;
+    result.ReplaceBody(Aws::New<Aws::StringStream>("MockS3Client", data.substr(first, length)));
+    result.SetContentLength(length);
+
+    return Aws::S3Crt::Model::GetObjectOutcome(std::move(result));
+}
+
+Aws::S3Crt::Model::ListObjectsV2Outcome MockS3Client::ListObjectsV2(Aws::S3Crt::Model::ListObjectsV2Request& request) {
+    if (!isInMemory()) {
+        return *_listOutcome;
+    }
+
+    std::scoped_lock lock(_mutex);
+
+    const Aws::String& prefix = request.GetPrefix();
+    const Aws::String& delimiter = request.GetDelimiter();
+
+    Aws::S3Crt::Model::ListObjectsV2Result result;
+    std::string lastCommonPrefix;
+
+    for (auto it = _objects.lower_bound(prefix); it != _objects.end(); ++it) {
+        const std::string& key = it->first;
+        if (!key.starts_with(prefix)) {
+            break;
+        }
+
+        if (!delimiter.empty()) {
+            const size_t pos = key.find(delimiter, prefix.size());
+            if (pos != std::string::npos) {
+                std::string commonPrefix = key.substr(0, pos + delimiter.size());
+                if (commonPrefix != lastCommonPrefix) {
+                    result.AddCommonPrefixes(Aws::S3Crt::Model::CommonPrefix().WithPrefix(commonPrefix));
+                    lastCommonPrefix = std::move(commonPrefix);
+                }
+                continue;
+            }
+        }
+
+        result.AddContents(Aws::S3Crt::Model::Object()
+                               .WithKey(key)
+                               .WithSize((long long)it->second.size()));
+    }
+
+    return result;
+}
+
+Aws::S3Crt::Model::CreateMultipartUploadOutcome MockS3Client::CreateMultipartUpload(
+    Aws::S3Crt::Model::CreateMultipartUploadRequest& request) {
+    std::scoped_lock lock(_mutex);
+
+    const std::string uploadId = std::to_string(_nextUploadId++);
+    _uploads[uploadId]._key = request.GetKey();
+
+    Aws::S3Crt::Model::CreateMultipartUploadResult result;
+    result.SetUploadId(uploadId);
+
+    return result;
+}
+
+Aws::S3Crt::Model::UploadPartOutcome MockS3Client::UploadPart(Aws::S3Crt::Model::UploadPartRequest& request) {
+    std::string data = readBody(request.GetBody());
+
+    std::scoped_lock lock(_mutex);
+    _partCount++;
+
+    const auto it = _uploads.find(request.GetUploadId());
+    if (it == _uploads.end()) {
+        return makeError(Aws::S3Crt::S3CrtErrors::NO_SUCH_UPLOAD,
+                         Aws::Http::HttpResponseCode::NOT_FOUND);
+    }
+
+    it->second._parts[request.GetPartNumber()] = std::move(data);
+
+    Aws::S3Crt::Model::UploadPartResult result;
+    result.SetETag(std::to_string(request.GetPartNumber()));
+
+    return result;
+}
+
+Aws::S3Crt::Model::CompleteMultipartUploadOutcome MockS3Client::CompleteMultipartUpload(
+    Aws::S3Crt::Model::CompleteMultipartUploadRequest& request) {
+    std::scoped_lock lock(_mutex);
+
+    const auto it = _uploads.find(request.GetUploadId());
+    if (it == _uploads.end()) {
+        return makeError(Aws::S3Crt::S3CrtErrors::NO_SUCH_UPLOAD,
+                         Aws::Http::HttpResponseCode::NOT_FOUND);
+    }
+
+    if (request.IfNoneMatchHasBeenSet() && request.GetIfNoneMatch() == "*"
+        && _objects.contains(it->second._key)) {
+        return makeError(Aws::S3Crt::S3CrtErrors::UNKNOWN,
+                         Aws::Http::HttpResponseCode::PRECONDITION_FAILED);
+    }
+
+    std::string data;
+    for (const auto& part : request.GetMultipartUpload().GetParts()) {
+        const auto partIt = it->second._parts.find(part.GetPartNumber());
+        if (partIt == it->second._parts.end()) {
+            return makeError(Aws::S3Crt::S3CrtErrors::UNKNOWN,
+                             Aws::Http::HttpResponseCode::BAD_REQUEST);
+        }
+        data += partIt->second;
+    }
+
+    _objects[it->second._key] = std::move(data);
+    _uploads.erase(it);
+    _putCount++;
+
+    return Aws::S3Crt::Model::CompleteMultipartUploadResult {};
+}
+
+Aws::S3Crt::Model::AbortMultipartUploadOutcome MockS3Client::AbortMultipartUpload(
+    Aws::S3Crt::Model::AbortMultipartUploadRequest& request) {
+    std::scoped_lock lock(_mutex);
+
+    if (_uploads.erase(request.GetUploadId()) == 0) {
+        return makeError(Aws::S3Crt::S3CrtErrors::NO_SUCH_UPLOAD,
+                         Aws::Http::HttpResponseCode::NOT_FOUND);
+    }
+
+    return Aws::S3Crt::Model::AbortMultipartUploadResult {};
+}
+
+bool MockS3Client::hasObject(const std::string& key) const {
+    std::scoped_lock lock(_mutex);
+    return _objects.contains(key);
+}
+
+std::string MockS3Client::getObjectData(const std::string& key) const {
+    std::scoped_lock lock(_mutex);
+
+    const auto it = _objects.find(key);
+    return it != _objects.end() ? it->second : std::string {};
+}
+
+void MockS3Client::putObjectData(const std::string& key, const std::string& data) {
+    std::scoped_lock lock(_mutex);
+    _objects[key] = data;
 }
 
-Aws::S3Crt::Model::ListObjectsV2Outcome& MockS3Client::ListObjectsV2(Aws::S3Crt::Model::ListObjectsV2Request& request) {
-    return _listOutcome;
+void MockS3Client::resetCounts() {
+    std::scoped_lock lock(_mutex);
+    _putCount = 0;
+    _getCount = 0;
+    _partCount = 0;
 }
@@ -1,5 +1,9 @@
 #pragma once
 
+#include <map>
+#include <mutex>
+#include <string>
+
 #include <aws/s3-crt/S3CrtServiceClientModel.h>
 
 namespace Aws {
@@ -8,26 +12,73 @@ namespace Model {
 class PutObjectRequest;
 class GetObjectRequest;
 class ListObjectsV2Request;
+class CreateMultipartUploadRequest;
+class UploadPartRequest;
+class CompleteMultipartUploadRequest;
+class AbortMultipartUploadRequest;
 }
 }
 }
 
 namespace S3 {
 
+/**
+ * @brief S3 client used by the tests.
+ *
+ * @detail Constructed with outcomes, the client returns them whatever the
+ * requests. Default constructed, the client behaves like an in-memory bucket:
+ * objects can be put, listed, read by ranges and uploaded in parts, so that
+ * the transfers can be tested offline.
+ */
 class MockS3Client {
 public:
+    MockS3Client();
     MockS3Client(Aws::S3Crt::Model::PutObjectOutcome& putOutcome,
                  Aws::S3Crt::Model::GetObjectOutcome& getOutcome,
                  Aws::S3Crt::Model::ListObjectsV2Outcome& listOutcome);
 
-    Aws::S3Crt::Model::PutObjectOutcome& PutObject(Aws::S3Crt::Model::PutObjectRequest& request);
+    Aws::S3Crt::Model::PutObjectOutcome PutObject(Aws::S3Crt::Model::PutObjectRequest& request);
     Aws::S3Crt::Model::GetObjectOutcome GetObject(Aws::S3Crt::Model::GetObjectRequest& request);
-    Aws::S3Crt::Model::ListObjectsV2Outcome& ListObjectsV2(Aws::S3Crt::Model::ListObjectsV2Request& request);
+    Aws::S3Crt::Model::ListObjectsV2Outcome ListObjectsV2(Aws::S3Crt::Model::ListObjectsV2Request& request);
+
+    Aws::S3Crt::Model::CreateMultipartUploadOutcome CreateMultipartUpload(
+        Aws::S3Crt::Model::CreateMultipartUploadRequest& request);
+    Aws::S3Crt::Model::UploadPartOutcome UploadPart(Aws::S3Crt::Model::UploadPartRequest& request);
+    Aws::S3Crt::Model::CompleteMultipartUploadOutcome CompleteMultipartUpload(
+        Aws::S3Crt::Model::CompleteMultipartUploadRequest& request);
+    Aws::S3Crt::Model::AbortMultipartUploadOutcome AbortMultipartUpload(
+        Aws::S3Crt::Model::AbortMultipartUploadRequest& request);
+
+    // Inspection of the in-memory bucket
+    bool hasObject(const std::string& key) const;
+    std::string getObjectData(const std::string& key) const;
+    void putObjectData(const std::string& key, const std::string& data);
+
+    size_t getPutCount() const { return _putCount; }
+    size_t getGetCount() const { return _getCount; }
+    size_t getPartCount() const { return _partCount; }
+    void resetCounts();
 
 private:
-    Aws::S3Crt::Model::PutObjectOutcome& _putOutcome;
-    Aws::S3Crt::Model::GetObjectOutcome& _getOutcome;
-    Aws::S3Crt::Model::ListObjectsV2Outcome& _listOutcome;
+    struct Upload {
+        std::string _key;
+        std::map<int, std::string> _parts;
+    };
+
+    Aws::S3Crt::Model::PutObjectOutcome* _putOutcome {nullptr};
+    Aws::S3Crt::Model::GetObjectOutcome* _getOutcome {nullptr};
+    Aws::S3Crt::Model::ListObjectsV2Outcome* _listOutcome {nullptr};
+
+    mutable std::mutex _mutex;
+    std::map<std::string, std::string> _objects;
+    std::map<std::string, Upload> _uploads;
+    size_t _nextUploadId {0};
+
+    size_t _putCount {0};
+    size_t _getCount {0};
+    size_t _partCount {0};
+
+    bool isInMemory() const { return _putOutcome == nullptr; }
 };
 
 }
@@ -1,7 +1,11 @@
 #include "TuringS3Client.h"
 
+#include <atomic>
 #include <filesystem>
 #include <fstream>
+#include <iterator>
+#include <fcntl.h>
+#include <unistd.h>
 
 #include <aws/core/Aws.h>
 #include <aws/s3/S3Client.h>
@@ -13,13 +17,56 @@
 #include <aws/s3-crt/model/DeleteBucketRequest.h>
 #include <aws/s3-crt/model/PutObjectRequest.h>
 #include <aws/s3-crt/model/GetObjectRequest.h>
+#include <aws/s3-crt/model/CreateMultipartUploadRequest.h>
+#include <aws/s3-crt/model/UploadPartRequest.h>
+#include <aws/s3-crt/model/CompleteMultipartUploadRequest.h>
+#include <aws/s3-crt/model/AbortMultipartUploadRequest.h>
 #include <aws/core/platform/FileSystem.h>
 
 #include "AwsS3ClientWrapper.h"
+#include "JobSystem.h"
+#include "JobGroup.h"
 #include "spdlog/spdlog.h"
 
 using namespace S3;
 
+namespace {
+
+template <typename ErrorT>
+S3ClientErrorType toUploadError(const ErrorT& error) {
+    switch (error.GetErrorType()) {
+        case Aws::S3Crt::S3CrtErrors::ACCESS_DENIED:
+        case Aws::S3Crt::S3CrtErrors::SIGNATURE_DOES_NOT_MATCH:
+        case Aws::S3Crt::S3CrtErrors::INVALID_ACCESS_KEY_ID:
+            return S3ClientErrorType::ACCESS_DENIED;
+        case Aws::S3Crt::S3CrtErrors::NO_SUCH_BUCKET:
+            return S3ClientErrorType::INVALID_BUCKET_NAME;
+        default:
+            if (error.GetResponseCode() == Aws::Http::HttpResponseCode::PRECONDITION_FAILED) {
+                return S3ClientErrorType::FILE_EXISTS;
+            }
+            return S3ClientErrorType::CANNOT_UPLOAD_FILE;
+    }
+}
+
+template <typename ErrorT>
+S3ClientErrorType toDownloadError(const ErrorT& error) {
+    switch (error.GetErrorType()) {
+        case Aws::S3Crt::S3CrtErrors::ACCESS_DENIED:
+        case Aws::S3Crt::S3CrtErrors::SIGNATURE_DOES_NOT_MATCH:
+        case Aws::S3Crt::S3CrtErrors::INVALID_ACCESS_KEY_ID:
+            return S3ClientErrorType::ACCESS_DENIED;
+        case Aws::S3Crt::S3CrtErrors::NO_SUCH_KEY:
+            return S3ClientErrorType::INVALID_KEY_NAME;
+        case Aws::S3Crt::S3CrtErrors::NO_SUCH_BUCKET:
+            return S3ClientErrorType::INVALID_BUCKET_NAME;
+        default:
+            return S3ClientErrorType::CANNOT_DOWNLOAD_FILE;
+    }
+}
+
+}
+
 template <typename ClientType>
 TuringS3Client<ClientType>::TuringS3Client(ClientType&& client)
     : _client(std::move(client))
@@ -186,7 +233,8 @@ S3ClientResult<void> TuringS3Client<T>::listFolders(const std::string& bucketNam
 template <typename T>
 S3ClientResult<void> TuringS3Client<T>::uploadFile(const Aws::String& filePath,
                                                    const Aws::String& bucketName,
-                                                   const Aws::String& keyName) {
+                                                   const Aws::String& keyName,
+                                                   bool overwrite) {
     std::error_code ec;
     if (!std::filesystem::exists(filePath, ec)) {
         if (ec) {
@@ -195,9 +243,21 @@ S3ClientResult<void> TuringS3Client<T>::uploadFile(const Aws::String& filePath,
         return S3ClientError::result(S3ClientErrorType::FILE_NOT_FOUND);
     }
 
+    const size_t fileSize = std::filesystem::file_size(filePath, ec);
+    if (ec) {
+        return S3ClientError::result(S3ClientErrorType::FILE_SYSTEM_ERROR);
+    }
+
+    if (fileSize > _partSize) {
+        return uploadFileParts(filePath, bucketName, keyName, fileSize, overwrite);
+    }
+
     Aws::S3Crt::Model::PutObjectRequest request;
-    // SetIfNoneMatch("*") makes the upload fail if the resource exists in the bucket
-    request.WithBucket(bucketName).WithKey(keyName).SetIfNoneMatch("*");
+    request.WithBucket(bucketName).WithKey(keyName);
+    if (!overwrite) {
+        // SetIfNoneMatch("*") makes the upload fail if the resource exists in the bucket
+        request.SetIfNoneMatch("*");
+    }
     std::shared_ptr<Aws::IOStream> inputData = Aws::MakeShared<Aws::FStream>("TuringS3Client", filePath.c_str(), std::ios_base::in | std::ios_base::binary);
 
     if (!*inputData) {
@@ -268,6 +328,229 @@ S3ClientResult<void> TuringS3Client<T>::downloadFile(const Aws::String& fileName
     return {};
 }
 
+template <typename T>
+S3ClientResult<void> TuringS3Client<T>::downloadFile(const std::string& filePath,
+                                                     const std::string& bucketName,
+                                                     const std::string& keyName,
+                                                     size_t size) {
+    if (size <= _partSize) {
+        return downloadFile(filePath, bucketName, keyName);
+    }
+
+    return downloadFileParts(filePath, bucketName, keyName, size);
+}
+
+template <typename T>
+S3ClientResult<void> TuringS3Client<T>::putObject(const std::string& data,
+                                                  const std::string& bucketName,
+                                                  const std::string& keyName) {
+    Aws::S3Crt::Model::PutObjectRequest request;
+    request.WithBucket(bucketName).WithKey(keyName);
+    request.SetBody(Aws::MakeShared<Aws::StringStream>("TuringS3Client", data));
+    request.SetContentLength(data.size());
+
+    const auto outcome = _client.PutObject(request);
+    if (!outcome.IsSuccess()) {
+        return S3ClientError::result(toUploadError(outcome.GetError()));
+    }
+
+    return {};
+}
+
+template <typename T>
+S3ClientResult<void> TuringS3Client<T>::getObject(std::string& data,
+                                                  const std::string& bucketName,
+                                                  const std::string& keyName) {
+    Aws::S3Crt::Model::GetObjectRequest request;
+    request.WithBucket(bucketName).WithKey(keyName);
+
+    auto outcome = _client.GetObject(request);
+    if (!outcome.IsSuccess()) {
+        return S3ClientError::result(toDownloadError(outcome.GetError()));
+    }
+
+    auto& body = outcome.GetResult().GetBody();
+    data.assign(std::istreambuf_iterator<char>(body), std::istreambuf_iterator<char>());
+
+    return {};
+}
+
+template <typename T>
+void TuringS3Client<T>::runParts(size_t partCount, const std::function<void(size_t)>& func) {
+    if (!_jobSystem || partCount == 1) {
+        for (size_t i = 0; i < partCount; i++) {
+            func(i);
+        }
+        return;
+    }
+
+    db::JobGroup group = _jobSystem->newGroup();
+    for (size_t i = 0; i < partCount; i++) {
+        group.submit<void>([&func, i](db::Promise*) {
+            func(i);
+        });
+    }
+    group.wait();
+}
+
+template <typename T>
+S3ClientResult<void> TuringS3Client<T>::uploadFileParts(const std::string& filePath,
+                                                        const std::string& bucketName,
+                                                        const std::string& keyName,
+                                                        size_t size,
+                                                        bool overwrite) {
+    Aws::S3Crt::Model::CreateMultipartUploadRequest createRequest;
+    createRequest.WithBucket(bucketName).WithKey(keyName);
+
+    const auto createOutcome = _client.CreateMultipartUpload(createRequest);
+    if (!createOutcome.IsSuccess()) {
+        return S3ClientError::result(toUploadError(createOutcome.GetError()));
+    }
+
+    const Aws::String uploadId = createOutcome.GetResult().GetUploadId();
+    const size_t partCount = (size + _partSize - 1) / _partSize;
+
+    std::vector<Aws::S3Crt::Model::CompletedPart> completedParts(partCount);
+    std::atomic<S3ClientErrorType> partError {S3ClientErrorType::UNKNOWN};
+    std::atomic<bool> failed {false};
+
+    runParts(partCount, [&](size_t i) {
+        if (failed.load(std::memory_order_relaxed)) {
+            return;
+        }
+
+        const size_t offset = i * _partSize;
+        const size_t partSize = std::min(_partSize, size - offset);
+
+        // Each part reads its own range of the file
+        Aws::String buffer(partSize, '\0');
+        std::ifstream file(filePath, std::ios_base::in | std::ios_base::binary);
+        file.seekg(offset);
+        if (!file.read(buffer.data(), partSize)) {
+            partError = S3ClientErrorType::CANNOT_OPEN_FILE;
+            failed = true;
+            return;
+        }
+
+        Aws::S3Crt::Model::UploadPartRequest request;
+        request.WithBucket(bucketName)
+            .WithKey(keyName)
+            .WithUploadId(uploadId)
+            .WithPartNumber((int)i + 1);
+        request.SetBody(Aws::MakeShared<Aws::StringStream>("TuringS3Client", std::move(buffer)));
+        request.SetContentLength(partSize);
+
+        const auto outcome = _client.UploadPart(request);
+        if (!outcome.IsSuccess()) {
+            partError = toUploadError(outcome.GetError());
+            failed = true;
+            return;
+        }
+
+        completedParts[i].WithPartNumber((int)i + 1).WithETag(outcome.GetResult().GetETag());
+    });
+
+    if (!failed) {
+        Aws::S3Crt::Model::CompleteMultipartUploadRequest completeRequest;
+        completeRequest.WithBucket(bucketName)
+            .WithKey(keyName)
+            .WithUploadId(uploadId)
+            .WithMultipartUpload(Aws::S3Crt::Model::CompletedMultipartUpload().WithParts(completedParts));
+        if (!overwrite) {
+            completeRequest.SetIfNoneMatch("*");
+        }
+
+        const auto outcome = _client.CompleteMultipartUpload(completeRequest);
+        if (outcome.IsSuccess()) {
+            return {};
+        }
+
+        partError = toUploadError(outcome.GetError());
+    }
+
+    // Parts of an upload which is not completed are billed until aborted
+    Aws::S3Crt::Model::AbortMultipartUploadRequest abortRequest;
+    abortRequest.WithBucket(bucketName).WithKey(keyName).WithUploadId(uploadId);
+    _client.AbortMultipartUpload(abortRequest);
+
+    return S3ClientError::result(partError.load());
+}
+
+template <typename T>
+S3ClientResult<void> TuringS3Client<T>::downloadFileParts(const std::string& filePath,
+                                                          const std::string& bucketName,
+                                                          const std::string& keyName,
+                                                          size_t size) {
+    const int fd = ::open(filePath.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0) {
+        return S3ClientError::result(S3ClientErrorType::CANNOT_OPEN_FILE);
+    }
+
+    if (::ftruncate(fd, size) != 0) {
+        ::close(fd);
+        return S3ClientError::result(S3ClientErrorType::FILE_SYSTEM_ERROR);
+    }
+
+    const size_t partCount = (size + _partSize - 1) / _partSize;
+
+    std::atomic<S3ClientErrorType> partError {S3ClientErrorType::UNKNOWN};
+    std::atomic<bool> failed {false};
+
+    runParts(partCount, [&](size_t i) {
+        if (failed.load(std::memory_order_relaxed)) {
+            return;
+        }
+
+        const size_t first = i * _partSize;
+        const size_t last = std::min(first + _partSize, size) - 1;
+
+        Aws::S3Crt::Model::GetObjectRequest request;
+        request.WithBucket(bucketName)
+            .WithKey(keyName)
+            .WithRange(fmt::format("bytes={}-{}", first, last));
+
+        auto outcome = _client.GetObject(request);
+        if (!outcome.IsSuccess()) {
+            partError = toDownloadError(outcome.GetError());
+            failed = true;
+            return;
+        }
+
+        // Ranges are written in place, at their offset in the file
+        std::vector<char> buffer(last - first + 1);
+        auto& body = outcome.GetResult().GetBody();
+        if (!body.read(buffer.data(), buffer.size())) {
+            partError = S3ClientErrorType::CANNOT_DOWNLOAD_FILE;
+            failed = true;
+            return;
+        }
+
+        size_t written = 0;
+        while (written < buffer.size()) {
+            const ssize_t res = ::pwrite(fd,
+                                         buffer.data() + written,
+                                         buffer.size() - written,
+                                         first + written);
+            if (res <= 0) {
+                partError = S3ClientErrorType::FILE_SYSTEM_ERROR;
+                failed = true;
+                return;
+            }
+            written += res;
+        }
+    });
+
+    ::close(fd);
+
+    if (failed) {
+        std::error_code ec;
+        std::filesystem::remove(filePath, ec);
+        return S3ClientError::result(partError.load());
+    }
+
+    return {};
+}
+
 // Need trailing forward slash at the end of the prefix parameter!
 template <typename T>
 S3ClientResult<void> TuringS3Client<T>::uploadDirectory(const std::string& directory,
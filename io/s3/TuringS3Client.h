@@ -1,14 +1,26 @@
 #pragma once
 
+#include <functional>
+
 #include <aws/core/utils/memory/stl/AWSString.h>
 
 #include "S3ClientResult.h"
 
 class RemoteStorageClient;
+
+namespace db {
+class JobSystem;
+}
+
 namespace S3 {
 template <typename ClientType>
 class TuringS3Client {
 public:
+    // Files larger than a part are transferred with multipart uploads and
+    // ranged downloads, the parts are transferred concurrently on the job
+    // system if one is set
+    static constexpr size_t DEFAULT_PART_SIZE = 16 * 1024 * 1024;
+
     explicit TuringS3Client(ClientType&& client);
     explicit TuringS3Client(ClientType& client) = delete;
     TuringS3Client& operator=(const ClientType&) = delete;
@@ -17,6 +29,11 @@ public:
 
     ~TuringS3Client() = default;
 
+    void setJobSystem(db::JobSystem* jobSystem) { _jobSystem = jobSystem; }
+    db::JobSystem* getJobSystem() const { return _jobSystem; }
+    void setPartSize(size_t partSize) { _partSize = partSize; }
+    size_t getPartSize() const { return _partSize; }
+
     S3ClientResult<void> listKeys(const std::string& bucketName,
                                   const std::string& prefix,
                                   std::vector<std::string>& keyResults);
@@ -27,12 +44,27 @@ public:
                                      const std::string& prefix,
                                      std::vector<std::string>& folderResults);
 
+    // Fails with FILE_EXISTS if the object exists, unless overwrite is set
     S3ClientResult<void> uploadFile(const std::string& filePath,
                                     const std::string& bucketName,
-                                    const std::string& keyName);
+                                    const std::string& keyName,
+                                    bool overwrite = false);
     S3ClientResult<void> downloadFile(const std::string& filePath,
                                       const std::string& bucketName,
                                       const std::string& keyName);
+    // Downloads an object of known size, by ranges if larger than a part
+    S3ClientResult<void> downloadFile(const std::string& filePath,
+                                      const std::string& bucketName,
+                                      const std::string& keyName,
+                                      size_t size);
+
+    // Small objects held in memory, an existing object is overwritten
+    S3ClientResult<void> putObject(const std::string& data,
+                                   const std::string& bucketName,
+                                   const std::string& keyName);
+    S3ClientResult<void> getObject(std::string& data,
+                                   const std::string& bucketName,
+                                   const std::string& keyName);
 
     S3ClientResult<void> uploadDirectory(const std::string& directory,
                                          const std::string& bucketName,
@@ -43,5 +75,19 @@ public:
 
 private:
     ClientType _client;
+    db::JobSystem* _jobSystem {nullptr};
+    size_t _partSize {DEFAULT_PART_SIZE};
+
+    S3ClientResult<void> uploadFileParts(const std::string& filePath,
+                                         const std::string& bucketName,
+                                         const std::string& keyName,
+                                         size_t size,
+                                         bool overwrite);
+    S3ClientResult<void> downloadFileParts(const std::string& filePath,
+                                           const std::string& bucketName,
+                                           const std::string& keyName,
+                                           size_t size);
+
+    void runParts(size_t partCount, const std::function<void(size_t)>& func);
 };
 }
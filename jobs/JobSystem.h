@@ -73,6 +73,9 @@ public:
     void wait();
     void terminate();
 
+    // Jobs submitted and not yet picked by a worker
+    size_t getQueuedJobCount() const { return _jobs.size(); }
+
 private:
     size_t _nThreads {0};
     JobQueue _jobs;
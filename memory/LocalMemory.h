@@ -1,11 +1,13 @@
 #pragma once
 
+#include <algorithm>
 #include <string_view>
 #include <stddef.h>
 
 #include "MemoryPool.h"
 #include "TypeValueMap.h"
 #include "ColumnAllocator.h"
+#include "Arena.h"
 
 #include "columns/ColumnSet.h"
 #include "columns/ColumnVector.h"
@@ -79,11 +81,35 @@ public:
 
     template <typename KeyT, typename ValueT>
     struct ClearTransform {
+        size_t& _retentionBudget;
+
+        ClearTransform(size_t& retentionBudget)
+            : _retentionBudget(retentionBudget)
+        {
+        }
+
+        void operator()(ValueT& value) const {
+            value.clear(_retentionBudget);
+        }
+    };
+
+    template <typename KeyT, typename ValueT>
+    struct StatsTransform {
+        MemoryPoolStats& _stats;
+
+        StatsTransform(MemoryPoolStats& stats)
+            : _stats(stats)
+        {
+        }
+
         void operator()(ValueT& value) const {
-            value.clear();
+            value.addStats(_stats);
         }
     };
 
+    // Bytes of buffers kept by the columns of a thread across queries
+    static constexpr size_t DEFAULT_RETENTION_BUDGET = 64 * 1024 * 1024;
+
     LocalMemory(const LocalMemory&) = delete;
     LocalMemory(LocalMemory&&) = delete;
     LocalMemory& operator=(const LocalMemory&) = delete;
@@ -94,20 +120,49 @@ public:
 
     template <typename ObjT, typename... Args>
     ObjT* alloc(Args&&... args) {
-        return _pools.get<ObjT>().alloc(args...);
+        return _pools.get<ObjT>().alloc(std::forward<Args>(args)...);
     }
 
     Column* allocSame(const Column* col) {
         return _columnAllocators.get(col->getKind())->alloc();
     }
 
+    // The pipelines rewind the arena themselves when they are destroyed,
+    // its chunks are kept across queries
+    Arena& getPipelineArena() { return _pipelineArena; }
+
+    void setRetentionBudget(size_t bytes) { _retentionBudget = bytes; }
+
+    // Recycles all the columns, their buffers are kept for the next query
+    // within the retention budget
     void clear() {
-        _pools.transform<ClearTransform>();
+        // The columns are at their peak usage before being recycled
+        getStats();
+
+        size_t retentionBudget = _retentionBudget;
+        _pools.transform<ClearTransform>(retentionBudget);
+    }
+
+    // The peak usage is tracked per query, reset when a query starts
+    void resetPeakUsage() { _peakUsedBytes = 0; }
+
+    // Walks all the columns, meant to be called once per query
+    MemoryPoolStats getStats() {
+        MemoryPoolStats stats;
+        _pools.transform<StatsTransform>(stats);
+
+        _peakUsedBytes = std::max(_peakUsedBytes, stats._usedBytes);
+        stats._peakUsedBytes = _peakUsedBytes;
+
+        return stats;
     }
 
 private:
     MemoryPools _pools;
+    size_t _retentionBudget {DEFAULT_RETENTION_BUDGET};
+    size_t _peakUsedBytes {0};
     ColumnAllocatorMap _columnAllocators;
+    Arena _pipelineArena;
 };
 
 }
@@ -1,23 +1,49 @@
 #pragma once
 
+#include <memory>
+#include <new>
 #include <vector>
+#include <stddef.h>
+#include <stdint.h>
 
 namespace db {
 
-template <typename ObjectT>
-struct MemoryBlock;
+struct MemoryPoolStats {
+    // Objects handed out since the last clear
+    size_t _objectCount {0};
+
+    // Bytes of the blocks holding the objects
+    size_t _blockBytes {0};
+
+    // Bytes of the objects and of their buffers, in use and reserved
+    size_t _usedBytes {0};
+    size_t _reservedBytes {0};
+
+    // Highest _usedBytes seen since the peak was last reset, at the start
+    // of the current query
+    size_t _peakUsedBytes {0};
+};
 
+/**
+ * @brief Pool of objects of a single type, reclaimed in bulk with @ref clear.
+ *
+ * @detail Objects are constructed in blocks of BLOCK_BYTE_SIZE bytes which
+ * are allocated on demand. Clearing the pool does not destroy the objects,
+ * they are recycled: containers are emptied but keep their buffers, up to
+ * MAX_RETAINED_BYTES per object and within the retention budget given to
+ * @ref clear, so that the columns of the next query reuse the memory of the
+ * previous one. The buffers which do not fit are freed.
+ */
 template <typename ObjectT>
 class MemoryPool {
 public:
-    using MemoryBlockT = MemoryBlock<ObjectT>;
+    static constexpr size_t BLOCK_BYTE_SIZE = 64 * 1024;
+    static constexpr size_t BLOCK_CAPACITY = sizeof(ObjectT) < BLOCK_BYTE_SIZE
+                                           ? BLOCK_BYTE_SIZE / sizeof(ObjectT)
+                                           : 1;
+    static constexpr size_t MAX_RETAINED_BYTES = 1024 * 1024;
 
-    MemoryPool()
-        : _first(new MemoryBlock<ObjectT>()),
-        _last(_first),
-        _current(_first)
-    {
-    }
+    MemoryPool() = default;
 
     MemoryPool(const MemoryPool&) = delete;
     MemoryPool(MemoryPool&&) = delete;
@@ -25,63 +51,115 @@ public:
     MemoryPool& operator=(MemoryPool&&) = delete;
 
     ~MemoryPool() {
-        MemoryBlockT* block = _first;
-        while (block) {
-            MemoryBlockT* nextBlock = block->_next;
-            delete block;
-            block = nextBlock;
+        release();
+    }
+
+    template <typename... ArgsT>
+    inline ObjectT* alloc(ArgsT&&... args) {
+        if (_used < _constructed) {
+            ObjectT* obj = get(_used++);
+            if constexpr (sizeof...(ArgsT) != 0) {
+                *obj = ObjectT(std::forward<ArgsT>(args)...);
+            }
+            return obj;
+        }
+
+        if (_constructed == _blocks.size() * BLOCK_CAPACITY) {
+            _blocks.emplace_back(new Slot[BLOCK_CAPACITY]);
+        }
+
+        ObjectT* obj = new (get(_constructed)) ObjectT(std::forward<ArgsT>(args)...);
+        _constructed++;
+        _used++;
+
+        return obj;
+    }
+
+    // Recycles all the objects, @param retentionBudget is decreased by the
+    // bytes of the buffers they keep
+    void clear(size_t& retentionBudget) {
+        for (size_t i = 0; i < _constructed; i++) {
+            recycle(get(i), retentionBudget);
         }
+        _used = 0;
     }
 
     void clear() {
-        // Invoke std::vector clear on each MemoryBlock one by one
-        MemoryBlockT* block = _first;
-        while (block) {
-            block->_objects.clear();
-            block = block->_next;
+        size_t retentionBudget = SIZE_MAX;
+        clear(retentionBudget);
+    }
+
+    // Destroys the objects and frees the blocks
+    void release() {
+        for (size_t i = 0; i < _constructed; i++) {
+            get(i)->~ObjectT();
         }
-        _current = _first;
+        _blocks.clear();
+        _constructed = 0;
+        _used = 0;
     }
 
-    template <typename... ArgsT>
-    inline ObjectT* alloc(ArgsT&&... args) {
-        const size_t currentCapacity = _current->_objects.capacity();
-        if (currentCapacity == 0) {
-            if (!_current->_next) {
-                allocBlock();
+    void addStats(MemoryPoolStats& stats) const {
+        const size_t blockBytes = _blocks.size() * BLOCK_CAPACITY * sizeof(ObjectT);
+
+        stats._objectCount += _used;
+        stats._blockBytes += blockBytes;
+        stats._usedBytes += _used * sizeof(ObjectT);
+        stats._reservedBytes += blockBytes;
+
+        if constexpr (HasCapacity) {
+            using ValueT = typename ObjectT::ValueType;
+
+            for (size_t i = 0; i < _constructed; i++) {
+                const ObjectT* obj = get(i);
+                stats._reservedBytes += obj->capacity() * sizeof(ValueT);
+                if (i < _used) {
+                    stats._usedBytes += obj->size() * sizeof(ValueT);
+                }
             }
-            _current = _current->_next;
         }
-
-        return &_current->_objects.emplace_back(std::forward<ArgsT>(args)...);
     }
 
 private:
-    MemoryBlockT* _first {nullptr};
-    MemoryBlockT* _last {nullptr};
-    MemoryBlockT* _current {nullptr};
-
-    void allocBlock() {
-        MemoryBlockT* newBlock = new MemoryBlock<ObjectT>();
-        _last->_next = newBlock;
-        _last = newBlock;
+    struct Slot {
+        alignas(ObjectT) unsigned char _data[sizeof(ObjectT)];
+    };
+
+    static constexpr bool HasCapacity = requires(const ObjectT& obj) {
+        obj.capacity();
+        obj.size();
+        typename ObjectT::ValueType;
+    };
+
+    static constexpr bool HasClear = requires(ObjectT& obj) {
+        obj.clear();
+    };
+
+    std::vector<std::unique_ptr<Slot[]>> _blocks;
+    size_t _constructed {0};
+    size_t _used {0};
+
+    ObjectT* get(size_t i) const {
+        Slot* slot = &_blocks[i / BLOCK_CAPACITY][i % BLOCK_CAPACITY];
+        return std::launder(reinterpret_cast<ObjectT*>(slot->_data));
     }
-};
 
-template <typename ObjectT>
-struct MemoryBlock {
-    // Each block is 8MB in capacity
-    static constexpr size_t MEMORY_BLOCK_BYTE_CAPACITY = 8*1024*1024;
-    static constexpr size_t MEMORY_BLOCK_CAPACITY = MEMORY_BLOCK_BYTE_CAPACITY/sizeof(ObjectT);
-    static_assert(sizeof(ObjectT) <= MEMORY_BLOCK_BYTE_CAPACITY);
-
-    MemoryBlock()
-    {
-        _objects.reserve(MEMORY_BLOCK_CAPACITY);
-    }
+    static void recycle(ObjectT* obj, size_t& retentionBudget) {
+        if constexpr (HasCapacity && HasClear) {
+            using ValueT = typename ObjectT::ValueType;
+            const size_t bytes = obj->capacity() * sizeof(ValueT);
+            if (bytes <= MAX_RETAINED_BYTES && bytes <= retentionBudget) {
+                obj->clear();
+                retentionBudget -= bytes;
+                return;
+            }
+        } else if constexpr (HasClear) {
+            obj->clear();
+            return;
+        }
 
-    std::vector<ObjectT> _objects;
-    MemoryBlock<ObjectT>* _next {nullptr};
+        *obj = ObjectT();
+    }
 };
 
 }
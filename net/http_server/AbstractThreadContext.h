@@ -5,6 +5,7 @@
 namespace net {
 
 class HTTPServer;
+class ExecutionPool;
 
 class AbstractThreadContext {
 public:
@@ -22,6 +23,7 @@ private:
     size_t _threadID {};
 
     friend HTTPServer;
+    friend ExecutionPool;
     void setThreadID(size_t threadID) { _threadID = threadID; }
 };
 
@@ -5,6 +5,7 @@ namespace net {
 enum class ContentType {
     TEXT = 0,
     JSON,
+    BINARY,
 };
 
 }
@@ -0,0 +1,129 @@
+#include "ExecutionPool.h"
+
+#include "AbstractThreadContext.h"
+
+#include "BioAssert.h"
+
+using namespace net;
+
+ExecutionPool::ExecutionPool(const CreateThreadContext& createThreadContext,
+                             size_t threadCount,
+                             size_t maxQueuedTasks)
+    : _createThreadContext(createThreadContext),
+    _threadCount(threadCount),
+    _maxQueuedTasks(maxQueuedTasks)
+{
+}
+
+ExecutionPool::~ExecutionPool() {
+    terminate();
+}
+
+void ExecutionPool::start(size_t firstThreadID) {
+    {
+        std::unique_lock lock(_mutex);
+        bioassert(!_running, "ExecutionPool is already running");
+        _running = true;
+    }
+
+    _threads.reserve(_threadCount);
+    for (size_t i = 0; i < _threadCount; i++) {
+        _threads.emplace_back([this, threadID = firstThreadID + i] {
+            runThread(threadID);
+        });
+    }
+}
+
+void ExecutionPool::terminate() {
+    {
+        std::unique_lock lock(_mutex);
+        _running = false;
+    }
+
+    _cv.notify_all();
+
+    for (auto& thread : _threads) {
+        thread.join();
+    }
+
+    _threads.clear();
+
+    // Remaining tasks are not executed, the server is shutting down
+    std::unordered_map<std::string, std::deque<QueuedTask>> queues;
+    {
+        std::unique_lock lock(_mutex);
+        queues = std::move(_queues);
+        _queues.clear();
+        _readyQueues.clear();
+        _queuedTaskCount = 0;
+    }
+
+    for (auto& [name, queue] : queues) {
+        for (QueuedTask& task : queue) {
+            if (task._cancel) {
+                task._cancel();
+            }
+        }
+    }
+}
+
+bool ExecutionPool::submit(std::string_view queue, Task&& task, Cancel&& cancel) {
+    {
+        std::unique_lock lock(_mutex);
+        if (!_running || _queuedTaskCount >= _maxQueuedTasks) {
+            return false;
+        }
+
+        auto [it, inserted] = _queues.try_emplace(std::string(queue));
+        if (inserted) {
+            _readyQueues.push_back(it->first);
+        }
+
+        it->second.push_back({std::move(task), std::move(cancel)});
+        _queuedTaskCount++;
+    }
+
+    _cv.notify_one();
+    return true;
+}
+
+size_t ExecutionPool::getQueuedTaskCount() const {
+    std::unique_lock lock(_mutex);
+    return _queuedTaskCount;
+}
+
+void ExecutionPool::runThread(size_t threadID) {
+    auto threadContext = _createThreadContext();
+    bioassert(threadContext, "createThreadContext function was not set");
+    threadContext->setThreadID(threadID);
+
+    for (;;) {
+        Task task;
+
+        {
+            std::unique_lock lock(_mutex);
+            _cv.wait(lock, [this] { return !_running || !_readyQueues.empty(); });
+
+            if (!_running) {
+                return;
+            }
+
+            // Round-robin over the queues, a queue goes back to the end
+            // of the line as long as it has tasks
+            auto it = _queues.find(_readyQueues.front());
+            _readyQueues.pop_front();
+
+            task = std::move(it->second.front()._task);
+            it->second.pop_front();
+            _queuedTaskCount--;
+
+            if (it->second.empty()) {
+                _queues.erase(it);
+            } else {
+                _readyQueues.push_back(it->first);
+            }
+        }
+
+        task(threadContext.get());
+    }
+}
@@ -0,0 +1,74 @@
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "ServerContext.h"
+
+namespace net {
+
+class AbstractThreadContext;
+
+/**
+ * @brief Executes the requests dispatched by the I/O threads on dedicated threads.
+ *
+ * @detail Requests are queued per key (e.g. the graph of a query), the threads
+ * take requests from the queues in turn so that one key cannot starve the others.
+ * The tasks still queued when the pool is terminated are not executed, their
+ * cancel function is called instead so that their connections are not left open.
+ */
+class ExecutionPool {
+public:
+    using Task = std::function<void(AbstractThreadContext*)>;
+    using Cancel = std::function<void()>;
+
+    ExecutionPool(const CreateThreadContext& createThreadContext,
+                  size_t threadCount,
+                  size_t maxQueuedTasks);
+    ~ExecutionPool();
+
+    ExecutionPool(const ExecutionPool&) = delete;
+    ExecutionPool(ExecutionPool&&) = delete;
+    ExecutionPool& operator=(const ExecutionPool&) = delete;
+    ExecutionPool& operator=(ExecutionPool&&) = delete;
+
+    // The first thread is given the ID firstThreadID
+    void start(size_t firstThreadID);
+    void terminate();
+
+    // Returns false if too many tasks are already queued or if the pool
+    // is not running. The cancel function is called if the task is dropped
+    [[nodiscard]] bool submit(std::string_view queue, Task&& task, Cancel&& cancel);
+
+    size_t getQueuedTaskCount() const;
+
+private:
+    struct QueuedTask {
+        Task _task;
+        Cancel _cancel;
+    };
+
+    const CreateThreadContext& _createThreadContext;
+    const size_t _threadCount {0};
+    const size_t _maxQueuedTasks {0};
+
+    mutable std::mutex _mutex;
+    std::condition_variable _cv;
+    std::unordered_map<std::string, std::deque<QueuedTask>> _queues;
+    std::deque<std::string> _readyQueues;
+    size_t _queuedTaskCount {0};
+    bool _running {false};
+
+    std::vector<std::thread> _threads;
+
+    void runThread(size_t threadID);
+};
+
+}
@@ -7,6 +7,7 @@
 #include <spdlog/spdlog.h>
 
 #include "AbstractThreadContext.h"
+#include "ExecutionPool.h"
 #include "TCPConnection.h"
 #include "TCPConnectionManager.h"
 #include "TCPConnectionStorage.h"
@@ -94,6 +95,13 @@ FlowStatus HTTPServer::initialize() {
 FlowStatus HTTPServer::start() {
     _running.store(true);
 
+    if (_functions._dispatcher) {
+        _executionPool = std::make_unique<ExecutionPool>(_functions._createThreadContext,
+                                                         _executorCount,
+                                                         _maxQueuedRequests);
+        _executionPool->start(_workerCount + 1);
+    }
+
     ServerContext ctxt {
         ._socket = _serverSocket,
         ._instance = _epollInstance,
@@ -103,7 +111,10 @@ FlowStatus HTTPServer::start() {
         ._status = _status,
         ._running = _running,
         ._process = _functions._processor,
+        ._dispatch = _functions._dispatcher,
+        ._executionPool = _executionPool.get(),
         ._createThreadContext = _functions._createThreadContext,
+        ._metrics = _metrics,
     };
 
     _threads.reserve(_workerCount);
@@ -120,11 +131,31 @@ FlowStatus HTTPServer::start() {
 
     _threads.clear();
 
+    // Waits for the requests being executed, they use the server context
+    if (_executionPool) {
+        _executionPool->terminate();
+        _executionPool.reset();
+    }
+
     ::close(_serverSocket);
 
     return FlowStatus::OK;
 }
 
+size_t HTTPServer::getConnectionCount() const {
+    if (!_connections) {
+        return 0;
+    }
+
+    // The server socket also holds a connection
+    const size_t count = _connections->getUsedCount();
+    return count > 0 ? count - 1 : 0;
+}
+
+size_t HTTPServer::getQueuedRequestCount() const {
+    return _executionPool ? _executionPool->getQueuedTaskCount() : 0;
+}
+
 void HTTPServer::terminate() {
     if (!_running.load()) {
         return;
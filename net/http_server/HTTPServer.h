@@ -7,12 +7,14 @@
 #include "AbstractHTTPParser.h"
 #include "FlowStatus.h"
 #include "ServerContext.h"
+#include "ServerMetrics.h"
 #include "Utils.h"
 
 namespace net {
 
 class TCPConnectionStorage;
 class TCPConnection;
+class ExecutionPool;
 
 class HTTPServer {
 public:
@@ -20,6 +22,9 @@ public:
         ServerProcessor _processor;
         CreateThreadContext _createThreadContext;
         CreateAbstractHTTPParserFunc _createHttpParser;
+
+        // Optional, requests are executed on the I/O threads if not set
+        ServerDispatcher _dispatcher;
     };
     
     explicit HTTPServer(Functions&&);
@@ -37,15 +42,27 @@ public:
     void setAddress(const char* address) { _address = address; };
     void setPort(uint32_t port) { _port = port; };
     void setWorkerCount(uint32_t count) { _workerCount = count; };
+    void setExecutorCount(uint32_t count) { _executorCount = count; };
+    void setMaxQueuedRequests(uint32_t count) { _maxQueuedRequests = count; };
     void setMaxConnections(uint32_t count) { _maxConnections = count; }
 
     std::string_view getAddress() const { return {_actualAddress.data()}; };
     uint32_t getPort() const { return _port; };
 
+    const ServerMetrics& getMetrics() const { return _metrics; }
+
+    // Open client connections
+    size_t getConnectionCount() const;
+
+    // Requests waiting for a thread of the execution pool
+    size_t getQueuedRequestCount() const;
+
 private:
     const char* _address = "127.0.0.1";
     uint32_t _port = 6666;
     uint32_t _workerCount = 8;
+    uint32_t _executorCount = 8;
+    uint32_t _maxQueuedRequests = 256;
     uint32_t _maxConnections = 1024;
 
     utils::ServerSocket _serverSocket {};
@@ -53,9 +70,11 @@ private:
     utils::StringAddress _actualAddress {};
     utils::EpollSignal _signalFd {};
     std::unique_ptr<TCPConnectionStorage> _connections;
+    std::unique_ptr<ExecutionPool> _executionPool;
     TCPConnection* _serverConnection {nullptr};
     std::atomic<FlowStatus> _status;
     std::atomic<bool> _running = false;
+    ServerMetrics _metrics;
     Functions _functions;
     std::vector<std::thread> _threads;
 
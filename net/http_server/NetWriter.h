@@ -1,7 +1,10 @@
 #pragma once
 
+#include <algorithm>
 #include <string.h>
 #include <string_view>
+#include <utility>
+#include <poll.h>
 #include <sys/socket.h>
 
 #include "ContentType.h"
@@ -64,6 +67,7 @@ public:
     void addContentType(ContentType contentType) {
         static constexpr std::string_view text = "Content-type: text/plain\r\n";
         static constexpr std::string_view json = "Content-type: application/json\r\n";
+        static constexpr std::string_view binary = "Content-type: application/octet-stream\r\n";
 
         switch (contentType) {
             case net::ContentType::TEXT: {
@@ -78,6 +82,12 @@ public:
                 _header.increment(json.size());
                 return;
             }
+            case ContentType::BINARY: {
+                bioassert(binary.size() <= _header._remaining, "Header does not fit in buffer");
+                memcpy(_header._content.data() + _header._position, binary.data(), binary.size());
+                _header.increment(binary.size());
+                return;
+            }
         }
     }
 
@@ -151,6 +161,20 @@ public:
         _chunk.increment(content.size());
     }
 
+    // Writes content of any size, split over as many chunks as needed
+    void writeBytes(std::string_view content) {
+        while (!content.empty() && !_errorOccured) {
+            if (_chunk._remaining == 0) {
+                flush();
+            }
+
+            const size_t count = std::min(content.size(), _chunk._remaining);
+            memcpy(_chunk._content.data() + _chunk._position, content.data(), count);
+            _chunk.increment(count);
+            content.remove_prefix(count);
+        }
+    }
+
     void write(char c) {
         if (_errorOccured) {
             return;
@@ -245,14 +269,21 @@ public:
         return _errorOccured;
     }
 
+    // Bytes sent on the socket since the last call
+    size_t takeBytesSent() {
+        return std::exchange(_bytesSent, 0);
+    }
+
 private:
     static inline constexpr size_t _maxHeaderSize = 512;
     static inline constexpr size_t _maxChunkSize = 1024ul * 32ul;
     static inline constexpr size_t _safety = 64; // Includes the size + opening/closing \r\n tokens
+    static inline constexpr int _sendTimeoutMs = 30'000;
 
     utils::DataSocket _socket {};
     bool _wroteNonEmptyChunk = false;
     bool _errorOccured = false;
+    size_t _bytesSent = 0;
 
     struct Header {
         std::array<char, _maxHeaderSize> _content {};
@@ -344,15 +375,44 @@ private:
             const auto sent = ::send(_socket, data, remainingBytes, MSG_NOSIGNAL);
             if (sent == -1) {
                 if (errno == EAGAIN || errno == EWOULDBLOCK) {
+                    // Back-pressure, the socket is non-blocking so wait for the
+                    // client to drain its side instead of spinning
+                    if (!waitWritable()) {
+                        _errorOccured = true;
+                        break;
+                    }
+
                     continue; // Try again
                 }
 
+                if (errno == EINTR) {
+                    continue;
+                }
+
                 _errorOccured = true;
                 break;
             }
 
             data += sent;
             remainingBytes -= sent;
+            _bytesSent += sent;
+        }
+    }
+
+    bool waitWritable() {
+        pollfd fd {};
+        fd.fd = _socket;
+        fd.events = POLLOUT;
+
+        for (;;) {
+            const int res = ::poll(&fd, 1, _sendTimeoutMs);
+            if (res > 0) {
+                return (fd.revents & (POLLERR | POLLHUP | POLLNVAL)) == 0;
+            }
+
+            if (res == 0 || errno != EINTR) {
+                return false; // Timed out, the client stopped reading
+            }
         }
     }
 };
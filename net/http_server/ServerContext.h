@@ -6,13 +6,28 @@
 #include <atomic>
 #include <memory>
 #include <functional>
+#include <string>
 
 namespace net {
 
 class AbstractThreadContext;
 class TCPConnectionStorage;
 class TCPConnection;
+class ExecutionPool;
+class ServerMetrics;
+
+// Where a parsed request is executed
+struct RequestDispatch {
+    // Executed on the execution pool instead of the I/O thread
+    bool _async {false};
+
+    // Queue of the execution pool, requests of different queues are
+    // executed in turn
+    std::string _queue;
+};
+
 using ServerProcessor = std::function<void(AbstractThreadContext*, TCPConnection&)>;
+using ServerDispatcher = std::function<RequestDispatch(TCPConnection&)>;
 using CreateThreadContext = std::function<std::unique_ptr<AbstractThreadContext>()>;
 
 struct ServerContext {
@@ -24,7 +39,10 @@ struct ServerContext {
     std::atomic<FlowStatus>& _status;
     std::atomic<bool>& _running;
     const ServerProcessor& _process;
+    const ServerDispatcher& _dispatch;
+    ExecutionPool* _executionPool {nullptr};
     const CreateThreadContext& _createThreadContext;
+    ServerMetrics& _metrics;
 
     void encounteredError(FlowStatus err) {
         _status.store(err);
@@ -0,0 +1,44 @@
+#pragma once
+
+#include "ThreadCounters.h"
+
+namespace net {
+
+// Counters of the HTTP server, incremented by the I/O and execution threads
+class ServerMetrics {
+public:
+    enum class Counter : size_t {
+        ACCEPTED_CONNECTIONS = 0,
+
+        // Connections closed with a busy response, the connection storage was full
+        REJECTED_CONNECTIONS,
+
+        // Requests rejected with a busy response, the execution pool queue was full
+        REJECTED_REQUESTS,
+
+        BYTES_SENT,
+
+        _SIZE
+    };
+
+    ServerMetrics() = default;
+    ~ServerMetrics() = default;
+
+    ServerMetrics(const ServerMetrics&) = delete;
+    ServerMetrics(ServerMetrics&&) = delete;
+    ServerMetrics& operator=(const ServerMetrics&) = delete;
+    ServerMetrics& operator=(ServerMetrics&&) = delete;
+
+    void add(Counter counter, uint64_t value = 1) {
+        _counters.add((size_t)counter, value);
+    }
+
+    uint64_t get(Counter counter) const {
+        return _counters.get((size_t)counter);
+    }
+
+private:
+    db::ThreadCounters<(size_t)Counter::_SIZE> _counters;
+};
+
+}
@@ -4,7 +4,9 @@
 #include <sys/socket.h>
 #include <unistd.h>
 
+#include "ExecutionPool.h"
 #include "ServerContext.h"
+#include "ServerMetrics.h"
 #include "TCPConnection.h"
 
 using namespace net;
@@ -37,29 +39,28 @@ void TCPConnectionManager::process(AbstractThreadContext* threadContext,
 
         auto* parser = connection.getParser();
         auto analyzeRes = parser->analyze();
-        auto& writer = connection.getWriter();
 
         if (!analyzeRes) {
             // Analyze HTTP Request failed
             switch (analyzeRes.error()) {
                 case net::HTTP::Error::REQUEST_TOO_BIG: {
-                    writer.setFirstLine(net::HTTP::Status::CONTENT_TOO_LARGE);
+                    rejectRequest(connection, net::HTTP::Status::CONTENT_TOO_LARGE);
                     break;
                 }
                 case net::HTTP::Error::HEADER_INCOMPLETE: {
-                    writer.setFirstLine(net::HTTP::Status::BAD_REQUEST);
+                    rejectRequest(connection, net::HTTP::Status::BAD_REQUEST);
                     break;
                 }
                 case net::HTTP::Error::TOO_MANY_PARAMS: {
-                    writer.setFirstLine(net::HTTP::Status::CONTENT_TOO_LARGE);
+                    rejectRequest(connection, net::HTTP::Status::CONTENT_TOO_LARGE);
                     break;
                 }
                 case net::HTTP::Error::UNKNOWN_ENDPOINT: {
-                    writer.setFirstLine(net::HTTP::Status::NOT_FOUND);
+                    rejectRequest(connection, net::HTTP::Status::NOT_FOUND);
                     break;
                 }
                 case net::HTTP::Error::INVALID_METHOD: {
-                    writer.setFirstLine(net::HTTP::Status::METHOD_NOT_ALLOWED);
+                    rejectRequest(connection, net::HTTP::Status::METHOD_NOT_ALLOWED);
                     break;
                 }
                 case net::HTTP::Error::NO_METHOD:
@@ -67,61 +68,116 @@ void TCPConnectionManager::process(AbstractThreadContext* threadContext,
                 case net::HTTP::Error::UNKNOWN:
                 case net::HTTP::Error::INVALID_URI:
                 case net::HTTP::Error::_SIZE: {
-                    writer.setFirstLine(net::HTTP::Status::BAD_REQUEST);
+                    rejectRequest(connection, net::HTTP::Status::BAD_REQUEST);
                     break;
                 }
             }
-            writer.addConnection(net::getConnectionHeader(true));
-            writer.addChunkedTransferEncoding();
-            writer.addContentType(net::ContentType::JSON);
-            writer.endHeader();
-            writer.flushHeader();
-            writer.flush();
-            writer.reset();
-            parser->reset();
-            inputWriter.reset();
-            connection.close();
             return;
         }
 
         const bool finished = analyzeRes.value();
 
         if (finished) {
-            // Process with stored callback
-            _ctxt._process(threadContext, connection);
-
-            if (writer.getBytesWritten() != 0) {
-                writer.flush(); // Make sure we sent everything
+            if (_ctxt._executionPool && _ctxt._dispatch) {
+                const RequestDispatch dispatch = _ctxt._dispatch(connection);
+
+                if (dispatch._async) {
+                    // The connection receives no event until it is rearmed
+                    // by the execution pool, once the request is processed.
+                    // Requests still queued at shutdown are rejected
+                    ServerContext& ctxt = _ctxt;
+                    const bool submitted = _ctxt._executionPool->submit(
+                        dispatch._queue,
+                        [&ctxt, &connection](AbstractThreadContext* executorContext) {
+                            execute(ctxt, executorContext, connection);
+                        },
+                        [&ctxt, &connection] {
+                            ctxt._metrics.add(ServerMetrics::Counter::REJECTED_REQUESTS);
+                            rejectRequest(connection, net::HTTP::Status::SERVICE_UNAVAILABLE);
+                        });
+
+                    if (!submitted) {
+                        _ctxt._metrics.add(ServerMetrics::Counter::REJECTED_REQUESTS);
+                        rejectRequest(connection, net::HTTP::Status::SERVICE_UNAVAILABLE);
+                    }
+
+                    return;
+                }
             }
 
-            if (writer.errorOccured()) {
-                writer.reset();
-                parser->reset();
-                inputWriter.reset();
-                connection.close();
-                return;
-            }
+            execute(_ctxt, threadContext, connection);
+            return;
+        }
+    }
 
-            if (writer.wroteNonEmptyChunk()) {
-                writer.flush();
-                writer.reset();
-            }
+    rearm(_ctxt, connection);
+}
 
-            // Reset for next query
-            parser->reset();
-            inputWriter.reset();
+void TCPConnectionManager::execute(ServerContext& ctxt,
+                                   AbstractThreadContext* threadContext,
+                                   TCPConnection& connection) {
+    auto* parser = connection.getParser();
+    auto& writer = connection.getWriter();
+    auto inputWriter = connection.getInputBuffer().getWriter();
 
-            if (connection.isCloseRequired()) {
-                connection.close();
-                return;
-            }
-        }
+    // Process with stored callback
+    ctxt._process(threadContext, connection);
+
+    if (writer.getBytesWritten() != 0) {
+        writer.flush(); // Make sure we sent everything
+    }
+
+    if (writer.errorOccured()) {
+        ctxt._metrics.add(ServerMetrics::Counter::BYTES_SENT, writer.takeBytesSent());
+        writer.reset();
+        parser->reset();
+        inputWriter.reset();
+        connection.close();
+        return;
+    }
+
+    if (writer.wroteNonEmptyChunk()) {
+        writer.flush();
+        writer.reset();
+    }
+
+    ctxt._metrics.add(ServerMetrics::Counter::BYTES_SENT, writer.takeBytesSent());
+
+    // Reset for next query
+    parser->reset();
+    inputWriter.reset();
+
+    if (connection.isCloseRequired()) {
+        connection.close();
+        return;
     }
 
+    rearm(ctxt, connection);
+}
+
+void TCPConnectionManager::rejectRequest(TCPConnection& connection, HTTP::Status status) {
+    auto& writer = connection.getWriter();
+    auto inputWriter = connection.getInputBuffer().getWriter();
+
+    writer.setFirstLine(status);
+    writer.addConnection(net::getConnectionHeader(true));
+    writer.addChunkedTransferEncoding();
+    writer.addContentType(net::ContentType::JSON);
+    writer.endHeader();
+    writer.flushHeader();
+    writer.flush();
+    writer.reset();
+    connection.getParser()->reset();
+    inputWriter.reset();
+    connection.close();
+}
+
+void TCPConnectionManager::rearm(ServerContext& ctxt, TCPConnection& connection) {
+    utils::EpollEvent ev;
     ev.events = utils::EVENT_IN | utils::EVENT_ET | utils::EVENT_ONESHOT;
     ev.data = &connection;
-    if (!utils::epollMod(_ctxt._instance, s, ev)) {
+    if (!utils::epollMod(ctxt._instance, connection.getSocket(), ev)) {
         utils::logError("EpollMod existing connection");
-        _ctxt.encounteredError(FlowStatus::CTL_ERROR);
+        ctxt.encounteredError(FlowStatus::CTL_ERROR);
     }
 }
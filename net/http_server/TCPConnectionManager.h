@@ -1,11 +1,13 @@
 #pragma once
 
+#include "HTTP.h"
 #include "Utils.h"
 
 namespace net {
 
 struct ServerContext;
 class AbstractThreadContext;
+class TCPConnection;
 
 class TCPConnectionManager {
 public:
@@ -14,8 +16,17 @@ public:
     void process(AbstractThreadContext* threadContext,
                  utils::EpollEvent& ev);
 
+    // Processes a fully parsed request then waits for the next request of
+    // the connection, called by the I/O threads or by the execution pool
+    static void execute(ServerContext& ctxt,
+                        AbstractThreadContext* threadContext,
+                        TCPConnection& connection);
+
 private:
     ServerContext& _ctxt;
+
+    static void rejectRequest(TCPConnection& connection, HTTP::Status status);
+    static void rearm(ServerContext& ctxt, TCPConnection& connection);
 };
 
 }
@@ -39,4 +39,9 @@ void TCPConnectionStorage::dealloc(TCPConnection* connection) {
     _free.push_back(connection->getStorageIndex());
 }
 
+size_t TCPConnectionStorage::getUsedCount() const {
+    std::unique_lock lock(_mutex);
+    return _maxConnections - _free.size();
+}
+
 }
@@ -35,8 +35,10 @@ public:
     TCPConnection* alloc(utils::DataSocket socket);
     void dealloc(TCPConnection* connection);
 
+    size_t getUsedCount() const;
+
 private:
-    std::mutex _mutex;
+    mutable std::mutex _mutex;
     std::vector<TCPConnection> _connections;
     std::vector<size_t> _free;
     uint32_t _maxConnections {1024};
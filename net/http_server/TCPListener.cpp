@@ -6,6 +6,7 @@
 #include <unistd.h>
 
 #include "ServerContext.h"
+#include "ServerMetrics.h"
 #include "TCPConnectionStorage.h"
 
 using namespace net;
@@ -42,6 +43,8 @@ void TCPListener::accept(utils::EpollEvent& ev) {
         ev.data = _ctxt._connections.alloc(s);
 
         if (!ev.data) {
+            _ctxt._metrics.add(ServerMetrics::Counter::REJECTED_CONNECTIONS);
+
             ::send(s, busyResponse.data(), busyResponse.size(), 0);
             ::shutdown(s, SHUT_RDWR);
             ::close(s);
@@ -56,6 +59,8 @@ void TCPListener::accept(utils::EpollEvent& ev) {
             continue;
         }
 
+        _ctxt._metrics.add(ServerMetrics::Counter::ACCEPTED_CONNECTIONS);
+
         if (!utils::epollAdd(_ctxt._instance, s, ev)) {
             utils::logError("EpollAdd new connection");
             _ctxt.encounteredError(FlowStatus::CTL_ERROR);
@@ -21,13 +21,13 @@ class DoubleLiteral;
 class StringLiteral;
 class CharLiteral;
 class MapLiteral;
+class ParameterLiteral;
 class WildcardLiteral;
 class Expr;
 class ExprChain;
 class BinaryExpr;
 class LiteralExpr;
 class EntityTypeExpr;
-class ParameterExpr;
 class PathExpr;
 class PropertyExpr;
 class StringExpr;
@@ -92,12 +92,12 @@ public:
     friend StringLiteral;
     friend CharLiteral;
     friend MapLiteral;
+    friend ParameterLiteral;
     friend WildcardLiteral;
     friend ExprChain;
     friend BinaryExpr;
     friend LiteralExpr;
     friend EntityTypeExpr;
-    friend ParameterExpr;
     friend PathExpr;
     friend PropertyExpr;
     friend StringExpr;
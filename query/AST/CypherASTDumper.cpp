@@ -841,6 +841,11 @@ void CypherASTDumper::dump(std::ostream& out, const LiteralExpr* expr) {
             out << "        MapLiteral _" << mapLiteral << "\n";
             break;
         }
+        case Literal::Kind::PARAMETER: {
+            const ParameterLiteral* paramLiteral = dynamic_cast<const ParameterLiteral*>(literal);
+            out << "        ParameterLiteral $" << paramLiteral->getName() << "\n";
+            break;
+        }
         default: {
             throw CompilerException("Unknown literal type");
             break;
@@ -29,7 +29,6 @@ class BinaryExpr;
 class UnaryExpr;
 class SymbolExpr;
 class LiteralExpr;
-class ParameterExpr;
 class PathExpr;
 class EntityTypeExpr;
 class StringExpr;
@@ -22,6 +22,34 @@ std::unique_ptr<FunctionDecls> FunctionDecls::createDefault(const ProcedureBluep
         auto declBuilder = decls->create(blueprint._name);
         declBuilder.setIsDatabaseProcedure(true);
 
+        for (const auto& arg : blueprint._arguments) {
+            switch (arg._type) {
+                case ProcedureArgumentType::INVALID:
+                    throw FatalException("Invalid procedure argument type");
+                    break;
+
+                case ProcedureArgumentType::NODE:
+                    declBuilder.addArgument(EvaluatedType::NodePattern);
+                    break;
+                case ProcedureArgumentType::INT64:
+                    declBuilder.addArgument(EvaluatedType::Integer);
+                    break;
+                case ProcedureArgumentType::DOUBLE:
+                    declBuilder.addArgument(EvaluatedType::Double);
+                    break;
+                case ProcedureArgumentType::STRING:
+                    declBuilder.addArgument(EvaluatedType::String);
+                    break;
+                case ProcedureArgumentType::VECTOR:
+                    declBuilder.addArgument(EvaluatedType::List);
+                    break;
+
+                case ProcedureArgumentType::_SIZE:
+                    throw FatalException("Invalid procedure argument type: _SIZE");
+                break;
+            }
+        }
+
         for (const auto& returnItem : blueprint._returnValues) {
             switch (returnItem._type) {
                 case ProcedureReturnType::INVALID:
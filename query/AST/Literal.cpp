@@ -57,6 +57,12 @@ void MapLiteral::set(Symbol* key, Expr* value) {
     _map[key] = value;
 }
 
+ParameterLiteral* ParameterLiteral::create(CypherAST* ast, std::string_view name) {
+    ParameterLiteral* literal = new ParameterLiteral(name);
+    ast->addLiteral(literal);
+    return literal;
+}
+
 WildcardLiteral::WildcardLiteral() {
 }
 
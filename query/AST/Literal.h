@@ -25,6 +25,7 @@ public:
         CHAR,
         MAP,
         WILDCARD,
+        PARAMETER,
     };
 
     virtual Kind getKind() const = 0;
@@ -180,6 +181,31 @@ private:
     ~MapLiteral() override;
 };
 
+class ParameterLiteral : public Literal {
+public:
+    static ParameterLiteral* create(CypherAST* ast, std::string_view name);
+
+    constexpr Kind getKind() const override { return Kind::PARAMETER; }
+
+    // Type of the value bound to the parameter, set by the analyzer
+    EvaluatedType getType() const override { return _type; }
+
+    void setType(EvaluatedType type) { _type = type; }
+
+    std::string_view getName() const { return _name; }
+
+private:
+    std::string_view _name;
+    EvaluatedType _type {EvaluatedType::Invalid};
+
+    ParameterLiteral(std::string_view name)
+        : _name(name)
+    {
+    }
+
+    ~ParameterLiteral() override = default;
+};
+
 class WildcardLiteral : public Literal {
 public:
     static WildcardLiteral* create(CypherAST* ast);
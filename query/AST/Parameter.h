@@ -1,11 +0,0 @@
-#pragma once
-
-#include <string_view>
-
-namespace db {
-
-struct Parameter {
-    std::string_view _name;
-};
-
-}
@@ -23,12 +23,24 @@ public:
         SHOW_PROCEDURES_QUERY,
     };
 
+    // EXPLAIN only plans the query, PROFILE also executes it
+    // and reports the runtime counters of each processor
+    enum class ExplainMode {
+        NONE = 0,
+        EXPLAIN,
+        PROFILE,
+    };
+
     virtual Kind getKind() const = 0;
 
     DeclContext* getDeclContext() const { return _declContext; }
 
+    ExplainMode getExplainMode() const { return _explainMode; }
+    void setExplainMode(ExplainMode mode) { _explainMode = mode; }
+
 protected:
     DeclContext* _declContext {nullptr};
+    ExplainMode _explainMode {ExplainMode::NONE};
 
     QueryCommand(DeclContext* declContext);
     virtual ~QueryCommand();
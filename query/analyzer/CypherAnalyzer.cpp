@@ -44,6 +44,10 @@ CypherAnalyzer::CypherAnalyzer(CypherAST* ast, GraphView graphView)
 CypherAnalyzer::~CypherAnalyzer() {
 }
 
+void CypherAnalyzer::setParameters(const QueryParams* params) {
+    _exprAnalyzer->setParameters(params);
+}
+
 void CypherAnalyzer::analyze() {
     for (QueryCommand* query : _ast->queries()) {
         DeclContext* ctxt = query->getDeclContext();
@@ -135,10 +139,6 @@ void CypherAnalyzer::analyze(const SinglePartQuery* query) {
 void CypherAnalyzer::analyze(const ReturnStmt* returnSt) {
     Projection* projection = returnSt->getProjection();
 
-    if (projection->isDistinct()) {
-        throwError("DISTINCT not supported", returnSt);
-    }
-
     if (projection->hasOrderBy()) {
         analyze(projection->getOrderBy());
     }
@@ -21,6 +21,7 @@ class OrderBy;
 class Skip;
 class Limit;
 class ReturnStmt;
+class QueryParams;
 
 class CypherAnalyzer {
 public:
@@ -34,6 +35,8 @@ public:
 
     CypherAST* getAST() const { return _ast; }
 
+    void setParameters(const QueryParams* params);
+
     void analyze();
 
     // Query types
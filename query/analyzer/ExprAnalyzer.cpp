@@ -1,5 +1,7 @@
 #include "ExprAnalyzer.h"
 
+#include <variant>
+
 #include "DiagnosticsManager.h"
 #include "AnalyzeException.h"
 #include "CypherAST.h"
@@ -8,6 +10,7 @@
 #include "QualifiedName.h"
 #include "Symbol.h"
 #include "Literal.h"
+#include "QueryParams.h"
 #include "decl/DeclContext.h"
 #include "decl/EvaluatedType.h"
 #include "decl/VarDecl.h"
@@ -290,7 +293,7 @@ void ExprAnalyzer::analyzeSymbolExpr(SymbolExpr* expr) {
 }
 
 void ExprAnalyzer::analyzeLiteralExpr(LiteralExpr* expr) {
-    const Literal* literal = expr->getLiteral();
+    Literal* literal = expr->getLiteral();
 
     switch (literal->getKind()) {
         case Literal::Kind::NULL_LITERAL: {
@@ -317,7 +320,36 @@ void ExprAnalyzer::analyzeLiteralExpr(LiteralExpr* expr) {
         case Literal::Kind::WILDCARD: {
             expr->setType(EvaluatedType::Wildcard);
         } break;
+        case Literal::Kind::PARAMETER: {
+            analyzeParameterLiteral(static_cast<ParameterLiteral*>(literal), expr);
+        } break;
+    }
+}
+
+void ExprAnalyzer::analyzeParameterLiteral(ParameterLiteral* literal, const LiteralExpr* expr) {
+    const QueryParams::Value* value = _params ? _params->get(literal->getName()) : nullptr;
+    if (!value) {
+        throwError(fmt::format("Parameter '${}' is not bound", literal->getName()), expr);
     }
+
+    // The value itself is only read when generating the pipeline
+    const EvaluatedType type = std::visit([]<typename T>(const T&) {
+        if constexpr (std::is_same_v<T, bool>) {
+            return EvaluatedType::Bool;
+        } else if constexpr (std::is_same_v<T, int64_t>) {
+            return EvaluatedType::Integer;
+        } else if constexpr (std::is_same_v<T, double>) {
+            return EvaluatedType::Double;
+        } else if constexpr (std::is_same_v<T, std::string>) {
+            return EvaluatedType::String;
+        } else if constexpr (std::is_same_v<T, QueryParams::Vector>) {
+            return EvaluatedType::List;
+        } else {
+            return EvaluatedType::Null;
+        }
+    }, *value);
+
+    literal->setType(type);
 }
 
 ValueType ExprAnalyzer::analyzePropertyExpr(PropertyExpr* expr, bool allowCreate, ValueType defaultType) {
@@ -20,12 +20,14 @@ class BinaryExpr;
 class UnaryExpr;
 class SymbolExpr;
 class LiteralExpr;
+class ParameterLiteral;
 class PropertyExpr;
 class StringExpr;
 class EntityTypeExpr;
 class PathExpr;
 class FunctionInvocationExpr;
 class Symbol;
+class QueryParams;
 
 class ExprAnalyzer {
 public:
@@ -38,6 +40,7 @@ public:
     ExprAnalyzer& operator=(ExprAnalyzer&&) = delete;
 
     void setDeclContext(DeclContext* ctxt) { _ctxt = ctxt; }
+    void setParameters(const QueryParams* params) { _params = params; }
 
     // Expressions
     void analyzeRootExpr(Expr* expr);
@@ -46,6 +49,7 @@ public:
     void analyzeUnaryExpr(UnaryExpr* expr);
     void analyzeSymbolExpr(SymbolExpr* expr);
     void analyzeLiteralExpr(LiteralExpr* expr);
+    void analyzeParameterLiteral(ParameterLiteral* literal, const LiteralExpr* expr);
     void analyzeStringExpr(StringExpr* expr);
     void analyzeEntityTypeExpr(EntityTypeExpr* expr);
     void analyzeFuncInvocExpr(FunctionInvocationExpr* expr);
@@ -63,6 +67,7 @@ private:
     CypherAST* _ast {nullptr};
     GraphView _graphView;
     DeclContext* _ctxt {nullptr};
+    const QueryParams* _params {nullptr};
     const GraphMetadata& _graphMetadata;
 
     std::unordered_map<std::string_view, ValueType> _toBeCreatedTypes;
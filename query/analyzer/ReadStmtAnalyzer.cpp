@@ -68,10 +68,6 @@ void ReadStmtAnalyzer::analyze(const Stmt* stmt) {
 }
 
 void ReadStmtAnalyzer::analyze(const MatchStmt* matchSt) {
-    if (matchSt->isOptional()) {
-        throwError("OPTIONAL MATCH not supported", matchSt);
-    }
-
     const Pattern* pattern = matchSt->getPattern();
     if (!pattern) {
         throwError("MATCH statement must have a pattern", matchSt);
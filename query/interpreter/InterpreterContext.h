@@ -11,6 +11,7 @@ class LocalMemory;
 namespace db {
 
 class ProcedureBlueprintMap;
+class QueryParams;
 
 class InterpreterContext {
 public:
@@ -35,12 +36,21 @@ public:
     CommitHash getCommitHash() const { return _commitHash; }
     ChangeID getChangeID() const { return _changeID; }
 
+    const QueryParams* getParameters() const { return _params; }
+    void setParameters(const QueryParams* params) { _params = params; }
+
+    // 0 to keep the default chunk size of the execution context
+    size_t getChunkSize() const { return _chunkSize; }
+    void setChunkSize(size_t chunkSize) { _chunkSize = chunkSize; }
+
 private:
     LocalMemory* _mem {nullptr};
     QueryCallbackV2 _callback;
     const ProcedureBlueprintMap* _procedures {nullptr};
     CommitHash _commitHash;
     ChangeID _changeID;
+    const QueryParams* _params {nullptr};
+    size_t _chunkSize {0};
 };
 
 }
@@ -0,0 +1,156 @@
+#include "PlanCache.h"
+
+#include <ctype.h>
+
+#include "CypherAST.h"
+#include "PlanGraphGenerator.h"
+#include "QueryParams.h"
+#include "views/GraphView.h"
+#include "metadata/GraphMetadata.h"
+
+using namespace db;
+
+namespace {
+
+// Collapses the runs of whitespaces outside of the quoted strings and names
+void appendNormalizedQuery(std::string& out, std::string_view query) {
+    char quote = 0;
+    bool pendingSpace = false;
+
+    for (size_t i = 0; i < query.size(); i++) {
+        const char c = query[i];
+
+        if (quote) {
+            out += c;
+            if (c == '\\' && i + 1 < query.size()) {
+                out += query[++i];
+            } else if (c == quote) {
+                quote = 0;
+            }
+            continue;
+        }
+
+        if (isspace((unsigned char)c)) {
+            pendingSpace = true;
+            continue;
+        }
+
+        if (pendingSpace && !out.empty()) {
+            out += ' ';
+        }
+        pendingSpace = false;
+
+        if (c == '\'' || c == '"' || c == '`') {
+            quote = c;
+        }
+
+        out += c;
+    }
+}
+
+}
+
+CompiledQuery::CompiledQuery(const ProcedureBlueprintMap& procedures,
+                             std::string_view query)
+    : _query(query),
+    _ast(std::make_unique<CypherAST>(procedures, _query))
+{
+}
+
+CompiledQuery::~CompiledQuery() {
+}
+
+void CompiledQuery::setPlanGenerator(std::unique_ptr<PlanGraphGenerator> planGen) {
+    _planGen = std::move(planGen);
+}
+
+PlanCache::PlanCache(size_t capacity)
+    : _capacity(capacity)
+{
+}
+
+PlanCache::~PlanCache() {
+}
+
+PlanCache::Entry PlanCache::get(const std::string& key) {
+    std::scoped_lock lock(_mutex);
+
+    const auto it = _entries.find(key);
+    if (it == _entries.end()) {
+        _missCount.fetch_add(1, std::memory_order_relaxed);
+        return nullptr;
+    }
+
+    _lru.splice(_lru.begin(), _lru, it->second);
+    _hitCount.fetch_add(1, std::memory_order_relaxed);
+
+    return it->second->second;
+}
+
+void PlanCache::insert(const std::string& key, Entry query) {
+    if (_capacity == 0) {
+        return;
+    }
+
+    std::scoped_lock lock(_mutex);
+
+    // Another thread compiled the same query concurrently
+    if (_entries.contains(key)) {
+        return;
+    }
+
+    if (_lru.size() >= _capacity) {
+        _entries.erase(_lru.back().first);
+        _lru.pop_back();
+    }
+
+    _lru.emplace_front(key, std::move(query));
+    _entries.emplace(_lru.front().first, _lru.begin());
+}
+
+void PlanCache::clear() {
+    std::scoped_lock lock(_mutex);
+
+    _entries.clear();
+    _lru.clear();
+}
+
+size_t PlanCache::size() const {
+    std::scoped_lock lock(_mutex);
+    return _lru.size();
+}
+
+void PlanCache::makeKey(std::string& key,
+                        std::string_view query,
+                        std::string_view graphName,
+                        const GraphView& view,
+                        const QueryParams* params) {
+    key.clear();
+    key.reserve(query.size() + graphName.size() + 64);
+
+    key += graphName;
+    key += '\n';
+
+    // The frozen commits of a graph form a linear history and the metadata
+    // maps are append-only, so the first commit and the sizes of the maps
+    // identify the metadata the plan was built against
+    const auto commits = view.commits();
+    const GraphMetadata& metadata = view.metadata();
+
+    key += std::to_string(commits.empty() ? 0 : commits.front().hash().get());
+    for (const size_t count : {metadata.labels().getCount(),
+                               metadata.edgeTypes().getCount(),
+                               metadata.propTypes().getCount(),
+                               metadata.labelsets().getCount()}) {
+        key += ':';
+        key += std::to_string(count);
+    }
+    key += '\n';
+
+    if (params) {
+        params->appendSignature(key);
+    }
+    key += '\n';
+
+    appendNormalizedQuery(key, query);
+}
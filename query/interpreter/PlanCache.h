@@ -0,0 +1,109 @@
+#pragma once
+
+#include <atomic>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+namespace db {
+class GraphView;
+class QueryParams;
+}
+
+namespace db {
+
+class CypherAST;
+class PlanGraphGenerator;
+class ProcedureBlueprintMap;
+
+/**
+ * @brief Parsed, analyzed and optimized query.
+ *
+ * @detail The AST refers to the query string owned by the compiled query.
+ * Once it is stored in the plan cache, a compiled query is only read by the
+ * pipeline generators of the queries sharing it.
+ */
+class CompiledQuery {
+public:
+    CompiledQuery(const ProcedureBlueprintMap& procedures, std::string_view query);
+    ~CompiledQuery();
+
+    CompiledQuery(const CompiledQuery&) = delete;
+    CompiledQuery(CompiledQuery&&) = delete;
+    CompiledQuery& operator=(const CompiledQuery&) = delete;
+    CompiledQuery& operator=(CompiledQuery&&) = delete;
+
+    std::string_view getQuery() const { return _query; }
+
+    CypherAST& getAST() { return *_ast; }
+
+    PlanGraphGenerator* getPlanGenerator() { return _planGen.get(); }
+    void setPlanGenerator(std::unique_ptr<PlanGraphGenerator> planGen);
+
+private:
+    std::string _query;
+    std::unique_ptr<CypherAST> _ast;
+    std::unique_ptr<PlanGraphGenerator> _planGen;
+};
+
+/**
+ * @brief LRU cache of the compiled read queries.
+ *
+ * @detail A plan depends on the text of the query, on the metadata of the graph
+ * it was built against and on the types of the parameters, but not on their
+ * values. See @ref makeKey.
+ */
+class PlanCache {
+public:
+    using Entry = std::shared_ptr<CompiledQuery>;
+
+    static constexpr size_t DEFAULT_CAPACITY = 256;
+
+    explicit PlanCache(size_t capacity = DEFAULT_CAPACITY);
+    ~PlanCache();
+
+    PlanCache(const PlanCache&) = delete;
+    PlanCache(PlanCache&&) = delete;
+    PlanCache& operator=(const PlanCache&) = delete;
+    PlanCache& operator=(PlanCache&&) = delete;
+
+    // Returns nullptr and counts a miss if the key is not cached
+    Entry get(const std::string& key);
+
+    void insert(const std::string& key, Entry query);
+
+    void clear();
+
+    size_t size() const;
+    size_t getCapacity() const { return _capacity; }
+
+    uint64_t getHitCount() const { return _hitCount.load(std::memory_order_relaxed); }
+    uint64_t getMissCount() const { return _missCount.load(std::memory_order_relaxed); }
+
+    static void makeKey(std::string& key,
+                        std::string_view query,
+                        std::string_view graphName,
+                        const GraphView& view,
+                        const QueryParams* params);
+
+private:
+    using LRUList = std::list<std::pair<std::string, Entry>>;
+
+    const size_t _capacity {0};
+
+    mutable std::mutex _mutex;
+
+    // Most recently used first
+    LRUList _lru;
+
+    // Keys point to the strings stored in _lru
+    std::unordered_map<std::string_view, LRUList::iterator> _entries;
+
+    std::atomic<uint64_t> _hitCount {0};
+    std::atomic<uint64_t> _missCount {0};
+};
+
+}
@@ -1,6 +1,7 @@
 #include "QueryInterpreterV2.h"
 
 #include "InterpreterContext.h"
+#include "PlanCache.h"
 #include "SystemManager.h"
 #include "JobSystem.h"
 #include "versioning/Transaction.h"
@@ -9,10 +10,14 @@
 #include "CypherAnalyzer.h"
 #include "PlanGraphGenerator.h"
 #include "PipelineV2.h"
+#include "LocalMemory.h"
 #include "PlanOptimizer.h"
+#include "QueryCommand.h"
 #include "PipelineGenerator.h"
 #include "PipelineExecutor.h"
+#include "PipelineProfiler.h"
 #include "ExecutionContext.h"
+#include "QueryProfile.h"
 
 #include "PipelineException.h"
 #include "CompilerException.h"
@@ -23,9 +28,11 @@
 using namespace db;
 
 QueryInterpreterV2::QueryInterpreterV2(db::SystemManager* sysMan,
-                                       db::JobSystem* jobSystem)
+                                       db::JobSystem* jobSystem,
+                                       PlanCache* planCache)
     : _sysMan(sysMan),
-    _jobSystem(jobSystem)
+    _jobSystem(jobSystem),
+    _planCache(planCache)
 {
 }
 
@@ -54,76 +61,47 @@ db::QueryStatus QueryInterpreterV2::execute(const InterpreterContext& ctxt,
     }
 
     const GraphView view = txRes->viewGraph();
+    const QueryParams* params = ctxt.getParameters();
 
-    // Parsing query
-    CypherAST ast(*ctxt.getProcedures(), query);
-    CypherParser parser(&ast);
-    try {
-        parser.parse(query);
-    } catch (const CompilerException& e) {
-        return QueryStatus(QueryStatus::Status::PARSE_ERROR, e.what());
-    } catch (const std::exception& e) {
-        return QueryStatus(QueryStatus::Status::PARSE_ERROR,
-                           std::string("Unexpected exception: ") + e.what());
-    } catch (...) {
-        return QueryStatus(QueryStatus::Status::PARSE_ERROR,
-                           "Unknown exception occurred");
-    }
+    // Only the queries reading frozen commits are cached, the metadata
+    // of pending commits can change between two queries
+    PlanCache* planCache = txRes->readingFrozenCommit() ? _planCache : nullptr;
 
-    // Analyze query
-    CypherAnalyzer analyzer(&ast, view);
-    try {
-        analyzer.analyze();
-    } catch (const CompilerException& e) {
-        return QueryStatus(QueryStatus::Status::ANALYZE_ERROR, e.what());
-    } catch (const std::exception& e) {
-        return QueryStatus(QueryStatus::Status::ANALYZE_ERROR,
-                           std::string("Unexpected exception: ") + e.what());
-    } catch (...) {
-        return QueryStatus(QueryStatus::Status::ANALYZE_ERROR,
-                           "Unknown exception occurred");
+    std::string cacheKey;
+    PlanCache::Entry compiled;
+    if (planCache) {
+        PlanCache::makeKey(cacheKey, query, graphName, view, params);
+        compiled = planCache->get(cacheKey);
     }
 
-    // Generate plan graph
-    PlanGraphGenerator planGen(ast, view);
-    try {
-        planGen.generate(ast.queries().front());
-    } catch (const CompilerException& e) {
-        return QueryStatus(QueryStatus::Status::PLAN_ERROR, e.what());
-    } catch (const std::exception& e) {
-        return QueryStatus(QueryStatus::Status::PLAN_ERROR,
-                           std::string("Unexpected exception: ") + e.what());
-    } catch (...) {
-        return QueryStatus(QueryStatus::Status::PLAN_ERROR,
-                           "Unknown exception occurred");
-    }
+    if (!compiled) {
+        compiled = std::make_shared<CompiledQuery>(*ctxt.getProcedures(), query);
 
-    PlanGraph& planGraph = planGen.getPlanGraph();
+        if (auto res = compile(*compiled, view, params); !res.isOk()) {
+            return res;
+        }
 
-    // Optimize plan graph
-    PlanOptimizer planOpt(&planGraph);
-    try {
-        planOpt.optimize();
-    } catch (const CompilerException& e) {
-        return QueryStatus(QueryStatus::Status::PLAN_ERROR, e.what());
-    } catch (const std::exception& e) {
-        return QueryStatus(QueryStatus::Status::PLAN_ERROR,
-                           std::string("Unexpected exception: ") + e.what());
-    } catch (...) {
-        return QueryStatus(QueryStatus::Status::PLAN_ERROR,
-                           "Unknown exception occurred");
+        const auto& queries = compiled->getAST().queries();
+        if (planCache && queries.front()->getKind() == QueryCommand::Kind::SINGLE_PART_QUERY) {
+            planCache->insert(cacheKey, compiled);
+        }
     }
 
+    PlanGraph& planGraph = compiled->getPlanGenerator()->getPlanGraph();
+
     // Generate pipeline
     LocalMemory* mem = ctxt.getLocalMemory();
-    PipelineV2 pipeline;
+    mem->resetPeakUsage();
+
+    PipelineV2 pipeline(&mem->getPipelineArena());
     PipelineGenerator pipelineGen(&planGraph,
                                   view,
                                   &pipeline,
                                   mem,
-                                  ast.getSourceManager(),
+                                  compiled->getAST().getSourceManager(),
                                   *ctxt.getProcedures(),
                                   ctxt.getQueryCallback());
+    pipelineGen.setParameters(params);
     try {
         pipelineGen.generate();
     } catch (const CompilerException& e) {
@@ -136,14 +114,32 @@ db::QueryStatus QueryInterpreterV2::execute(const InterpreterContext& ctxt,
                            "Unknown exception occurred");
     }
 
+    // EXPLAIN stops before the execution
+    const auto explainMode = compiled->getAST().queries().front()->getExplainMode();
+    if (explainMode == QueryCommand::ExplainMode::EXPLAIN) {
+        auto profile = std::make_shared<QueryProfile>(false);
+        PipelineProfiler::buildProfile(&pipeline, *profile);
+
+        auto res = QueryStatus(QueryStatus::Status::OK);
+        res.setTotalTime(Clock::now() - start);
+        res.setProfile(std::move(profile));
+        return res;
+    }
+
+    const bool profiling = explainMode == QueryCommand::ExplainMode::PROFILE;
+
     // Execute pipeline
     ExecutionContext execCtxt(_sysMan, view);
     execCtxt.setTransaction(&txRes.value());
     execCtxt.setGraphName(graphName);
     execCtxt.setJobSystem(_jobSystem);
     execCtxt.setProcedures(ctxt.getProcedures());
+    if (ctxt.getChunkSize() > 0) {
+        execCtxt.setChunkSize(ctxt.getChunkSize());
+    }
 
     PipelineExecutor executor(&pipeline, &execCtxt);
+    executor.setProfiling(profiling);
     try {
         executor.execute();
     } catch (const PipelineException& e) {
@@ -160,7 +156,87 @@ db::QueryStatus QueryInterpreterV2::execute(const InterpreterContext& ctxt,
 
     const auto end = Clock::now();
 
+    const MemoryPoolStats memStats = mem->getStats();
+
     auto res = QueryStatus(QueryStatus::Status::OK);
     res.setTotalTime(end - start);
+    res.setMemoryUsage(memStats._usedBytes,
+                       memStats._reservedBytes,
+                       memStats._peakUsedBytes);
+
+    if (profiling) {
+        auto profile = std::make_shared<QueryProfile>(true);
+        PipelineProfiler::buildProfile(&pipeline, *profile);
+        res.setProfile(std::move(profile));
+    }
+
     return res;
 }
+
+db::QueryStatus QueryInterpreterV2::compile(CompiledQuery& compiled,
+                                            const GraphView& view,
+                                            const QueryParams* params) {
+    // Parsing query
+    CypherAST& ast = compiled.getAST();
+    CypherParser parser(&ast);
+    try {
+        parser.parse(compiled.getQuery());
+    } catch (const CompilerException& e) {
+        return QueryStatus(QueryStatus::Status::PARSE_ERROR, e.what());
+    } catch (const std::exception& e) {
+        return QueryStatus(QueryStatus::Status::PARSE_ERROR,
+                           std::string("Unexpected exception: ") + e.what());
+    } catch (...) {
+        return QueryStatus(QueryStatus::Status::PARSE_ERROR,
+                           "Unknown exception occurred");
+    }
+
+    // Analyze query
+    CypherAnalyzer analyzer(&ast, view);
+    analyzer.setParameters(params);
+    try {
+        analyzer.analyze();
+    } catch (const CompilerException& e) {
+        return QueryStatus(QueryStatus::Status::ANALYZE_ERROR, e.what());
+    } catch (const std::exception& e) {
+        return QueryStatus(QueryStatus::Status::ANALYZE_ERROR,
+                           std::string("Unexpected exception: ") + e.what());
+    } catch (...) {
+        return QueryStatus(QueryStatus::Status::ANALYZE_ERROR,
+                           "Unknown exception occurred");
+    }
+
+    // Generate plan graph
+    auto planGen = std::make_unique<PlanGraphGenerator>(ast, view);
+    try {
+        planGen->generate(ast.queries().front());
+    } catch (const CompilerException& e) {
+        return QueryStatus(QueryStatus::Status::PLAN_ERROR, e.what());
+    } catch (const std::exception& e) {
+        return QueryStatus(QueryStatus::Status::PLAN_ERROR,
+                           std::string("Unexpected exception: ") + e.what());
+    } catch (...) {
+        return QueryStatus(QueryStatus::Status::PLAN_ERROR,
+                           "Unknown exception occurred");
+    }
+
+    PlanGraph& planGraph = planGen->getPlanGraph();
+
+    // Optimize plan graph
+    PlanOptimizer planOpt(&planGraph, view);
+    try {
+        planOpt.optimize();
+    } catch (const CompilerException& e) {
+        return QueryStatus(QueryStatus::Status::PLAN_ERROR, e.what());
+    } catch (const std::exception& e) {
+        return QueryStatus(QueryStatus::Status::PLAN_ERROR,
+                           std::string("Unexpected exception: ") + e.what());
+    } catch (...) {
+        return QueryStatus(QueryStatus::Status::PLAN_ERROR,
+                           "Unknown exception occurred");
+    }
+
+    compiled.setPlanGenerator(std::move(planGen));
+
+    return QueryStatus(QueryStatus::Status::OK);
+}
@@ -8,17 +8,22 @@ namespace db {
 
 class SystemManager;
 class JobSystem;
+class GraphView;
+class QueryParams;
 
 }
 
 namespace db {
 
 class InterpreterContext;
+class CompiledQuery;
+class PlanCache;
 
 class QueryInterpreterV2 {
 public:
     QueryInterpreterV2(db::SystemManager* sysMan,
-                       db::JobSystem* jobSystem);
+                       db::JobSystem* jobSystem,
+                       PlanCache* planCache = nullptr);
 
     ~QueryInterpreterV2();
 
@@ -29,6 +34,11 @@ public:
 private:
     SystemManager* _sysMan {nullptr};
     JobSystem* _jobSystem {nullptr};
+    PlanCache* _planCache {nullptr};
+
+    db::QueryStatus compile(CompiledQuery& compiled,
+                            const GraphView& view,
+                            const QueryParams* params);
 };
 
 }
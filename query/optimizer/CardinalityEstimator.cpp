@@ -0,0 +1,189 @@
+#include "CardinalityEstimator.h"
+
+#include <algorithm>
+
+#include "Predicate.h"
+#include "nodes/FilterNode.h"
+#include "decl/VarDecl.h"
+#include "expr/BinaryExpr.h"
+#include "expr/PropertyExpr.h"
+#include "expr/UnaryExpr.h"
+#include "statistics/GraphStatistics.h"
+#include "views/GraphView.h"
+#include "metadata/GraphMetadata.h"
+
+using namespace db;
+
+namespace {
+
+// Selectivities used when the statistics can not tell
+constexpr double DEFAULT_EQUALITY_SELECTIVITY = 0.1;
+constexpr double DEFAULT_RANGE_SELECTIVITY = 1.0 / 3.0;
+constexpr double DEFAULT_STRING_SELECTIVITY = 0.1;
+constexpr double DEFAULT_SELECTIVITY = 0.5;
+
+}
+
+CardinalityEstimator::CardinalityEstimator(const GraphView& view)
+    : _metadata(view.metadata()),
+    _statistics(view.statistics())
+{
+}
+
+CardinalityEstimator::~CardinalityEstimator() {
+}
+
+double CardinalityEstimator::nodeCount(const LabelSet& labels) const {
+    if (!_statistics) {
+        return 0;
+    }
+
+    if (labels.empty()) {
+        return (double)_statistics->nodeCount();
+    }
+
+    uint64_t count = 0;
+    for (const auto& [labelset, labelsetCount] : _statistics->nodeCounts()) {
+        if (hasLabels(labelset, labels)) {
+            count += labelsetCount;
+        }
+    }
+
+    return (double)count;
+}
+
+double CardinalityEstimator::edgeCount(const LabelSet& sourceLabels,
+                                       std::span<const EdgeTypeID> edgeTypes,
+                                       const LabelSet& targetLabels) const {
+    if (!_statistics) {
+        return 0;
+    }
+
+    if (sourceLabels.empty() && edgeTypes.empty() && targetLabels.empty()) {
+        return (double)_statistics->edgeCount();
+    }
+
+    uint64_t count = 0;
+    for (const auto& [key, patternCount] : _statistics->edgeCounts()) {
+        if (!edgeTypes.empty()
+            && std::find(edgeTypes.begin(), edgeTypes.end(), key._edgeType) == edgeTypes.end()) {
+            continue;
+        }
+
+        if (!hasLabels(key._sourceLabelSet, sourceLabels)
+            || !hasLabels(key._targetLabelSet, targetLabels)) {
+            continue;
+        }
+
+        count += patternCount;
+    }
+
+    return (double)count;
+}
+
+double CardinalityEstimator::selectivity(const FilterNode* filter) const {
+    double selectivity = 1.0;
+    for (const Predicate* pred : filter->getPredicates()) {
+        selectivity *= exprSelectivity(pred->getExpr());
+    }
+
+    return selectivity;
+}
+
+bool CardinalityEstimator::hasLabels(LabelSetID labelset, const LabelSet& labels) const {
+    if (labels.empty()) {
+        return true;
+    }
+
+    // Edges to nodes of unknown labelsets have an invalid labelset
+    const auto handle = _metadata.labelsets().getValue(labelset);
+    if (!handle) {
+        return false;
+    }
+
+    return handle->hasAtLeastLabels(LabelSetHandle {labels});
+}
+
+double CardinalityEstimator::exprSelectivity(const Expr* expr) const {
+    switch (expr->getKind()) {
+        case Expr::Kind::BINARY: {
+            const auto* binary = static_cast<const BinaryExpr*>(expr);
+
+            switch (binary->getOperator()) {
+                case BinaryOperator::And: {
+                    return exprSelectivity(binary->getLHS()) * exprSelectivity(binary->getRHS());
+                }
+                case BinaryOperator::Or: {
+                    const double lhs = exprSelectivity(binary->getLHS());
+                    const double rhs = exprSelectivity(binary->getRHS());
+                    return lhs + rhs - lhs * rhs;
+                }
+                case BinaryOperator::Xor: {
+                    const double lhs = exprSelectivity(binary->getLHS());
+                    const double rhs = exprSelectivity(binary->getRHS());
+                    return lhs + rhs - 2 * lhs * rhs;
+                }
+                case BinaryOperator::Equal: {
+                    return equalitySelectivity(binary->getLHS(), binary->getRHS());
+                }
+                case BinaryOperator::NotEqual: {
+                    return 1.0 - equalitySelectivity(binary->getLHS(), binary->getRHS());
+                }
+                case BinaryOperator::LessThan:
+                case BinaryOperator::GreaterThan:
+                case BinaryOperator::LessThanOrEqual:
+                case BinaryOperator::GreaterThanOrEqual: {
+                    return DEFAULT_RANGE_SELECTIVITY;
+                }
+                default: {
+                    return DEFAULT_SELECTIVITY;
+                }
+            }
+        }
+
+        case Expr::Kind::UNARY: {
+            const auto* unary = static_cast<const UnaryExpr*>(expr);
+            if (unary->getOperator() == UnaryOperator::Not) {
+                return 1.0 - exprSelectivity(unary->getSubExpr());
+            }
+
+            return DEFAULT_SELECTIVITY;
+        }
+
+        case Expr::Kind::STRING: {
+            return DEFAULT_STRING_SELECTIVITY;
+        }
+
+        default: {
+            return DEFAULT_SELECTIVITY;
+        }
+    }
+}
+
+double CardinalityEstimator::equalitySelectivity(const Expr* lhs, const Expr* rhs) const {
+    const Expr* propExpr = lhs->getKind() == Expr::Kind::PROPERTY ? lhs : rhs;
+    if (propExpr->getKind() != Expr::Kind::PROPERTY || !_statistics) {
+        return DEFAULT_EQUALITY_SELECTIVITY;
+    }
+
+    const auto* prop = static_cast<const PropertyExpr*>(propExpr);
+    const auto propType = _metadata.propTypes().get(prop->getPropName());
+    if (!propType) {
+        // Unknown properties are null everywhere
+        return 0;
+    }
+
+    const bool isNode = prop->getEntityVarDecl()->getType() == EvaluatedType::NodePattern;
+    const PropertyStatistics* propStats = isNode
+                                            ? _statistics->getNodeProperty(propType->_id)
+                                            : _statistics->getEdgeProperty(propType->_id);
+    if (!propStats || propStats->distinctCount() == 0) {
+        return DEFAULT_EQUALITY_SELECTIVITY;
+    }
+
+    const double nullFraction = isNode
+                                  ? _statistics->getNodePropertyNullFraction(propType->_id)
+                                  : _statistics->getEdgePropertyNullFraction(propType->_id);
+
+    return (1.0 - nullFraction) / (double)propStats->distinctCount();
+}
@@ -0,0 +1,56 @@
+#pragma once
+
+#include <memory>
+#include <span>
+
+#include "ID.h"
+#include "metadata/LabelSet.h"
+
+namespace db {
+
+class Expr;
+class FilterNode;
+class GraphMetadata;
+class GraphStatistics;
+class GraphView;
+
+/**
+ * @brief Estimates the number of rows produced by the plan graph nodes
+ * from the statistics of the graph.
+ *
+ * @detail Labels, edge types and predicates are assumed to be independent,
+ * except for the labels of the endpoints of the edges which are known
+ * exactly from the statistics. Without statistics, the estimates are zero.
+ */
+class CardinalityEstimator {
+public:
+    explicit CardinalityEstimator(const GraphView& view);
+    ~CardinalityEstimator();
+
+    CardinalityEstimator(const CardinalityEstimator&) = delete;
+    CardinalityEstimator(CardinalityEstimator&&) = delete;
+    CardinalityEstimator& operator=(const CardinalityEstimator&) = delete;
+    CardinalityEstimator& operator=(CardinalityEstimator&&) = delete;
+
+    // Number of nodes having at least the given labels
+    [[nodiscard]] double nodeCount(const LabelSet& labels) const;
+
+    // Number of edges of one of the given types (any type if empty) from nodes
+    // having at least the source labels to nodes having at least the target labels
+    [[nodiscard]] double edgeCount(const LabelSet& sourceLabels,
+                                   std::span<const EdgeTypeID> edgeTypes,
+                                   const LabelSet& targetLabels) const;
+
+    // Fraction of the entities passing the predicates of the filter
+    [[nodiscard]] double selectivity(const FilterNode* filter) const;
+
+private:
+    const GraphMetadata& _metadata;
+    std::shared_ptr<const GraphStatistics> _statistics;
+
+    [[nodiscard]] bool hasLabels(LabelSetID labelset, const LabelSet& labels) const;
+    [[nodiscard]] double exprSelectivity(const Expr* expr) const;
+    [[nodiscard]] double equalitySelectivity(const Expr* lhs, const Expr* rhs) const;
+};
+
+}
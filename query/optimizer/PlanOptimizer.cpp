@@ -1,14 +1,308 @@
 #include "PlanOptimizer.h"
 
+#include <algorithm>
+#include <optional>
+#include <unordered_map>
+#include <unordered_set>
+
+#include "CardinalityEstimator.h"
 #include "PlanGraph.h"
+#include "Predicate.h"
+#include "expr/BinaryExpr.h"
+#include "expr/PropertyExpr.h"
+#include "metadata/GraphMetadata.h"
+#include "views/GraphView.h"
+#include "nodes/AggregateEvalNode.h"
 #include "nodes/ScanNodesNode.h"
 #include "nodes/FilterNode.h"
+#include "nodes/GetEdgesNode.h"
+#include "nodes/GetEntityTypeNode.h"
+#include "nodes/GetInEdgesNode.h"
+#include "nodes/GetOutEdgesNode.h"
+#include "nodes/GetPropertyWithNullNode.h"
+#include "nodes/JoinNode.h"
 #include "nodes/ScanNodesByLabelNode.h"
+#include "nodes/VarNode.h"
 
 using namespace db;
 
-PlanOptimizer::PlanOptimizer(PlanGraph* plan)
-    : _plan(plan)
+namespace db {
+
+// Property reads, filter and var of an entity of a pattern element
+struct PatternSegment {
+    std::vector<PlanGraphNode*> _nodes;
+
+    FilterNode* filter() const {
+        return static_cast<FilterNode*>(_nodes[_nodes.size() - 2]);
+    }
+
+    VarNode* var() const {
+        return static_cast<VarNode*>(_nodes.back());
+    }
+};
+
+struct PatternStep {
+    PlanGraphNode* _expansion {nullptr};
+    PatternSegment _edge;
+    PlanGraphNode* _target {nullptr};
+    PatternSegment _node;
+};
+
+// Linear chain of a pattern element, from the scan to the var of its last node
+struct PatternChain {
+    ScanNodesNode* _scan {nullptr};
+    PatternSegment _origin;
+    std::vector<PatternStep> _steps;
+
+    VarNode* tail() const {
+        return _steps.back()._node.var();
+    }
+};
+
+}
+
+namespace {
+
+// Rows of the stream produced by a node
+struct StreamEstimate {
+    double _rows {0};
+
+    // Labels of the nodes of the stream, or of the source nodes of an expansion
+    LabelSet _labels;
+
+    // Set while the stream comes from the expansion of _sourceRows nodes
+    PlanGraphOpcode _expansion {PlanGraphOpcode::UNKNOWN};
+    double _sourceRows {0};
+    std::vector<EdgeTypeID> _edgeTypes;
+    double _edgeSelectivity {1};
+};
+
+// Optional expansions keep their source nodes, they can not be reversed
+bool isExpansion(const PlanGraphNode* node) {
+    switch (node->getOpcode()) {
+        case PlanGraphOpcode::GET_OUT_EDGES:
+        case PlanGraphOpcode::GET_IN_EDGES:
+        case PlanGraphOpcode::GET_EDGES:
+            return !static_cast<const EdgeExpansionNode*>(node)->isOptional();
+        default:
+            return false;
+    }
+}
+
+PlanGraphOpcode reverseExpansion(PlanGraphOpcode opcode) {
+    switch (opcode) {
+        case PlanGraphOpcode::GET_OUT_EDGES:
+            return PlanGraphOpcode::GET_IN_EDGES;
+        case PlanGraphOpcode::GET_IN_EDGES:
+            return PlanGraphOpcode::GET_OUT_EDGES;
+        default:
+            return opcode;
+    }
+}
+
+// Number of edges traversed by an expansion from the source labels to the target labels
+double expansionCount(const CardinalityEstimator& estimator,
+                      PlanGraphOpcode expansion,
+                      const LabelSet& sourceLabels,
+                      std::span<const EdgeTypeID> edgeTypes,
+                      const LabelSet& targetLabels) {
+    switch (expansion) {
+        case PlanGraphOpcode::GET_OUT_EDGES:
+            return estimator.edgeCount(sourceLabels, edgeTypes, targetLabels);
+        case PlanGraphOpcode::GET_IN_EDGES:
+            return estimator.edgeCount(targetLabels, edgeTypes, sourceLabels);
+        default:
+            return estimator.edgeCount(sourceLabels, edgeTypes, targetLabels)
+                 + estimator.edgeCount(targetLabels, edgeTypes, sourceLabels);
+    }
+}
+
+// Returns the successor of node if it is the only one and node is its only input
+PlanGraphNode* getChainSuccessor(const PlanGraphNode* node) {
+    if (node->outputs().size() != 1) {
+        return nullptr;
+    }
+
+    PlanGraphNode* next = node->outputs().front();
+    if (next->inputs().size() != 1) {
+        return nullptr;
+    }
+
+    return next;
+}
+
+const VarDecl* getReadEntityDecl(const PlanGraphNode* node) {
+    switch (node->getOpcode()) {
+        case PlanGraphOpcode::GET_PROPERTY_WITH_NULL:
+            return static_cast<const GetPropertyWithNullNode*>(node)->getEntityVarDecl();
+        case PlanGraphOpcode::GET_ENTITY_TYPE:
+            return static_cast<const GetEntityTypeNode*>(node)->getEntityVarDecl();
+        default:
+            return nullptr;
+    }
+}
+
+// Reads [GetPropertyWithNull|GetEntityType]* -> Filter -> Var starting at node.
+// The segment only depends on its own var, so it can be moved along the chain
+bool readSegment(PlanGraphNode* node, PlanGraphOpcode filterOpcode, PatternSegment& segment) {
+    while (node && getReadEntityDecl(node)) {
+        segment._nodes.push_back(node);
+        node = getChainSuccessor(node);
+    }
+
+    if (!node || node->getOpcode() != filterOpcode) {
+        return false;
+    }
+
+    FilterNode* filter = static_cast<FilterNode*>(node);
+    segment._nodes.push_back(filter);
+
+    node = getChainSuccessor(filter);
+    if (!node || node->getOpcode() != PlanGraphOpcode::VAR || filter->getVarNode() != node) {
+        return false;
+    }
+
+    VarNode* var = static_cast<VarNode*>(node);
+    segment._nodes.push_back(var);
+
+    for (const PlanGraphNode* read : segment._nodes) {
+        const VarDecl* decl = getReadEntityDecl(read);
+        if (decl && decl != var->getVarDecl()) {
+            return false;
+        }
+    }
+
+    for (const Predicate* pred : filter->getPredicates()) {
+        for (const auto& dep : pred->getDependencies().getVarDeps()) {
+            if (dep._var != var) {
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+std::optional<PatternChain> readChain(ScanNodesNode* scan) {
+    PatternChain chain;
+    chain._scan = scan;
+
+    if (!readSegment(getChainSuccessor(scan), PlanGraphOpcode::FILTER_NODE, chain._origin)) {
+        return std::nullopt;
+    }
+
+    VarNode* tail = chain._origin.var();
+
+    while (true) {
+        PlanGraphNode* expansion = getChainSuccessor(tail);
+        if (!expansion || !isExpansion(expansion)) {
+            break;
+        }
+
+        PatternStep step;
+        step._expansion = expansion;
+
+        if (!readSegment(getChainSuccessor(expansion), PlanGraphOpcode::FILTER_EDGE, step._edge)) {
+            break;
+        }
+
+        step._target = getChainSuccessor(step._edge.var());
+        if (!step._target || step._target->getOpcode() != PlanGraphOpcode::GET_EDGE_TARGET) {
+            break;
+        }
+
+        if (!readSegment(getChainSuccessor(step._target), PlanGraphOpcode::FILTER_NODE, step._node)) {
+            break;
+        }
+
+        tail = step._node.var();
+        chain._steps.push_back(std::move(step));
+    }
+
+    if (chain._steps.empty()) {
+        return std::nullopt;
+    }
+
+    return chain;
+}
+
+// Returns true if the successors of node only read the columns of the variables,
+// the stream entering them can then be changed without changing the results
+bool isStreamIndependent(const PlanGraphNode* node) {
+    switch (node->getOpcode()) {
+        case PlanGraphOpcode::PRODUCE_RESULTS:
+        case PlanGraphOpcode::WRITE:
+            return true;
+
+        case PlanGraphOpcode::JOIN: {
+            const auto* join = static_cast<const JoinNode*>(node);
+            if (join->getJoinType() != JoinType::COMMON_ANCESTOR
+                && join->getJoinType() != JoinType::PREDICATE) {
+                return false;
+            }
+        } break;
+
+        case PlanGraphOpcode::GET_PROPERTY_WITH_NULL:
+        case PlanGraphOpcode::GET_ENTITY_TYPE:
+        case PlanGraphOpcode::CARTESIAN_PRODUCT:
+        case PlanGraphOpcode::FUNC_EVAL:
+        case PlanGraphOpcode::AGGREGATE_EVAL:
+        case PlanGraphOpcode::DISTINCT:
+        case PlanGraphOpcode::ORDER_BY:
+        case PlanGraphOpcode::SKIP:
+        case PlanGraphOpcode::LIMIT:
+            break;
+
+        default:
+            return false;
+    }
+
+    return std::ranges::all_of(node->outputs(), isStreamIndependent);
+}
+
+// Collects the operands of a tree of cartesian products, the products are
+// collected with the root last
+void collectProductOperands(PlanGraphNode* product,
+                            std::vector<PlanGraphNode*>& products,
+                            std::vector<PlanGraphNode*>& operands) {
+    for (PlanGraphNode* input : product->inputs()) {
+        if (input->getOpcode() == PlanGraphOpcode::CARTESIAN_PRODUCT
+            && input->outputs().size() == 1) {
+            collectProductOperands(input, products, operands);
+        } else {
+            operands.push_back(input);
+        }
+    }
+
+    products.push_back(product);
+}
+
+// Collects the expression variables of the properties read upstream of node
+void collectReadProperties(const PlanGraphNode* node,
+                           std::unordered_set<const PlanGraphNode*>& visited,
+                           std::unordered_set<const VarDecl*>& properties) {
+    if (!visited.insert(node).second) {
+        return;
+    }
+
+    if (node->getOpcode() == PlanGraphOpcode::GET_PROPERTY_WITH_NULL) {
+        const auto* getProperty = static_cast<const GetPropertyWithNullNode*>(node);
+        if (const Expr* expr = getProperty->getExpr()) {
+            properties.insert(expr->getExprVarDecl());
+        }
+    }
+
+    for (const PlanGraphNode* input : node->inputs()) {
+        collectReadProperties(input, visited, properties);
+    }
+}
+
+}
+
+PlanOptimizer::PlanOptimizer(PlanGraph* plan, const GraphView& view)
+    : _plan(plan),
+    _metadata(view.metadata()),
+    _estimator(std::make_unique<CardinalityEstimator>(view))
 {
 }
 
@@ -18,9 +312,336 @@ PlanOptimizer::~PlanOptimizer() {
 void PlanOptimizer::optimize() {
     // Do some very simple plan rewriting
 
+    chooseTraversalDirections();
+
+    estimateCardinalities();
+    orderCartesianProducts();
+    rewriteValueJoins();
+
     rewriteScanByLabels();
 
     _plan->removeIsolatedNodes();
+
+    pushEdgeTypesIntoExpansions();
+
+    // Estimates of the final plan
+    estimateCardinalities();
+}
+
+void PlanOptimizer::chooseTraversalDirections() {
+    std::vector<PlanGraphNode*> roots;
+    _plan->getRoots(roots);
+
+    for (PlanGraphNode* root : roots) {
+        // === Check rewrite rule precondition ===
+        // We are looking for linear pattern chains:
+        // [root] ScanNodesNode --> Filter --> Var --> GetOutEdges --> ... --> Var
+        //
+        // A pipeline can not expand a chain on both sides of a node without a join,
+        // so the chain is anchored either on its first node or on its last one
+        ScanNodesNode* scanNodes = dynamic_cast<ScanNodesNode*>(root);
+        if (!scanNodes) {
+            continue;
+        }
+
+        std::optional<PatternChain> chain = readChain(scanNodes);
+        if (!chain) {
+            continue;
+        }
+
+        // The rest of the plan continues from the other end of the chain
+        if (!std::ranges::all_of(chain->tail()->outputs(), isStreamIndependent)) {
+            continue;
+        }
+
+        const double forwardCost = estimateChainCost(*chain, false);
+        const double reversedCost = estimateChainCost(*chain, true);
+        if (reversedCost >= forwardCost) {
+            continue;
+        }
+
+        // === Rewrite ===
+        reverseChain(*chain);
+    }
+}
+
+double PlanOptimizer::estimateChainCost(const PatternChain& chain, bool reversed) const {
+    const size_t stepCount = chain._steps.size();
+
+    const auto getSegment = [&](size_t i) -> const PatternSegment& {
+        return i == 0 ? chain._origin : chain._steps[i - 1]._node;
+    };
+
+    const auto getLabels = [&](size_t i) -> const LabelSet& {
+        return getSegment(i).filter()->asNodeFilter()->getLabelConstraints();
+    };
+
+    // Scanning the anchor
+    const size_t anchor = reversed ? stepCount : 0;
+    const NodeFilterNode* anchorFilter = getSegment(anchor).filter()->asNodeFilter();
+    const LabelSet& anchorLabels = anchorFilter->getLabelConstraints();
+
+    // Nodes are scanned by label if the filter has no predicates
+    const bool scanByLabel = anchorFilter->getPredicates().empty();
+    double cost = _estimator->nodeCount(scanByLabel ? anchorLabels : LabelSet {});
+    double rows = _estimator->nodeCount(anchorLabels) * _estimator->selectivity(anchorFilter);
+    cost += rows;
+
+    // Expanding towards the other end
+    for (size_t i = 0; i < stepCount; i++) {
+        const size_t stepIndex = reversed ? stepCount - 1 - i : i;
+        const PatternStep& step = chain._steps[stepIndex];
+
+        const size_t source = reversed ? stepIndex + 1 : stepIndex;
+        const size_t target = reversed ? stepIndex : stepIndex + 1;
+
+        const PlanGraphOpcode expansion = reversed
+                                            ? reverseExpansion(step._expansion->getOpcode())
+                                            : step._expansion->getOpcode();
+
+        const LabelSet& sourceLabels = getLabels(source);
+        const LabelSet& targetLabels = getLabels(target);
+        const EdgeFilterNode* edgeFilter = step._edge.filter()->asEdgeFilter();
+        const auto& edgeTypes = edgeFilter->getEdgeTypeConstraints();
+
+        const double sourceCount = std::max(_estimator->nodeCount(sourceLabels), 1.0);
+        const double edgeSelectivity = _estimator->selectivity(edgeFilter);
+        const double nodeSelectivity = _estimator->selectivity(getSegment(target).filter());
+
+        const double edgeRows = rows / sourceCount
+            * expansionCount(*_estimator, expansion, sourceLabels, {}, {});
+        const double filteredEdgeRows = rows / sourceCount * edgeSelectivity
+            * expansionCount(*_estimator, expansion, sourceLabels, edgeTypes, {});
+        const double targetRows = rows / sourceCount * edgeSelectivity * nodeSelectivity
+            * expansionCount(*_estimator, expansion, sourceLabels, edgeTypes, targetLabels);
+
+        // Expansion, edge filter, edge target and target filter
+        cost += edgeRows + 2 * filteredEdgeRows + targetRows;
+        rows = targetRows;
+    }
+
+    return cost;
+}
+
+void PlanOptimizer::reverseChain(PatternChain& chain) {
+    VarNode* oldTail = chain.tail();
+    VarNode* newTail = chain._origin.var();
+
+    std::vector<PlanGraphNode*> reversedChain;
+    reversedChain.push_back(chain._scan);
+
+    const auto appendSegment = [&](const PatternSegment& segment) {
+        reversedChain.insert(reversedChain.end(), segment._nodes.begin(), segment._nodes.end());
+    };
+
+    appendSegment(chain._steps.back()._node);
+
+    for (size_t i = chain._steps.size(); i-- > 0;) {
+        const PatternStep& step = chain._steps[i];
+
+        PlanGraphNode* expansion = nullptr;
+        switch (reverseExpansion(step._expansion->getOpcode())) {
+            case PlanGraphOpcode::GET_OUT_EDGES:
+                expansion = _plan->create<GetOutEdgesNode>();
+                break;
+            case PlanGraphOpcode::GET_IN_EDGES:
+                expansion = _plan->create<GetInEdgesNode>();
+                break;
+            default:
+                expansion = _plan->create<GetEdgesNode>();
+                break;
+        }
+
+        reversedChain.push_back(expansion);
+        appendSegment(step._edge);
+        reversedChain.push_back(step._target);
+        appendSegment(i == 0 ? chain._origin : chain._steps[i - 1]._node);
+    }
+
+    // Disconnect the chain, the former expansions become isolated
+    chain._scan->clearOutputs();
+    for (PlanGraphNode* node : chain._origin._nodes) {
+        node->clearOutputs();
+    }
+
+    for (const PatternStep& step : chain._steps) {
+        step._expansion->clearOutputs();
+        step._target->clearOutputs();
+
+        for (PlanGraphNode* node : step._edge._nodes) {
+            node->clearOutputs();
+        }
+
+        for (PlanGraphNode* node : step._node._nodes) {
+            if (node != oldTail) {
+                node->clearOutputs();
+            }
+        }
+    }
+
+    // The rest of the plan continues from the first node of the pattern
+    oldTail->moveOutputsTo(newTail);
+
+    for (size_t i = 1; i < reversedChain.size(); i++) {
+        reversedChain[i - 1]->connectOut(reversedChain[i]);
+    }
+}
+
+void PlanOptimizer::orderCartesianProducts() {
+    for (const auto& node : _plan->nodes()) {
+        // === Check rewrite rule precondition ===
+        // We are looking for the roots of trees of cartesian products.
+        // The stream of a cartesian product is the one of its first input,
+        // so we only reorder products followed by stream independent nodes
+        if (node->getOpcode() != PlanGraphOpcode::CARTESIAN_PRODUCT) {
+            continue;
+        }
+
+        const auto& outputs = node->outputs();
+        if (outputs.size() == 1 && outputs.front()->getOpcode() == PlanGraphOpcode::CARTESIAN_PRODUCT) {
+            continue;
+        }
+
+        if (!std::ranges::all_of(outputs, isStreamIndependent)) {
+            continue;
+        }
+
+        std::vector<PlanGraphNode*> products;
+        std::vector<PlanGraphNode*> operands;
+        collectProductOperands(node.get(), products, operands);
+
+        const bool canReorder = operands.size() == products.size() + 1
+            && std::ranges::all_of(operands, [](const PlanGraphNode* operand) {
+            return operand->hasEstimatedRows() && operand->outputs().size() == 1;
+        });
+
+        if (!canReorder) {
+            continue;
+        }
+
+        // Smallest operands first to keep the intermediate products small
+        std::vector<PlanGraphNode*> sortedOperands = operands;
+        std::ranges::stable_sort(sortedOperands, {}, &PlanGraphNode::getEstimatedRows);
+        if (sortedOperands == operands) {
+            continue;
+        }
+
+        // === Rewrite ===
+        for (PlanGraphNode* product : products) {
+            product->clearInputs();
+        }
+
+        sortedOperands[0]->connectOut(products[0]);
+        sortedOperands[1]->connectOut(products[0]);
+
+        for (size_t i = 1; i < products.size(); i++) {
+            products[i - 1]->connectOut(products[i]);
+            sortedOperands[i + 1]->connectOut(products[i]);
+        }
+    }
+}
+
+void PlanOptimizer::rewriteValueJoins() {
+    std::vector<PlanGraphNode*> products;
+    for (const auto& node : _plan->nodes()) {
+        if (node->getOpcode() == PlanGraphOpcode::CARTESIAN_PRODUCT) {
+            products.push_back(node.get());
+        }
+    }
+
+    for (PlanGraphNode* product : products) {
+        // === Check rewrite rule precondition ===
+        // We are looking for cartesian products followed by an equality
+        // between a property of each side:
+        // CartesianProduct --> Filter (lhs.x = rhs.y)
+        //
+        // The properties must be read before the product, on their side,
+        // and have the same type to be compared as join keys
+        const auto& inputs = product->inputs();
+        const auto& outputs = product->outputs();
+        if (inputs.size() != 2 || outputs.size() != 1) {
+            continue;
+        }
+
+        FilterNode* filter = dynamic_cast<FilterNode*>(outputs.front());
+        if (!filter || filter->inputs().size() != 1) {
+            continue;
+        }
+
+        PlanGraphNode* lhs = inputs[0];
+        PlanGraphNode* rhs = inputs[1];
+
+        std::unordered_set<const PlanGraphNode*> visited;
+        std::unordered_set<const VarDecl*> lhsProperties;
+        std::unordered_set<const VarDecl*> rhsProperties;
+        collectReadProperties(lhs, visited, lhsProperties);
+        visited.clear();
+        collectReadProperties(rhs, visited, rhsProperties);
+
+        const auto isJoinKey = [&](const PropertyExpr* key, const auto& sideProperties,
+                                   const auto& otherProperties) {
+            const VarDecl* decl = key->getExprVarDecl();
+            return sideProperties.contains(decl) && !otherProperties.contains(decl);
+        };
+
+        const Predicate* joinPred = nullptr;
+        const VarDecl* leftKey = nullptr;
+        const VarDecl* rightKey = nullptr;
+
+        for (const Predicate* pred : filter->getPredicates()) {
+            const Expr* expr = pred->getExpr();
+            if (expr->getKind() != Expr::Kind::BINARY) {
+                continue;
+            }
+
+            const auto* binary = static_cast<const BinaryExpr*>(expr);
+            if (binary->getOperator() != BinaryOperator::Equal
+                || binary->getLHS()->getKind() != Expr::Kind::PROPERTY
+                || binary->getRHS()->getKind() != Expr::Kind::PROPERTY) {
+                continue;
+            }
+
+            const auto* first = static_cast<const PropertyExpr*>(binary->getLHS());
+            const auto* second = static_cast<const PropertyExpr*>(binary->getRHS());
+
+            const auto firstType = _metadata.propTypes().get(first->getPropName());
+            const auto secondType = _metadata.propTypes().get(second->getPropName());
+            if (!firstType || !secondType || firstType->_valueType != secondType->_valueType) {
+                continue;
+            }
+
+            if (isJoinKey(first, lhsProperties, rhsProperties)
+                && isJoinKey(second, rhsProperties, lhsProperties)) {
+                leftKey = first->getExprVarDecl();
+                rightKey = second->getExprVarDecl();
+            } else if (isJoinKey(second, lhsProperties, rhsProperties)
+                       && isJoinKey(first, rhsProperties, lhsProperties)) {
+                leftKey = second->getExprVarDecl();
+                rightKey = first->getExprVarDecl();
+            } else {
+                continue;
+            }
+
+            joinPred = pred;
+            break;
+        }
+
+        if (!joinPred) {
+            continue;
+        }
+
+        // === Rewrite ===
+        // The join keeps the inputs and the stream of the product,
+        // the equality is evaluated by the join instead of the filter
+        JoinNode* join = _plan->create<JoinNode>(leftKey, rightKey, JoinType::PREDICATE);
+
+        product->clearInputs();
+        lhs->connectOut(join);
+        rhs->connectOut(join);
+        product->moveOutputsTo(join);
+
+        filter->removePredicate(joinPred);
+    }
 }
 
 void PlanOptimizer::rewriteScanByLabels() {
@@ -28,7 +649,7 @@ void PlanOptimizer::rewriteScanByLabels() {
     _plan->getRoots(roots);
 
     for (PlanGraphNode* root : roots) {
-        // === Check rewrite rule precondition === 
+        // === Check rewrite rule precondition ===
         // We are looking for pairs:
         // [root] ScanNodesNode --> NodeFilterNode (label, no predicates)
         //
@@ -36,7 +657,7 @@ void PlanOptimizer::rewriteScanByLabels() {
         ScanNodesNode* scanNodes = dynamic_cast<ScanNodesNode*>(root);
         if (!scanNodes) {
             continue;
-        } 
+        }
 
         const auto& scanNodesOutputs = scanNodes->outputs();
         if (scanNodesOutputs.size() != 1) {
@@ -53,9 +674,9 @@ void PlanOptimizer::rewriteScanByLabels() {
         if (labelset.empty() || !filterNode->getPredicates().empty()) {
             continue;
         }
-        
+
         // === Rewrite ===
-        
+
         // Create ScanNodesByLabel
         ScanNodesByLabelNode* scanNodesByLabel = _plan->create<ScanNodesByLabelNode>(labelset);
 
@@ -63,8 +684,230 @@ void PlanOptimizer::rewriteScanByLabels() {
         for (PlanGraphNode* filterNodeNext : filterNode->outputs()) {
             scanNodesByLabel->connectOut(filterNodeNext);
         }
-        
+
         scanNodes->clearOutputs();
         filterNode->clearOutputs();
     }
 }
+
+void PlanOptimizer::pushEdgeTypesIntoExpansions() {
+    for (const auto& node : _plan->nodes()) {
+        // === Check rewrite rule precondition ===
+        // We are looking for:
+        // GetOutEdges --> [GetPropertyWithNull|GetEntityType]* --> EdgeFilterNode (edge types)
+        //
+        // The expansion can then skip the edges of other types while iterating
+        // over the edges of each node, instead of writing them to be filtered
+        if (!isExpansion(node.get())) {
+            continue;
+        }
+
+        EdgeExpansionNode* expansion = static_cast<EdgeExpansionNode*>(node.get());
+        if (!expansion->getEdgeTypeConstraints().empty()) {
+            continue;
+        }
+
+        PlanGraphNode* next = getChainSuccessor(expansion);
+        while (next && getReadEntityDecl(next)) {
+            next = getChainSuccessor(next);
+        }
+
+        if (!next || next->getOpcode() != PlanGraphOpcode::FILTER_EDGE) {
+            continue;
+        }
+
+        EdgeFilterNode* edgeFilter = static_cast<EdgeFilterNode*>(next);
+        if (edgeFilter->getEdgeTypeConstraints().empty()) {
+            continue;
+        }
+
+        // === Rewrite ===
+        for (const EdgeTypeID edgeType : edgeFilter->getEdgeTypeConstraints()) {
+            expansion->addEdgeTypeConstraint(edgeType);
+        }
+
+        edgeFilter->clearEdgeTypeConstraints();
+    }
+}
+
+void PlanOptimizer::estimateCardinalities() {
+    const auto nodes = _plan->nodes();
+
+    // Visiting the nodes after all their inputs
+    std::unordered_map<const PlanGraphNode*, size_t> pendingInputs;
+    std::vector<PlanGraphNode*> ready;
+    for (const auto& node : nodes) {
+        node->setEstimatedRows(-1);
+        pendingInputs[node.get()] = node->inputs().size();
+        if (node->isRoot()) {
+            ready.push_back(node.get());
+        }
+    }
+
+    std::unordered_map<const PlanGraphNode*, StreamEstimate> estimates;
+    std::unordered_map<const VarDecl*, double> varRows;
+
+    const auto nodeCount = [&](const LabelSet& labels) {
+        return std::max(_estimator->nodeCount(labels), 1.0);
+    };
+
+    while (!ready.empty()) {
+        PlanGraphNode* node = ready.back();
+        ready.pop_back();
+
+        for (PlanGraphNode* output : node->outputs()) {
+            if (--pendingInputs.at(output) == 0) {
+                ready.push_back(output);
+            }
+        }
+
+        const auto& inputs = node->inputs();
+        const bool inputsEstimated = std::ranges::all_of(inputs, [&](const PlanGraphNode* input) {
+            return estimates.contains(input);
+        });
+
+        if (!inputsEstimated) {
+            continue;
+        }
+
+        StreamEstimate estimate;
+        if (!inputs.empty()) {
+            estimate = estimates.at(inputs.front());
+        }
+
+        switch (node->getOpcode()) {
+            case PlanGraphOpcode::SCAN_NODES: {
+                estimate._rows = _estimator->nodeCount({});
+            } break;
+
+            case PlanGraphOpcode::SCAN_NODES_BY_LABEL: {
+                const auto* scan = static_cast<const ScanNodesByLabelNode*>(node);
+                estimate._labels = scan->getLabelSet();
+                estimate._rows = _estimator->nodeCount(estimate._labels);
+            } break;
+
+            case PlanGraphOpcode::VAR: {
+                varRows[static_cast<const VarNode*>(node)->getVarDecl()] = estimate._rows;
+            } break;
+
+            case PlanGraphOpcode::GET_OUT_EDGES:
+            case PlanGraphOpcode::GET_IN_EDGES:
+            case PlanGraphOpcode::GET_EDGES: {
+                const auto* expansion = static_cast<const EdgeExpansionNode*>(node);
+                if (expansion->isOptional()) {
+                    // Every source node produces at least one row
+                    const double edgeRows = estimate._rows / nodeCount(estimate._labels)
+                        * expansionCount(*_estimator, node->getOpcode(), estimate._labels,
+                                         expansion->getEdgeTypeConstraints(), {});
+                    estimate._rows = std::max(edgeRows, estimate._rows);
+                    estimate._labels = {};
+                    estimate._expansion = PlanGraphOpcode::UNKNOWN;
+                    break;
+                }
+
+                estimate._expansion = node->getOpcode();
+                estimate._sourceRows = estimate._rows;
+                estimate._edgeTypes = expansion->getEdgeTypeConstraints();
+                estimate._edgeSelectivity = 1;
+                estimate._rows = estimate._sourceRows / nodeCount(estimate._labels)
+                    * expansionCount(*_estimator, estimate._expansion,
+                                     estimate._labels, estimate._edgeTypes, {});
+            } break;
+
+            case PlanGraphOpcode::FILTER_EDGE: {
+                const auto* filter = static_cast<const EdgeFilterNode*>(node);
+                const double selectivity = _estimator->selectivity(filter);
+
+                if (estimate._expansion == PlanGraphOpcode::UNKNOWN) {
+                    estimate._rows *= selectivity;
+                    break;
+                }
+
+                // Edge types pushed into the expansion are no longer on the filter
+                if (!filter->getEdgeTypeConstraints().empty()) {
+                    estimate._edgeTypes = filter->getEdgeTypeConstraints();
+                }
+
+                estimate._edgeSelectivity = selectivity;
+                estimate._rows = estimate._sourceRows / nodeCount(estimate._labels) * selectivity
+                    * expansionCount(*_estimator, estimate._expansion,
+                                     estimate._labels, estimate._edgeTypes, {});
+            } break;
+
+            case PlanGraphOpcode::FILTER_NODE: {
+                const auto* filter = static_cast<const NodeFilterNode*>(node);
+                const LabelSet& labels = filter->getLabelConstraints();
+                const double selectivity = _estimator->selectivity(filter);
+
+                if (estimate._expansion == PlanGraphOpcode::UNKNOWN) {
+                    LabelSet merged = estimate._labels;
+                    merged.merge(labels);
+
+                    estimate._rows *= _estimator->nodeCount(merged) / nodeCount(estimate._labels) * selectivity;
+                    estimate._labels = merged;
+                    break;
+                }
+
+                // Target nodes of an expansion
+                estimate._rows = estimate._sourceRows / nodeCount(estimate._labels)
+                    * estimate._edgeSelectivity * selectivity
+                    * expansionCount(*_estimator, estimate._expansion,
+                                     estimate._labels, estimate._edgeTypes, labels);
+                estimate._labels = labels;
+                estimate._expansion = PlanGraphOpcode::UNKNOWN;
+            } break;
+
+            case PlanGraphOpcode::AGGREGATE_EVAL: {
+                const auto* aggregate = static_cast<const AggregateEvalNode*>(node);
+                if (aggregate->getGroupByKeys().empty()) {
+                    estimate._rows = 1;
+                }
+            } break;
+
+            case PlanGraphOpcode::CARTESIAN_PRODUCT: {
+                if (inputs.size() != 2) {
+                    break;
+                }
+
+                // The stream is the one of the first input
+                const double rhsRows = estimates.at(inputs.back())._rows;
+                estimate._rows *= rhsRows;
+                estimate._sourceRows *= rhsRows;
+            } break;
+
+            case PlanGraphOpcode::JOIN: {
+                if (inputs.size() != 2) {
+                    break;
+                }
+
+                const auto* join = static_cast<const JoinNode*>(node);
+                const double lhsRows = estimate._rows;
+                const double rhsRows = estimates.at(inputs.back())._rows;
+
+                // Rows joined on a shared variable, on the streams otherwise
+                double keyCount = std::max(lhsRows, rhsRows);
+                if (join->getJoinType() == JoinType::COMMON_ANCESTOR) {
+                    const auto it = varRows.find(join->getLeftVarDecl());
+                    if (it != varRows.end()) {
+                        keyCount = it->second;
+                    }
+                }
+
+                estimate._rows = lhsRows * rhsRows / std::max(keyCount, 1.0);
+                if (lhsRows > 0) {
+                    estimate._sourceRows *= estimate._rows / lhsRows;
+                }
+            } break;
+
+            default: {
+                // Roots without statistics, such as procedures, are not estimated
+                if (inputs.empty()) {
+                    continue;
+                }
+            } break;
+        }
+
+        node->setEstimatedRows(estimate._rows);
+        estimates[node] = std::move(estimate);
+    }
+}
@@ -1,20 +1,36 @@
 #pragma once
 
+#include <memory>
+
 namespace db {
 
 class PlanGraph;
+class GraphView;
+class GraphMetadata;
+class CardinalityEstimator;
+struct PatternChain;
 
 class PlanOptimizer {
 public:
-    explicit PlanOptimizer(PlanGraph* plan);
+    PlanOptimizer(PlanGraph* plan, const GraphView& view);
     ~PlanOptimizer();
 
     void optimize();
 
 private:
     PlanGraph* _plan {nullptr};
+    const GraphMetadata& _metadata;
+    std::unique_ptr<CardinalityEstimator> _estimator;
 
+    void chooseTraversalDirections();
+    void orderCartesianProducts();
+    void rewriteValueJoins();
     void rewriteScanByLabels();
+    void pushEdgeTypesIntoExpansions();
+    void estimateCardinalities();
+
+    double estimateChainCost(const PatternChain& chain, bool reversed) const;
+    void reverseChain(PatternChain& chain);
 };
 
 }
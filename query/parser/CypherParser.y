@@ -126,6 +126,8 @@
 %token<std::string_view> CONTAINS
 %token<std::string_view> DISTINCT
 %token<std::string_view> EXTRACT
+%token<std::string_view> EXPLAIN
+%token<std::string_view> PROFILE
 %token<std::string_view> REQUIRE
 %token<std::string_view> COLLECT
 %token<std::string_view> CONNECT
@@ -205,7 +207,7 @@
 
 %token UNKNOWN
 
-%type<db::Literal*> numLit literal
+%type<db::Literal*> numLit literal parameter
 %type<db::BoolLiteral*> boolLit
 %type<db::StringLiteral*> stringLit
 %type<db::MapLiteral*> mapLit
@@ -325,6 +327,8 @@ queries
 
 query
     : singleQuery
+    | EXPLAIN singleQuery { $2->setExplainMode(QueryCommand::ExplainMode::EXPLAIN); }
+    | PROFILE singleQuery { $2->setExplainMode(QueryCommand::ExplainMode::PROFILE); }
     | singleQuery unionList { scanner.notImplemented(@$, "Query + Unions"); }
     ;
 
@@ -821,7 +825,7 @@ atomExpr
     | literal { $$ = LiteralExpr::create(ast, $1); LOC($$, @$); }
     | symbol { $$ = SymbolExpr::create(ast, $1); LOC($$, @$); }
 
-    | parameter { scanner.notImplemented(@$, "Parameters"); }
+    | parameter { $$ = LiteralExpr::create(ast, $1); LOC($$, @$); }
     | caseExpr { scanner.notImplemented(@$, "CASE"); }
     | countFunc { $$ = FunctionInvocationExpr::create(ast, $1); LOC($$, @$); }
     | listComprehension { scanner.notImplemented(@$, "List comprehensions"); }
@@ -920,8 +924,8 @@ edgeDetail
 
 edgeTypes
     : COLON name { $$ = SymbolChain::create(ast); $$->add($2); }
-    | edgeTypes PIPE name { scanner.notImplemented(@$, "EdgeType | EdgeType | ..."); }
-    | edgeTypes PIPE COLON name { scanner.notImplemented(@$, "EdgeType | EdgeType | ..."); }
+    | edgeTypes PIPE name { $$ = $1; $$->add($3); }
+    | edgeTypes PIPE COLON name { $$ = $1; $$->add($4); }
     ;
 
 unionSt
@@ -1086,7 +1090,15 @@ countFunc
         $$->setArguments($3);
         LOC($$, @$);
       }
-    | COUNT OPAREN DISTINCT exprChain CPAREN { scanner.notImplemented(@$, "count(DISTINCT)"); }
+    | COUNT OPAREN DISTINCT exprChain CPAREN {
+        Symbol* symbol = Symbol::create(ast, "count");
+        QualifiedName* name = QualifiedName::create(ast);
+        name->addName(symbol);
+        $$ = FunctionInvocation::create(ast, name);
+        $$->setArguments($4);
+        $$->setDistinct(true);
+        LOC($$, @$);
+      }
     | COUNT OBRACE patternWhere CBRACE { scanner.notImplemented(@$, "count(pattern WHERE)"); }
 
     // Here, returnSt is mandatory for MATCH subqueries, as opposed to Neo4j's Cypher parser
@@ -1110,8 +1122,8 @@ whenThen
     ;
 
 parameter
-    : DOLLAR symbol { scanner.notImplemented(@$, "Parameters"); }
-    | DOLLAR numLit { scanner.notImplemented(@$, "Parameters"); }
+    : DOLLAR symbol { $$ = ParameterLiteral::create(ast, $2->getName()); }
+    | DOLLAR numLit { scanner.notImplemented(@$, "Positional parameters"); }
     ;
 
 literal
@@ -1239,6 +1251,8 @@ reservedWord
     | CONTAINS { $$ = Symbol::create(ast, $1); }
     | DISTINCT { $$ = Symbol::create(ast, $1); }
     // | EXTRACT { $$ = Symbol::create(ast, $1); }
+    | EXPLAIN { $$ = Symbol::create(ast, $1); }
+    | PROFILE { $$ = Symbol::create(ast, $1); }
     | REQUIRE { $$ = Symbol::create(ast, $1); }
     | COLLECT { $$ = Symbol::create(ast, $1); }
     | SUBMIT { $$ = Symbol::create(ast, $1); }
@@ -1,21 +1,22 @@
 #include "PipelineBuffer.h"
 
-#include "dataframe/Dataframe.h"
-
 #include "PipelineV2.h"
 
 using namespace db;
 
 PipelineBuffer::PipelineBuffer()
-    : _dataframe(std::make_unique<Dataframe>())
 {
 }
 
 PipelineBuffer::~PipelineBuffer() {
 }
 
+void* PipelineBuffer::operator new(size_t size, PipelineV2* pipeline) {
+    return pipeline->allocObject(size);
+}
+
 PipelineBuffer* PipelineBuffer::create(PipelineV2* pipeline) {
-    PipelineBuffer* buffer = new PipelineBuffer();
+    PipelineBuffer* buffer = new (pipeline) PipelineBuffer();
     pipeline->addBuffer(buffer);
     return buffer;
 }
@@ -1,10 +1,8 @@
 #pragma once
 
-#include <memory>
+#include <stddef.h>
 
-namespace db {
-class Dataframe;
-}
+#include "dataframe/Dataframe.h"
 
 namespace db {
 
@@ -20,8 +18,8 @@ public:
 
     bool hasData() const { return _hasData; }
 
-    Dataframe* getDataframe() { return _dataframe.get(); }
-    const Dataframe* getDataframe() const { return _dataframe.get(); }
+    Dataframe* getDataframe() { return &_dataframe; }
+    const Dataframe* getDataframe() const { return &_dataframe; }
 
     void setSource(PipelinePort* source) { _source = source; }
     void setConsumer(PipelinePort* consumer) { _consumer = consumer; }
@@ -35,7 +33,11 @@ private:
     PipelinePort* _source {nullptr};
     PipelinePort* _consumer {nullptr};
     bool _hasData {false};
-    std::unique_ptr<Dataframe> _dataframe;
+    Dataframe _dataframe;
+
+    static void* operator new(size_t size, PipelineV2* pipeline);
+    static void operator delete(void*, PipelineV2*) {}
+    static void operator delete(void*) {}
 
     PipelineBuffer();
     ~PipelineBuffer();
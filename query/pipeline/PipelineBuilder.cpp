@@ -1,11 +1,14 @@
 #include "PipelineBuilder.h"
 
+#include <algorithm>
+
 #include "processors/CartesianProductProcessor.h"
 #include "processors/ChangeProcessor.h"
 #include "processors/CommitProcessor.h"
 #include "processors/DatabaseProcedureProcessor.h"
 #include "processors/ForkProcessor.h"
 #include "processors/HashJoinProcessor.h"
+#include "processors/ValueHashJoinProcessor.h"
 #include "processors/ExprProgram.h"
 #include "processors/ScanNodesProcessor.h"
 #include "processors/ScanNodesByLabelProcessor.h"
@@ -18,6 +21,7 @@
 #include "processors/GetPropertiesProcessor.h"
 #include "processors/GetPropertiesWithNullProcessor.h"
 #include "processors/SkipProcessor.h"
+#include "processors/DistinctProcessor.h"
 #include "processors/LimitProcessor.h"
 #include "processors/CountProcessor.h"
 #include "processors/WriteProcessor.h"
@@ -114,6 +118,33 @@ void createHashJoinDataFrameShape(LocalMemory* mem,
     auto* newNamedCol = NamedColumn::create(dfMan, newCol, joinColTag);
     dest->addColumn(newNamedCol);
 }
+
+// Sizes the first chunk of the processors streaming into a LIMIT to the rows
+// it needs, up to the first processor that consumes its whole input.
+// Writes consume their whole input, so nothing is limited after them
+void propagateRowLimit(LimitProcessor* limit, size_t rowLimit) {
+    const PipelineInputPort* input = limit->inputs().front();
+
+    while (const PipelineOutputPort* upstream = input->getConnectedPort()) {
+        Processor* proc = upstream->getProcessor();
+        if (dynamic_cast<CountProcessor*>(proc) || proc->hasSideEffectsUpstream()) {
+            break;
+        }
+
+        if (const auto* skip = dynamic_cast<SkipProcessor*>(proc)) {
+            rowLimit += skip->getSkipCount();
+        }
+
+        proc->setRowLimit(std::max<size_t>(rowLimit, 1));
+
+        if (proc->inputs().size() != 1) {
+            break;
+        }
+
+        input = proc->inputs().front();
+    }
+}
+
 }
 
 PipelineNodeOutputInterface& PipelineBuilder::addScanNodes() {
@@ -133,8 +164,13 @@ PipelineNodeOutputInterface& PipelineBuilder::addScanNodes() {
     return outNodeIDs;
 }
 
-PipelineEdgeOutputInterface& PipelineBuilder::addGetOutEdges() {
+PipelineEdgeOutputInterface& PipelineBuilder::addGetOutEdges(std::unique_ptr<OuterExpansion> outer,
+                                                             std::span<const EdgeTypeID> edgeTypes) {
     GetOutEdgesProcessor* getOutEdges = GetOutEdgesProcessor::create(_pipeline);
+    getOutEdges->setEdgeTypes(edgeTypes);
+    if (outer) {
+        getOutEdges->setOuterExpansion(std::move(outer));
+    }
 
     PipelineNodeInputInterface& input = getOutEdges->inNodeIDs();
     PipelineEdgeOutputInterface& output = getOutEdges->outEdges();
@@ -195,8 +231,13 @@ PipelineBlockOutputInterface& PipelineBuilder::addCartesianProduct(PipelineOutpu
     return output;
 }
 
-PipelineEdgeOutputInterface& PipelineBuilder::addGetInEdges() {
+PipelineEdgeOutputInterface& PipelineBuilder::addGetInEdges(std::unique_ptr<OuterExpansion> outer,
+                                                            std::span<const EdgeTypeID> edgeTypes) {
     GetInEdgesProcessor* getInEdges = GetInEdgesProcessor::create(_pipeline);
+    getInEdges->setEdgeTypes(edgeTypes);
+    if (outer) {
+        getInEdges->setOuterExpansion(std::move(outer));
+    }
 
     PipelineNodeInputInterface& input = getInEdges->inNodeIDs();
     PipelineEdgeOutputInterface& output = getInEdges->outEdges();
@@ -225,8 +266,13 @@ PipelineEdgeOutputInterface& PipelineBuilder::addGetInEdges() {
     return output;
 }
 
-PipelineEdgeOutputInterface& PipelineBuilder::addGetEdges() {
+PipelineEdgeOutputInterface& PipelineBuilder::addGetEdges(std::unique_ptr<OuterExpansion> outer,
+                                                          std::span<const EdgeTypeID> edgeTypes) {
     GetEdgesProcessor* getEdges = GetEdgesProcessor::create(_pipeline);
+    getEdges->setEdgeTypes(edgeTypes);
+    if (outer) {
+        getEdges->setOuterExpansion(std::move(outer));
+    }
 
     PipelineNodeInputInterface& input = getEdges->inNodeIDs();
     PipelineEdgeOutputInterface& output = getEdges->outEdges();
@@ -293,6 +339,21 @@ void PipelineBuilder::addLambda(const LambdaProcessor::Callback& callback) {
     _pendingOutput.updateInterface(nullptr);
 }
 
+PipelineBlockOutputInterface& PipelineBuilder::addDistinct(std::vector<ColumnTag> keys) {
+    DistinctProcessor* distinct = DistinctProcessor::create(_pipeline, std::move(keys));
+
+    auto& input = distinct->input();
+    auto& output = distinct->output();
+
+    _pendingOutput.connectTo(input);
+    output.setStream(input.getStream());
+    duplicateDataframeShape(_mem, _dfMan, input.getDataframe(), output.getDataframe());
+
+    _pendingOutput.updateInterface(&output);
+
+    return distinct->output();
+}
+
 PipelineBlockOutputInterface& PipelineBuilder::addSkip(size_t count) {
     SkipProcessor* skip = SkipProcessor::create(_pipeline, count);
 
@@ -318,6 +379,8 @@ PipelineBlockOutputInterface& PipelineBuilder::addLimit(size_t count) {
     output.setStream(input.getStream());
     duplicateDataframeShape(_mem, _dfMan, input.getDataframe(), output.getDataframe());
 
+    propagateRowLimit(limit, count);
+
     _pendingOutput.updateInterface(&output);
 
     return limit->output();
@@ -394,6 +457,38 @@ PipelineBlockOutputInterface& PipelineBuilder::addHashJoin(PipelineOutputInterfa
     return outInterface;
 }
 
+PipelineBlockOutputInterface& PipelineBuilder::addValueHashJoin(PipelineOutputInterface* rhs,
+                                                                ColumnTag leftJoinKey,
+                                                                ColumnTag rightJoinKey) {
+    ValueHashJoinProcessor* join = ValueHashJoinProcessor::create(_pipeline,
+                                                                  leftJoinKey,
+                                                                  rightJoinKey);
+
+    // LHS is implict in @ref _pendingOutput
+    _pendingOutput.connectTo(join->leftHandSide());
+    rhs->connectTo(join->rightHandSide());
+
+    PipelineBlockOutputInterface& output = join->output();
+    Dataframe* outDf = output.getDataframe();
+
+    Dataframe* leftDf = join->leftHandSide().getDataframe();
+    Dataframe* rightDf = join->rightHandSide().getDataframe();
+
+    // The output DF has the columns of both inputs, as for CartesianProduct
+    duplicateDataframeShape(_mem, _dfMan, leftDf, outDf);
+    concatDataframeShape(_mem, _dfMan, rightDf, outDf);
+
+    // Stream does not change when joining on values
+    output.setStream(_pendingOutput.getInterface()->getStream());
+    _pendingOutput.updateInterface(&output);
+
+    // Initialise the processor's "memory" stores for left and right ports
+    duplicateDataframeShape(_mem, _dfMan, leftDf, &join->leftMemory());
+    duplicateDataframeShape(_mem, _dfMan, rightDf, &join->rightMemory());
+
+    return output;
+}
+
 PipelineBlockOutputInterface& PipelineBuilder::addLambdaSource(const LambdaSourceProcessor::Callback& callback) {
     LambdaSourceProcessor* source = LambdaSourceProcessor::create(_pipeline, callback);
     _pendingOutput.updateInterface(&source->output());
@@ -401,14 +496,32 @@ PipelineBlockOutputInterface& PipelineBuilder::addLambdaSource(const LambdaSourc
 }
 
 PipelineBlockOutputInterface& PipelineBuilder::addDatabaseProcedure(const ProcedureBlueprint& blueprint,
-                                                                    std::span<ProcedureBlueprint::YieldItem> yield) {
-    DatabaseProcedureProcessor* proc = DatabaseProcedureProcessor::create(_pipeline, blueprint);
+                                                                    std::span<ProcedureBlueprint::YieldItem> yield,
+                                                                    std::vector<QueryParams::Value>&& args,
+                                                                    ColumnTag inputNodeIDs) {
+    DatabaseProcedureProcessor* proc = DatabaseProcedureProcessor::create(_pipeline,
+                                                                          blueprint,
+                                                                          std::move(args),
+                                                                          inputNodeIDs);
     auto& output = proc->output();
 
+    if (proc->hasInput()) {
+        _pendingOutput.connectTo(proc->input());
+    }
+
     _pendingOutput.updateInterface(&output);
 
     proc->allocColumns(*_mem, *_dfMan, yield);
 
+    // Yielded nodes can be expanded by the next processors
+    for (const auto& item : yield) {
+        const size_t index = blueprint.getReturnValueIndex(item._baseName);
+        if (item._col && blueprint.getReturnValueType(index) == ProcedureReturnType::NODE) {
+            output.setStream(EntityOutputStream::createNodeStream(item._col->getTag()));
+            break;
+        }
+    }
+
     return output;
 }
 
@@ -1,13 +1,18 @@
 #pragma once
 
+#include <memory>
+#include <span>
 #include <string_view>
+#include <vector>
 
 #include "ChangeOp.h"
+#include "ID.h"
 #include "EntityType.h"
 #include "Path.h"
 #include "PipelineV2.h"
 #include "PendingOutputView.h"
 #include "procedures/ProcedureBlueprint.h"
+#include "QueryParams.h"
 
 #include "ProjectionItem.h"
 #include "dataframe/Dataframe.h"
@@ -20,6 +25,7 @@
 #include "interfaces/PipelineValueOutputInterface.h"
 
 #include "processors/LambdaProcessor.h"
+#include "processors/OuterExpansion.h"
 #include "processors/LambdaSourceProcessor.h"
 #include "processors/LambdaTransformProcessor.h"
 #include "processors/WriteProcessor.h"
@@ -61,17 +67,23 @@ public:
     PipelineNodeOutputInterface& addScanNodesByLabel(const LabelSet* labelset);
     PipelineBlockOutputInterface& addLambdaSource(const LambdaSourceProcessor::Callback& callback);
     PipelineBlockOutputInterface& addDatabaseProcedure(const ProcedureBlueprint& blueprint,
-                                                       std::span<ProcedureBlueprint::YieldItem> yield);
+                                                       std::span<ProcedureBlueprint::YieldItem> yield,
+                                                       std::vector<QueryParams::Value>&& args,
+                                                       ColumnTag inputNodeIDs = ColumnTag {});
     PipelineBlockOutputInterface& addChangeOp(ChangeOp op);
     PipelineBlockOutputInterface& addCommit();
 
     PipelineValuesOutputInterface& addGetLabelSetID();
     PipelineValuesOutputInterface& addGetEdgeTypeID();
 
-    // Get edges
-    PipelineEdgeOutputInterface& addGetOutEdges();
-    PipelineEdgeOutputInterface& addGetInEdges();
-    PipelineEdgeOutputInterface& addGetEdges();
+    // Get the edges of edgeTypes (all if empty), optional expansions
+    // (with an outer expansion) keep the nodes without such edges
+    PipelineEdgeOutputInterface& addGetOutEdges(std::unique_ptr<OuterExpansion> outer = nullptr,
+                                                std::span<const EdgeTypeID> edgeTypes = {});
+    PipelineEdgeOutputInterface& addGetInEdges(std::unique_ptr<OuterExpansion> outer = nullptr,
+                                               std::span<const EdgeTypeID> edgeTypes = {});
+    PipelineEdgeOutputInterface& addGetEdges(std::unique_ptr<OuterExpansion> outer = nullptr,
+                                             std::span<const EdgeTypeID> edgeTypes = {});
 
     PipelineOutputInterface& projectEdgesOnOtherIDs() {
         _pendingOutput.projectEdgesOnOtherIDs();
@@ -120,8 +132,12 @@ public:
     PipelineBlockOutputInterface& addHashJoin(PipelineOutputInterface* rhs,
                                               ColumnTag leftJoinKey,
                                               ColumnTag rightJoinKey);
+    PipelineBlockOutputInterface& addValueHashJoin(PipelineOutputInterface* rhs,
+                                                   ColumnTag leftJoinKey,
+                                                   ColumnTag rightJoinKey);
 
     // Aggregations
+    PipelineBlockOutputInterface& addDistinct(std::vector<ColumnTag> keys);
     PipelineBlockOutputInterface& addSkip(size_t count);
     PipelineBlockOutputInterface& addLimit(size_t count);
     PipelineValueOutputInterface& addCount(ColumnTag colTag = ColumnTag {});
@@ -3,6 +3,7 @@
 #include "Processor.h"
 #include "PipelineV2.h"
 #include "PipelineBuffer.h"
+#include "PartIterator.h"
 
 using namespace db;
 
@@ -61,6 +62,12 @@ void PipelineExecutor::executeCycle() {
         Processor* currentProc = updateQueue.front();
         updateQueue.pop();
 
+        // Cancelled by a processor executed after it was scheduled
+        if (currentProc->isCancelled()) {
+            currentProc->setScheduled(false);
+            continue;
+        }
+
         if (!currentProc->isPrepared()) {
             currentProc->prepare(_ctxt);
         }
@@ -69,10 +76,14 @@ void PipelineExecutor::executeCycle() {
             currentProc->reset();
         }
 
-        currentProc->execute();
+        if (_profiling) {
+            executeProfiled(currentProc);
+        } else {
+            currentProc->execute();
+        }
 
         // If the processor is not finished in one step, add to the active queue
-        if (!currentProc->isFinished()) {
+        if (!currentProc->isFinished() && !currentProc->isCancelled()) {
             activeStack.push(currentProc);
         }
 
@@ -91,3 +102,48 @@ void PipelineExecutor::executeCycle() {
         }
     }
 }
+
+void PipelineExecutor::executeProfiled(Processor* proc) {
+    ProcessorProfile& profile = proc->getProfile();
+    const auto& inputs = proc->inputs();
+
+    // Rows waiting on each input, only the chunks consumed
+    // by this execution are counted as input rows
+    _pendingInputRows.clear();
+    for (const PipelineInputPort* input : inputs) {
+        if (input->hasData()) {
+            _pendingInputRows.push_back(input->getBuffer()->getDataframe()->getRowCount());
+        } else {
+            _pendingInputRows.push_back(std::nullopt);
+        }
+    }
+
+    const size_t visitedParts = PartIterator::getVisitedPartCount();
+    const auto start = Clock::now();
+
+    proc->execute();
+
+    profile._time += Clock::now() - start;
+    profile._dataparts += PartIterator::getVisitedPartCount() - visitedParts;
+    profile._executions++;
+
+    for (size_t i = 0; i < inputs.size(); i++) {
+        if (_pendingInputRows[i] && !inputs[i]->hasData()) {
+            profile._rowsIn += *_pendingInputRows[i];
+
+            // Sinks hand the chunks they consume over to the query callback
+            if (proc->isSink()) {
+                profile._rowsOut += *_pendingInputRows[i];
+                profile._chunks++;
+            }
+        }
+    }
+
+    // The outputs were all free before the execution
+    for (const PipelineOutputPort* output : proc->outputs()) {
+        if (output->hasData()) {
+            profile._rowsOut += output->getBuffer()->getDataframe()->getRowCount();
+            profile._chunks++;
+        }
+    }
+}
@@ -1,7 +1,9 @@
 #pragma once
 
+#include <optional>
 #include <queue>
 #include <stack>
+#include <vector>
 
 namespace db {
 
@@ -21,11 +23,18 @@ public:
     void init();
     void executeCycle();
 
+    // Collect the runtime counters of each processor, see ProcessorProfile
+    void setProfiling(bool profiling) { _profiling = profiling; }
+
 private:
     PipelineV2* _pipeline {nullptr};
     ExecutionContext* _ctxt {nullptr};
     std::stack<Processor*> _activeStack;
     std::queue<Processor*> _updateQueue;
+    bool _profiling {false};
+    std::vector<std::optional<size_t>> _pendingInputRows;
+
+    void executeProfiled(Processor* proc);
 };
 
 }
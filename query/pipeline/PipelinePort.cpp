@@ -5,18 +5,22 @@
 
 using namespace db;
 
+void* PipelinePort::operator new(size_t size, PipelineV2* pipeline) {
+    return pipeline->allocObject(size);
+}
+
 void PipelinePort::postCreate(PipelineV2* pipeline) {
     pipeline->addPort(this);
 }
 
 PipelineInputPort* PipelineInputPort::create(PipelineV2* pipeline, Processor* processor) {
-    PipelineInputPort* port = new PipelineInputPort(processor);
+    PipelineInputPort* port = new (pipeline) PipelineInputPort(processor);
     port->postCreate(pipeline);
     return port;
 }
 
 PipelineOutputPort* PipelineOutputPort::create(PipelineV2* pipeline, Processor* processor) {
-    PipelineOutputPort* port = new PipelineOutputPort(processor);
+    PipelineOutputPort* port = new (pipeline) PipelineOutputPort(processor);
 
     port->_buffer = PipelineBuffer::create(pipeline);
 
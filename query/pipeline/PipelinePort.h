@@ -1,5 +1,7 @@
 #pragma once
 
+#include <stddef.h>
+
 #include "PipelineBuffer.h"
 
 namespace db {
@@ -50,6 +52,10 @@ protected:
     bool _open {true};
     bool _needsData {true};
 
+    static void* operator new(size_t size, PipelineV2* pipeline);
+    static void operator delete(void*, PipelineV2*) {}
+    static void operator delete(void*) {}
+
     explicit PipelinePort(Processor* processor)
         : _processor(processor)
     {
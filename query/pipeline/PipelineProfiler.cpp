@@ -0,0 +1,94 @@
+#include "PipelineProfiler.h"
+
+#include <unordered_set>
+
+#include "PipelineV2.h"
+#include "PipelineBuffer.h"
+#include "Processor.h"
+#include "QueryProfile.h"
+#include "dataframe/Dataframe.h"
+#include "dataframe/NamedColumn.h"
+#include "columns/Column.h"
+
+using namespace db;
+
+namespace {
+
+using VisitedSet = std::unordered_set<const Processor*>;
+
+std::string getOperatorName(const Processor* proc) {
+    // Drop the address from the description
+    std::string name = proc->describe();
+    if (const size_t pos = name.find(" @="); pos != std::string::npos) {
+        name.resize(pos);
+    }
+
+    return name;
+}
+
+// Bytes allocated in the local memory for the output chunks of the processor
+size_t getOutputBytes(const Processor* proc) {
+    size_t bytes = 0;
+    for (const PipelineOutputPort* output : proc->outputs()) {
+        for (const NamedColumn* col : output->getBuffer()->getDataframe()->cols()) {
+            bytes += col->getColumn()->getAllocatedBytes();
+        }
+    }
+
+    return bytes;
+}
+
+size_t addOperator(const Processor* proc,
+                   size_t depth,
+                   VisitedSet& visited,
+                   QueryProfile& profile) {
+    visited.insert(proc);
+
+    const size_t index = profile.operators().size();
+    const ProcessorProfile& counters = proc->getProfile();
+
+    {
+        QueryProfile::Operator& op = profile.operators().emplace_back();
+        op._name = getOperatorName(proc);
+        op._depth = depth;
+        op._estimatedRows = counters._estimatedRows;
+        op._rowsIn = counters._rowsIn;
+        op._rowsOut = counters._rowsOut;
+        op._chunks = counters._chunks;
+        op._executions = counters._executions;
+        op._time = counters._time;
+        op._dataparts = counters._dataparts;
+        op._memoryBytes = profile.isExecuted() ? getOutputBytes(proc) : 0;
+    }
+
+    for (const PipelineInputPort* input : proc->inputs()) {
+        const PipelineOutputPort* connected = input->getConnectedPort();
+        if (!connected) {
+            continue;
+        }
+
+        const Processor* producer = connected->getProcessor();
+        if (visited.contains(producer)) {
+            continue;
+        }
+
+        const size_t child = addOperator(producer, depth + 1, visited, profile);
+
+        // The operators vector may have grown
+        profile.operators()[index]._children.push_back(child);
+    }
+
+    return index;
+}
+
+}
+
+void PipelineProfiler::buildProfile(const PipelineV2* pipeline, QueryProfile& profile) {
+    VisitedSet visited;
+
+    for (const Processor* proc : pipeline->processors()) {
+        if (proc->isSink() && !visited.contains(proc)) {
+            profile.roots().push_back(addOperator(proc, 0, visited, profile));
+        }
+    }
+}
@@ -0,0 +1,15 @@
+#pragma once
+
+namespace db {
+
+class PipelineV2;
+class QueryProfile;
+
+class PipelineProfiler {
+public:
+    // Operators of the pipeline with the counters collected by the
+    // PipelineExecutor, if it was executed with profiling enabled
+    static void buildProfile(const PipelineV2* pipeline, QueryProfile& profile);
+};
+
+}
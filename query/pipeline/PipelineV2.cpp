@@ -1,29 +1,63 @@
 #include "PipelineV2.h"
 
+#include <variant>
+
 #include "Processor.h"
 #include "PipelinePort.h"
 #include "PipelineBuffer.h"
 #include "processors/ExprProgram.h"
+#include "columns/ColumnConst.h"
+#include "metadata/PropertyType.h"
+#include "QueryParams.h"
+#include "Overloaded.h"
+
+#include "PipelineException.h"
 
 using namespace db;
 
+namespace {
+
+template <typename T>
+void setConstValue(Column* column, T value) {
+    auto* col = dynamic_cast<ColumnConst<T>*>(column);
+    if (!col) {
+        throw PipelineException("PipelineV2: parameter column has the wrong type");
+    }
+    col->set(value);
+}
+
+}
+
 PipelineV2::PipelineV2()
+    : PipelineV2(nullptr)
+{
+}
+
+PipelineV2::PipelineV2(Arena* arena)
+    : _arena(arena ? arena : &_localArena),
+    _arenaMark(_arena->mark()),
+    _dfMan(_arena)
 {
 }
 
 PipelineV2::~PipelineV2() {
+    // The objects were allocated in the arena, only their destructors
+    // are run here and the memory is given back with the arena
     for (Processor* processor : _processors) {
-        delete processor;
+        processor->~Processor();
     }
     for (PipelineBuffer* buffer : _buffers) {
-        delete buffer;
+        buffer->~PipelineBuffer();
     }
     for (PipelinePort* port : _ports) {
-        delete port;
+        port->~PipelinePort();
     }
     for (ExprProgram* prog : _exprProgs) {
-        delete prog;
+        prog->~ExprProgram();
     }
+
+    _dfMan.clear();
+    _arena->rewind(_arenaMark);
 }
 
 void PipelineV2::addProcessor(Processor* processor) {
@@ -50,5 +84,72 @@ void PipelineV2::clear() {
         processor->_prepared = false;
         processor->_finished = false;
         processor->_scheduled = false;
+        processor->_cancelled = false;
+        processor->_wroteFirstChunk = false;
+    }
+}
+
+void PipelineV2::reset() {
+    // Processors restore their execution state in prepare
+    clear();
+
+    for (PipelinePort* port : _ports) {
+        port->_open = true;
+    }
+
+    for (PipelineBuffer* buffer : _buffers) {
+        buffer->_hasData = false;
+    }
+}
+
+void PipelineV2::addParameter(std::string_view name, size_t typeIndex, Column* column) {
+    _params.emplace_back(std::string(name), typeIndex, column);
+}
+
+void PipelineV2::addBuildParameter(std::string_view name, const QueryParams::Value& value) {
+    _buildParams.emplace_back(std::string(name), value);
+}
+
+void PipelineV2::bindParameters(const QueryParams& params) {
+    // Their value is baked in the processors, a new pipeline must be generated
+    for (const auto& [name, buildValue] : _buildParams) {
+        const QueryParams::Value* value = params.get(name);
+        if (!value || *value != buildValue) {
+            throw PipelineException("PipelineV2: parameter $" + name
+                                    + " is read when building the pipeline, it can not be rebound");
+        }
+    }
+
+    for (const Parameter& param : _params) {
+        const QueryParams::Value* value = params.get(param._name);
+        if (!value) {
+            throw PipelineException("PipelineV2: parameter $" + param._name + " is not bound");
+        }
+
+        // The type of a parameter is part of the plan
+        if (value->index() != param._typeIndex) {
+            throw PipelineException("PipelineV2: parameter $" + param._name
+                                    + " has changed type");
+        }
+
+        Column* column = param._column;
+        std::visit(Overloaded {
+            [&](const QueryParams::Null&) {},
+            [&](bool v) {
+                setConstValue<types::Bool::Primitive>(column, v);
+            },
+            [&](int64_t v) {
+                setConstValue<types::Int64::Primitive>(column, v);
+            },
+            [&](double v) {
+                setConstValue<types::Double::Primitive>(column, v);
+            },
+            // The string is owned by the parameters, which outlive the execution
+            [&](const std::string& v) {
+                setConstValue<types::String::Primitive>(column, v);
+            },
+            // Only passed to procedures, which do not read them from columns
+            [&](const QueryParams::Vector&) {},
+        }, *value);
     }
 }
@@ -1,9 +1,14 @@
 #pragma once
 
 #include <vector>
+#include <string>
+#include <string_view>
 #include <unordered_set>
+#include <stddef.h>
 
 #include "dataframe/DataframeManager.h"
+#include "Arena.h"
+#include "QueryParams.h"
 
 namespace db {
 
@@ -12,7 +17,22 @@ class PipelinePort;
 class PipelineBuffer;
 class ExprProgram;
 class PredicateProgram;
+class Column;
 
+/**
+ * @brief Graph of processors connected by ports and buffers.
+ *
+ * @detail The processors, ports, buffers, expression programs and named columns
+ * of a pipeline are allocated in an arena and all released at once when the
+ * pipeline is destroyed. The arena can be shared across the queries of a
+ * thread, see LocalMemory::getPipelineArena, so that building a pipeline does
+ * not allocate once the arena is warm.
+ *
+ * A pipeline can be executed again after @ref reset, possibly with new values
+ * for the parameters of the query, see @ref bindParameters. Only the parameters
+ * held by constant columns can be rebound, the ones read when building the
+ * pipeline (LIMIT, SKIP, procedure arguments) must keep their value.
+ */
 class PipelineV2 {
 public:
     friend Processor;
@@ -27,8 +47,14 @@ public:
     using ExprPrograms = std::vector<ExprProgram*>;
 
     PipelineV2();
+    explicit PipelineV2(Arena* arena);
     ~PipelineV2();
 
+    PipelineV2(const PipelineV2&) = delete;
+    PipelineV2(PipelineV2&&) = delete;
+    PipelineV2& operator=(const PipelineV2&) = delete;
+    PipelineV2& operator=(PipelineV2&&) = delete;
+
     DataframeManager* getDataframeManager() { return &_dfMan; }
 
     const SourcesSet& sources() const { return _sources; }
@@ -37,14 +63,40 @@ public:
 
     void clear();
 
+    // Brings the pipeline back to its state before execution
+    void reset();
+
+    // Registers the constant column holding the value of a query parameter
+    void addParameter(std::string_view name, size_t typeIndex, Column* column);
+
+    // Registers a parameter read when building the pipeline, not held by a column
+    void addBuildParameter(std::string_view name, const QueryParams::Value& value);
+
+    // Writes new values in the parameter columns, the types must not change
+    // and the parameters read when building the pipeline must not change value
+    void bindParameters(const QueryParams& params);
+
 private:
+    struct Parameter {
+        std::string _name;
+        size_t _typeIndex {0};
+        Column* _column {nullptr};
+    };
+
+    Arena _localArena;
+    Arena* _arena {nullptr};
+    Arena::Mark _arenaMark;
     Processors _processors;
     Buffers _buffers;
     Ports _ports;
     SourcesSet _sources;
     ExprPrograms _exprProgs;
+    std::vector<Parameter> _params;
+    std::vector<std::pair<std::string, QueryParams::Value>> _buildParams;
     DataframeManager _dfMan;
 
+    void* allocObject(size_t size) { return _arena->alloc(size); }
+
     void addProcessor(Processor* processor);
     void addPort(PipelinePort* port);
     void addBuffer(PipelineBuffer* buffer);
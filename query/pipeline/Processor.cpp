@@ -1,9 +1,18 @@
 #include "Processor.h"
 
+#include <algorithm>
+
 #include "PipelineV2.h"
+#include "ExecutionContext.h"
+#include "iterators/ChunkConfig.h"
+#include "dataframe/Dataframe.h"
 
 using namespace db;
 
+void* Processor::operator new(size_t size, PipelineV2* pipeline) {
+    return pipeline->allocObject(size);
+}
+
 void Processor::postCreate(PipelineV2* pipeline) {
     pipeline->addProcessor(this);
 }
@@ -39,3 +48,87 @@ void Processor::closeOutputs() {
         output->close();
     }
 }
+
+bool Processor::hasSideEffectsUpstream() const {
+    if (hasSideEffects()) {
+        return true;
+    }
+
+    for (const PipelineInputPort* input : _inputs) {
+        const PipelineOutputPort* output = input->getConnectedPort();
+        if (output && output->getProcessor()->hasSideEffectsUpstream()) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void Processor::cancelInputs() {
+    for (PipelineInputPort* input : _inputs) {
+        PipelineOutputPort* output = input->getConnectedPort();
+
+        // The processors between a write and this processor keep streaming,
+        // otherwise the write would stop before the end of its input
+        if (output && output->getProcessor()->hasSideEffectsUpstream()) {
+            continue;
+        }
+
+        input->close();
+
+        if (output) {
+            output->getProcessor()->cancelIfUnused();
+        }
+    }
+}
+
+void Processor::cancelIfUnused() {
+    if (_cancelled) {
+        return;
+    }
+
+    // A processor with other open outputs, such as a fork, still has consumers
+    for (const PipelineOutputPort* output : _outputs) {
+        if (output->isOpen()) {
+            return;
+        }
+    }
+
+    _cancelled = true;
+    cancelInputs();
+}
+
+size_t Processor::getStageChunkSize() {
+    // The shape of the dataframes does not change once the pipeline is built
+    if (_rowBytes == 0) {
+        _rowBytes = std::max<size_t>(computeRowBytes(), 1);
+    }
+
+    return std::min(_ctxt->getChunkSize(), ChunkConfig::getChunkSize(_rowBytes));
+}
+
+size_t Processor::nextChunkSize() {
+    const size_t chunkSize = getStageChunkSize();
+    if (_rowLimit == 0 || _wroteFirstChunk) {
+        return chunkSize;
+    }
+
+    _wroteFirstChunk = true;
+    return std::min(chunkSize, _rowLimit);
+}
+
+size_t Processor::computeRowBytes() const {
+    // The rows written by the processor are carried by the processors downstream,
+    // which can add columns to them, until a processor with several outputs
+    size_t rowBytes = 0;
+    const Processor* proc = this;
+    while (proc && proc->_outputs.size() == 1) {
+        const PipelineOutputPort* output = proc->_outputs.front();
+        rowBytes = std::max(rowBytes, output->getBuffer()->getDataframe()->getRowBytes());
+
+        const PipelineInputPort* next = output->getConnectedPort();
+        proc = next ? next->getProcessor() : nullptr;
+    }
+
+    return rowBytes;
+}
@@ -2,8 +2,10 @@
 
 #include <vector>
 #include <string>
+#include <stddef.h>
 
 #include "PipelinePort.h"
+#include "TuringTime.h"
 
 namespace db {
 
@@ -11,6 +13,20 @@ class PipelineV2;
 class PipelinePort;
 class ExecutionContext;
 
+// Runtime counters of a processor, filled by the PipelineExecutor
+// when profiling is enabled
+struct ProcessorProfile {
+    size_t _rowsIn {0};
+    size_t _rowsOut {0};
+    size_t _chunks {0};
+    size_t _executions {0};
+    Milliseconds _time {0};
+    size_t _dataparts {0};
+
+    // Rows estimated by the planner for the plan node of the processor
+    double _estimatedRows {-1};
+};
+
 class Processor {
 public:
     friend PipelineV2;
@@ -28,6 +44,22 @@ public:
     bool isFinished() const { return _finished; }
     bool isPrepared() const { return _prepared; }
 
+    // A cancelled processor is never executed again, its consumers
+    // do not need its outputs anymore, see cancelInputs
+    bool isCancelled() const { return _cancelled; }
+
+    // Processors writing to the graph or to the files of the database
+    // have to consume all their input, a LIMIT can not cut them short
+    virtual bool hasSideEffects() const { return false; }
+
+    // Returns true if the processor or a processor upstream has side effects
+    bool hasSideEffectsUpstream() const;
+
+    // Upper bound on the rows needed downstream, set when the processor
+    // feeds a LIMIT. The first chunk written is sized to it, see nextChunkSize
+    void setRowLimit(size_t rowLimit) { _rowLimit = rowLimit; }
+    size_t getRowLimit() const { return _rowLimit; }
+
     virtual void prepare(ExecutionContext* ctxt) = 0;
     virtual void reset() = 0;
     virtual void execute() = 0;
@@ -35,10 +67,17 @@ public:
     bool isScheduled() const { return _scheduled; }
     void setScheduled(bool scheduled) { _scheduled = scheduled; }
 
+    ProcessorProfile& getProfile() { return _profile; }
+    const ProcessorProfile& getProfile() const { return _profile; }
+
     // Checks if the processor can execute
     // 1. All inputs have data (the processor has all the data it needs)
     // 2. All outputs are free (the processor can write its output)
     bool canExecute() const {
+        if (_cancelled) {
+            return false;
+        }
+
         for (const PipelineInputPort* input : _inputs) {
             if (!input->hasData() && input->needsData()) {
                 return false;
@@ -55,6 +94,11 @@ public:
     }
 
 protected:
+    // Processors live in the arena of their pipeline, see PipelineV2
+    static void* operator new(size_t size, PipelineV2* pipeline);
+    static void operator delete(void*, PipelineV2*) {}
+    static void operator delete(void*) {}
+
     Processor() = default;
     virtual ~Processor() = default;
     void postCreate(PipelineV2* pipeline);
@@ -64,6 +108,18 @@ protected:
     void markAsReset() { _finished = false; }
     void finish();
 
+    // Closes the inputs and cancels the processors upstream
+    // whose outputs are all closed. The inputs fed by processors
+    // with side effects are kept open, see hasSideEffects
+    void cancelInputs();
+
+    // Chunk size of the processor, the chunk size of the context bounded by
+    // the rows of the widest dataframe it streams into that fit in the L2 budget
+    size_t getStageChunkSize();
+
+    // Chunk size to fill by the chunk writers of the processor
+    size_t nextChunkSize();
+
     ExecutionContext* _ctxt {nullptr};
 
 private:
@@ -72,9 +128,16 @@ private:
     bool _scheduled {false};
     bool _finished {false};
     bool _prepared {false};
+    bool _cancelled {false};
+    bool _wroteFirstChunk {false};
+    size_t _rowLimit {0};
+    size_t _rowBytes {0};
+    ProcessorProfile _profile;
 
     bool checkInputsClosed() const;
     void closeOutputs();
+    void cancelIfUnused();
+    size_t computeRowBytes() const;
 };
 
 }
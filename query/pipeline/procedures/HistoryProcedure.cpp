@@ -50,6 +50,11 @@ void HistoryProcedure::execute(Procedure& proc) {
             return;
         }
 
+        case Procedure::Step::CONSUME: {
+            // Takes no node argument, never has an input
+            break;
+        }
+
         case Procedure::Step::EXECUTE: {
             size_t remaining = std::distance(data._it, _view.commits().end());
             remaining = std::min(remaining, ctxt->getChunkSize());
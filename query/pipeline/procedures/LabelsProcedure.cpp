@@ -38,6 +38,11 @@ void LabelsProcedure::execute(Procedure& proc) {
             return;
         }
 
+        case Procedure::Step::CONSUME: {
+            // Takes no node argument, never has an input
+            break;
+        }
+
         case Procedure::Step::EXECUTE: {
             data._it->fill(proc.ctxt()->getChunkSize());
 
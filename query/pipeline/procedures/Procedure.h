@@ -1,9 +1,13 @@
 #pragma once
 
 #include <memory>
+#include <variant>
+#include <vector>
 
 #include "ProcedureBlueprint.h"
 #include "ProcedureData.h"
+#include "columns/ColumnIDs.h"
+#include "QueryParams.h"
 
 #include "BioAssert.h"
 
@@ -16,6 +20,9 @@ public:
     enum class Step {
         PREPARE,
         RESET,
+        // Called for each chunk of the input of procedures taking a node
+        // argument, the procedure is executed once the input is consumed
+        CONSUME,
         EXECUTE,
     };
 
@@ -32,6 +39,17 @@ public:
     [[nodiscard]] Step step() const { return _step; }
     [[nodiscard]] const ExecutionContext* ctxt() const { return _ctxt; }
 
+    // Values of the arguments, resolved when the pipeline is generated
+    template <typename T>
+    [[nodiscard]] const T& getArgument(size_t i) const {
+        bioassert(i < _args.size(), "Procedure argument is out of range");
+        bioassert(std::holds_alternative<T>(_args[i]), "Procedure argument is not of the expected type");
+        return std::get<T>(_args[i]);
+    }
+
+    // Node IDs of the current input chunk, set in the CONSUME step
+    [[nodiscard]] const ColumnNodeIDs* getInputNodeIDs() const { return _inputNodeIDs; }
+
     void finish() { _finished = true; }
 
 private:
@@ -40,6 +58,8 @@ private:
     std::unique_ptr<ProcedureData> _data;
     const ProcedureBlueprint* _blueprint {nullptr};
     const ExecutionContext* _ctxt {nullptr};
+    std::vector<QueryParams::Value> _args;
+    const ColumnNodeIDs* _inputNodeIDs {nullptr};
     bool _finished {false};
     Step _step {};
 };
@@ -0,0 +1,74 @@
+#pragma once
+
+#include <string_view>
+#include <vector>
+
+#include "EnumToString.h"
+
+namespace db {
+
+enum class ProcedureArgumentType : uint8_t {
+    INVALID = 0,
+    NODE,
+    INT64,
+    DOUBLE,
+    STRING,
+    VECTOR,
+    _SIZE,
+};
+
+using ProcedureArgumentTypeName = EnumToString<ProcedureArgumentType>::Create<
+    EnumStringPair<ProcedureArgumentType::INVALID, "INVALID">,
+    EnumStringPair<ProcedureArgumentType::NODE, "NODE">,
+    EnumStringPair<ProcedureArgumentType::INT64, "INTEGER">,
+    EnumStringPair<ProcedureArgumentType::DOUBLE, "FLOAT">,
+    EnumStringPair<ProcedureArgumentType::STRING, "STRING">,
+    EnumStringPair<ProcedureArgumentType::VECTOR, "LIST<FLOAT>">>;
+
+struct ProcedureArgument {
+    std::string_view _name;
+    ProcedureArgumentType _type {};
+};
+
+class ProcedureArguments {
+public:
+    using Vector = std::vector<ProcedureArgument>;
+
+    ProcedureArguments() = default;
+    ~ProcedureArguments() = default;
+
+    ProcedureArguments(std::initializer_list<ProcedureArgument> arguments)
+        : _arguments(arguments)
+    {
+    }
+
+    ProcedureArguments(const ProcedureArguments&) = default;
+    ProcedureArguments(ProcedureArguments&&) noexcept = default;
+    ProcedureArguments& operator=(const ProcedureArguments&) = default;
+    ProcedureArguments& operator=(ProcedureArguments&&) noexcept = default;
+
+    [[nodiscard]] size_t size() const {
+        return _arguments.size();
+    }
+
+    [[nodiscard]] bool empty() const {
+        return _arguments.empty();
+    }
+
+    [[nodiscard]] const ProcedureArgument& operator[](size_t i) const {
+        return _arguments[i];
+    }
+
+    Vector::const_iterator begin() const {
+        return _arguments.begin();
+    }
+
+    Vector::const_iterator end() const {
+        return _arguments.end();
+    }
+
+private:
+    Vector _arguments;
+};
+
+}
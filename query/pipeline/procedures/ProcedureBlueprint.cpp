@@ -24,3 +24,34 @@ void ProcedureBlueprint::returnAll(std::vector<YieldItem>& yieldItems) const {
         yieldItems.emplace_back(item._name);
     }
 }
+
+void ProcedureBlueprint::buildSignature(std::string& result) const {
+    result.clear();
+    result += _name;
+    result += "(";
+
+    bool first = true;
+    for (const auto& arg : _arguments) {
+        if (!first) {
+            result += ", ";
+        }
+        result += arg._name;
+        result += " :: ";
+        result += ProcedureArgumentTypeName::value(arg._type);
+        first = false;
+    }
+
+    result += ") :: (";
+
+    first = true;
+    for (const auto& rv : _returnValues) {
+        if (!first) {
+            result += ", ";
+        }
+        result += rv._name;
+        result += " :: ";
+        result += ProcedureReturnTypeName::value(rv._type);
+        first = false;
+    }
+    result += ")";
+}
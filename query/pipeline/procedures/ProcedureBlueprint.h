@@ -1,9 +1,11 @@
 #pragma once
 
 #include <memory>
+#include <string>
 #include <vector>
 
 #include "ProcedureData.h"
+#include "procedures/ProcedureArguments.h"
 #include "procedures/ProcedureReturnValues.h"
 
 namespace db {
@@ -33,10 +35,14 @@ public:
 
     void returnAll(std::vector<YieldItem>& yieldItems) const;
 
+    // name(arg :: TYPE, ...) :: (returnValue :: TYPE, ...)
+    void buildSignature(std::string& result) const;
+
     std::string_view _name;
     ExecuteCallback _execCallback {nullptr};
     AllocCallback _allocCallback {nullptr};
     ProcedureReturnValues _returnValues;
+    ProcedureArguments _arguments;
 };
 
 }
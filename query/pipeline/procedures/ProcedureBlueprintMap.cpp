@@ -5,6 +5,8 @@
 #include "PropertyTypesProcedure.h"
 #include "HistoryProcedure.h"
 #include "ProceduresProcedure.h"
+#include "VectorSearchProcedure.h"
+#include "StatisticsProcedure.h"
 
 using namespace db;
 
@@ -21,6 +23,9 @@ std::unique_ptr<ProcedureBlueprintMap> ProcedureBlueprintMap::create() {
     map->_blueprints.emplace_back(EdgeTypesProcedure::createBlueprint());
     map->_blueprints.emplace_back(HistoryProcedure::createBlueprint());
     map->_blueprints.emplace_back(ProceduresProcedure::createBlueprint());
+    map->_blueprints.emplace_back(VectorSearchProcedure::createBlueprint());
+    map->_blueprints.emplace_back(VectorSearchProcedure::createCandidatesBlueprint());
+    map->_blueprints.emplace_back(StatisticsProcedure::createBlueprint());
 
     return map;
 }
@@ -34,3 +39,14 @@ const ProcedureBlueprint* ProcedureBlueprintMap::getBlueprint(const std::string_
 
     return nullptr;
 }
+
+const ProcedureBlueprint* ProcedureBlueprintMap::getBlueprint(const std::string_view& name,
+                                                              size_t argCount) const {
+    for (const auto& blueprint : _blueprints) {
+        if (blueprint._name == name && blueprint._arguments.size() == argCount) {
+            return &blueprint;
+        }
+    }
+
+    return nullptr;
+}
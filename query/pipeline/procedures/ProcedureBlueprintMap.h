@@ -21,6 +21,9 @@ public:
     static std::unique_ptr<ProcedureBlueprintMap> create();
 
     const ProcedureBlueprint* getBlueprint(const std::string_view& name) const;
+
+    // Procedures can be overloaded on their number of arguments
+    const ProcedureBlueprint* getBlueprint(const std::string_view& name, size_t argCount) const;
     const std::vector<ProcedureBlueprint>& getAll() const { return _blueprints; }
 
 private:
@@ -4,7 +4,6 @@
 #include "procedures/Procedure.h"
 #include "procedures/ProcedureBlueprintMap.h"
 #include "procedures/ProcedureBlueprint.h"
-#include "procedures/ProcedureReturnValues.h"
 #include "columns/ColumnVector.h"
 
 #include "PipelineException.h"
@@ -17,24 +16,6 @@ struct Data : public ProcedureData {
     std::vector<ProcedureBlueprint>::const_iterator _it;
 };
 
-void buildSignature(std::string& result, const ProcedureBlueprint& blueprint) {
-    result.clear();
-    result += blueprint._name;
-    result += "() :: (";
-
-    bool first = true;
-    for (const auto& rv : blueprint._returnValues) {
-        if (!first) {
-            result += ", ";
-        }
-        result += rv._name;
-        result += " :: ";
-        result += ProcedureReturnTypeName::value(rv._type);
-        first = false;
-    }
-    result += ")";
-}
-
 }
 
 std::unique_ptr<ProcedureData> ProceduresProcedure::allocData() {
@@ -63,6 +44,11 @@ void ProceduresProcedure::execute(Procedure& proc) {
             return;
         }
 
+        case Procedure::Step::CONSUME: {
+            // Takes no node argument, never has an input
+            break;
+        }
+
         case Procedure::Step::EXECUTE: {
             const auto& allBlueprints = blueprints->getAll();
             size_t remaining = std::distance(data._it, allBlueprints.end());
@@ -85,7 +71,7 @@ void ProceduresProcedure::execute(Procedure& proc) {
                 }
 
                 if (signatureCol) {
-                    buildSignature(signature, blueprint);
+                    blueprint.buildSignature(signature);
                     signatureCol->push_back(signature);
                 }
 
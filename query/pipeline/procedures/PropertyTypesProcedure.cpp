@@ -41,6 +41,11 @@ void PropertyTypesProcedure::execute(Procedure& proc) {
             return;
         }
 
+        case Procedure::Step::CONSUME: {
+            // Takes no node argument, never has an input
+            break;
+        }
+
         case Procedure::Step::EXECUTE: {
             data._it->fill(proc.ctxt()->getChunkSize());
 
@@ -0,0 +1,269 @@
+#include "StatisticsProcedure.h"
+
+#include <algorithm>
+
+#include "ExecutionContext.h"
+#include "procedures/Procedure.h"
+#include "columns/ColumnVector.h"
+#include "statistics/GraphStatistics.h"
+#include "views/GraphView.h"
+
+#include "PipelineException.h"
+
+using namespace db;
+
+namespace {
+
+struct Row {
+    std::string _kind;
+    std::string _entity;
+    uint64_t _count {0};
+    uint64_t _distinct {0};
+    double _nullFraction {0};
+    std::string _min;
+    std::string _max;
+};
+
+struct Data : public ProcedureData {
+    std::vector<Row> _rows;
+    size_t _pos {0};
+};
+
+std::string getLabelSetName(const GraphMetadata& metadata, LabelSetID labelsetID) {
+    const auto labelset = metadata.labelsets().getValue(labelsetID);
+    if (!labelset) {
+        return "?";
+    }
+
+    std::vector<LabelID> labels;
+    labelset->decompose(labels);
+
+    std::string name;
+    for (const LabelID label : labels) {
+        name += ":";
+        name += metadata.labels().getName(label).value_or("?");
+    }
+
+    return name;
+}
+
+std::string getEdgeTypeName(const GraphMetadata& metadata, EdgeTypeID edgeType) {
+    return std::string {metadata.edgeTypes().getName(edgeType).value_or("?")};
+}
+
+void addPropertyRows(std::vector<Row>& rows,
+                     const GraphMetadata& metadata,
+                     std::string_view kind,
+                     const GraphStatistics::PropertyStatisticsMap& properties,
+                     uint64_t entityCount) {
+    for (const auto& [ptID, stats] : properties) {
+        Row& row = rows.emplace_back();
+        row._kind = kind;
+        row._entity = metadata.propTypes().getName(ptID).value_or("?");
+        row._count = stats._count;
+        row._distinct = stats.distinctCount();
+        row._nullFraction = entityCount == 0
+                              ? 1.0
+                              : 1.0 - std::min(1.0, (double)stats._count / entityCount);
+
+        if (!stats._hasRange) {
+            continue;
+        }
+
+        if (stats._valueType == ValueType::String) {
+            row._min = stats._minString;
+            row._max = stats._maxString;
+        } else {
+            row._min = fmt::format("{}", stats._min);
+            row._max = fmt::format("{}", stats._max);
+        }
+    }
+}
+
+void addDegreeRows(std::vector<Row>& rows,
+                   const GraphMetadata& metadata,
+                   std::string_view kind,
+                   const GraphStatistics::DegreeHistograms& histograms) {
+    for (const auto& [edgeType, histogram] : histograms) {
+        Row& row = rows.emplace_back();
+        row._kind = kind;
+        row._entity = getEdgeTypeName(metadata, edgeType);
+        row._count = histogram._nodeCount;
+
+        size_t minBucket = DegreeHistogram::BUCKET_COUNT;
+        size_t maxBucket = 0;
+        for (size_t i = 0; i < DegreeHistogram::BUCKET_COUNT; i++) {
+            if (histogram._buckets[i] != 0) {
+                minBucket = std::min(minBucket, i);
+                maxBucket = i;
+            }
+        }
+
+        // Bounds of the degrees of the nodes having such edges
+        if (minBucket != DegreeHistogram::BUCKET_COUNT) {
+            row._min = std::to_string(uint64_t {1} << minBucket);
+            row._max = std::to_string((uint64_t {1} << (maxBucket + 1)) - 1);
+        }
+    }
+}
+
+// Rows are sorted to have a stable output
+void sortRows(std::vector<Row>::iterator first, std::vector<Row>::iterator last) {
+    std::sort(first, last, [](const Row& a, const Row& b) {
+        return a._entity < b._entity;
+    });
+}
+
+void buildRows(std::vector<Row>& rows, const GraphView& view) {
+    const GraphMetadata& metadata = view.metadata();
+    const std::shared_ptr<const GraphStatistics> stats = view.statistics();
+
+    size_t first = rows.size();
+    for (const auto& [labelset, count] : stats->nodeCounts()) {
+        Row& row = rows.emplace_back();
+        row._kind = "NODES";
+        row._entity = getLabelSetName(metadata, labelset);
+        row._count = count;
+    }
+    sortRows(rows.begin() + first, rows.end());
+
+    first = rows.size();
+    for (const auto& [key, count] : stats->edgeCounts()) {
+        Row& row = rows.emplace_back();
+        row._kind = "EDGES";
+        row._entity = fmt::format("({})-[:{}]->({})",
+                                  getLabelSetName(metadata, key._sourceLabelSet),
+                                  getEdgeTypeName(metadata, key._edgeType),
+                                  getLabelSetName(metadata, key._targetLabelSet));
+        row._count = count;
+    }
+    sortRows(rows.begin() + first, rows.end());
+
+    first = rows.size();
+    addDegreeRows(rows, metadata, "OUT_DEGREE", stats->outDegrees());
+    sortRows(rows.begin() + first, rows.end());
+
+    first = rows.size();
+    addDegreeRows(rows, metadata, "IN_DEGREE", stats->inDegrees());
+    sortRows(rows.begin() + first, rows.end());
+
+    first = rows.size();
+    addPropertyRows(rows, metadata, "NODE_PROPERTY", stats->nodeProperties(), stats->nodeCount());
+    sortRows(rows.begin() + first, rows.end());
+
+    first = rows.size();
+    addPropertyRows(rows, metadata, "EDGE_PROPERTY", stats->edgeProperties(), stats->edgeCount());
+    sortRows(rows.begin() + first, rows.end());
+}
+
+}
+
+std::unique_ptr<ProcedureData> StatisticsProcedure::allocData() {
+    return std::make_unique<Data>();
+}
+
+void StatisticsProcedure::execute(Procedure& proc) {
+    Data& data = proc.data<Data>();
+    const ExecutionContext* ctxt = proc.ctxt();
+    const GraphView& view = ctxt->getGraphView();
+
+    auto* kindCol = static_cast<ColumnVector<std::string>*>(data.getReturnColumn(0));
+    auto* entityCol = static_cast<ColumnVector<std::string>*>(data.getReturnColumn(1));
+    auto* countCol = static_cast<ColumnVector<types::UInt64::Primitive>*>(data.getReturnColumn(2));
+    auto* distinctCol = static_cast<ColumnVector<types::UInt64::Primitive>*>(data.getReturnColumn(3));
+    auto* nullFractionCol = static_cast<ColumnVector<types::Double::Primitive>*>(data.getReturnColumn(4));
+    auto* minCol = static_cast<ColumnVector<std::string>*>(data.getReturnColumn(5));
+    auto* maxCol = static_cast<ColumnVector<std::string>*>(data.getReturnColumn(6));
+
+    switch (proc.step()) {
+        case Procedure::Step::PREPARE: {
+            data._rows.clear();
+            buildRows(data._rows, view);
+            data._pos = 0;
+            return;
+        }
+
+        case Procedure::Step::RESET: {
+            data._pos = 0;
+            return;
+        }
+
+        case Procedure::Step::CONSUME: {
+            // Takes no node argument, never has an input
+            break;
+        }
+
+        case Procedure::Step::EXECUTE: {
+            const size_t remaining = std::min(data._rows.size() - data._pos,
+                                              ctxt->getChunkSize());
+
+            if (kindCol) {
+                kindCol->clear();
+            }
+
+            if (entityCol) {
+                entityCol->clear();
+            }
+
+            if (countCol) {
+                countCol->clear();
+            }
+
+            if (distinctCol) {
+                distinctCol->clear();
+            }
+
+            if (nullFractionCol) {
+                nullFractionCol->clear();
+            }
+
+            if (minCol) {
+                minCol->clear();
+            }
+
+            if (maxCol) {
+                maxCol->clear();
+            }
+
+            for (size_t i = 0; i < remaining; i++) {
+                const Row& row = data._rows[data._pos++];
+
+                if (kindCol) {
+                    kindCol->push_back(row._kind);
+                }
+
+                if (entityCol) {
+                    entityCol->push_back(row._entity);
+                }
+
+                if (countCol) {
+                    countCol->push_back(row._count);
+                }
+
+                if (distinctCol) {
+                    distinctCol->push_back(row._distinct);
+                }
+
+                if (nullFractionCol) {
+                    nullFractionCol->push_back(row._nullFraction);
+                }
+
+                if (minCol) {
+                    minCol->push_back(row._min);
+                }
+
+                if (maxCol) {
+                    maxCol->push_back(row._max);
+                }
+            }
+
+            if (data._pos == data._rows.size()) {
+                proc.finish();
+            }
+
+            return;
+        }
+    }
+
+    throw PipelineException("Unknown procedure step");
+}
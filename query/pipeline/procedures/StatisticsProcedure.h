@@ -0,0 +1,31 @@
+#pragma once
+
+#include "procedures/ProcedureBlueprint.h"
+#include "ProcedureData.h"
+
+namespace db {
+
+// Lists the statistics used to estimate the cardinalities of the query plans.
+// Degree rows count the nodes having edges of the type, min and max bound
+// their degree
+struct StatisticsProcedure {
+    static std::unique_ptr<ProcedureData> allocData();
+    static void execute(Procedure& proc);
+
+    static ProcedureBlueprint createBlueprint() noexcept {
+        return {
+            ._name = "db.statistics",
+            ._execCallback = &execute,
+            ._allocCallback = &allocData,
+            ._returnValues = {{"kind", ProcedureReturnType::STRING},
+                              {"entity", ProcedureReturnType::STRING},
+                              {"count", ProcedureReturnType::UINT_64},
+                              {"distinct", ProcedureReturnType::UINT_64},
+                              {"nullFraction", ProcedureReturnType::DOUBLE},
+                              {"min", ProcedureReturnType::STRING},
+                              {"max", ProcedureReturnType::STRING}},
+        };
+    }
+};
+
+}
@@ -0,0 +1,116 @@
+#include "VectorSearchProcedure.h"
+
+#include <spdlog/fmt/fmt.h>
+
+#include "ExecutionContext.h"
+#include "SystemManager.h"
+#include "procedures/Procedure.h"
+#include "columns/ColumnVector.h"
+#include "columns/ColumnIDs.h"
+#include "metadata/PropertyType.h"
+
+#include "VectorDatabase.h"
+#include "VecLibAccessor.h"
+#include "VectorSearchQuery.h"
+#include "VectorSearchResult.h"
+
+#include "PipelineException.h"
+
+using namespace db;
+
+namespace {
+
+void search(Procedure& proc, bool withCandidates) {
+    auto& data = proc.data<VectorSearchProcedure::Data>();
+
+    switch (proc.step()) {
+        case Procedure::Step::PREPARE:
+        case Procedure::Step::RESET: {
+            data._candidates.clear();
+            return;
+        }
+
+        case Procedure::Step::CONSUME: {
+            // Candidates are gathered from all the input chunks,
+            // the search is then run once on the whole set
+            const ColumnNodeIDs* nodeIDs = proc.getInputNodeIDs();
+            if (!nodeIDs) {
+                return;
+            }
+
+            for (const NodeID nodeID : *nodeIDs) {
+                data._candidates.push_back(nodeID.getValue());
+            }
+
+            return;
+        }
+
+        case Procedure::Step::EXECUTE: {
+            break;
+        }
+    }
+
+    vec::VectorDatabase* vectorDB = proc.ctxt()->getSystemManager()->getVectorDatabase();
+    if (!vectorDB) {
+        throw PipelineException("db.vectorSearch: no vector database is attached");
+    }
+
+    const std::string& libName = proc.getArgument<std::string>(0);
+    const auto& embedding = proc.getArgument<QueryParams::Vector>(1);
+    const int64_t k = proc.getArgument<int64_t>(2);
+
+    if (k <= 0) {
+        throw PipelineException("db.vectorSearch: k must be positive");
+    }
+
+    vec::VecLibAccessor lib = vectorDB->getLibrary(libName);
+    if (!lib.isValid()) {
+        throw PipelineException(fmt::format("db.vectorSearch: library '{}' does not exist", libName));
+    }
+
+    vec::VectorSearchQuery query(embedding.size());
+    query.setVector(embedding);
+    query.setMaxResultCount(k);
+
+    if (withCandidates) {
+        query.setCandidates(data._candidates);
+    }
+
+    vec::VectorSearchResult result;
+    if (auto res = lib.search(query, result); !res) {
+        throw PipelineException(fmt::format("db.vectorSearch: {}", res.error().fmtMessage()));
+    }
+
+    auto* nodeIDsCol = static_cast<ColumnNodeIDs*>(data.getReturnColumn(0));
+    auto* scoresCol = static_cast<ColumnVector<types::Double::Primitive>*>(data.getReturnColumn(1));
+
+    if (nodeIDsCol) {
+        nodeIDsCol->clear();
+        for (const uint64_t id : result.ids()) {
+            nodeIDsCol->push_back(NodeID {id});
+        }
+    }
+
+    if (scoresCol) {
+        scoresCol->clear();
+        for (const float distance : result.distances()) {
+            scoresCol->push_back(distance);
+        }
+    }
+
+    proc.finish();
+}
+
+}
+
+std::unique_ptr<ProcedureData> VectorSearchProcedure::allocData() {
+    return std::make_unique<Data>();
+}
+
+void VectorSearchProcedure::execute(Procedure& proc) {
+    search(proc, false);
+}
+
+void VectorSearchProcedure::executeWithCandidates(Procedure& proc) {
+    search(proc, true);
+}
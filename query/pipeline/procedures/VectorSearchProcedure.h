@@ -0,0 +1,47 @@
+#pragma once
+
+#include "procedures/ProcedureBlueprint.h"
+#include "ProcedureData.h"
+
+namespace db {
+
+struct VectorSearchProcedure {
+    struct Data : public ProcedureData {
+        // External IDs of the nodes passed as candidates
+        std::vector<uint64_t> _candidates;
+    };
+
+    static std::unique_ptr<ProcedureData> allocData();
+    static void execute(Procedure& proc);
+    static void executeWithCandidates(Procedure& proc);
+
+    static ProcedureBlueprint createBlueprint() noexcept {
+        return {
+            ._name = "db.vectorSearch",
+            ._execCallback = &execute,
+            ._allocCallback = &allocData,
+            ._returnValues = {{"nodeID", ProcedureReturnType::NODE},
+                              {"score", ProcedureReturnType::DOUBLE}},
+            ._arguments = {{"library", ProcedureArgumentType::STRING},
+                           {"embedding", ProcedureArgumentType::VECTOR},
+                           {"k", ProcedureArgumentType::INT64}},
+        };
+    }
+
+    // The search is restricted to the nodes matched upstream
+    static ProcedureBlueprint createCandidatesBlueprint() noexcept {
+        return {
+            ._name = "db.vectorSearch",
+            ._execCallback = &executeWithCandidates,
+            ._allocCallback = &allocData,
+            ._returnValues = {{"nodeID", ProcedureReturnType::NODE},
+                              {"score", ProcedureReturnType::DOUBLE}},
+            ._arguments = {{"library", ProcedureArgumentType::STRING},
+                           {"embedding", ProcedureArgumentType::VECTOR},
+                           {"k", ProcedureArgumentType::INT64},
+                           {"candidates", ProcedureArgumentType::NODE}},
+        };
+    }
+};
+
+}
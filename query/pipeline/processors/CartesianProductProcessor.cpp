@@ -56,7 +56,7 @@ void verifyRectangular(const Dataframe* df) {
 }
 
 CartesianProductProcessor* CartesianProductProcessor::create(PipelineV2* pipeline) {
-    auto* processor = new CartesianProductProcessor();
+    auto* processor = new (pipeline) CartesianProductProcessor();
 
     {
         PipelineInputPort* lhsInput = PipelineInputPort::create(pipeline, processor);
@@ -88,6 +88,15 @@ void CartesianProductProcessor::prepare(ExecutionContext* ctxt) {
     _lhsPtr = 0;
     _rhsPtr = 0;
 
+    _rowsWrittenThisCycle = 0;
+    _rowsWrittenSinceLastFinished = 0;
+    _rowsToWriteBeforeFinished = 0;
+    _rowsWrittenThisState = 0;
+    _currentState = State::INIT;
+
+    clearDataframe(&_leftMemory);
+    clearDataframe(&_rightMemory);
+
     markAsPrepared();
 }
 
@@ -26,7 +26,7 @@ std::string ChangeProcessor::describe() const {
 }
 
 ChangeProcessor* ChangeProcessor::create(PipelineV2* pipeline, ChangeOp op) {
-    ChangeProcessor* proj = new ChangeProcessor(op);
+    ChangeProcessor* proj = new (pipeline) ChangeProcessor(op);
 
     PipelineOutputPort* output = PipelineOutputPort::create(pipeline, proj);
     proj->_output.setPort(output);
@@ -116,8 +116,8 @@ void ChangeProcessor::submitChange() const {
 
     const std::string graphName {_ctxt->getGraphName()};
 
-    // Step 2: Dump newly created commits
-    if (const auto res = sysMan->dumpGraph(graphName); !res) {
+    // Step 2: Persist newly created commits
+    if (const auto res = sysMan->syncGraph(graphName); !res) {
         throw PipelineException(fmt::format("Failed to dump new commits: {}", res.error().fmtMessage()));
     }
 
@@ -21,6 +21,8 @@ public:
     void reset() override;
     void execute() override;
 
+    bool hasSideEffects() const override { return true; }
+
     void setColumn(ColumnVector<ChangeID>* changeIDCol) {
         _changeIDCol = changeIDCol;
     }
@@ -23,7 +23,7 @@ std::string CommitProcessor::describe() const {
 }
 
 CommitProcessor* CommitProcessor::create(PipelineV2* pipeline) {
-    CommitProcessor* proc = new CommitProcessor();
+    CommitProcessor* proc = new (pipeline) CommitProcessor();
 
     PipelineOutputPort* output = PipelineOutputPort::create(pipeline, proc);
     proc->_output.setPort(output);
@@ -18,7 +18,7 @@ std::string ComputeExprProcessor::describe() const {
 
 ComputeExprProcessor* ComputeExprProcessor::create(PipelineV2* pipeline,
                                                    ExprProgram* exprProg) {
-    ComputeExprProcessor* computeExpr = new ComputeExprProcessor(exprProg);
+    ComputeExprProcessor* computeExpr = new (pipeline) ComputeExprProcessor(exprProg);
 
     {
         PipelineInputPort* input = PipelineInputPort::create(pipeline, computeExpr);
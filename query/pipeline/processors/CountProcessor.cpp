@@ -1,7 +1,10 @@
 #include "CountProcessor.h"
 
+#include <concepts>
+
 #include <spdlog/fmt/fmt.h>
 
+#include "ID.h"
 #include "metadata/PropertyType.h"
 #include "columns/ColumnDispatcher.h"
 #include "dataframe/Dataframe.h"
@@ -24,7 +27,7 @@ std::string CountProcessor::describe() const {
 }
 
 CountProcessor* CountProcessor::create(PipelineV2* pipeline, ColumnTag colTag) {
-    CountProcessor* count = new CountProcessor();
+    CountProcessor* count = new (pipeline) CountProcessor();
 
     PipelineInputPort* input = PipelineInputPort::create(pipeline, count);
     count->_input.setPort(input);
@@ -46,10 +49,12 @@ void CountProcessor::prepare(ExecutionContext* ctxt) {
     }
 
     _countColumn = countColumn;
+    _countRunning = 0;
 
     if (!_colTag.isValid()) {
         // If column tag is not set, we are just counting the number of rows in the block
         // In cypher this is done with count(*)
+        markAsPrepared();
         return;
     }
 
@@ -98,6 +103,13 @@ void CountProcessor::execute() {
                         _countRunning++;
                     }
                 }
+            } else if constexpr (std::same_as<ValueType, NodeID> || std::same_as<ValueType, EdgeID>) {
+                // Invalid IDs are the nulls of optional matches
+                for (const ValueType& v : *col) {
+                    if (v.isValid()) {
+                        _countRunning++;
+                    }
+                }
             } else {
                 const size_t blockRowCount = inputDf->getRowCount();
                 _countRunning += blockRowCount;
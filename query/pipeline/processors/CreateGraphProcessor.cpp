@@ -20,7 +20,7 @@ CreateGraphProcessor::~CreateGraphProcessor() {
 }
 
 CreateGraphProcessor* CreateGraphProcessor::create(PipelineV2* pipeline, std::string_view graphName) {
-    CreateGraphProcessor* loadGraph = new CreateGraphProcessor(graphName);
+    CreateGraphProcessor* loadGraph = new (pipeline) CreateGraphProcessor(graphName);
 
     PipelineOutputPort* outName = PipelineOutputPort::create(pipeline, loadGraph);
     loadGraph->_outName.setPort(outName);
@@ -18,6 +18,8 @@ public:
     void reset() final;
     void execute() final;
 
+    bool hasSideEffects() const final { return true; }
+
     PipelineValueOutputInterface& output() { return _outName; }
 
 protected:
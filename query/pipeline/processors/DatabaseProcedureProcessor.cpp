@@ -13,9 +13,19 @@
 using namespace db;
 
 DatabaseProcedureProcessor* DatabaseProcedureProcessor::create(PipelineV2* pipeline,
-                                                               const ProcedureBlueprint& blueprint) {
-
-    DatabaseProcedureProcessor* processor = new DatabaseProcedureProcessor();
+                                                               const ProcedureBlueprint& blueprint,
+                                                               std::vector<QueryParams::Value>&& args,
+                                                               ColumnTag inputNodeIDs) {
+
+    DatabaseProcedureProcessor* processor = new (pipeline) DatabaseProcedureProcessor();
+
+    // Procedures without input are sources of the pipeline
+    if (inputNodeIDs.isValid()) {
+        PipelineInputPort* input = PipelineInputPort::create(pipeline, processor);
+        processor->_input.setPort(input);
+        processor->addInput(input);
+        processor->_inputNodeIDs = inputNodeIDs;
+    }
 
     PipelineOutputPort* output = PipelineOutputPort::create(pipeline, processor);
     processor->_output.setPort(output);
@@ -23,6 +33,7 @@ DatabaseProcedureProcessor* DatabaseProcedureProcessor::create(PipelineV2* pipel
 
     Procedure& procedure = processor->_procedure;
     procedure._blueprint = &blueprint;
+    procedure._args = std::move(args);
 
     if (blueprint._allocCallback) {
         procedure._data = blueprint._allocCallback();
@@ -38,6 +49,21 @@ std::string DatabaseProcedureProcessor::describe() const {
 
 void DatabaseProcedureProcessor::prepare(ExecutionContext* ctxt) {
     _procedure._ctxt = ctxt;
+
+    if (hasInput()) {
+        const NamedColumn* nodeIDs = _input.getDataframe()->getColumn(_inputNodeIDs);
+        if (!nodeIDs) [[unlikely]] {
+            throw PipelineException("DatabaseProcedureProcessor: input node IDs column does not exist");
+        }
+
+        _procedure._inputNodeIDs = dynamic_cast<const ColumnNodeIDs*>(nodeIDs->getColumn());
+        if (!_procedure._inputNodeIDs) [[unlikely]] {
+            throw PipelineException("DatabaseProcedureProcessor: input column does not contain node IDs");
+        }
+
+        _input.getPort()->setNeedsData(true);
+    }
+
     _procedure._step = Procedure::Step::PREPARE;
     _procedure._blueprint->_execCallback(_procedure);
 
@@ -60,6 +86,22 @@ void DatabaseProcedureProcessor::reset() {
 }
 
 void DatabaseProcedureProcessor::execute() {
+    PipelineInputPort* inputPort = _input.getPort();
+    if (inputPort && inputPort->needsData()) {
+        inputPort->consume();
+
+        _procedure._step = Procedure::Step::CONSUME;
+        _procedure._blueprint->_execCallback(_procedure);
+
+        if (!inputPort->isClosed()) {
+            return;
+        }
+
+        // The whole input is consumed, the procedure can now
+        // be executed without waiting for more data
+        inputPort->setNeedsData(false);
+    }
+
     _procedure._step = Procedure::Step::EXECUTE;
     _procedure._blueprint->_execCallback(_procedure);
     _output.getPort()->writeData();
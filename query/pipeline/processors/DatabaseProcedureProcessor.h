@@ -4,8 +4,10 @@
 #include <stdint.h>
 
 #include "Processor.h"
+#include "interfaces/PipelineBlockInputInterface.h"
 #include "interfaces/PipelineBlockOutputInterface.h"
 #include "procedures/Procedure.h"
+#include "dataframe/ColumnTag.h"
 
 namespace db {
 
@@ -21,8 +23,12 @@ class ProcedureBlueprint;
 
 class DatabaseProcedureProcessor : public Processor {
 public:
+    // Procedures taking a node argument have an input, from which the
+    // column @param inputNodeIDs is read
     static DatabaseProcedureProcessor* create(PipelineV2* pipeline,
-                                              const ProcedureBlueprint& blueprint);
+                                              const ProcedureBlueprint& blueprint,
+                                              std::vector<QueryParams::Value>&& args,
+                                              ColumnTag inputNodeIDs = ColumnTag {});
 
     std::string describe() const override;
 
@@ -34,13 +40,18 @@ public:
                       DataframeManager&,
                       std::span<ProcedureBlueprint::YieldItem> yield);
 
+    PipelineBlockInputInterface& input() { return _input; }
     PipelineBlockOutputInterface& output() { return _output; }
 
+    bool hasInput() const { return _inputNodeIDs.isValid(); }
+
     const Procedure& procedure() const { return _procedure; }
 
 private:
     Procedure _procedure;
+    PipelineBlockInputInterface _input;
     PipelineBlockOutputInterface _output;
+    ColumnTag _inputNodeIDs;
 
     DatabaseProcedureProcessor();
     ~DatabaseProcedureProcessor();
@@ -0,0 +1,235 @@
+#include "DistinctProcessor.h"
+
+#include <algorithm>
+#include <concepts>
+#include <optional>
+#include <type_traits>
+
+#include <spdlog/fmt/fmt.h>
+
+#include "PipelineV2.h"
+#include "PipelinePort.h"
+#include "columns/ColumnIDs.h"
+#include "columns/ColumnVector.h"
+#include "columns/ColumnOptVector.h"
+#include "columns/ColumnDispatcher.h"
+#include "dataframe/Dataframe.h"
+#include "dataframe/NamedColumn.h"
+#include "metadata/PropertyType.h"
+
+#include "PipelineException.h"
+
+using namespace db;
+
+namespace {
+
+template <typename T>
+struct IsOptional : std::false_type {};
+
+template <typename T>
+struct IsOptional<std::optional<T>> : std::true_type {};
+
+// Appends the bytes of a value to the key of a row,
+// strings are prefixed by their size so that the keys can not be ambiguous
+template <typename T>
+void appendKey(std::string& key, const T& value) {
+    if constexpr (IsOptional<T>::value) {
+        key.push_back(value.has_value() ? 1 : 0);
+        if (value) {
+            appendKey(key, *value);
+        }
+    } else if constexpr (std::same_as<T, std::string_view> || std::same_as<T, std::string>) {
+        const size_t size = value.size();
+        key.append(reinterpret_cast<const char*>(&size), sizeof(size));
+        key.append(value.data(), size);
+    } else if constexpr (std::same_as<T, types::Double::Primitive>) {
+        // -0.0 and 0.0 are equal
+        const double normalized = value == 0.0 ? 0.0 : value;
+        key.append(reinterpret_cast<const char*>(&normalized), sizeof(normalized));
+    } else {
+        static_assert(std::is_trivially_copyable_v<T>);
+        key.append(reinterpret_cast<const char*>(&value), sizeof(T));
+    }
+}
+
+}
+
+DistinctProcessor::DistinctProcessor(std::vector<ColumnTag> keys)
+    : _keyTags(std::move(keys))
+{
+}
+
+DistinctProcessor::~DistinctProcessor() {
+}
+
+std::string DistinctProcessor::describe() const {
+    return fmt::format("DistinctProcessor @={}", fmt::ptr(this));
+}
+
+DistinctProcessor* DistinctProcessor::create(PipelineV2* pipeline, std::vector<ColumnTag> keys) {
+    DistinctProcessor* distinct = new (pipeline) DistinctProcessor(std::move(keys));
+
+    PipelineInputPort* input = PipelineInputPort::create(pipeline, distinct);
+    distinct->_input.setPort(input);
+    distinct->addInput(input);
+
+    PipelineOutputPort* output = PipelineOutputPort::create(pipeline, distinct);
+    distinct->_output.setPort(output);
+    distinct->addOutput(output);
+
+    distinct->postCreate(pipeline);
+
+    return distinct;
+}
+
+void DistinctProcessor::prepare(ExecutionContext* ctxt) {
+    const Dataframe* inputDf = _input.getDataframe();
+
+    _keys.clear();
+    for (const ColumnTag tag : _keyTags) {
+        const NamedColumn* col = inputDf->getColumn(tag);
+        if (!col) [[unlikely]] {
+            throw PipelineException("DistinctProcessor: key column does not exist");
+        }
+
+        _keys.push_back(col->getColumn());
+    }
+
+    if (_keys.empty()) [[unlikely]] {
+        throw PipelineException("DistinctProcessor: no key columns");
+    }
+
+    _isNodeIDKey = _keys.size() == 1
+                && _keys.front()->getKind() == ColumnNodeIDs::staticKind();
+
+    _seenNodes.clear();
+    _seenInvalidNode = false;
+    _seenKeys.clear();
+
+    markAsPrepared();
+}
+
+void DistinctProcessor::reset() {
+    markAsReset();
+}
+
+void DistinctProcessor::execute() {
+    _input.getPort()->consume();
+
+    const Dataframe* inputDf = _input.getDataframe();
+    Dataframe* outputDf = _output.getDataframe();
+    const size_t rowCount = inputDf->getRowCount();
+
+    _rows.clear();
+
+    if (_isNodeIDKey) {
+        findNewNodes(rowCount);
+    } else {
+        findNewRows(rowCount);
+    }
+
+    if (_rows.size() == rowCount && rowCount > 0) {
+        outputDf->copyFrom(inputDf);
+        _output.getPort()->writeData();
+    } else if (!_rows.empty()) {
+        emitRows();
+        _output.getPort()->writeData();
+    } else if (_input.getPort()->isClosed()) {
+        // Write an empty chunk so that the following processor can execute
+        outputDf->copyFromLine(inputDf, 0, 0);
+        _output.getPort()->writeData();
+    }
+
+    finish();
+}
+
+void DistinctProcessor::findNewNodes(size_t rowCount) {
+    const auto* col = static_cast<const ColumnNodeIDs*>(_keys.front());
+    const auto& nodeIDs = col->getRaw();
+
+    for (size_t row = 0; row < rowCount; row++) {
+        const NodeID nodeID = nodeIDs[row];
+
+        // Invalid IDs are the nulls of optional matches
+        if (!nodeID.isValid()) {
+            if (!_seenInvalidNode) {
+                _seenInvalidNode = true;
+                _rows.push_back(row);
+            }
+            continue;
+        }
+
+        const size_t index = nodeID.getValue();
+        if (index >= _seenNodes.size()) {
+            _seenNodes.resize(std::max(index + 1, _seenNodes.size() * 2));
+        }
+
+        if (!_seenNodes[index]) {
+            _seenNodes[index] = true;
+            _rows.push_back(row);
+        }
+    }
+}
+
+void DistinctProcessor::findNewRows(size_t rowCount) {
+    if (_rowKeys.size() < rowCount) {
+        _rowKeys.resize(rowCount);
+    }
+
+    for (size_t row = 0; row < rowCount; row++) {
+        _rowKeys[row].clear();
+    }
+
+    // The keys are built column by column to dispatch on the type of each column once
+    for (const Column* key : _keys) {
+        // Constant keys (literals, parameters) hold one value for all the rows
+        if (isColumnConst(key)) {
+            dispatchColumnConst(key, [&](const auto* col) {
+                const auto& value = col->getRaw();
+                for (size_t row = 0; row < rowCount; row++) {
+                    appendKey(_rowKeys[row], value);
+                }
+            });
+            continue;
+        }
+
+        dispatchColumnVector(key, [&](const auto* col) {
+            const auto& raw = col->getRaw();
+            for (size_t row = 0; row < rowCount; row++) {
+                appendKey(_rowKeys[row], raw[row]);
+            }
+        });
+    }
+
+    for (size_t row = 0; row < rowCount; row++) {
+        if (_seenKeys.insert(_rowKeys[row]).second) {
+            _rows.push_back(row);
+        }
+    }
+}
+
+void DistinctProcessor::emitRows() {
+    const auto& inCols = _input.getDataframe()->cols();
+    const auto& outCols = _output.getDataframe()->cols();
+
+    for (size_t i = 0; i < outCols.size(); i++) {
+        const Column* src = inCols[i]->getColumn();
+
+        if (isColumnConst(src)) {
+            outCols[i]->getColumn()->assign(src);
+            continue;
+        }
+
+        dispatchColumnVector(outCols[i]->getColumn(), [&](auto* outCol) {
+            using ColType = std::remove_pointer_t<decltype(outCol)>;
+            const auto* srcCol = static_cast<const ColType*>(src);
+            const auto& srcRaw = srcCol->getRaw();
+            auto& outRaw = outCol->getRaw();
+
+            outRaw.resize(_rows.size());
+            for (size_t row = 0; row < _rows.size(); row++) {
+                outRaw[row] = srcRaw[_rows[row]];
+            }
+        });
+    }
+}
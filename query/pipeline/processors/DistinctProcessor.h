@@ -0,0 +1,64 @@
+#pragma once
+
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+#include "Processor.h"
+
+#include "interfaces/PipelineBlockInputInterface.h"
+#include "interfaces/PipelineBlockOutputInterface.h"
+
+#include "dataframe/ColumnTag.h"
+
+namespace db {
+
+class Column;
+class PipelineV2;
+
+/**
+ * @brief Streaming deduplication of the rows on a set of key columns.
+ *
+ * @detail Each chunk only emits the rows whose keys were not seen in the previous
+ * chunks, in their input order. The keys of a single node ID column are tracked
+ * in a bitmap indexed by the node IDs, other keys are encoded as byte strings
+ * in a hash set. All the columns of the input are forwarded.
+ */
+class DistinctProcessor : public Processor {
+public:
+    static DistinctProcessor* create(PipelineV2* pipeline, std::vector<ColumnTag> keys);
+
+    std::string describe() const override;
+
+    PipelineBlockInputInterface& input() { return _input; }
+    PipelineBlockOutputInterface& output() { return _output; }
+
+    void prepare(ExecutionContext* ctxt) override;
+    void reset() override;
+    void execute() override;
+
+private:
+    PipelineBlockInputInterface _input;
+    PipelineBlockOutputInterface _output;
+    const std::vector<ColumnTag> _keyTags;
+
+    std::vector<const Column*> _keys;
+    bool _isNodeIDKey {false};
+
+    std::vector<bool> _seenNodes;
+    bool _seenInvalidNode {false};
+    std::unordered_set<std::string> _seenKeys;
+
+    // Keys of the rows of the current chunk and rows seen for the first time
+    std::vector<std::string> _rowKeys;
+    std::vector<size_t> _rows;
+
+    DistinctProcessor(std::vector<ColumnTag> keys);
+    ~DistinctProcessor() override;
+
+    void findNewNodes(size_t rowCount);
+    void findNewRows(size_t rowCount);
+    void emitRows();
+};
+
+}
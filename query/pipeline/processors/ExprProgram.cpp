@@ -183,8 +183,12 @@ constexpr OperationKind::Code UnaryOpCase = OperationKind::code(Op, Lhs::staticK
     CASE_NAME(ColumnOptVector<types::Double::Primitive>, ColumnConst<types::Int64::Primitive>)       \
     CASE_NAME(ColumnOptVector<types::Double::Primitive>, ColumnConst<types::UInt64::Primitive>)      \
 
+void* ExprProgram::operator new(size_t size, PipelineV2* pipeline) {
+    return pipeline->allocObject(size);
+}
+
 ExprProgram* ExprProgram::create(PipelineV2* pipeline) {
-    ExprProgram* prog = new ExprProgram();
+    ExprProgram* prog = new (pipeline) ExprProgram();
     pipeline->addExprProgram(prog);
 
     return prog;
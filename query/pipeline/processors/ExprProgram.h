@@ -1,6 +1,7 @@
 #pragma once
 
 #include <vector>
+#include <stddef.h>
 
 #include "columns/ColumnOperator.h"
 
@@ -40,6 +41,10 @@ private:
     // All instructions which need be evaluated
     Instructions _instrs;
 
+    static void* operator new(size_t size, PipelineV2* pipeline);
+    static void operator delete(void*, PipelineV2*) {}
+    static void operator delete(void*) {}
+
     ExprProgram() = default;
     virtual ~ExprProgram() = default;
     void evalInstr(const Instruction& instr);
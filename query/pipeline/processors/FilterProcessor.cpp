@@ -1,5 +1,7 @@
 #include "FilterProcessor.h"
 
+#include <algorithm>
+
 #include <spdlog/fmt/fmt.h>
 #include <range/v3/view/drop.hpp>
 
@@ -26,19 +28,29 @@ namespace rv = rg::views;
 
 namespace {
 
-#define APPLY_MASK_CASE(Type)                \
-    case Type::staticKind(): {               \
-        ColumnOperators::applyMask(          \
-            static_cast<const Type*>(src),   \
-            mask,                            \
-            static_cast<Type*>(dest));       \
-    }                                        \
+#define APPLY_MASK_CASE(Type)                      \
+    case Type::staticKind(): {                     \
+        if (append) {                              \
+            ColumnOperators::appendMask(           \
+                static_cast<const Type*>(src),     \
+                mask,                              \
+                static_cast<Type*>(dest));         \
+        } else {                                   \
+            ColumnOperators::applyMask(            \
+                static_cast<const Type*>(src),     \
+                mask,                              \
+                static_cast<Type*>(dest));         \
+        }                                          \
+    }                                              \
     break;
 
 
+// Writes the rows of src selected by the mask in dest,
+// after the rows already in dest if append is true
 void applyMask(const Column* src,
                const ColumnMask* mask,
-               Column* dest) {
+               Column* dest,
+               bool append) {
     switch (src->getKind()) {
         APPLY_MASK_CASE(ColumnVector<types::Bool::Primitive>)
         APPLY_MASK_CASE(ColumnVector<types::Int64::Primitive>)
@@ -79,7 +91,7 @@ FilterProcessor::FilterProcessor(PredicateProgram* predProg)
 }
 
 FilterProcessor* FilterProcessor::create(PipelineV2* pipeline, PredicateProgram* predProg) {
-    auto* proc = new FilterProcessor(predProg);
+    auto* proc = new (pipeline) FilterProcessor(predProg);
 
     {
         PipelineInputPort* filterInput = PipelineInputPort::create(pipeline, proc);
@@ -98,7 +110,10 @@ FilterProcessor* FilterProcessor::create(PipelineV2* pipeline, PredicateProgram*
     return proc;
 }
 
-void FilterProcessor::prepare(ExecutionContext*) {
+void FilterProcessor::prepare(ExecutionContext* ctxt) {
+    _ctxt = ctxt;
+    _pendingRowCount = 0;
+
     // Check dataframes have same number of columns
     const Dataframe* srcDF = _input.getDataframe();
     const Dataframe* destDF = _output.getDataframe();
@@ -172,17 +187,28 @@ void FilterProcessor::execute() {
     for (size_t i = 0; i < colCount; i++) {
         const Column* srcCol = srcCols[i]->getColumn();
         Column* destCol = destCols[i]->getColumn(); 
-        applyMask(srcCol, &finalMask, destCol);
+        applyMask(srcCol, &finalMask, destCol, _pendingRowCount > 0);
     }
 
     _input.getPort()->consume();
 
+    // Selective predicates leave few rows per chunk, they are coalesced
+    // until half a chunk so that the next processors do not pay
+    // the overhead of a chunk for a handful of rows
+    size_t coalesceRowCount = getStageChunkSize() / 2;
+    if (getRowLimit() > 0) {
+        coalesceRowCount = std::min(coalesceRowCount, getRowLimit());
+    }
+
     // Only ever emit an empty chunk if our input is closed, to allow the next processor
     // to proceed.
-    const bool haveOutput = destDF->getRowCount() != 0;
+    const size_t rowCount = destDF->getRowCount();
     const bool inputClosed = _input.getPort()->isClosed();
-    if (haveOutput || inputClosed) {
+    if (rowCount >= std::max<size_t>(coalesceRowCount, 1) || inputClosed) {
         _output.getPort()->writeData();
+        _pendingRowCount = 0;
+    } else {
+        _pendingRowCount = rowCount;
     }
 
     finish();
@@ -28,6 +28,9 @@ private:
 
     PredicateProgram* _predProg {nullptr};
 
+    // Rows kept in the output until enough rows are coalesced
+    size_t _pendingRowCount {0};
+
     FilterProcessor(PredicateProgram* exprProg);
     ~FilterProcessor() final = default ;
 };
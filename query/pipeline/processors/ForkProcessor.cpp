@@ -20,7 +20,7 @@ ForkProcessor::ForkProcessor(size_t count)
 
 ForkProcessor* ForkProcessor::create(PipelineV2* pipeline,
                                      size_t count) {
-    ForkProcessor* fork = new ForkProcessor(count);
+    ForkProcessor* fork = new (pipeline) ForkProcessor(count);
     PipelineInputPort* input = PipelineInputPort::create(pipeline, fork);
     fork->_input.setPort(input);
     fork->addInput(input);
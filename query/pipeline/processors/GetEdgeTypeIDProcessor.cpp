@@ -21,7 +21,7 @@ GetEdgeTypeIDProcessor::~GetEdgeTypeIDProcessor() {
 }
 
 GetEdgeTypeIDProcessor* GetEdgeTypeIDProcessor::create(PipelineV2* pipeline) {
-    auto* proc = new GetEdgeTypeIDProcessor();
+    auto* proc = new (pipeline) GetEdgeTypeIDProcessor();
 
     {
         PipelineInputPort* inputEdgeIDs = PipelineInputPort::create(pipeline, proc);
@@ -2,6 +2,7 @@
 
 #include "PipelineV2.h"
 #include "PipelinePort.h"
+#include "OuterExpansion.h"
 
 #include "iterators/GetEdgesIterator.h"
 
@@ -27,7 +28,7 @@ std::string GetEdgesProcessor::describe() const {
 }
 
 GetEdgesProcessor* GetEdgesProcessor::create(PipelineV2* pipeline) {
-    GetEdgesProcessor* getInEdges = new GetEdgesProcessor();
+    GetEdgesProcessor* getInEdges = new (pipeline) GetEdgesProcessor();
 
     PipelineInputPort* inNodeIDs = PipelineInputPort::create(pipeline, getInEdges);
     PipelineOutputPort* outEdges = PipelineOutputPort::create(pipeline, getInEdges);
@@ -41,6 +42,14 @@ GetEdgesProcessor* GetEdgesProcessor::create(PipelineV2* pipeline) {
     return getInEdges;
 }
 
+void GetEdgesProcessor::setEdgeTypes(std::span<const EdgeTypeID> edgeTypes) {
+    _edgeTypes = EdgeTypeFilter(edgeTypes);
+}
+
+void GetEdgesProcessor::setOuterExpansion(std::unique_ptr<OuterExpansion> outer) {
+    _outer = std::move(outer);
+}
+
 void GetEdgesProcessor::prepare(ExecutionContext* ctxt) {
     _ctxt = ctxt;
 
@@ -55,19 +64,38 @@ void GetEdgesProcessor::prepare(ExecutionContext* ctxt) {
     _it->setEdgeIDs(edgeIDs);
     _it->setOtherIDs(otherNodes);
     _it->setEdgeTypes(edgeTypes);
+    _it->setEdgeTypeFilter(&_edgeTypes);
+
+    if (_outer) {
+        _outer->setOutput(ctxt->getGraphView(), _outEdges);
+        _outer->reset(nodeIDs->size());
+    }
 
     markAsPrepared();
 }
 
 void GetEdgesProcessor::reset() {
     _it->reset();
+
+    if (_outer) {
+        _outer->reset(_inNodeIDs.getNodeIDs()->getColumn()->size());
+    }
+
     markAsReset();
 }
 
 void GetEdgesProcessor::execute() {
-    _it->fill(_ctxt->getChunkSize());
+    _it->fill(nextChunkSize());
+
+    if (_outer) {
+        _outer->addEdges();
+    }
 
     if (!_it->isValid()) {
+        if (_outer) {
+            _outer->addUnmatchedRows();
+        }
+
         _inNodeIDs.getPort()->consume();
         finish();
     }
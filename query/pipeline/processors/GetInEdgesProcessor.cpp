@@ -2,6 +2,7 @@
 
 #include "PipelineV2.h"
 #include "PipelinePort.h"
+#include "OuterExpansion.h"
 
 #include "iterators/GetInEdgesIterator.h"
 
@@ -27,7 +28,7 @@ std::string GetInEdgesProcessor::describe() const {
 }
 
 GetInEdgesProcessor* GetInEdgesProcessor::create(PipelineV2* pipeline) {
-    GetInEdgesProcessor* getInEdges = new GetInEdgesProcessor();
+    GetInEdgesProcessor* getInEdges = new (pipeline) GetInEdgesProcessor();
 
     PipelineInputPort* inNodeIDs = PipelineInputPort::create(pipeline, getInEdges);
     PipelineOutputPort* outEdges = PipelineOutputPort::create(pipeline, getInEdges);
@@ -41,6 +42,14 @@ GetInEdgesProcessor* GetInEdgesProcessor::create(PipelineV2* pipeline) {
     return getInEdges;
 }
 
+void GetInEdgesProcessor::setEdgeTypes(std::span<const EdgeTypeID> edgeTypes) {
+    _edgeTypes = EdgeTypeFilter(edgeTypes);
+}
+
+void GetInEdgesProcessor::setOuterExpansion(std::unique_ptr<OuterExpansion> outer) {
+    _outer = std::move(outer);
+}
+
 void GetInEdgesProcessor::prepare(ExecutionContext* ctxt) {
     _ctxt = ctxt;
 
@@ -55,19 +64,38 @@ void GetInEdgesProcessor::prepare(ExecutionContext* ctxt) {
     _it->setEdgeIDs(edgeIDs);
     _it->setSrcIDs(sourceNodes);
     _it->setEdgeTypes(edgeTypes);
+    _it->setEdgeTypeFilter(&_edgeTypes);
+
+    if (_outer) {
+        _outer->setOutput(ctxt->getGraphView(), _outEdges);
+        _outer->reset(nodeIDs->size());
+    }
 
     markAsPrepared();
 }
 
 void GetInEdgesProcessor::reset() {
     _it->reset();
+
+    if (_outer) {
+        _outer->reset(_inNodeIDs.getNodeIDs()->getColumn()->size());
+    }
+
     markAsReset();
 }
 
 void GetInEdgesProcessor::execute() {
-    _it->fill(_ctxt->getChunkSize());
+    _it->fill(nextChunkSize());
+
+    if (_outer) {
+        _outer->addEdges();
+    }
 
     if (!_it->isValid()) {
+        if (_outer) {
+            _outer->addUnmatchedRows();
+        }
+
         _inNodeIDs.getPort()->consume();
         finish();
     }
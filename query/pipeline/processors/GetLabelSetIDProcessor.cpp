@@ -20,7 +20,7 @@ GetLabelSetIDProcessor::~GetLabelSetIDProcessor() {
 }
 
 GetLabelSetIDProcessor* GetLabelSetIDProcessor::create(PipelineV2* pipeline) {
-    GetLabelSetIDProcessor* getlabel = new GetLabelSetIDProcessor();
+    GetLabelSetIDProcessor* getlabel = new (pipeline) GetLabelSetIDProcessor();
 
     PipelineInputPort* inNodeIDs = PipelineInputPort::create(pipeline, getlabel);
     getlabel->_input.setPort(inNodeIDs);
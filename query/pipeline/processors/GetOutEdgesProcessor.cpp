@@ -2,6 +2,7 @@
 
 #include "PipelineV2.h"
 #include "PipelinePort.h"
+#include "OuterExpansion.h"
 
 #include "iterators/GetOutEdgesIterator.h"
 
@@ -27,7 +28,7 @@ std::string GetOutEdgesProcessor::describe() const {
 }
 
 GetOutEdgesProcessor* GetOutEdgesProcessor::create(PipelineV2* pipeline) {
-    GetOutEdgesProcessor* getOutEdges = new GetOutEdgesProcessor();
+    GetOutEdgesProcessor* getOutEdges = new (pipeline) GetOutEdgesProcessor();
 
     PipelineInputPort* inNodeIDs = PipelineInputPort::create(pipeline, getOutEdges);
     PipelineOutputPort* outEdges = PipelineOutputPort::create(pipeline, getOutEdges);
@@ -43,6 +44,14 @@ GetOutEdgesProcessor* GetOutEdgesProcessor::create(PipelineV2* pipeline) {
     return getOutEdges;
 }
 
+void GetOutEdgesProcessor::setEdgeTypes(std::span<const EdgeTypeID> edgeTypes) {
+    _edgeTypes = EdgeTypeFilter(edgeTypes);
+}
+
+void GetOutEdgesProcessor::setOuterExpansion(std::unique_ptr<OuterExpansion> outer) {
+    _outer = std::move(outer);
+}
+
 void GetOutEdgesProcessor::prepare(ExecutionContext* ctxt) {
     _ctxt = ctxt;
 
@@ -57,19 +66,38 @@ void GetOutEdgesProcessor::prepare(ExecutionContext* ctxt) {
     _it->setEdgeIDs(edgeIDs);
     _it->setTgtIDs(targetNodes);
     _it->setEdgeTypes(edgeTypes);
+    _it->setEdgeTypeFilter(&_edgeTypes);
+
+    if (_outer) {
+        _outer->setOutput(ctxt->getGraphView(), _outEdges);
+        _outer->reset(nodeIDs->size());
+    }
 
     markAsPrepared();
 }
 
 void GetOutEdgesProcessor::reset() {
     _it->reset();
+
+    if (_outer) {
+        _outer->reset(_inNodeIDs.getNodeIDs()->getColumn()->size());
+    }
+
     markAsReset();
 }
 
 void GetOutEdgesProcessor::execute() {
-    _it->fill(_ctxt->getChunkSize());
+    _it->fill(nextChunkSize());
+
+    if (_outer) {
+        _outer->addEdges();
+    }
 
     if (!_it->isValid()) {
+        if (_outer) {
+            _outer->addUnmatchedRows();
+        }
+
         _inNodeIDs.getPort()->consume();
         finish();
     }
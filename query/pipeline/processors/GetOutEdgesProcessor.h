@@ -1,14 +1,19 @@
 #pragma once
 
 #include <memory>
+#include <span>
 
 #include "Processor.h"
 
 #include "interfaces/PipelineNodeInputInterface.h"
 #include "interfaces/PipelineEdgeOutputInterface.h"
 
+#include "iterators/EdgeTypeFilter.h"
+#include "ID.h"
+
 namespace db {
 class GetOutEdgesChunkWriter;
+class OuterExpansion;
 }
 
 namespace db {
@@ -19,6 +24,12 @@ public:
 
     std::string describe() const override;
 
+    // Only expands the edges of the given types, all the edges if empty
+    void setEdgeTypes(std::span<const EdgeTypeID> edgeTypes);
+
+    // Makes the expansion a left outer expansion
+    void setOuterExpansion(std::unique_ptr<OuterExpansion> outer);
+
     void prepare(ExecutionContext* ctxt) override;
     void reset() override;
     void execute() override;
@@ -30,6 +41,8 @@ private:
     PipelineNodeInputInterface _inNodeIDs;
     PipelineEdgeOutputInterface _outEdges;
     std::unique_ptr<GetOutEdgesChunkWriter> _it;
+    std::unique_ptr<OuterExpansion> _outer;
+    EdgeTypeFilter _edgeTypes;
 
     GetOutEdgesProcessor();
     ~GetOutEdgesProcessor();
@@ -20,7 +20,7 @@ std::string GetPropertiesProcessor<Entity, T>::describe() const {
 
 template <EntityType Entity, SupportedType T>
 GetPropertiesProcessor<Entity, T>* GetPropertiesProcessor<Entity, T>::create(PipelineV2* pipeline, PropertyType propType) {
-    auto* getProps = new GetPropertiesProcessor(propType);
+    auto* getProps = new (pipeline) GetPropertiesProcessor(propType);
 
     PipelineInputPort* inIDs = PipelineInputPort::create(pipeline, getProps);
     PipelineOutputPort* outValues = PipelineOutputPort::create(pipeline, getProps);
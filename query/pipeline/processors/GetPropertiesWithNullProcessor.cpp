@@ -20,7 +20,7 @@ template <EntityType Entity, SupportedType T>
 GetPropertiesWithNullProcessor<Entity, T>* GetPropertiesWithNullProcessor<Entity, T>::create(PipelineV2* pipeline,
                                                                                              ColumnTag entityTag,
                                                                                              PropertyType propType) {
-    auto* getProps = new GetPropertiesWithNullProcessor(entityTag, propType);
+    auto* getProps = new (pipeline) GetPropertiesWithNullProcessor(entityTag, propType);
 
     PipelineInputPort* inIDs = PipelineInputPort::create(pipeline, getProps);
     PipelineOutputPort* outValues = PipelineOutputPort::create(pipeline, getProps);
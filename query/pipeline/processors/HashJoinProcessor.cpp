@@ -55,7 +55,7 @@ HashJoinProcessor::HashJoinProcessor(const ColumnTag leftJoinKey,
 HashJoinProcessor* HashJoinProcessor::create(PipelineV2* pipeline,
                                              const ColumnTag leftJoinKey,
                                              const ColumnTag rightJoinKey) {
-    HashJoinProcessor* hashJoin = new HashJoinProcessor(leftJoinKey, rightJoinKey);
+    HashJoinProcessor* hashJoin = new (pipeline) HashJoinProcessor(leftJoinKey, rightJoinKey);
 
     PipelineInputPort* leftInput = PipelineInputPort::create(pipeline, hashJoin);
     leftInput->setNeedsData(false);
@@ -92,6 +92,14 @@ void HashJoinProcessor::prepare(ExecutionContext* ctxt) {
     //the size of the output dataframe
     _rightRowLen = outDf->size() - _leftRowLen - 1;
 
+    _leftMap.clear();
+    _rightMap.clear();
+    _store = RowStore {};
+    _leftInputIdx = 0;
+    _rightInputIdx = 0;
+    _hasWritten = false;
+    _rowOffsetState.reset();
+
     markAsPrepared();
 }
 void HashJoinProcessor::reset() {
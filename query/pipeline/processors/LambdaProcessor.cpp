@@ -32,7 +32,7 @@ void LambdaProcessor::execute() {
 }
 
 LambdaProcessor* LambdaProcessor::create(PipelineV2* pipeline, const Callback& callback) {
-    LambdaProcessor* lambda = new LambdaProcessor(callback);
+    LambdaProcessor* lambda = new (pipeline) LambdaProcessor(callback);
 
     PipelineInputPort* input = PipelineInputPort::create(pipeline, lambda);
     lambda->_input.setPort(input);
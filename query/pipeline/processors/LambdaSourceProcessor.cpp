@@ -40,7 +40,7 @@ void LambdaSourceProcessor::execute() {
 }
 
 LambdaSourceProcessor* LambdaSourceProcessor::create(PipelineV2* pipeline, Callback callback) {
-    LambdaSourceProcessor* lambda = new LambdaSourceProcessor(callback);
+    LambdaSourceProcessor* lambda = new (pipeline) LambdaSourceProcessor(callback);
 
     PipelineOutputPort* output = PipelineOutputPort::create(pipeline, lambda);
     lambda->_output.setPort(output);
@@ -40,7 +40,7 @@ void LambdaTransformProcessor::execute() {
 }
 
 LambdaTransformProcessor* LambdaTransformProcessor::create(PipelineV2* pipeline, Callback callback) {
-    LambdaTransformProcessor* lambda = new LambdaTransformProcessor(callback);
+    LambdaTransformProcessor* lambda = new (pipeline) LambdaTransformProcessor(callback);
 
     PipelineInputPort* input = PipelineInputPort::create(pipeline, lambda);
     lambda->_input.setPort(input);
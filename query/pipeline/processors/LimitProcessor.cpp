@@ -20,7 +20,7 @@ std::string LimitProcessor::describe() const {
 }
 
 LimitProcessor* LimitProcessor::create(PipelineV2* pipeline, size_t limit) {
-    LimitProcessor* processor = new LimitProcessor(limit);
+    LimitProcessor* processor = new (pipeline) LimitProcessor(limit);
 
     PipelineInputPort* input = PipelineInputPort::create(pipeline, processor);
     processor->_input.setPort(input);
@@ -36,6 +36,9 @@ LimitProcessor* LimitProcessor::create(PipelineV2* pipeline, size_t limit) {
 }
 
 void LimitProcessor::prepare(ExecutionContext* ctxt) {
+    _currentRowCount = 0;
+    _reachedLimit = false;
+
     markAsPrepared();
 }
 
@@ -45,31 +48,35 @@ void LimitProcessor::reset() {
 
 void LimitProcessor::execute() {
     _input.getPort()->consume();
-    finish();
 
     if (_reachedLimit) {
         // We have reached the limit, do nothing
+        finish();
         return;
-    } else {
-        const Dataframe* inputDf = _input.getDataframe();
-        Dataframe* outputDf = _output.getDataframe();
-        const size_t blockRowCount = inputDf->getRowCount();
-        const size_t remainingCapacity = _limit - _currentRowCount;
-
-        // Write rows of inputBlock that are below the limit
-        const size_t rowsToWrite = std::min(blockRowCount, remainingCapacity);
-        if (rowsToWrite == 0) {
-            _reachedLimit = true;
-            return;
-        }
-        
-        outputDf->copyFromLine(inputDf, 0, rowsToWrite);
+    }
+
+    const Dataframe* inputDf = _input.getDataframe();
+    Dataframe* outputDf = _output.getDataframe();
+    const size_t blockRowCount = inputDf->getRowCount();
+    const size_t remainingCapacity = _limit - _currentRowCount;
 
-        if (blockRowCount >= remainingCapacity) {
-            _reachedLimit = true;
-        }
+    // Write rows of inputBlock that are below the limit
+    const size_t rowsToWrite = std::min(blockRowCount, remainingCapacity);
+    if (blockRowCount >= remainingCapacity) {
+        _reachedLimit = true;
 
+        // Stop the processors upstream, the closed input
+        // also closes the outputs in finish
+        cancelInputs();
+    }
+
+    // An empty chunk is written at the end of the stream so that
+    // the following processor can execute
+    if (rowsToWrite > 0 || _reachedLimit || _input.getPort()->isClosed()) {
+        outputDf->copyFromLine(inputDf, 0, rowsToWrite);
         _currentRowCount += rowsToWrite;
         _output.getPort()->writeData();
     }
+
+    finish();
 }
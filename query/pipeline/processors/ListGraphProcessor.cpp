@@ -22,7 +22,7 @@ std::string ListGraphProcessor::describe() const {
 }
 
 ListGraphProcessor* ListGraphProcessor::create(PipelineV2* pipeline) {
-    ListGraphProcessor* count = new ListGraphProcessor();
+    ListGraphProcessor* count = new (pipeline) ListGraphProcessor();
 
     PipelineOutputPort* output = PipelineOutputPort::create(pipeline, count);
     count->_output.setPort(output);
@@ -22,7 +22,7 @@ LoadGMLProcessor::~LoadGMLProcessor() {
 }
 
 LoadGMLProcessor* LoadGMLProcessor::create(PipelineV2* pipeline, std::string_view graphName, const fs::Path& filePath) {
-    LoadGMLProcessor* loadGML = new LoadGMLProcessor(graphName, filePath);
+    LoadGMLProcessor* loadGML = new (pipeline) LoadGMLProcessor(graphName, filePath);
 
     PipelineOutputPort* outName = PipelineOutputPort::create(pipeline, loadGML);
     loadGML->_outName.setPort(outName);
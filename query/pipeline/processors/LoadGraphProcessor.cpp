@@ -20,7 +20,7 @@ LoadGraphProcessor::~LoadGraphProcessor() {
 }
 
 LoadGraphProcessor* LoadGraphProcessor::create(PipelineV2* pipeline, std::string_view graphName) {
-    LoadGraphProcessor* loadGraph = new LoadGraphProcessor(graphName);
+    LoadGraphProcessor* loadGraph = new (pipeline) LoadGraphProcessor(graphName);
 
     PipelineOutputPort* outName = PipelineOutputPort::create(pipeline, loadGraph);
     loadGraph->_outName.setPort(outName);
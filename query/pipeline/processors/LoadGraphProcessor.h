@@ -18,6 +18,8 @@ public:
     void reset() override;
     void execute() override;
 
+    bool hasSideEffects() const override { return true; }
+
     PipelineValueOutputInterface& output() { return _outName; }
 
 protected:
@@ -24,7 +24,7 @@ LoadNeo4jProcessor::~LoadNeo4jProcessor() {
 LoadNeo4jProcessor* LoadNeo4jProcessor::create(PipelineV2* pipeline,
                                                const fs::Path& path,
                                                std::string_view graphName) {
-    LoadNeo4jProcessor* proc = new LoadNeo4jProcessor(path, graphName);
+    LoadNeo4jProcessor* proc = new (pipeline) LoadNeo4jProcessor(path, graphName);
 
     PipelineOutputPort* outName = PipelineOutputPort::create(pipeline, proc);
     proc->_outName.setPort(outName);
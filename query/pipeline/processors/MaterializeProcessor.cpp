@@ -106,7 +106,7 @@ std::string MaterializeProcessor::describe() const {
 }
 
 MaterializeProcessor* MaterializeProcessor::create(PipelineV2* pipeline, LocalMemory* mem) {
-    MaterializeProcessor* materialize = new MaterializeProcessor(mem, pipeline->getDataframeManager());
+    MaterializeProcessor* materialize = new (pipeline) MaterializeProcessor(mem, pipeline->getDataframeManager());
 
     PipelineInputPort* input = PipelineInputPort::create(pipeline, materialize);
     materialize->_input.setPort(input);
@@ -0,0 +1,168 @@
+#include "OuterExpansion.h"
+
+#include <optional>
+
+#include "interfaces/PipelineEdgeOutputInterface.h"
+#include "dataframe/NamedColumn.h"
+#include "columns/ColumnOptMask.h"
+#include "columns/ColumnOptVector.h"
+#include "processors/PredicateProgram.h"
+#include "reader/GraphReader.h"
+#include "LocalMemory.h"
+
+#include "PipelineException.h"
+
+using namespace db;
+
+OuterExpansion::OuterExpansion()
+{
+}
+
+OuterExpansion::~OuterExpansion() {
+}
+
+template <EntityType Entity, SupportedType T>
+Column* OuterExpansion::addProperty(LocalMemory* mem, PropertyTypeID propType) {
+    using Value = typename T::Primitive;
+
+    auto* values = mem->alloc<ColumnOptVector<Value>>();
+
+    _operands.emplace_back([values, propType](const GraphReader& reader,
+                                              const ColumnEdgeIDs& edgeIDs,
+                                              const ColumnNodeIDs& otherIDs) {
+        auto& raw = values->getRaw();
+
+        if constexpr (Entity == EntityType::Node) {
+            raw.resize(otherIDs.size());
+            for (size_t i = 0; i < otherIDs.size(); i++) {
+                const Value* value = reader.tryGetNodeProperty<T>(propType, otherIDs[i]);
+                raw[i] = value ? std::optional<Value> {*value} : std::nullopt;
+            }
+        } else {
+            raw.resize(edgeIDs.size());
+            for (size_t i = 0; i < edgeIDs.size(); i++) {
+                const Value* value = reader.tryGetEdgeProperty<T>(propType, edgeIDs[i]);
+                raw[i] = value ? std::optional<Value> {*value} : std::nullopt;
+            }
+        }
+    });
+
+    return values;
+}
+
+Column* OuterExpansion::addOtherLabelSets(LocalMemory* mem) {
+    auto* labelsets = mem->alloc<ColumnVector<LabelSetID>>();
+
+    _operands.emplace_back([labelsets](const GraphReader& reader,
+                                       const ColumnEdgeIDs&,
+                                       const ColumnNodeIDs& otherIDs) {
+        labelsets->resize(otherIDs.size());
+        for (size_t i = 0; i < otherIDs.size(); i++) {
+            labelsets->set(i, reader.getNodeLabelSet(otherIDs[i]).getID());
+        }
+    });
+
+    return labelsets;
+}
+
+void OuterExpansion::setOutput(const GraphView& view, const PipelineEdgeOutputInterface& output) {
+    _view = view;
+    _indices = dynamic_cast<ColumnIndices*>(output.getIndices()->getColumn());
+    _edgeIDs = dynamic_cast<ColumnEdgeIDs*>(output.getEdgeIDs()->getColumn());
+    _types = dynamic_cast<ColumnEdgeTypes*>(output.getEdgeTypes()->getColumn());
+    _otherIDs = dynamic_cast<ColumnNodeIDs*>(output.getOtherNodes()->getColumn());
+
+    if (!_indices || !_edgeIDs || !_types || !_otherIDs) [[unlikely]] {
+        throw PipelineException("OuterExpansion: the expansion does not write all its edge columns");
+    }
+}
+
+void OuterExpansion::reset(size_t rowCount) {
+    _matched.assign(rowCount, false);
+}
+
+void OuterExpansion::addEdges() {
+    if (_predProg) {
+        filterEdges();
+    }
+
+    for (const size_t row : _indices->getRaw()) {
+        _matched[row] = true;
+    }
+}
+
+void OuterExpansion::filterEdges() {
+    const GraphReader reader = _view.read();
+    for (const OperandWriter& writeOperand : _operands) {
+        writeOperand(reader, *_edgeIDs, *_otherIDs);
+    }
+
+    _predProg->evaluateInstructions();
+    const std::vector<Column*>& predicates = _predProg->getTopLevelPredicates();
+
+    auto& indices = _indices->getRaw();
+    auto& edgeIDs = _edgeIDs->getRaw();
+    auto& types = _types->getRaw();
+    auto& otherIDs = _otherIDs->getRaw();
+
+    // An edge matches if all the predicates are true, not false or null
+    const auto isMatch = [&](size_t row) {
+        for (const Column* predicate : predicates) {
+            const auto* mask = dynamic_cast<const ColumnOptMask*>(predicate);
+            if (!mask || !mask->getRaw()[row].value_or(false)) {
+                return false;
+            }
+        }
+
+        return true;
+    };
+
+    size_t kept = 0;
+    for (size_t row = 0; row < indices.size(); row++) {
+        if (!isMatch(row)) {
+            continue;
+        }
+
+        indices[kept] = indices[row];
+        edgeIDs[kept] = edgeIDs[row];
+        types[kept] = types[row];
+        otherIDs[kept] = otherIDs[row];
+        kept++;
+    }
+
+    indices.resize(kept);
+    edgeIDs.resize(kept);
+    types.resize(kept);
+    otherIDs.resize(kept);
+}
+
+void OuterExpansion::addUnmatchedRows() {
+    auto& indices = _indices->getRaw();
+
+    for (size_t row = 0; row < _matched.size(); row++) {
+        if (!_matched[row]) {
+            indices.push_back(row);
+        }
+    }
+
+    // The IDs appended by resize are default constructed, so invalid
+    const size_t rowCount = indices.size();
+    _edgeIDs->getRaw().resize(rowCount);
+    _types->getRaw().resize(rowCount);
+    _otherIDs->getRaw().resize(rowCount);
+}
+
+namespace db {
+
+template Column* OuterExpansion::addProperty<EntityType::Node, types::Int64>(LocalMemory*, PropertyTypeID);
+template Column* OuterExpansion::addProperty<EntityType::Node, types::UInt64>(LocalMemory*, PropertyTypeID);
+template Column* OuterExpansion::addProperty<EntityType::Node, types::Double>(LocalMemory*, PropertyTypeID);
+template Column* OuterExpansion::addProperty<EntityType::Node, types::String>(LocalMemory*, PropertyTypeID);
+template Column* OuterExpansion::addProperty<EntityType::Node, types::Bool>(LocalMemory*, PropertyTypeID);
+template Column* OuterExpansion::addProperty<EntityType::Edge, types::Int64>(LocalMemory*, PropertyTypeID);
+template Column* OuterExpansion::addProperty<EntityType::Edge, types::UInt64>(LocalMemory*, PropertyTypeID);
+template Column* OuterExpansion::addProperty<EntityType::Edge, types::Double>(LocalMemory*, PropertyTypeID);
+template Column* OuterExpansion::addProperty<EntityType::Edge, types::String>(LocalMemory*, PropertyTypeID);
+template Column* OuterExpansion::addProperty<EntityType::Edge, types::Bool>(LocalMemory*, PropertyTypeID);
+
+}
@@ -0,0 +1,79 @@
+#pragma once
+
+#include <functional>
+#include <vector>
+
+#include "columns/ColumnIndices.h"
+#include "columns/ColumnIDs.h"
+#include "columns/ColumnEdgeTypes.h"
+#include "metadata/PropertyType.h"
+#include "metadata/SupportedType.h"
+#include "views/GraphView.h"
+#include "EntityType.h"
+
+namespace db {
+
+class Column;
+class GraphReader;
+class LocalMemory;
+class PredicateProgram;
+class PipelineEdgeOutputInterface;
+
+/**
+ * @brief Turns the chunks written by an edge expansion into the chunks
+ * of a left outer expansion, used by OPTIONAL MATCH.
+ *
+ * @detail The edges of each chunk, already filtered on their types by the
+ * expansion, are filtered on the predicates of the optional pattern. The input
+ * rows with at least one remaining edge are marked as matched. Once all the
+ * edges of an input chunk are written, the unmatched rows are appended to
+ * the last chunk with invalid edge, edge type and node IDs, which are the
+ * nulls of the optional match.
+ */
+class OuterExpansion {
+public:
+    OuterExpansion();
+    ~OuterExpansion();
+
+    // Predicates of the optional pattern, all of them must be true for an edge to match
+    void setPredicates(PredicateProgram* predProg) { _predProg = predProg; }
+
+    // Adds a column of the values of a property of the edges or of their other
+    // nodes, read for each chunk before evaluating the predicates
+    template <EntityType Entity, SupportedType T>
+    Column* addProperty(LocalMemory* mem, PropertyTypeID propType);
+
+    // Adds a column of the label sets of the other nodes of the edges
+    Column* addOtherLabelSets(LocalMemory* mem);
+
+    void setOutput(const GraphView& view, const PipelineEdgeOutputInterface& output);
+
+    // Starts a new input chunk of rowCount rows
+    void reset(size_t rowCount);
+
+    // Filters the edges of the current chunk and marks their input rows
+    void addEdges();
+
+    // Appends the input rows without edges to the current chunk
+    void addUnmatchedRows();
+
+private:
+    using OperandWriter = std::function<void(const GraphReader& reader,
+                                             const ColumnEdgeIDs& edgeIDs,
+                                             const ColumnNodeIDs& otherIDs)>;
+
+    GraphView _view;
+    ColumnIndices* _indices {nullptr};
+    ColumnEdgeIDs* _edgeIDs {nullptr};
+    ColumnEdgeTypes* _types {nullptr};
+    ColumnNodeIDs* _otherIDs {nullptr};
+
+    PredicateProgram* _predProg {nullptr};
+    std::vector<OperandWriter> _operands;
+
+    std::vector<bool> _matched;
+
+    void filterEdges();
+};
+
+}
@@ -4,7 +4,7 @@
 using namespace db;
 
 PredicateProgram* PredicateProgram::create(PipelineV2* pipeline) {
-    PredicateProgram* prog = new PredicateProgram();
+    PredicateProgram* prog = new (pipeline) PredicateProgram();
     pipeline->addExprProgram(prog);
 
     return prog;
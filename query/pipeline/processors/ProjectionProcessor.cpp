@@ -16,7 +16,7 @@ std::string ProjectionProcessor::describe() const {
 }
 
 ProjectionProcessor* ProjectionProcessor::create(PipelineV2* pipeline) {
-    ProjectionProcessor* proj = new ProjectionProcessor();
+    ProjectionProcessor* proj = new (pipeline) ProjectionProcessor();
 
     PipelineInputPort* input = PipelineInputPort::create(pipeline, proj);
     proj->_input.setPort(input);
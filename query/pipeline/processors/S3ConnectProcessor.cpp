@@ -23,7 +23,7 @@ S3ConnectProcessor* S3ConnectProcessor::create(PipelineV2* pipeline,
                                                std::string_view accessId,
                                                std::string_view secretKey,
                                                std::string_view region) {
-    S3ConnectProcessor* s3Connect = new S3ConnectProcessor(accessId, secretKey, region);
+    S3ConnectProcessor* s3Connect = new (pipeline) S3ConnectProcessor(accessId, secretKey, region);
 
     PipelineOutputPort* output = PipelineOutputPort::create(pipeline, s3Connect);
     s3Connect->_output.setPort(output);
@@ -54,6 +54,9 @@ void S3ConnectProcessor::execute() {
                         std::string(_secretKey),
                         std::string(_region));
 
+    // Large graph files are transferred by parts on the job system
+    sysMan->getS3Client()->setJobSystem(_ctxt->getJobSystem());
+
     spdlog::info("Sucesfully Connected To S3 Account!");
     _output.getPort()->writeData();
     finish();
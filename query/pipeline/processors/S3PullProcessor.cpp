@@ -29,7 +29,7 @@ S3PullProcessor* S3PullProcessor::create(PipelineV2* pipeline,
                                          std::string_view s3Prefix,
                                          std::string_view s3File,
                                          std::string_view localPath) {
-    S3PullProcessor* s3Pull = new S3PullProcessor(s3Bucket, s3Prefix, s3File, localPath);
+    S3PullProcessor* s3Pull = new (pipeline) S3PullProcessor(s3Bucket, s3Prefix, s3File, localPath);
 
     PipelineOutputPort* output = PipelineOutputPort::create(pipeline, s3Pull);
     s3Pull->_output.setPort(output);
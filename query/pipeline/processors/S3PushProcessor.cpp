@@ -28,7 +28,7 @@ S3PushProcessor* S3PushProcessor::create(PipelineV2* pipeline,
                                          std::string_view s3Prefix,
                                          std::string_view s3File,
                                          std::string_view localPath) {
-    S3PushProcessor* s3Push = new S3PushProcessor(s3Bucket, s3Prefix, s3File, localPath);
+    S3PushProcessor* s3Push = new (pipeline) S3PushProcessor(s3Bucket, s3Prefix, s3File, localPath);
 
     PipelineOutputPort* output = PipelineOutputPort::create(pipeline, s3Push);
     s3Push->_output.setPort(output);
@@ -23,7 +23,7 @@ std::string ScanNodesByLabelProcessor::describe() const {
 }
 
 ScanNodesByLabelProcessor* ScanNodesByLabelProcessor::create(PipelineV2* pipeline, const LabelSet* labelset) {
-    ScanNodesByLabelProcessor* scanNodes = new ScanNodesByLabelProcessor(labelset);
+    ScanNodesByLabelProcessor* scanNodes = new (pipeline) ScanNodesByLabelProcessor(labelset);
 
     PipelineOutputPort* outNodeIDs = PipelineOutputPort::create(pipeline, scanNodes);
     scanNodes->_outNodeIDs.setPort(outNodeIDs);
@@ -49,7 +49,7 @@ void ScanNodesByLabelProcessor::reset() {
 }
 
 void ScanNodesByLabelProcessor::execute() {
-    _it->fill(_ctxt->getChunkSize());
+    _it->fill(nextChunkSize());
 
     if (!_it->isValid()) {
         finish();
@@ -23,7 +23,7 @@ std::string ScanNodesProcessor::describe() const {
 }
 
 ScanNodesProcessor* ScanNodesProcessor::create(PipelineV2* pipeline) {
-    ScanNodesProcessor* scanNodes = new ScanNodesProcessor();
+    ScanNodesProcessor* scanNodes = new (pipeline) ScanNodesProcessor();
 
     PipelineOutputPort* outNodeIDs = PipelineOutputPort::create(pipeline, scanNodes);
     scanNodes->_outNodeIDs.setPort(outNodeIDs);
@@ -48,7 +48,7 @@ void ScanNodesProcessor::reset() {
 }
 
 void ScanNodesProcessor::execute() {
-    _it->fill(_ctxt->getChunkSize());
+    _it->fill(nextChunkSize());
 
     if (!_it->isValid()) {
         finish();
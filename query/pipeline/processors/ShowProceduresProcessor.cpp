@@ -8,32 +8,9 @@
 #include "metadata/PropertyType.h"
 #include "procedures/ProcedureBlueprintMap.h"
 #include "procedures/ProcedureBlueprint.h"
-#include "procedures/ProcedureReturnValues.h"
 
 using namespace db;
 
-namespace {
-
-void buildSignature(std::string& result, const ProcedureBlueprint& blueprint) {
-    result.clear();
-    result += blueprint._name;
-    result += "() :: (";
-
-    bool first = true;
-    for (const auto& rv : blueprint._returnValues) {
-        if (!first) {
-            result += ", ";
-        }
-        result += rv._name;
-        result += " :: ";
-        result += ProcedureReturnTypeName::value(rv._type);
-        first = false;
-    }
-    result += ")";
-}
-
-}
-
 ShowProceduresProcessor::ShowProceduresProcessor()
 {
 }
@@ -46,7 +23,7 @@ std::string ShowProceduresProcessor::describe() const {
 }
 
 ShowProceduresProcessor* ShowProceduresProcessor::create(PipelineV2* pipeline) {
-    ShowProceduresProcessor* proc = new ShowProceduresProcessor();
+    ShowProceduresProcessor* proc = new (pipeline) ShowProceduresProcessor();
 
     PipelineOutputPort* output = PipelineOutputPort::create(pipeline, proc);
     proc->_output.setPort(output);
@@ -74,7 +51,7 @@ void ShowProceduresProcessor::execute() {
     std::string signature;
     for (const auto& blueprint : blueprints) {
         colName->push_back(blueprint._name);
-        buildSignature(signature, blueprint);
+        blueprint.buildSignature(signature);
         colSignature->push_back(signature);
     }
 
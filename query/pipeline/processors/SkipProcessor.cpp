@@ -22,7 +22,7 @@ std::string SkipProcessor::describe() const {
 }
 
 SkipProcessor* SkipProcessor::create(PipelineV2* pipeline, size_t skipCount) {
-    SkipProcessor* skip = new SkipProcessor(skipCount);
+    SkipProcessor* skip = new (pipeline) SkipProcessor(skipCount);
 
     PipelineInputPort* input = PipelineInputPort::create(pipeline, skip);
     skip->_input.setPort(input);
@@ -38,6 +38,9 @@ SkipProcessor* SkipProcessor::create(PipelineV2* pipeline, size_t skipCount) {
 }
 
 void SkipProcessor::prepare(ExecutionContext* ctxt) {
+    _skipping = true;
+    _currentRowCount = 0;
+
     markAsPrepared();
 }
 
@@ -16,6 +16,8 @@ public:
     PipelineBlockInputInterface& input() { return _input; }
     PipelineBlockOutputInterface& output() { return _output; }
 
+    size_t getSkipCount() const { return _skipCount; }
+
     void prepare(ExecutionContext* ctxt) override;
     void reset() override;
     void execute() override;
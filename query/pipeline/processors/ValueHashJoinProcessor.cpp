@@ -0,0 +1,358 @@
+#include "ValueHashJoinProcessor.h"
+
+#include <concepts>
+
+#include "PipelineV2.h"
+#include "PipelinePort.h"
+#include "ExecutionContext.h"
+#include "columns/ColumnVector.h"
+#include "columns/ColumnOptVector.h"
+#include "columns/ColumnDispatcher.h"
+#include "dataframe/NamedColumn.h"
+#include "metadata/PropertyType.h"
+
+#include "FatalException.h"
+
+using namespace db;
+
+namespace {
+
+// Rows per partition before the number of partitions is doubled
+constexpr size_t PARTITION_CAPACITY = 1 << 16;
+constexpr size_t MAX_PARTITION_BITS = 10;
+
+template <typename T>
+concept JoinKeyType = std::same_as<T, types::Int64::Primitive>
+                   || std::same_as<T, types::UInt64::Primitive>
+                   || std::same_as<T, types::Double::Primitive>
+                   || std::same_as<T, types::String::Primitive>
+                   || std::same_as<T, types::Bool::Primitive>
+                   || std::same_as<T, std::string>;
+
+// Finalizer of MurmurHash3, the partitions are chosen on the high bits
+// and std::hash is the identity for integers
+size_t mixHash(size_t hash) {
+    hash ^= hash >> 33;
+    hash *= 0xff51afd7ed558ccdULL;
+    hash ^= hash >> 33;
+    hash *= 0xc4ceb9fe1a85ec53ULL;
+    hash ^= hash >> 33;
+    return hash;
+}
+
+template <typename T>
+std::optional<size_t> hashKey(const T& value) {
+    if constexpr (std::same_as<T, types::Bool::Primitive>) {
+        return mixHash(value._boolean ? 1 : 0);
+    } else if constexpr (std::same_as<T, types::Double::Primitive>) {
+        // -0.0 and 0.0 are equal
+        const double normalized = value == 0.0 ? 0.0 : value;
+        return mixHash(std::hash<double> {}(normalized));
+    } else if constexpr (JoinKeyType<T>) {
+        return mixHash(std::hash<T> {}(value));
+    } else {
+        throw FatalException("ValueHashJoinProcessor can not join on a column of this type");
+    }
+}
+
+template <typename T>
+std::optional<size_t> hashKey(const std::optional<T>& value) {
+    if (!value) {
+        return std::nullopt;
+    }
+
+    return hashKey(*value);
+}
+
+template <typename T>
+bool keysEqual(const T& lhs, const T& rhs) {
+    if constexpr (JoinKeyType<T>) {
+        return lhs == rhs;
+    } else {
+        return false;
+    }
+}
+
+template <typename T>
+bool keysEqual(const std::optional<T>& lhs, const std::optional<T>& rhs) {
+    return lhs && rhs && keysEqual(*lhs, *rhs);
+}
+
+void clearDataframe(Dataframe* df) {
+    for (NamedColumn* nCol : df->cols()) {
+        Column* col = nCol->getColumn();
+        dispatchColumnVector(col, [](auto* colVec) { colVec->clear(); });
+    }
+}
+
+}
+
+ValueHashTable::ValueHashTable()
+    : _partitions(1)
+{
+}
+
+ValueHashTable::~ValueHashTable() {
+}
+
+void ValueHashTable::clear() {
+    _partitions.clear();
+    _partitions.resize(1);
+    _partitionBits = 0;
+    _rowCount = 0;
+}
+
+void ValueHashTable::insert(size_t hash, size_t row) {
+    if (_rowCount >= _partitions.size() * PARTITION_CAPACITY
+        && _partitionBits < MAX_PARTITION_BITS) {
+        repartition();
+    }
+
+    _partitions[getPartitionIndex(hash)][hash].push_back(row);
+    _rowCount++;
+}
+
+const ValueHashTable::Rows* ValueHashTable::find(size_t hash) const {
+    const Partition& partition = _partitions[getPartitionIndex(hash)];
+
+    const auto it = partition.find(hash);
+    if (it == partition.end()) {
+        return nullptr;
+    }
+
+    return &it->second;
+}
+
+size_t ValueHashTable::getPartitionIndex(size_t hash) const {
+    if (_partitionBits == 0) {
+        return 0;
+    }
+
+    return hash >> (sizeof(size_t) * 8 - _partitionBits);
+}
+
+void ValueHashTable::repartition() {
+    std::vector<Partition> oldPartitions = std::move(_partitions);
+
+    _partitionBits++;
+    _partitions.clear();
+    _partitions.resize(size_t {1} << _partitionBits);
+
+    for (Partition& partition : oldPartitions) {
+        for (auto& [hash, rows] : partition) {
+            _partitions[getPartitionIndex(hash)].emplace(hash, std::move(rows));
+        }
+    }
+}
+
+ValueHashJoinProcessor::ValueHashJoinProcessor(ColumnTag leftJoinKey,
+                                               ColumnTag rightJoinKey)
+    : _leftJoinKey(leftJoinKey),
+    _rightJoinKey(rightJoinKey)
+{
+}
+
+ValueHashJoinProcessor* ValueHashJoinProcessor::create(PipelineV2* pipeline,
+                                                       ColumnTag leftJoinKey,
+                                                       ColumnTag rightJoinKey) {
+    auto* processor = new (pipeline) ValueHashJoinProcessor(leftJoinKey, rightJoinKey);
+
+    {
+        PipelineInputPort* lhsInput = PipelineInputPort::create(pipeline, processor);
+        processor->_lhs.setPort(lhsInput);
+        processor->addInput(lhsInput);
+        lhsInput->setNeedsData(false);
+    }
+
+    {
+        PipelineInputPort* rhsInput = PipelineInputPort::create(pipeline, processor);
+        processor->_rhs.setPort(rhsInput);
+        processor->addInput(rhsInput);
+        rhsInput->setNeedsData(false);
+    }
+
+    {
+        PipelineOutputPort* output = PipelineOutputPort::create(pipeline, processor);
+        processor->_out.setPort(output);
+        processor->addOutput(output);
+    }
+
+    processor->postCreate(pipeline);
+    return processor;
+}
+
+std::string ValueHashJoinProcessor::describe() const {
+    return fmt::format("ValueHashJoinProcessor @={}", fmt::ptr(this));
+}
+
+void ValueHashJoinProcessor::prepare(ExecutionContext* ctxt) {
+    _ctxt = ctxt;
+
+    clearDataframe(&_leftMemory);
+    clearDataframe(&_rightMemory);
+    _leftTable.clear();
+    _rightTable.clear();
+
+    _probeSide = Side::LEFT;
+    _probeRow = 0;
+    _probeEnd = 0;
+    _matchPos = 0;
+    _probeHashes.clear();
+
+    _leftRows.clear();
+    _rightRows.clear();
+
+    markAsPrepared();
+}
+
+void ValueHashJoinProcessor::reset() {
+    markAsReset();
+}
+
+void ValueHashJoinProcessor::execute() {
+    _leftRows.clear();
+    _rightRows.clear();
+
+    const size_t chunkSize = _ctxt->getChunkSize();
+
+    // Probe the pending rows first, the next chunks are only
+    // received once all the pairs of the previous ones are emitted
+    while (_leftRows.size() < chunkSize) {
+        if (hasPendingProbe()) {
+            probe();
+            continue;
+        }
+
+        if (_lhs.getPort()->hasData()) {
+            ingest(Side::LEFT);
+            continue;
+        }
+
+        if (_rhs.getPort()->hasData()) {
+            ingest(Side::RIGHT);
+            continue;
+        }
+
+        break;
+    }
+
+    if (!_leftRows.empty()) {
+        emitOutput();
+    } else if (_lhs.getPort()->isClosed() && _rhs.getPort()->isClosed()) {
+        // Write an empty chunk so that the following processor can execute
+        clearDataframe(_out.getDataframe());
+        _out.getPort()->writeData();
+    }
+
+    // The output chunk is full, continue in the next cycle
+    if (hasPendingProbe() || _lhs.getPort()->hasData() || _rhs.getPort()->hasData()) {
+        return;
+    }
+
+    finish();
+}
+
+void ValueHashJoinProcessor::ingest(Side side) {
+    const bool isLeft = side == Side::LEFT;
+    PipelineBlockInputInterface& input = isLeft ? _lhs : _rhs;
+    Dataframe& memory = isLeft ? _leftMemory : _rightMemory;
+    ValueHashTable& table = isLeft ? _leftTable : _rightTable;
+    const ColumnTag joinKey = isLeft ? _leftJoinKey : _rightJoinKey;
+
+    const size_t firstRow = memory.getRowCount();
+    memory.append(input.getDataframe());
+    input.getPort()->consume();
+
+    const size_t endRow = memory.getRowCount();
+    Column* keyCol = memory.getColumn(joinKey)->getColumn();
+
+    _probeHashes.clear();
+    dispatchColumnVector(keyCol, [&](auto* col) {
+        const auto& raw = col->getRaw();
+        for (size_t row = firstRow; row < endRow; row++) {
+            _probeHashes.push_back(hashKey(raw[row]));
+        }
+    });
+
+    // The new rows are probed against the other side only,
+    // so they can already be indexed for the next chunks of the other side
+    for (size_t i = 0; i < _probeHashes.size(); i++) {
+        if (_probeHashes[i]) {
+            table.insert(*_probeHashes[i], firstRow + i);
+        }
+    }
+
+    _probeSide = side;
+    _probeRow = firstRow;
+    _probeEnd = endRow;
+    _matchPos = 0;
+}
+
+void ValueHashJoinProcessor::probe() {
+    const bool isLeft = _probeSide == Side::LEFT;
+    Dataframe& probeMemory = isLeft ? _leftMemory : _rightMemory;
+    Dataframe& buildMemory = isLeft ? _rightMemory : _leftMemory;
+    const ValueHashTable& buildTable = isLeft ? _rightTable : _leftTable;
+    std::vector<size_t>& probeRows = isLeft ? _leftRows : _rightRows;
+    std::vector<size_t>& buildRows = isLeft ? _rightRows : _leftRows;
+
+    Column* probeKeyCol = probeMemory.getColumn(isLeft ? _leftJoinKey : _rightJoinKey)->getColumn();
+    Column* buildKeyCol = buildMemory.getColumn(isLeft ? _rightJoinKey : _leftJoinKey)->getColumn();
+
+    const size_t chunkSize = _ctxt->getChunkSize();
+    const size_t firstRow = _probeEnd - _probeHashes.size();
+
+    dispatchColumnVector(probeKeyCol, [&](auto* probeCol) {
+        const auto* buildCol = static_cast<decltype(probeCol)>(buildKeyCol);
+        const auto& probeRaw = probeCol->getRaw();
+        const auto& buildRaw = buildCol->getRaw();
+
+        for (; _probeRow < _probeEnd; _probeRow++) {
+            const std::optional<size_t>& hash = _probeHashes[_probeRow - firstRow];
+            const ValueHashTable::Rows* matches = hash ? buildTable.find(*hash) : nullptr;
+
+            if (matches) {
+                for (; _matchPos < matches->size(); _matchPos++) {
+                    if (probeRows.size() == chunkSize) {
+                        // Resume from this match in the next cycle
+                        return;
+                    }
+
+                    // Different keys can have the same hash
+                    const size_t buildRow = (*matches)[_matchPos];
+                    if (keysEqual(probeRaw[_probeRow], buildRaw[buildRow])) {
+                        probeRows.push_back(_probeRow);
+                        buildRows.push_back(buildRow);
+                    }
+                }
+            }
+
+            _matchPos = 0;
+        }
+    });
+}
+
+void ValueHashJoinProcessor::emitOutput() {
+    const auto& outCols = _out.getDataframe()->cols();
+    const size_t leftColCount = _leftMemory.size();
+
+    for (size_t i = 0; i < outCols.size(); i++) {
+        const bool isLeft = i < leftColCount;
+        const Dataframe& memory = isLeft ? _leftMemory : _rightMemory;
+        const std::vector<size_t>& rows = isLeft ? _leftRows : _rightRows;
+        Column* src = memory.cols()[isLeft ? i : i - leftColCount]->getColumn();
+
+        dispatchColumnVector(outCols[i]->getColumn(), [&](auto* outCol) {
+            const auto* srcCol = static_cast<decltype(outCol)>(src);
+            const auto& srcRaw = srcCol->getRaw();
+            auto& outRaw = outCol->getRaw();
+
+            outRaw.resize(rows.size());
+            for (size_t row = 0; row < rows.size(); row++) {
+                outRaw[row] = srcRaw[rows[row]];
+            }
+        });
+    }
+
+    _out.getPort()->writeData();
+}
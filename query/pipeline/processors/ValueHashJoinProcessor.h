@@ -0,0 +1,127 @@
+#pragma once
+
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+#include "Processor.h"
+
+#include "interfaces/PipelineBlockInputInterface.h"
+#include "interfaces/PipelineBlockOutputInterface.h"
+
+#include "dataframe/ColumnTag.h"
+#include "dataframe/Dataframe.h"
+
+namespace db {
+
+class PipelineV2;
+
+/**
+ * @brief Rows of one side of a value join indexed by the hash of their key.
+ *
+ * @detail The rows are radix partitioned on the high bits of the hash, and the
+ * number of partitions doubles as the side grows. A large build side is thus split
+ * in bounded partitions instead of one large hash map, and each probe only touches
+ * one of them. Everything stays in memory, nothing is spilled.
+ */
+class ValueHashTable {
+public:
+    using Rows = std::vector<size_t>;
+
+    ValueHashTable();
+    ~ValueHashTable();
+
+    void clear();
+
+    void insert(size_t hash, size_t row);
+
+    // Rows whose key has the given hash, nullptr if there are none
+    const Rows* find(size_t hash) const;
+
+    size_t size() const { return _rowCount; }
+    size_t getPartitionCount() const { return _partitions.size(); }
+
+private:
+    using Partition = std::unordered_map<size_t, Rows>;
+
+    std::vector<Partition> _partitions;
+    size_t _partitionBits {0};
+    size_t _rowCount {0};
+
+    size_t getPartitionIndex(size_t hash) const;
+    void repartition();
+};
+
+/**
+ * @brief Equi-join of two streams on property values.
+ *
+ * @detail Both sides are consumed as their chunks arrive: the rows of a new chunk
+ * are probed against the hash table of the other side, then inserted in the hash
+ * table of their own side. Each matching pair is emitted exactly once, by the
+ * last of its two rows to arrive.
+ *
+ * The output has the columns of the left hand side followed by the columns of
+ * the right hand side, as for the cartesian product. Null keys never match.
+ */
+class ValueHashJoinProcessor final : public Processor {
+public:
+    static ValueHashJoinProcessor* create(PipelineV2* pipeline,
+                                          ColumnTag leftJoinKey,
+                                          ColumnTag rightJoinKey);
+
+    void prepare(ExecutionContext* ctxt) final;
+    void reset() final;
+    void execute() final;
+
+    std::string describe() const final;
+
+    PipelineBlockInputInterface& leftHandSide() { return _lhs; }
+    PipelineBlockInputInterface& rightHandSide() { return _rhs; }
+    PipelineBlockOutputInterface& output() { return _out; }
+
+    Dataframe& leftMemory() { return _leftMemory; }
+    Dataframe& rightMemory() { return _rightMemory; }
+
+private:
+    enum class Side {
+        LEFT,
+        RIGHT
+    };
+
+    ValueHashJoinProcessor(ColumnTag leftJoinKey, ColumnTag rightJoinKey);
+    ~ValueHashJoinProcessor() final = default;
+
+    PipelineBlockInputInterface _lhs;
+    PipelineBlockInputInterface _rhs;
+    PipelineBlockOutputInterface _out;
+
+    ColumnTag _leftJoinKey;
+    ColumnTag _rightJoinKey;
+
+    // All the rows received so far on each side
+    Dataframe _leftMemory;
+    Dataframe _rightMemory;
+
+    ValueHashTable _leftTable;
+    ValueHashTable _rightTable;
+
+    // Rows of the last received chunk, in the memory of _probeSide,
+    // that still need to be probed against the other side
+    Side _probeSide {Side::LEFT};
+    size_t _probeRow {0};
+    size_t _probeEnd {0};
+    size_t _matchPos {0};
+    std::vector<std::optional<size_t>> _probeHashes;
+
+    // Pairs of rows of the left and right memories to emit in the current chunk
+    std::vector<size_t> _leftRows;
+    std::vector<size_t> _rightRows;
+
+    bool hasPendingProbe() const { return _probeRow < _probeEnd; }
+
+    void ingest(Side side);
+    void probe();
+    void emitOutput();
+};
+
+}
@@ -10,6 +10,7 @@
 #include "ExecutionContext.h"
 
 #include "columns/ColumnConst.h"
+#include "columns/ColumnOptVector.h"
 #include "metadata/PropertyType.h"
 #include "metadata/SupportedType.h"
 #include "processors/ExprProgram.h"
@@ -60,53 +61,104 @@ void validateDeletions(const GraphReader reader, const ColumnVector<IDT>* col) {
 template void validateDeletions<NodeID>(const GraphReader reader, const ColumnVector<NodeID>* col);
 template void validateDeletions<EdgeID>(const GraphReader reader, const ColumnVector<EdgeID>* col);
 
-CommitWriteBuffer::UntypedProperty getConstPropertyValue(Column* valueCol,
-                                                         ValueType type,
-                                                         PropertyTypeID propID) {
+// Calls @param func with the SupportedType matching @param type
+template <typename Func>
+void dispatchValueType(ValueType type, Func&& func) {
     switch (type) {
         case ValueType::Int64: {
-            const auto* casted = dynamic_cast<ColumnConst<types::Int64::Primitive>*>(valueCol);
-            bioassert(casted, "Could not get constant property value.");
-            return {propID, casted->getRaw()};
+            func.template operator()<types::Int64>();
         }
-        break;
+        return;
 
         case ValueType::UInt64: {
-            const auto* casted = dynamic_cast<ColumnConst<types::UInt64::Primitive>*>(valueCol);
-            bioassert(casted, "Could not get constant property value.");
-            return {propID, casted->getRaw()};
+            func.template operator()<types::UInt64>();
         }
-        break;
+        return;
+
+        case ValueType::Double: {
+            func.template operator()<types::Double>();
+        }
+        return;
 
         case ValueType::String: {
-            const auto* casted = dynamic_cast<ColumnConst<types::String::Primitive>*>(valueCol);
-            bioassert(casted, "Could not get constant property value.");
-            return {propID, std::string(casted->getRaw())};
+            func.template operator()<types::String>();
+        }
+        return;
 
+        case ValueType::Bool: {
+            func.template operator()<types::Bool>();
         }
+        return;
+
+        case ValueType::Invalid:
+        case ValueType::_SIZE:
         break;
+    }
 
-        case ValueType::Double: {
-            const auto* casted = dynamic_cast<ColumnConst<types::Double::Primitive>*>(valueCol);
-            bioassert(casted, "Could not get constant property value.");
-            return {propID, casted->getRaw()};
+    throw FatalException("Property value column with invalid type.");
+}
+
+// Checks that @param valueCol holds values of type @param type for @param count
+// entities: either a constant, or one (possibly null) value per entity
+void checkPropertyColumn(ValueType type, const Column* valueCol, size_t count) {
+    dispatchValueType(type, [&]<SupportedType T>() {
+        using Primitive = T::Primitive;
+
+        if (dynamic_cast<const ColumnConst<Primitive>*>(valueCol)) {
+            return;
         }
-        break;
 
-        case ValueType::Bool: {
-            const auto* casted = dynamic_cast<ColumnConst<types::Bool::Primitive>*>(valueCol);
-            bioassert(casted, "Could not get constant property value.");
-            return {propID, casted->getRaw()};
+        if (const auto* col = dynamic_cast<const ColumnVector<Primitive>*>(valueCol)) {
+            if (col->size() == count) {
+                return;
+            }
         }
-        break;
 
-        case ValueType::Invalid:
-        case ValueType::_SIZE: {
-            throw FatalException("Property value column with invalid type.");
+        if (const auto* col = dynamic_cast<const ColumnOptVector<Primitive>*>(valueCol)) {
+            if (col->size() == count) {
+                return;
+            }
+        }
+
+        throw FatalException("Property value column does not match the property type.");
+    });
+}
+
+// Appends the values of @param valueCol to @param column, for the @param count
+// pending entities starting at offset @param first. Null values are skipped.
+// @warn @param valueCol must have been checked with @ref checkPropertyColumn
+template <SupportedType T>
+void appendPropertyColumn(TypedPropertyContainer<T>& column,
+                          const Column* valueCol,
+                          size_t first,
+                          size_t count) {
+    using Primitive = T::Primitive;
+
+    column.ids().reserve(column.size() + count);
+
+    if (const auto* col = dynamic_cast<const ColumnConst<Primitive>*>(valueCol)) {
+        const Primitive& value = col->getRaw();
+        for (size_t i = 0; i < count; i++) {
+            column.add(first + i, value);
+        }
+        return;
+    }
+
+    if (const auto* col = dynamic_cast<const ColumnVector<Primitive>*>(valueCol)) {
+        const auto& values = col->getRaw();
+        for (size_t i = 0; i < count; i++) {
+            column.add(first + i, values[i]);
+        }
+        return;
+    }
+
+    const auto* col = static_cast<const ColumnOptVector<Primitive>*>(valueCol);
+    const auto& values = col->getRaw();
+    for (size_t i = 0; i < count; i++) {
+        if (values[i]) {
+            column.add(first + i, *values[i]);
         }
-        break;
     }
-    throw FatalException("Failed to match against property value type.");
 }
 
 }
@@ -117,7 +169,7 @@ WriteProcessor::WriteProcessor(ExprProgram* exprProg)
 }
 
 WriteProcessor* WriteProcessor::create(PipelineV2* pipeline, ExprProgram* exprProg, bool hasInput) {
-    auto* processor = new WriteProcessor(exprProg);
+    auto* processor = new (pipeline) WriteProcessor(exprProg);
 
     if (hasInput) {
         processor->_input = std::make_optional<PipelineBlockInputInterface>();
@@ -212,6 +264,22 @@ void WriteProcessor::performDeletions() {
     }
 }
 
+void WriteProcessor::getPropertyColumns(const WriteProcessorTypes::PropertyConstraints& props,
+                                        size_t numIters,
+                                        std::vector<PropertyColumn>& columns) {
+    columns.clear();
+    columns.reserve(props.size());
+
+    for (const auto& [name, type, valueCol] : props) {
+        checkPropertyColumn(type, valueCol, numIters);
+
+        const PropertyTypeID propID =
+            _metadataBuilder->getOrCreatePropertyType(name, type)._id;
+
+        columns.emplace_back(propID, type, valueCol);
+    }
+}
+
 LabelSet WriteProcessor::getLabelSet(std::span<const std::string_view> labels) {
     LabelSet labelset;
     for (const std::string_view label : labels) {
@@ -222,10 +290,10 @@ LabelSet WriteProcessor::getLabelSet(std::span<const std::string_view> labels) {
 }
 
 void WriteProcessor::createNodes(size_t numIters) {
-    NodeID nextNodeID = _writeBuffer->numPendingNodes();
     const Dataframe* outDf = _output.getDataframe();
 
     LabelSet lblset;
+    std::vector<PropertyColumn> propColumns;
     for (const WriteProcessorTypes::PendingNode& node : _pendingNodes) {
         // This is checked for validity in the call to @ref setup
         auto* createdNodeCol = outDf->getColumn(node._tag)->as<ColumnNodeIDs>();
@@ -242,36 +310,22 @@ void WriteProcessor::createNodes(size_t numIters) {
         }
         lblset = getLabelSet(labels);
 
-        // Get all properties: this can throw, so we do this BEFORE adding PendingNodes to
-        // CommitWriteBuffer, as otherwise after throwing this could leave it in invalid
-        // state.
-        std::vector<CommitWriteBuffer::UntypedProperty> constProps;
-        constProps.reserve(node._properties.size());
-        for (const auto& [name, type, valueCol] : node._properties) {
-            const PropertyTypeID propID =
-                _metadataBuilder->getOrCreatePropertyType(name, type)._id;
-
-            constProps.emplace_back(getConstPropertyValue(valueCol, type, propID));
-        }
-
-        {
-            // Create nodes, set label set
-            const size_t numPendingNodesPrior = _writeBuffer->numPendingNodes();
-            const LabelSetHandle hdl = _metadataBuilder->getOrCreateLabelSet(lblset);
-            for (size_t row = 0; row < numIters; row++) {
-                CommitWriteBuffer::PendingNode& newNode = _writeBuffer->newPendingNode();
-                newNode.labelsetHandle = hdl;
-            }
-
-            // Add each property; NOTE: for now all ColumnConst, so all same value.
-            // Extract the value first, then add that value to each node to create.
-            // TODO: More cache friendly access patterns
-            for (const CommitWriteBuffer::UntypedProperty& prop : constProps) {
-                for (size_t i = 0; i < numIters; i++) {
-                    auto& pendingNode = _writeBuffer->getPendingNode(numPendingNodesPrior + i);
-                    pendingNode.properties.emplace_back(prop);
-                }
-            }
+        // Check all property columns: this can throw, so we do this BEFORE adding
+        // PendingNodes to CommitWriteBuffer, as otherwise after throwing this could leave
+        // it in invalid state.
+        getPropertyColumns(node._properties, numIters, propColumns);
+
+        // Create nodes, set label set
+        const LabelSetHandle hdl = _metadataBuilder->getOrCreateLabelSet(lblset);
+        const CommitWriteBuffer::PendingNodeOffset firstNode =
+            _writeBuffer->newPendingNodes(hdl, numIters);
+
+        // Append each property as a whole column
+        for (const PropertyColumn& prop : propColumns) {
+            dispatchValueType(prop._type, [&]<SupportedType T>() {
+                auto& column = _writeBuffer->getOrCreateNodePropertyColumn<T>(prop._propID);
+                appendPropertyColumn(column, prop._values, firstNode, numIters);
+            });
         }
 
         // Populate the output column for this node with the index in the CWB which it
@@ -281,10 +335,8 @@ void WriteProcessor::createNodes(size_t numIters) {
         std::vector<NodeID>& raw = createdNodeCol->getRaw();
         const size_t oldSize = raw.size();
         raw.resize(oldSize + numIters);
-        std::iota(raw.begin() + oldSize, raw.end(), nextNodeID);
+        std::iota(raw.begin() + oldSize, raw.end(), NodeID {firstNode});
         _writtenRowsThisCycle |= raw.size() > oldSize;
-
-        nextNodeID += numIters;
     }
 }
 
@@ -294,6 +346,7 @@ void WriteProcessor::createEdges(size_t numIters) {
     const Dataframe* inDf = _input ? _input->getDataframe() : nullptr;
     const Dataframe* outDf = _output.getDataframe();
 
+    std::vector<PropertyColumn> propColumns;
     for (const WriteProcessorTypes::PendingEdge& edge : _pendingEdges) {
         // This is checked for validity in the call to @ref setup
         auto* createdEdgeColumn = outDf->getColumn(edge._tag)->as<ColumnEdgeIDs>();
@@ -346,17 +399,10 @@ void WriteProcessor::createEdges(size_t numIters) {
         bioassert(tgtCol->size() == srcCol->size(), "src and target column should have same dimension");
         bioassert(tgtCol->size() == numIters, "invalid size of target column");
 
-        // Get all properties: this can throw, so we do this BEFORE adding PendingEdges to
-        // CommitWriteBuffer, as otherwise after throwing this could leave it in invalid
-        // state.
-        std::vector<CommitWriteBuffer::UntypedProperty> constProps;
-        constProps.reserve(edge._properties.size());
-        for (const auto& [name, type, valueCol] : edge._properties) {
-            const PropertyTypeID propID =
-                _metadataBuilder->getOrCreatePropertyType(name, type)._id;
-
-            constProps.emplace_back(getConstPropertyValue(valueCol, type, propID));
-        }
+        // Check all property columns: this can throw, so we do this BEFORE adding
+        // PendingEdges to CommitWriteBuffer, as otherwise after throwing this could leave
+        // it in invalid state.
+        getPropertyColumns(edge._properties, numIters, propColumns);
 
         const size_t numPendingEdgesPrior = _writeBuffer->numPendingEdges();
         const EdgeTypeID typeID = _metadataBuilder->getOrCreateEdgeType(edge._edgeType);
@@ -387,17 +433,14 @@ void WriteProcessor::createEdges(size_t numIters) {
             pendingEdge.edgeType = typeID;
         }
 
-        // Add each property; NOTE: for now all ColumnConst, so all same value.
-        // Extract the value first, then add that value to each node to create.
-        // TODO: More cache friendly access patterns
-        for (const CommitWriteBuffer::UntypedProperty& prop : constProps) {
-            for (size_t i = 0; i < numIters; i++) {
-                auto& pendingEdge = _writeBuffer->getPendingEdge(numPendingEdgesPrior + i);
-                pendingEdge.properties.emplace_back(prop);
-            }
+        // Append each property as a whole column
+        for (const PropertyColumn& prop : propColumns) {
+            dispatchValueType(prop._type, [&]<SupportedType T>() {
+                auto& column = _writeBuffer->getOrCreateEdgePropertyColumn<T>(prop._propID);
+                appendPropertyColumn(column, prop._values, numPendingEdgesPrior, numIters);
+            });
         }
 
-
         // Populate the output column for this edge with the index in the CWB which it
         // appears. These indexes are later transformed into "fake IDs" (an estimate as to
         // what the EdgeID will be when it is committed) in @ref postProcessFakeIDs.
@@ -43,6 +43,8 @@ public:
     void reset() final;
     void execute() final;
 
+    bool hasSideEffects() const final { return true; }
+
     void setPendingNodes(const PendingNodes& nodes) { _pendingNodes = nodes; }
     void setPendingEdges(const PendingEdges& edges) { _pendingEdges = edges; }
 
@@ -63,6 +65,14 @@ public:
     }
 
 private:
+    // Property of the entities created by a pending node/edge, with its resolved
+    // property type and the column holding its values
+    struct PropertyColumn {
+        PropertyTypeID _propID;
+        ValueType _type;
+        const Column* _values {nullptr};
+    };
+
     // WriteProcessor may have an input, but it does not require one.
     // @ref WriteProcessor::create may default initialise a block input, otherwise the
     // default state of the processor is no input (nullopt)
@@ -112,7 +122,8 @@ private:
 
     /**
      * @brief Adds @param numIters copies of each element of @ref _pendingNodes to @ref
-     * _writeBuffer. Fills @ref _output dataframe with the index in @ref
+     * _writeBuffer. Properties are appended to the columns of @ref _writeBuffer as whole
+     * columns of the input. Fills @ref _output dataframe with the index in @ref
      * _writeBuffer::_pendingNodes for which each node can be found.
      */
     void createNodes(size_t numIters);
@@ -132,6 +143,15 @@ private:
      */
     void postProcessTempIDs();
 
+    /**
+     * @brief Resolves the property types of @param props into @param columns and
+     * checks that their value columns hold @param numIters values.
+     * @warn Calls @ref _metadataBuilder::getOrCreatePropertyType as a side effect.
+     */
+    void getPropertyColumns(const WriteProcessorTypes::PropertyConstraints& props,
+                            size_t numIters,
+                            std::vector<PropertyColumn>& columns);
+
     /**
     * @brief Helper function to generate a LabelSet from a collection of node label names.
     * @warn Calls @ref _metadataBuilder::getOrCreateLabel as a side effect.
@@ -4,6 +4,7 @@
 
 #include "ID.h"
 #include "PipelineGenerator.h"
+#include "PipelineV2.h"
 #include "columns/ColumnOptMask.h"
 #include "dataframe/ColumnTag.h"
 #include "decl/EvaluatedType.h"
@@ -21,6 +22,8 @@
 #include "expr/LiteralExpr.h"
 #include "decl/VarDecl.h"
 #include "Literal.h"
+#include "QueryParams.h"
+#include "Overloaded.h"
 #include "metadata/PropertyType.h"
 
 #include "dataframe/NamedColumn.h"
@@ -182,6 +185,11 @@ Column* ExprProgramGenerator::generateBinaryExpr(const BinaryExpr* binExpr) {
 Column* ExprProgramGenerator::generatePropertyExpr(const PropertyExpr* propExpr) {
     const VarDecl* exprVarDecl = propExpr->getExprVarDecl();
 
+    const auto boundIt = _boundProperties.find(exprVarDecl);
+    if (boundIt != _boundProperties.end()) {
+        return boundIt->second;
+    }
+
     // Search exprVarDecl in column map
     const auto foundIt = _gen->varColMap().find(exprVarDecl);
     if (foundIt == _gen->varColMap().end()) {
@@ -224,6 +232,11 @@ Column* ExprProgramGenerator::generateLiteralExpr(const LiteralExpr* literalExpr
         }
         break;
 
+        case Literal::Kind::PARAMETER: {
+            return generateParameterLiteral(static_cast<const ParameterLiteral*>(literal));
+        }
+        break;
+
         default:
             throw PlannerException(
                 fmt::format("ExprProgramGenerator: unsupported literal of type {}",
@@ -232,6 +245,54 @@ Column* ExprProgramGenerator::generateLiteralExpr(const LiteralExpr* literalExpr
     }
 }
 
+Column* ExprProgramGenerator::generateParameterLiteral(const ParameterLiteral* literal) {
+    const QueryParams* params = _gen->parameters();
+    const QueryParams::Value* param = params ? params->get(literal->getName()) : nullptr;
+    if (!param) {
+        throw PlannerException(
+            fmt::format("ExprProgramGenerator: parameter ${} is not bound", literal->getName()));
+    }
+
+    LocalMemory& mem = _gen->memory();
+
+    Column* column = std::visit(Overloaded {
+        [&](const QueryParams::Null&) -> Column* {
+            return mem.alloc<ColumnConst<PropertyNull>>();
+        },
+        [&](bool v) -> Column* {
+            auto* value = mem.alloc<ColumnConst<types::Bool::Primitive>>();
+            value->set(v);
+            return value;
+        },
+        [&](int64_t v) -> Column* {
+            auto* value = mem.alloc<ColumnConst<types::Int64::Primitive>>();
+            value->set(v);
+            return value;
+        },
+        [&](double v) -> Column* {
+            auto* value = mem.alloc<ColumnConst<types::Double::Primitive>>();
+            value->set(v);
+            return value;
+        },
+        // The string is owned by the parameters, which outlive the query
+        [&](const std::string& v) -> Column* {
+            auto* value = mem.alloc<ColumnConst<types::String::Primitive>>();
+            value->set(v);
+            return value;
+        },
+        [&](const QueryParams::Vector&) -> Column* {
+            throw PlannerException(
+                fmt::format("ExprProgramGenerator: list parameter ${} can only be "
+                            "passed to a procedure", literal->getName()));
+        },
+    }, *param);
+
+    // Registered so that the pipeline can be executed again with other values
+    _gen->pipeline()->addParameter(literal->getName(), param->index(), column);
+
+    return column;
+}
+
 Column* ExprProgramGenerator::generateSymbolExpr(const SymbolExpr* symbolExpr) {
     const VarDecl* exprVarDecl = symbolExpr->getExprVarDecl();
     const EvaluatedType type = symbolExpr->getType();
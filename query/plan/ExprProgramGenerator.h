@@ -1,5 +1,7 @@
 #pragma once
 
+#include <unordered_map>
+
 #include "columns/ColumnOperator.h"
 #include "expr/Operators.h"
 
@@ -16,6 +18,7 @@ class UnaryExpr;
 class BinaryExpr;
 class PropertyExpr;
 class LiteralExpr;
+class ParameterLiteral;
 class SymbolExpr;
 class PipelineGenerator;
 class PendingOutputView;
@@ -42,16 +45,24 @@ public:
 
     Column* registerPropertyConstraint(const Expr* expr);
 
+    // Reads the values of a property expression from a column rather than
+    // from the pending output, e.g. the properties read by an optional expansion
+    void bindProperty(const VarDecl* exprDecl, Column* column) {
+        _boundProperties[exprDecl] = column;
+    }
+
 private:
     PipelineGenerator* _gen {nullptr};
     ExprProgram* _exprProg {nullptr};
     const PendingOutputView& _pendingOut;
+    std::unordered_map<const VarDecl*, Column*> _boundProperties;
 
     Column* generateExpr(const Expr* expr);
     Column* generateUnaryExpr(const UnaryExpr* expr);
     Column* generateBinaryExpr(const BinaryExpr* expr);
     Column* generatePropertyExpr(const PropertyExpr* propExpr);
     Column* generateLiteralExpr(const LiteralExpr* literalExpr);
+    Column* generateParameterLiteral(const ParameterLiteral* literal);
     Column* generateSymbolExpr(const SymbolExpr* symbolExpr);
 
     Column* allocResultColumn(const Expr* expr);
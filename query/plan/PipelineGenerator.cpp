@@ -21,6 +21,7 @@
 #include "expr/ExprChain.h"
 #include "expr/FunctionInvocationExpr.h"
 #include "expr/SymbolExpr.h"
+#include "expr/PropertyExpr.h"
 #include "interfaces/PipelineNodeOutputInterface.h"
 #include "interfaces/PipelineOutputInterface.h"
 #include "interfaces/PipelineValuesOutputInterface.h"
@@ -32,6 +33,7 @@
 #include "SourceManager.h"
 
 #include "processors/MaterializeProcessor.h"
+#include "processors/OuterExpansion.h"
 
 #include "nodes/ChangeNode.h"
 #include "nodes/CommitNode.h"
@@ -43,9 +45,11 @@
 #include "nodes/VarNode.h"
 #include "nodes/ScanNodesNode.h"
 #include "nodes/GetOutEdgesNode.h"
+#include "nodes/EdgeExpansionNode.h"
 #include "nodes/ProduceResultsNode.h"
 #include "nodes/FilterNode.h"
 #include "nodes/SkipNode.h"
+#include "nodes/DistinctNode.h"
 #include "nodes/LimitNode.h"
 #include "nodes/GetEdgeTargetNode.h"
 #include "nodes/GetEdgesNode.h"
@@ -67,6 +71,7 @@
 #include "decl/VarDecl.h"
 #include "expr/LiteralExpr.h"
 #include "Literal.h"
+#include "QueryParams.h"
 
 #include "Overloaded.h"
 #include "processors/ExprProgram.h"
@@ -136,6 +141,49 @@ ColumnTag PipelineGenerator::getCol(const VarDecl* var) {
     return tag;
 }
 
+std::optional<int64_t> PipelineGenerator::getIntegerValue(const Literal* literal) const {
+    if (const auto* integerLiteral = dynamic_cast<const IntegerLiteral*>(literal)) {
+        return integerLiteral->getValue();
+    }
+
+    if (const auto* paramLiteral = dynamic_cast<const ParameterLiteral*>(literal)) {
+        const QueryParams::Value* value = _params ? _params->get(paramLiteral->getName()) : nullptr;
+        if (value && std::holds_alternative<int64_t>(*value)) {
+            _pipeline->addBuildParameter(paramLiteral->getName(), *value);
+            return std::get<int64_t>(*value);
+        }
+    }
+
+    return std::nullopt;
+}
+
+std::optional<QueryParams::Value> PipelineGenerator::getLiteralValue(const Literal* literal) const {
+    switch (literal->getKind()) {
+        case Literal::Kind::BOOL:
+            return static_cast<const BoolLiteral*>(literal)->getValue();
+        case Literal::Kind::INTEGER:
+            return static_cast<const IntegerLiteral*>(literal)->getValue();
+        case Literal::Kind::DOUBLE:
+            return static_cast<const DoubleLiteral*>(literal)->getValue();
+        case Literal::Kind::STRING:
+            return std::string(static_cast<const StringLiteral*>(literal)->getValue());
+        case Literal::Kind::CHAR:
+            return std::string(1, static_cast<const CharLiteral*>(literal)->getValue());
+        case Literal::Kind::PARAMETER: {
+            const auto* paramLiteral = static_cast<const ParameterLiteral*>(literal);
+            const QueryParams::Value* value = _params ? _params->get(paramLiteral->getName()) : nullptr;
+            if (value) {
+                _pipeline->addBuildParameter(paramLiteral->getName(), *value);
+                return *value;
+            }
+        } break;
+        default:
+            break;
+    }
+
+    return std::nullopt;
+}
+
 void PipelineGenerator::generate() {
     TranslateTokenStack nodeStack;
 
@@ -160,8 +208,17 @@ void PipelineGenerator::generate() {
         // We also set the materialize processor from the previous materialize processor
         // of the node that inserted the current node into the stack
         _builder.setMaterializeProc(matProc);
+        const size_t firstProcIndex = _pipeline->processors().size();
         PipelineOutputInterface* outputIf = translateNode(node);
 
+        // Processors created for the node report its estimate in EXPLAIN and PROFILE
+        if (node->hasEstimatedRows()) {
+            const auto& processors = _pipeline->processors();
+            for (size_t i = firstProcIndex; i < processors.size(); i++) {
+                processors[i]->getProfile()._estimatedRows = node->getEstimatedRows();
+            }
+        }
+
         // If a new mat proc could be created during the node transalation
         //(In the case of join/cartesian product) we need to retreive
         // it from _builder - otherwise this will hold the same pinter as
@@ -261,6 +318,10 @@ PipelineOutputInterface* PipelineGenerator::translateNode(PlanGraphNode* node) {
             return translateEdgeFilterNode(static_cast<EdgeFilterNode*>(node));
         break;
 
+        case PlanGraphOpcode::DISTINCT:
+            return translateDistinctNode(static_cast<DistinctNode*>(node));
+        break;
+
         case PlanGraphOpcode::SKIP:
             return translateSkipNode(static_cast<SkipNode*>(node));
         break;
@@ -405,18 +466,69 @@ PipelineOutputInterface* PipelineGenerator::translateScanNodesByLabelNode(ScanNo
     return _builder.getPendingOutputInterface();
 }
 
+std::unique_ptr<OuterExpansion> PipelineGenerator::generateOuterExpansion(const EdgeExpansionNode* node) {
+    if (!node->isOptional()) {
+        return nullptr;
+    }
+
+    auto outer = std::make_unique<OuterExpansion>();
+
+    const LabelSet& labelConstrs = node->getTargetLabelConstraints();
+    const auto& predicates = node->getOptionalPredicates();
+    if (labelConstrs.empty() && predicates.empty()) {
+        return outer;
+    }
+
+    PredicateProgram* predProg = PredicateProgram::create(_pipeline);
+    PredicateProgramGenerator predGen(this, predProg, _builder.getPendingOutput());
+
+    // The properties read by the predicates are filled by the expansion
+    const PropertyTypeMap& propTypes = _view.read().getMetadata().propTypes();
+    for (const PropertyExpr* propExpr : node->getOptionalProperties()) {
+        const std::string_view propName = propExpr->getPropName();
+        const std::optional<PropertyType> foundProp = propTypes.get(propName);
+        if (!foundProp) {
+            throw PlannerException(fmt::format("Property type {} does not exist", propName));
+        }
+
+        const bool isEdge = propExpr->getEntityVarDecl()->getType() == EvaluatedType::EdgePattern;
+
+        Column* values = nullptr;
+        const auto process = [&]<SupportedType Type> {
+            values = isEdge ? outer->addProperty<EntityType::Edge, Type>(_mem, foundProp->_id)
+                            : outer->addProperty<EntityType::Node, Type>(_mem, foundProp->_id);
+        };
+        PropertyTypeDispatcher {foundProp->_valueType}.execute(process);
+
+        predGen.bindProperty(propExpr->getExprVarDecl(), values);
+    }
+
+    for (Expr* expr : predicates) {
+        const Predicate pred {expr};
+        predGen.generatePredicate(&pred);
+    }
+
+    if (!labelConstrs.empty()) {
+        predGen.addLabelConstraint(outer->addOtherLabelSets(_mem), labelConstrs);
+    }
+
+    outer->setPredicates(predProg);
+
+    return outer;
+}
+
 PipelineOutputInterface* PipelineGenerator::translateGetOutEdgesNode(GetOutEdgesNode* node) {
-    _builder.addGetOutEdges();
+    _builder.addGetOutEdges(generateOuterExpansion(node), node->getEdgeTypeConstraints());
     return _builder.getPendingOutputInterface();
 }
 
 PipelineOutputInterface* PipelineGenerator::translateGetInEdgesNode(GetInEdgesNode* node) {
-    _builder.addGetInEdges();
+    _builder.addGetInEdges(generateOuterExpansion(node), node->getEdgeTypeConstraints());
     return _builder.getPendingOutputInterface();
 }
 
 PipelineOutputInterface* PipelineGenerator::translateGetEdgesNode(GetEdgesNode* node) {
-    _builder.addGetEdges();
+    _builder.addGetEdges(generateOuterExpansion(node), node->getEdgeTypeConstraints());
     return _builder.getPendingOutputInterface();
 }
 
@@ -622,10 +734,6 @@ PipelineOutputInterface* PipelineGenerator::translateEdgeFilterNode(EdgeFilterNo
         }
     }
 
-    if (typeConstraint.size() > 1) {
-        throw PlannerException("Edges can only have 1 type constraint.");
-    }
-
     if (!typeConstraint.empty()) {
         const PipelineValuesOutputInterface& edgeTypeIf = _builder.addGetEdgeTypeID();
         const NamedColumn* edgeTypecol = edgeTypeIf.getValues();
@@ -636,10 +744,8 @@ PipelineOutputInterface* PipelineGenerator::translateEdgeFilterNode(EdgeFilterNo
         if (!edgeTypecol->getColumn()) {
             throw FatalException("Could not get label set column for label filter.");
         }
-        // Above checks there is exactly 1 type contraint
-        const EdgeTypeID edgeTypeConstr = typeConstraint.front();
-
-        predGen.addEdgeTypeConstraint(edgeTypecol->getColumn(), edgeTypeConstr);
+        // The edge matches any of the type constraints
+        predGen.addEdgeTypeConstraint(edgeTypecol->getColumn(), typeConstraint);
     }
 
     const auto& output = _builder.addFilter(predProg);
@@ -744,7 +850,26 @@ PipelineOutputInterface* PipelineGenerator::translateJoinNode(JoinNode* node) {
             throw PlannerException("Common Successor Joins With Common Ancestor Unsupported");
         }
         case JoinType::PREDICATE: {
-            throw PlannerException("Join On Predicates Not Been Supported");
+            // Equi-join on the values of two property columns
+            leftJoinTag = getCol(node->getLeftVarDecl());
+            rightJoinTag = getCol(node->getRightVarDecl());
+
+            const NamedColumn* leftKey = lhs->getDataframe()->getColumn(leftJoinTag);
+            const NamedColumn* rightKey = rhs->getDataframe()->getColumn(rightJoinTag);
+            if (!leftKey || !rightKey) {
+                throw PlannerException("Join keys must be computed before the join");
+            }
+
+            if (leftKey->getColumn()->getKind() != rightKey->getColumn()->getKind()) {
+                throw PlannerException("Join keys must have the same type");
+            }
+
+            const auto& outputIf = _builder.addValueHashJoin(rhs, leftJoinTag, rightJoinTag);
+            _builder.setMaterializeProc(MaterializeProcessor::createFromDf(_pipeline,
+                                                                           _mem,
+                                                                           outputIf.getDataframe()));
+
+            return _builder.getPendingOutputInterface();
         }
     }
 
@@ -756,6 +881,25 @@ PipelineOutputInterface* PipelineGenerator::translateJoinNode(JoinNode* node) {
     return _builder.getPendingOutputInterface();
 }
 
+PipelineOutputInterface* PipelineGenerator::translateDistinctNode(DistinctNode* node) {
+    if (!_builder.isSingleMaterializeStep()) {
+        _builder.addMaterialize();
+    }
+
+    std::vector<ColumnTag> keys;
+    for (const Expr* key : node->keys()) {
+        const VarDecl* decl = key->getExprVarDecl();
+        if (!decl) [[unlikely]] {
+            throw PlannerException("DISTINCT key does not have a variable declaration");
+        }
+
+        keys.push_back(_declToColumn.at(decl));
+    }
+
+    _builder.addDistinct(std::move(keys));
+    return _builder.getPendingOutputInterface();
+}
+
 PipelineOutputInterface* PipelineGenerator::translateSkipNode(SkipNode* node) {
     if (!_builder.isSingleMaterializeStep()) {
         _builder.addMaterialize();
@@ -767,16 +911,16 @@ PipelineOutputInterface* PipelineGenerator::translateSkipNode(SkipNode* node) {
         throw PlannerException("Skip expression must be a literal");
     }
 
-    const IntegerLiteral* integerLiteral = dynamic_cast<const IntegerLiteral*>(literalExpr->getLiteral());
-    if (!integerLiteral) {
+    const std::optional<int64_t> value = getIntegerValue(literalExpr->getLiteral());
+    if (!value) {
         throw PlannerException("Skip expression must be an integer");
     }
 
-    if (integerLiteral->getValue() < 0) {
+    if (value.value() < 0) {
         throw PlannerException("Skip expression must be a positive integer");
     }
 
-    _builder.addSkip(static_cast<size_t>(integerLiteral->getValue()));
+    _builder.addSkip(static_cast<size_t>(value.value()));
     return _builder.getPendingOutputInterface();
 }
 
@@ -791,16 +935,16 @@ PipelineOutputInterface* PipelineGenerator::translateLimitNode(LimitNode* node)
         throw PlannerException("Limit expression must be a literal");
     }
 
-    const IntegerLiteral* integerLiteral = dynamic_cast<const IntegerLiteral*>(literalExpr->getLiteral());
-    if (!integerLiteral) {
+    const std::optional<int64_t> value = getIntegerValue(literalExpr->getLiteral());
+    if (!value) {
         throw PlannerException("Limit expression must be an integer");
     }
 
-    if (integerLiteral->getValue() < 0) {
+    if (value.value() < 0) {
         throw PlannerException("Limit expression must be a positive integer");
     }
 
-    _builder.addLimit(static_cast<size_t>(integerLiteral->getValue()));
+    _builder.addLimit(static_cast<size_t>(value.value()));
     return _builder.getPendingOutputInterface();
 }
 
@@ -881,7 +1025,14 @@ PipelineOutputInterface* PipelineGenerator::translateAggregateEvalNode(Aggregate
                     output = &_builder.addCount();
                 } else {
                     // count(*)
-                    output = &_builder.addCount(_declToColumn.at(argDecl));
+                    const ColumnTag argTag = _declToColumn.at(argDecl);
+
+                    // count(DISTINCT expr) counts the first occurrence of each value
+                    if (invocation->isDistinct()) {
+                        _builder.addDistinct({argTag});
+                    }
+
+                    output = &_builder.addCount(argTag);
                 }
 
             } else [[unlikely]] {
@@ -930,11 +1081,38 @@ PipelineOutputInterface* PipelineGenerator::translateProcedureEvalNode(Procedure
     std::vector<const VarDecl*> yieldDecls;
     std::vector<ProcedureBlueprint::YieldItem> yieldItems;
 
-    const ProcedureBlueprint* blueprint = _blueprints->getBlueprint(signature->_fullName);
+    const ProcedureBlueprint* blueprint = _blueprints->getBlueprint(signature->_fullName,
+                                                                    args->size());
     if (!blueprint) {
         throw PlannerException(fmt::format("Procedure '{}' does not exist", signature->_fullName));
     }
 
+    // The node argument is read from the input of the procedure,
+    // the other arguments are resolved now
+    std::vector<QueryParams::Value> argValues;
+    ColumnTag inputNodeIDs;
+
+    for (const Expr* arg : args->getExprs()) {
+        if (arg->getType() == EvaluatedType::NodePattern) {
+            inputNodeIDs = getCol(arg->getExprVarDecl());
+            argValues.emplace_back(QueryParams::Null {});
+            continue;
+        }
+
+        const auto* literalExpr = dynamic_cast<const LiteralExpr*>(arg);
+        std::optional<QueryParams::Value> value;
+        if (literalExpr) {
+            value = getLiteralValue(literalExpr->getLiteral());
+        }
+
+        if (!value) {
+            throw PlannerException(fmt::format("Arguments of procedure '{}' must be literals or parameters",
+                                               signature->_fullName));
+        }
+
+        argValues.push_back(std::move(value.value()));
+    }
+
     if (!yield) {
         blueprint->returnAll(yieldItems);
     } else {
@@ -946,7 +1124,10 @@ PipelineOutputInterface* PipelineGenerator::translateProcedureEvalNode(Procedure
         }
     }
 
-    _builder.addDatabaseProcedure(*blueprint, yieldItems);
+    const auto& output = _builder.addDatabaseProcedure(*blueprint,
+                                                       yieldItems,
+                                                       std::move(argValues),
+                                                       inputNodeIDs);
 
     for (size_t i = 0; i < yieldItems.size(); i++) {
         const auto& item = yieldItems[i];
@@ -959,6 +1140,13 @@ PipelineOutputInterface* PipelineGenerator::translateProcedureEvalNode(Procedure
         }
     }
 
+    // The yielded nodes are expanded by the next nodes, which
+    // materialize the columns of the procedure
+    if (output.getStream().isNodeStream()) {
+        _builder.setMaterializeProc(
+            MaterializeProcessor::createFromDf(_pipeline, _mem, output.getDataframe()));
+    }
+
     return _builder.getPendingOutputInterface();
 }
 
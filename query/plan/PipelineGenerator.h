@@ -1,5 +1,7 @@
 #pragma once
 
+#include <optional>
+
 #include "QueryCallback.h"
 
 #include "PipelineBuilder.h"
@@ -13,6 +15,8 @@ namespace db {
 
 class SourceManager;
 class ProcedureBlueprintMap;
+class QueryParams;
+class Literal;
 class PlanGraph;
 class PipelineV2;
 class PlanGraphNode;
@@ -30,6 +34,7 @@ class EdgeFilterNode;
 class ProduceResultsNode;
 class JoinNode;
 class SkipNode;
+class DistinctNode;
 class LimitNode;
 class CartesianProductNode;
 class AggregateEvalNode;
@@ -46,6 +51,8 @@ class S3ConnectNode;
 class S3TransferNode;
 class ShowProceduresNode;
 class CommitNode;
+class EdgeExpansionNode;
+class OuterExpansion;
 
 class PipelineGenerator {
 public:
@@ -69,6 +76,8 @@ public:
 
     ~PipelineGenerator() = default;
 
+    void setParameters(const QueryParams* params) { _params = params; }
+
     void generate();
 
     struct BinaryNodeVisitInformation {
@@ -83,7 +92,9 @@ public:
 
     const VarColumnMap& varColMap() const { return _declToColumn; }
     LocalMemory& memory() { return *_mem; }
+    PipelineV2* pipeline() { return _pipeline; }
     GraphView view() { return _view; }
+    const QueryParams* parameters() const { return _params; }
 
 private:
     const PlanGraph* _graph {nullptr};
@@ -93,15 +104,24 @@ private:
     LocalMemory* _mem {nullptr};
     SourceManager* _sourceManager {nullptr};
     QueryCallbackV2 _callback;
+    const QueryParams* _params {nullptr};
     PipelineBuilder _builder;
 
      VarColumnMap _declToColumn;
 
     ColumnTag getCol(const VarDecl* var);
 
+    std::optional<int64_t> getIntegerValue(const Literal* literal) const;
+
+    // Value of a literal or of a bound parameter
+    std::optional<QueryParams::Value> getLiteralValue(const Literal* literal) const;
+
     // [BinaryNode -> Visited input] map
     BinaryNodeVisitedMap _binaryVisitedMap;
 
+    // Outer expansion of an optional expansion, null otherwise
+    std::unique_ptr<OuterExpansion> generateOuterExpansion(const EdgeExpansionNode* node);
+
     PipelineOutputInterface* translateNode(PlanGraphNode* node);
     PipelineOutputInterface* translateVarNode(VarNode* node);
     PipelineOutputInterface* translateScanNodesNode(ScanNodesNode* node);
@@ -115,6 +135,7 @@ private:
     PipelineOutputInterface* translateEdgeFilterNode(EdgeFilterNode* node);
     PipelineOutputInterface* translateProduceResultsNode(ProduceResultsNode* node);
     PipelineOutputInterface* translateJoinNode(JoinNode* node);
+    PipelineOutputInterface* translateDistinctNode(DistinctNode* node);
     PipelineOutputInterface* translateSkipNode(SkipNode* node);
     PipelineOutputInterface* translateLimitNode(LimitNode* node);
     PipelineOutputInterface* translateCartesianProductNode(CartesianProductNode* node);
@@ -11,6 +11,7 @@
 #include "nodes/ProcedureEvalNode.h"
 #include "nodes/VarNode.h"
 #include "nodes/CreateGraphNode.h"
+#include "nodes/EdgeExpansionNode.h"
 #include "nodes/WriteNode.h"
 #include "nodes/ScanNodesByLabelNode.h"
 #include "nodes/LoadGraphNode.h"
@@ -154,6 +155,19 @@ void PlanGraphDebug::dumpMermaidContent(std::ostream& output, const GraphView& v
                 }
             } break;
 
+            case PlanGraphOpcode::GET_OUT_EDGES:
+            case PlanGraphOpcode::GET_IN_EDGES:
+            case PlanGraphOpcode::GET_EDGES: {
+                const auto* e = dynamic_cast<EdgeExpansionNode*>(node.get());
+                if (e->isOptional()) {
+                    output << "        __optional__\n";
+                }
+
+                for (const auto& edgeType : e->getEdgeTypeConstraints()) {
+                    output << "        __edge_type__: " << edgeTypeMap.getName(edgeType).value() << "\n";
+                }
+            } break;
+
             case PlanGraphOpcode::FILTER_EDGE: {
                 const auto* e = dynamic_cast<EdgeFilterNode*>(node.get());
                 for (const auto& edgeType : e->getEdgeTypeConstraints()) {
@@ -336,6 +350,10 @@ void PlanGraphDebug::dumpMermaidContent(std::ostream& output, const GraphView& v
             } break;
         }
 
+        if (node->hasEstimatedRows()) {
+            output << fmt::format("        __estimated_rows__: {:.0f}\n", node->getEstimatedRows());
+        }
+
         output << "    `\"]\n";
     }
 
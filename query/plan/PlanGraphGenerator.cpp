@@ -24,6 +24,7 @@
 #include "WriteStmtGenerator.h"
 
 #include "nodes/OrderByNode.h"
+#include "nodes/DistinctNode.h"
 #include "nodes/LimitNode.h"
 #include "nodes/SkipNode.h"
 #include "nodes/WriteNode.h"
@@ -244,10 +245,6 @@ PlanGraphNode* PlanGraphGenerator::generateReturnStmt(const ReturnStmt* stmt, Pl
 
     const Projection* proj = stmt->getProjection();
 
-    if (proj->isDistinct()) {
-        throwError("DISTINCT not supported", stmt);
-    }
-
     FuncEvalNode* funcEval = _tree.create<FuncEvalNode>();
     AggregateEvalNode* aggregateEval = _tree.create<AggregateEvalNode>();
 
@@ -360,6 +357,15 @@ PlanGraphNode* PlanGraphGenerator::generateReturnStmt(const ReturnStmt* stmt, Pl
         prevNode = aggregateEval;
     }
 
+    // Deduplicated before ORDER BY, SKIP and LIMIT, which apply to the distinct rows
+    if (proj->isDistinct()) {
+        DistinctNode* distinct = _tree.newOut<DistinctNode>(prevNode);
+        for (const Expr* item : proj->items()) {
+            distinct->addKey(item);
+        }
+        prevNode = distinct;
+    }
+
     if (proj->hasOrderBy()) {
         OrderByNode* orderBy = _tree.newOut<OrderByNode>(prevNode);
         orderBy->setItems(proj->getOrderBy()->getItems());
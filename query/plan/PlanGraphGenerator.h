@@ -3,10 +3,7 @@
 #include <string_view>
 
 #include "PlanGraph.h"
-
-namespace db {
-class GraphView;
-}
+#include "views/GraphView.h"
 
 namespace db {
 
@@ -39,7 +36,7 @@ public:
 
 private:
     const CypherAST* _ast {nullptr};
-    const GraphView& _view;
+    GraphView _view;
     PlanGraph _tree;
     std::unique_ptr<PlanGraphVariables> _variables;
 
@@ -80,21 +80,34 @@ void PredicateProgramGenerator::addLabelConstraint(Column* lblsetCol,
 }
 
 void PredicateProgramGenerator::addEdgeTypeConstraint(Column* edgeTypeCol,
-                                                      const EdgeTypeID& typeConstr) {
+                                                      std::span<const EdgeTypeID> typeConstrs) {
     PredicateProgram* predProg = dynamic_cast<PredicateProgram*>(_exprProg);
     if (!predProg) {
         throw PlannerException(
             "Attempted to add label constraint to non-predicate program.");
     }
-    // Add the instruction to calculate equality
-    ColumnConst<EdgeTypeID>* constCol = _gen->memory().alloc<ColumnConst<EdgeTypeID>>();
-    constCol->set(typeConstr);
-
-    ColumnOptMask* finalEdgeTypeMask = _gen->memory().alloc<ColumnOptMask>();
-    predProg->addInstr(ColumnOperator::OP_EQUAL,
-                        finalEdgeTypeMask,
-                        edgeTypeCol,
-                        constCol);
+
+    // Fold over all edge type constraints with OR
+    Column* finalEdgeTypeMask {nullptr};
+    for (const EdgeTypeID typeConstr : typeConstrs) {
+        ColumnConst<EdgeTypeID>* constCol = _gen->memory().alloc<ColumnConst<EdgeTypeID>>();
+        constCol->set(typeConstr);
+
+        auto* resCol = _gen->memory().alloc<ColumnOptMask>();
+        predProg->addInstr(ColumnOperator::OP_EQUAL,
+                            resCol,
+                            edgeTypeCol,
+                            constCol);
+
+        if (finalEdgeTypeMask) {
+            predProg->addInstr(ColumnOperator::OP_OR,
+                                resCol,
+                                finalEdgeTypeMask,
+                                resCol);
+        }
+
+        finalEdgeTypeMask = resCol;
+    }
 
     // Add the top level predicate that all edges must satisfy this constraint
     predProg->addTopLevelPredicate(finalEdgeTypeMask);
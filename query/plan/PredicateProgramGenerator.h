@@ -1,8 +1,11 @@
 #pragma once
 
+#include <span>
+
 #include "ExprProgramGenerator.h"
 
 #include "metadata/LabelSet.h"
+#include "ID.h"
 
 namespace db {
 
@@ -19,7 +22,7 @@ public:
     
     void generatePredicate(const Predicate* pred);
     void addLabelConstraint(Column* lblsetCol, const LabelSet& lblConstraint);
-    void addEdgeTypeConstraint(Column* edgeTypeCol, const EdgeTypeID& typeConstr);
+    void addEdgeTypeConstraint(Column* edgeTypeCol, std::span<const EdgeTypeID> typeConstrs);
 };
 
 }
@@ -15,11 +15,16 @@
 #include "Predicate.h"
 #include "YieldClause.h"
 #include "YieldItems.h"
+#include "FunctionInvocation.h"
 #include "decl/VarDecl.h"
 #include "decl/PatternData.h"
+#include "expr/ExprChain.h"
+#include "expr/FunctionInvocationExpr.h"
+#include "expr/SymbolExpr.h"
 #include "metadata/LabelSet.h"
 
 #include "nodes/CartesianProductNode.h"
+#include "nodes/EdgeExpansionNode.h"
 #include "nodes/FilterNode.h"
 #include "nodes/GetEdgeTargetNode.h"
 #include "nodes/GetEdgesNode.h"
@@ -95,6 +100,11 @@ void ReadStmtGenerator::generateMatchStmt(const MatchStmt* stmt) {
                    stmt);
     }
 
+    if (stmt->isOptional()) {
+        generateOptionalMatchStmt(stmt);
+        return;
+    }
+
     // Each PatternElement is a target of the match
     // and contains a chain of EntityPatterns
     for (const PatternElement* element : pattern->elements()) {
@@ -107,6 +117,195 @@ void ReadStmtGenerator::generateMatchStmt(const MatchStmt* stmt) {
     }
 }
 
+void ReadStmtGenerator::generateOptionalMatchStmt(const MatchStmt* stmt) {
+    const Pattern* pattern = stmt->getPattern();
+
+    // An optional match is planned as a left outer expansion, which keeps the
+    // nodes without edges. Constraints applied after the expansion would drop
+    // these rows, so the constraints of the optional pattern are applied by
+    // the expansion itself, before the null extension
+    if (pattern->elements().size() != 1) {
+        throwError("OPTIONAL MATCH only supports a single pattern element for now", stmt);
+    }
+
+    const PatternElement* element = pattern->elements().front();
+    if (element->size() != 3) {
+        throwError("OPTIONAL MATCH only supports patterns with a single edge for now", element);
+    }
+
+    const auto& entities = element->getEntities();
+    const NodePattern* origin = dynamic_cast<const NodePattern*>(entities[0]);
+    const EdgePattern* edge = dynamic_cast<const EdgePattern*>(entities[1]);
+    const NodePattern* target = dynamic_cast<const NodePattern*>(entities[2]);
+
+    if (!origin || !edge || !target) {
+        throwError("OPTIONAL MATCH pattern must be a node, an edge and a node", element);
+    }
+
+    VarNode* originVar = _variables->getVarNode(origin->getDecl());
+    if (!originVar) {
+        throwError("OPTIONAL MATCH must start from a node matched by a previous MATCH", origin);
+    }
+
+    if (!origin->getData()->labelConstraints().empty()
+        || !origin->getData()->exprConstraints().empty()) {
+        throwError("OPTIONAL MATCH does not support constraints on its first node yet", origin);
+    }
+
+    if (_variables->getVarNode(edge->getDecl())) {
+        throwError("Re-using the same edge variable, this is not supported", edge);
+    }
+
+    if (_variables->getVarNode(target->getDecl())) {
+        throwError("OPTIONAL MATCH does not support targets matched by a previous MATCH yet", target);
+    }
+
+    EdgeExpansionNode* expansion = nullptr;
+    switch (edge->getDirection()) {
+        case EdgePattern::Direction::Undirected: {
+            expansion = _tree->newOut<GetEdgesNode>(originVar);
+        } break;
+        case EdgePattern::Direction::Backward: {
+            expansion = _tree->newOut<GetInEdgesNode>(originVar);
+        } break;
+        case EdgePattern::Direction::Forward: {
+            expansion = _tree->newOut<GetOutEdgesNode>(originVar);
+        } break;
+    }
+
+    expansion->setOptional(true);
+
+    // Edge types (any of them) are applied by the expansion, before the null extension
+    const std::span edgeTypes = edge->getData()->edgeTypeConstraints();
+    const EdgeTypeMap& edgeTypeMap = _graphMetadata.edgeTypes();
+
+    for (std::string_view edgeTypeName : edgeTypes) {
+        const std::optional edgeType = edgeTypeMap.get(edgeTypeName);
+        if (!edgeType) {
+            throwError(fmt::format("Unknown edge type: {}", edgeTypeName), edge);
+        }
+
+        expansion->addEdgeTypeConstraint(edgeType.value());
+    }
+
+    auto [edgeVar, edgeFilter] = _variables->createVarNodeAndFilter(edge->getDecl());
+    expansion->connectOut(edgeFilter);
+
+    // The filter of the target node is left without constraints, they belong
+    // to the expansion
+    PlanGraphNode* getTarget = _tree->newOut<GetEdgeTargetNode>(edgeVar);
+    auto [targetVar, targetFilter] = _variables->createVarNodeAndFilter(target->getDecl());
+    getTarget->connectOut(targetFilter);
+
+    // Labels of the target node
+    const LabelMap& labelMap = _graphMetadata.labels();
+    LabelSet labelset;
+
+    for (const std::string_view label : target->getData()->labelConstraints()) {
+        const std::optional<LabelID> labelID = labelMap.get(label);
+        if (!labelID) {
+            throwError(fmt::format("Unknown label: {}", label), target);
+        }
+        labelset.set(labelID.value());
+    }
+
+    expansion->addTargetLabelConstraints(labelset);
+
+    // Property constraints of the edge and of the target node
+    const PropertyTypeMap& propTypeMap = _graphMetadata.propTypes();
+
+    for (const auto* entityData : {static_cast<const PatternData*>(edge->getData()),
+                                   static_cast<const PatternData*>(target->getData())}) {
+        for (const EntityPropertyConstraint& constraint : entityData->exprConstraints()) {
+            if (!propTypeMap.get(constraint._propTypeName)) {
+                throwError(fmt::format("Unknown property type: {}", constraint._propTypeName), constraint._expr);
+            }
+
+            addOptionalPredicate(expansion, edge->getDecl(), target->getDecl(), constraint._expr);
+        }
+    }
+
+    if (const WhereClause* where = pattern->getWhere()) {
+        unwrapOptionalWhereExpr(expansion, edge->getDecl(), target->getDecl(), where->getExpr());
+    }
+}
+
+void ReadStmtGenerator::unwrapOptionalWhereExpr(EdgeExpansionNode* expansion,
+                                                const VarDecl* edgeDecl,
+                                                const VarDecl* targetDecl,
+                                                Expr* expr) {
+    if (expr->getKind() == Expr::Kind::ENTITY_TYPES) {
+        const EntityTypeExpr* entityTypeExpr = static_cast<const EntityTypeExpr*>(expr);
+        const SymbolChain* labels = entityTypeExpr->getTypes();
+
+        if (entityTypeExpr->getEntityVarDecl() != targetDecl || !labels) {
+            throwError("OPTIONAL MATCH ... WHERE only supports label constraints on the target node for now", expr);
+        }
+
+        const LabelMap& labelMap = _graphMetadata.labels();
+        LabelSet labelset;
+
+        for (const Symbol* symbol : *labels) {
+            const std::string_view label = symbol->getName();
+            const std::optional labelID = labelMap.get(label);
+
+            if (!labelID) {
+                throwError(fmt::format("Unknown label: {}", label), entityTypeExpr);
+            }
+
+            labelset.set(labelID.value());
+        }
+
+        expansion->addTargetLabelConstraints(labelset);
+        return;
+    }
+
+    if (expr->getKind() == Expr::Kind::BINARY) {
+        const BinaryExpr* binaryExpr = static_cast<const BinaryExpr*>(expr);
+
+        if (binaryExpr->getOperator() == BinaryOperator::And) {
+            unwrapOptionalWhereExpr(expansion, edgeDecl, targetDecl, binaryExpr->getLHS());
+            unwrapOptionalWhereExpr(expansion, edgeDecl, targetDecl, binaryExpr->getRHS());
+            return;
+        }
+    }
+
+    addOptionalPredicate(expansion, edgeDecl, targetDecl, expr);
+}
+
+void ReadStmtGenerator::addOptionalPredicate(EdgeExpansionNode* expansion,
+                                             const VarDecl* edgeDecl,
+                                             const VarDecl* targetDecl,
+                                             Expr* expr) {
+    ExprDependencies deps;
+    deps.genExprDependencies(*_variables, expr);
+
+    if (!deps.getFuncDeps().empty()) {
+        throwError("OPTIONAL MATCH does not support functions in its predicates yet", expr);
+    }
+
+    // The expansion reads the properties of its edges and of their targets,
+    // the other variables are not available before the null extension
+    std::vector<const PropertyExpr*> properties;
+    for (const ExprDependencies::VarDependency& dep : deps.getVarDeps()) {
+        const auto* propExpr = dynamic_cast<const PropertyExpr*>(dep._expr);
+        if (!propExpr) {
+            throwError("OPTIONAL MATCH predicates only support the properties "
+                       "of its edge and of its target node for now", expr);
+        }
+
+        const VarDecl* entityDecl = propExpr->getEntityVarDecl();
+        if (entityDecl != edgeDecl && entityDecl != targetDecl) {
+            throwError("OPTIONAL MATCH predicates only support the properties "
+                       "of its edge and of its target node for now", expr);
+        }
+
+        properties.push_back(propExpr);
+    }
+
+    expansion->addOptionalPredicate(expr, properties);
+}
+
 void ReadStmtGenerator::generateCallStmt(const CallStmt* callStmt) {
     if (callStmt->isOptional()) {
         throwError("OPTIONAL CALL not supported", callStmt);
@@ -125,6 +324,44 @@ void ReadStmtGenerator::generateCallStmt(const CallStmt* callStmt) {
     } else {
         bioassert(yield, "Procedure call without YIELD must be a standalone CALL");
     }
+
+    // A node argument is the input of the procedure, the nodes
+    // matched by the previous statements are consumed by the call
+    bool hasInput = false;
+    for (const Expr* arg : funcExpr->getFunctionInvocation()->getArguments()->getExprs()) {
+        if (arg->getType() != EvaluatedType::NodePattern) {
+            continue;
+        }
+
+        if (hasInput) {
+            throwError("Procedures can only take one node argument", arg);
+        }
+
+        VarNode* var = std::get<0>(_variables->getVarNodeAndFilter(arg->getExprVarDecl()));
+        if (!var) {
+            throwError("Node argument of a procedure must be matched before the call", arg);
+        }
+
+        var->connectOut(procNode);
+        hasInput = true;
+    }
+
+    // The yielded node can be expanded by the next statements
+    bool hasNodeYield = false;
+    for (const SymbolExpr* item : *yield->getItems()) {
+        const VarDecl* decl = item->getExprVarDecl();
+        if (decl->getType() != EvaluatedType::NodePattern) {
+            continue;
+        }
+
+        if (hasNodeYield) {
+            throwError("Procedure calls inside a query can only yield one node", item);
+        }
+
+        FilterNode* filter = std::get<1>(_variables->createVarNodeAndFilter(decl));
+        procNode->connectOut(filter);
+        hasNodeYield = true;
+    }
 }
 
 void ReadStmtGenerator::generateWhereClause(const WhereClause* where) {
@@ -235,10 +472,6 @@ VarNode* ReadStmtGenerator::generatePatternElementEdge(VarNode* prevNode,
     const PropertyTypeMap& propTypeMap = _graphMetadata.propTypes();
     const VarDecl* decl = edge->getDecl();
 
-    if (edgeTypes.size() > 1) {
-        throwError("Only one edge type constraint is supported for now", edge);
-    }
-
     auto [var, filter] = _variables->getVarNodeAndFilter(decl);
     if (!var) {
         std::tie(var, filter) = _variables->createVarNodeAndFilter(decl);
@@ -249,7 +482,7 @@ VarNode* ReadStmtGenerator::generatePatternElementEdge(VarNode* prevNode,
     currentNode->connectOut(filter);
     EdgeFilterNode* edgeFilter = filter->asEdgeFilter();
 
-    // Type constraints
+    // Type constraints, the edge matches any of them
     for (std::string_view edgeTypeName : edgeTypes) {
         const std::optional edgeType = edgeTypeMap.get(edgeTypeName);
         if (!edgeType) {
@@ -370,6 +603,12 @@ void ReadStmtGenerator::unwrapWhereExpr(Expr* expr) {
                     throwError("Only one edge type constraint is supported for now", expr);
                 }
 
+                // The types of the filter are alternatives, which can not express
+                // the conjunction with the types of the pattern
+                if (!edgeFilter->getEdgeTypeConstraints().empty()) {
+                    throwError("Edge type constraints in both the pattern and the WHERE clause are not supported yet", expr);
+                }
+
                 const std::string_view edgeTypeName = edgeTypes->front()->getName();
                 const std::optional edgeType = edgeTypeMap.get(edgeTypeName);
 
@@ -658,7 +897,8 @@ void ReadStmtGenerator::insertDataFlowNode(VarNode* node, VarNode* dependency) {
 
         case PlanGraphTopology::PathToDependency::NoPath: {
             // If nodes are on two different islands
-            // Cartesian product. This can be optimized in the future into a ValueHashJoin
+            // Cartesian product. PlanOptimizer turns it into a value join when the
+            // predicate is an equality between properties of the two islands
             CartesianProductNode* join = _tree->insertBefore<CartesianProductNode>(filter);
             PlanGraphNode* depBranchTip = _topology->getBranchTip(dependency);
             depBranchTip->connectOut(join);
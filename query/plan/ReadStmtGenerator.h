@@ -27,6 +27,8 @@ class NodePattern;
 class EdgePattern;
 class PropertyExpr;
 class EntityTypeExpr;
+class EdgeExpansionNode;
+class VarDecl;
 
 class ReadStmtGenerator {
 public:
@@ -44,6 +46,7 @@ public:
 
     void generateStmt(const Stmt* stmt);
     void generateMatchStmt(const MatchStmt* stmt);
+    void generateOptionalMatchStmt(const MatchStmt* stmt);
     void generateCallStmt(const CallStmt* stmt);
     void generateWhereClause(const WhereClause* where);
     void generatePatternElement(const PatternElement* element);
@@ -54,6 +57,16 @@ public:
 
     void unwrapWhereExpr(Expr*);
 
+    // Constraints of an optional pattern, applied by its expansion
+    void unwrapOptionalWhereExpr(EdgeExpansionNode* expansion,
+                                 const VarDecl* edgeDecl,
+                                 const VarDecl* targetDecl,
+                                 Expr* expr);
+    void addOptionalPredicate(EdgeExpansionNode* expansion,
+                              const VarDecl* edgeDecl,
+                              const VarDecl* targetDecl,
+                              Expr* expr);
+
     void placeJoinsOnVars();
     void placePredicateJoins();
     PlanGraphNode* generateEndpoint();
@@ -0,0 +1,32 @@
+#pragma once
+
+#include <vector>
+
+#include "PlanGraphNode.h"
+
+namespace db {
+
+class Expr;
+
+class DistinctNode : public PlanGraphNode {
+public:
+    using KeyVector = std::vector<const Expr*>;
+
+    explicit DistinctNode()
+        : PlanGraphNode(PlanGraphOpcode::DISTINCT)
+    {
+    }
+
+    void addKey(const Expr* key) {
+        _keys.push_back(key);
+    }
+
+    const KeyVector& keys() const {
+        return _keys;
+    }
+
+private:
+    KeyVector _keys;
+};
+
+}
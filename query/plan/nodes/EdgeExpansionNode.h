@@ -0,0 +1,78 @@
+#pragma once
+
+#include <span>
+#include <vector>
+
+#include "PlanGraphNode.h"
+#include "ID.h"
+#include "metadata/LabelSet.h"
+
+namespace db {
+
+class Expr;
+class PropertyExpr;
+
+/**
+ * @brief Base of the nodes expanding the edges of a stream of nodes.
+ *
+ * @detail An optional expansion is a left outer expansion: the nodes without
+ * any edge matching the constraints of the optional pattern are kept, with null
+ * edges and null target nodes. The constraints of the optional pattern (edge types,
+ * labels of the target node and predicates on the properties of the edge and of
+ * the target node) are applied by the expansion itself, before the rows without
+ * edges are extended with nulls.
+ * The edge types of the edge filter of other expansions are pushed into them
+ * by the optimizer. An edge matches any of the edge type constraints.
+ */
+class EdgeExpansionNode : public PlanGraphNode {
+public:
+    void setOptional(bool optional) { _optional = optional; }
+    bool isOptional() const { return _optional; }
+
+    void addEdgeTypeConstraint(EdgeTypeID edgeTypeID) {
+        _edgeTypeConstraints.emplace_back(edgeTypeID);
+    }
+
+    const std::vector<EdgeTypeID>& getEdgeTypeConstraints() const {
+        return _edgeTypeConstraints;
+    }
+
+    // Labels of the target nodes of an optional expansion
+    void addTargetLabelConstraints(const LabelSet& labels) {
+        _targetLabelConstraints.merge(labels);
+    }
+
+    const LabelSet& getTargetLabelConstraints() const {
+        return _targetLabelConstraints;
+    }
+
+    // Predicate of an optional expansion, which only reads the given
+    // properties of the edge and of the target node
+    void addOptionalPredicate(Expr* expr, std::span<const PropertyExpr* const> properties) {
+        _optionalPredicates.push_back(expr);
+        _optionalProperties.insert(_optionalProperties.end(), properties.begin(), properties.end());
+    }
+
+    const std::vector<Expr*>& getOptionalPredicates() const {
+        return _optionalPredicates;
+    }
+
+    const std::vector<const PropertyExpr*>& getOptionalProperties() const {
+        return _optionalProperties;
+    }
+
+protected:
+    explicit EdgeExpansionNode(PlanGraphOpcode opcode)
+        : PlanGraphNode(opcode)
+    {
+    }
+
+private:
+    bool _optional {false};
+    std::vector<EdgeTypeID> _edgeTypeConstraints;
+    LabelSet _targetLabelConstraints;
+    std::vector<Expr*> _optionalPredicates;
+    std::vector<const PropertyExpr*> _optionalProperties;
+};
+
+}
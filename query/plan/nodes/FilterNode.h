@@ -35,6 +35,10 @@ public:
         return _predicates;
     }
 
+    void removePredicate(const Predicate* pred) {
+        std::erase(_predicates, pred);
+    }
+
     NodeFilterNode* asNodeFilter();
     const NodeFilterNode* asNodeFilter() const;
 
@@ -88,6 +92,10 @@ public:
         return _edgeTypeConstraints;
     }
 
+    void clearEdgeTypeConstraints() {
+        _edgeTypeConstraints.clear();
+    }
+
     bool isEmpty() const override {
         return FilterNode::isEmpty() && _edgeTypeConstraints.empty();
     }
@@ -1,13 +1,13 @@
 #pragma once
 
-#include "PlanGraphNode.h"
+#include "EdgeExpansionNode.h"
 
 namespace db {
 
-class GetEdgesNode : public PlanGraphNode {
+class GetEdgesNode : public EdgeExpansionNode {
 public:
     explicit GetEdgesNode()
-        : PlanGraphNode(PlanGraphOpcode::GET_EDGES)
+        : EdgeExpansionNode(PlanGraphOpcode::GET_EDGES)
     {
     }
 };
@@ -1,13 +1,13 @@
 #pragma once
 
-#include "PlanGraphNode.h"
+#include "EdgeExpansionNode.h"
 
 namespace db {
 
-class GetInEdgesNode : public PlanGraphNode {
+class GetInEdgesNode : public EdgeExpansionNode {
 public:
     explicit GetInEdgesNode()
-        : PlanGraphNode(PlanGraphOpcode::GET_IN_EDGES)
+        : EdgeExpansionNode(PlanGraphOpcode::GET_IN_EDGES)
     {
     }
 };
@@ -1,13 +1,13 @@
 #pragma once
 
-#include "PlanGraphNode.h"
+#include "EdgeExpansionNode.h"
 
 namespace db {
 
-class GetOutEdgesNode : public PlanGraphNode {
+class GetOutEdgesNode : public EdgeExpansionNode {
 public:
     explicit GetOutEdgesNode()
-        : PlanGraphNode(PlanGraphOpcode::GET_OUT_EDGES)
+        : EdgeExpansionNode(PlanGraphOpcode::GET_OUT_EDGES)
     {
     }
 };
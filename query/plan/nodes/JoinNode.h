@@ -9,7 +9,7 @@ enum class JoinType : uint8_t {
     COMMON_ANCESTOR = 0,
     COMMON_SUCCESSOR,
     DIAMOND, // Common Ancestor + Common Sucessor
-    PREDICATE,
+    PREDICATE, // Equi-join on the values of the expressions of the join key vars
 };
 
 class JoinNode : public PlanGraphNode {
@@ -28,6 +28,7 @@ enum class PlanGraphOpcode {
     FUNC_EVAL,
     AGGREGATE_EVAL,
     PROCEDURE_EVAL,
+    DISTINCT,
     ORDER_BY,
     SKIP,
     LIMIT,
@@ -66,6 +67,7 @@ using PlanGraphOpcodeDescription = EnumToString<PlanGraphOpcode>::Create<
     EnumStringPair<PlanGraphOpcode::FUNC_EVAL, "FUNC_EVAL">,
     EnumStringPair<PlanGraphOpcode::AGGREGATE_EVAL, "AGGREGATE_EVAL">,
     EnumStringPair<PlanGraphOpcode::PROCEDURE_EVAL, "PROCEDURE_EVAL">,
+    EnumStringPair<PlanGraphOpcode::DISTINCT, "DISTINCT">,
     EnumStringPair<PlanGraphOpcode::ORDER_BY, "ORDER_BY">,
     EnumStringPair<PlanGraphOpcode::SKIP, "SKIP">,
     EnumStringPair<PlanGraphOpcode::LIMIT, "LIMIT">,
@@ -135,6 +137,30 @@ public:
         _outputs.clear();
     }
 
+    // Moves the outputs to other, keeping the position of other
+    // in the inputs of the outputs
+    void moveOutputsTo(PlanGraphNode* other) {
+        for (PlanGraphNode* output : _outputs) {
+            for (PlanGraphNode*& input : output->_inputs) {
+                if (input == this) {
+                    input = other;
+                    break;
+                }
+            }
+
+            other->_outputs.emplace_back(output);
+        }
+
+        _outputs.clear();
+    }
+
+    // Number of rows estimated by the optimizer, negative if unknown
+    double getEstimatedRows() const { return _estimatedRows; }
+
+    bool hasEstimatedRows() const { return _estimatedRows >= 0; }
+
+    void setEstimatedRows(double rows) { _estimatedRows = rows; }
+
 protected:
     explicit PlanGraphNode(PlanGraphOpcode opcode)
         : _opcode(opcode)
@@ -145,5 +171,6 @@ private:
     PlanGraphOpcode _opcode {PlanGraphOpcode::UNKNOWN};
     Nodes _inputs;
     Nodes _outputs;
+    double _estimatedRows {-1};
 };
 }
@@ -0,0 +1,136 @@
+#include <stdlib.h>
+
+#include <algorithm>
+#include <array>
+#include <string_view>
+#include <vector>
+
+#include <spdlog/fmt/fmt.h>
+
+#include "TuringDB.h"
+#include "TuringConfig.h"
+#include "SystemManager.h"
+#include "LocalMemory.h"
+#include "SimpleGraph.h"
+#include "TypingGraph.h"
+#include "dataframe/Dataframe.h"
+#include "iterators/ChunkConfig.h"
+#include "TuringTime.h"
+
+// Latency of the queries of the query tests for a sweep of chunk sizes,
+// the stages still bound their chunks by the L2 budget of their row width
+
+using namespace db;
+
+namespace {
+
+constexpr size_t runCount = 200;
+
+constexpr std::array chunkSizes = {
+    size_t {1},
+    size_t {16},
+    size_t {256},
+    size_t {4 * 1024},
+    ChunkConfig::CHUNK_SIZE,
+};
+
+struct BenchQuery {
+    std::string_view _graph;
+    std::string_view _query;
+};
+
+constexpr std::array queries = {
+    BenchQuery {"simpledb", "MATCH (n) RETURN n"},
+    BenchQuery {"simpledb", "MATCH (n:Person) RETURN n.name, n.age, n.isFrench"},
+    BenchQuery {"simpledb", "MATCH (n)-->(m) RETURN n.name, m.name"},
+    BenchQuery {"simpledb", "MATCH (n)-->(m)-->(p) RETURN n, m, p"},
+    BenchQuery {"simpledb", "MATCH (n) WHERE n.isFrench RETURN n.name"},
+    BenchQuery {"simpledb", "MATCH (a:Person)-->(b:Interest)<--(c:Person) RETURN a, b, c"},
+    BenchQuery {"simpledb", "MATCH (n)-->(m) RETURN count(m)"},
+    BenchQuery {"typingdb", "MATCH (n)-->(m) RETURN n, m"},
+};
+
+struct BenchResult {
+    float _medianDur {0};
+    size_t _rowCount {0};
+};
+
+bool runQuery(TuringDB& db, LocalMemory& mem, const BenchQuery& query, BenchResult& result) {
+    std::vector<float> durations;
+    durations.reserve(runCount);
+
+    for (size_t i = 0; i < runCount; i++) {
+        size_t rowCount = 0;
+
+        const auto t0 = Clock::now();
+        const auto res = db.query(query._query, query._graph, &mem, [&](const Dataframe* df) {
+            rowCount += df->getRowCount();
+        });
+        durations.push_back(duration<Milliseconds>(t0, Clock::now()));
+
+        if (!res) {
+            fmt::println("Query failed: {}: {}", query._query, res.getError());
+            return false;
+        }
+
+        result._rowCount = rowCount;
+    }
+
+    std::ranges::nth_element(durations, durations.begin() + durations.size() / 2);
+    result._medianDur = durations[durations.size() / 2];
+    return true;
+}
+
+}
+
+int main(int argc, char** argv) {
+    const fs::Path turingDir = fs::Path(SAMPLE_DIR) / ".turing";
+    if (turingDir.exists()) {
+        turingDir.rm();
+    }
+
+    TuringConfig config;
+    config.setTuringDirectory(turingDir);
+    config.setSyncedOnDisk(false);
+
+    TuringDB db(&config);
+    db.init();
+
+    SimpleGraph::createSimpleGraph(db.getSystemManager().createGraph("simpledb"));
+    TypingGraph::createTypingGraph(db.getSystemManager().createGraph("typingdb"));
+
+    LocalMemory mem;
+
+    fmt::println("Median latency (ms) over {} runs", runCount);
+    fmt::print("{:<70} {:>8}", "Query", "Rows");
+    for (const size_t chunkSize : chunkSizes) {
+        fmt::print(" {:>10}", chunkSize);
+    }
+    fmt::println("");
+
+    for (const BenchQuery& query : queries) {
+        size_t rowCount = 0;
+        std::vector<float> medians;
+
+        for (const size_t chunkSize : chunkSizes) {
+            // The config is read by each query
+            config.setChunkSize(chunkSize);
+
+            BenchResult result;
+            if (!runQuery(db, mem, query, result)) {
+                return EXIT_FAILURE;
+            }
+
+            rowCount = result._rowCount;
+            medians.push_back(result._medianDur);
+        }
+
+        fmt::print("{:<70} {:>8}", fmt::format("[{}] {}", query._graph, query._query), rowCount);
+        for (const float median : medians) {
+            fmt::print(" {:>10.3f}", median);
+        }
+        fmt::println("");
+    }
+
+    return EXIT_SUCCESS;
+}
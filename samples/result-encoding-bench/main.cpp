@@ -0,0 +1,161 @@
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <optional>
+#include <random>
+#include <string>
+#include <thread>
+
+#include <spdlog/fmt/fmt.h>
+
+#include "ColumnarEncoder.h"
+#include "JsonEncoder.h"
+#include "NetWriter.h"
+#include "PayloadWriter.h"
+#include "columns/ColumnOptVector.h"
+#include "columns/ColumnVector.h"
+#include "dataframe/DataframeManager.h"
+#include "TuringTime.h"
+
+// Size and encoding time of a query result in the JSON and columnar formats
+
+using namespace db;
+
+namespace {
+
+constexpr size_t rowCount = 1'000'000;
+constexpr size_t batchCount = 4;
+
+struct BenchResult {
+    size_t _bytes {0};
+    float _encodeDur {0};
+};
+
+// Encodes the batches into a socket drained by a reader thread, counting the bytes
+template <typename Func>
+bool runBench(Func&& encode, BenchResult& result) {
+    int sockets[2];
+    if (socketpair(AF_UNIX, SOCK_STREAM, 0, sockets) != 0) {
+        fmt::println("Could not create socket pair");
+        return false;
+    }
+
+    size_t receivedBytes = 0;
+    std::thread reader([&] {
+        std::vector<char> buffer(1 << 16);
+        while (true) {
+            const ssize_t count = ::read(sockets[1], buffer.data(), buffer.size());
+            if (count <= 0) {
+                break;
+            }
+
+            receivedBytes += count;
+        }
+    });
+
+    {
+        net::NetWriter writer {sockets[0]};
+
+        const auto t0 = Clock::now();
+        encode(writer);
+        writer.flush();
+        result._encodeDur = duration<Milliseconds>(t0, Clock::now());
+    }
+
+    ::shutdown(sockets[0], SHUT_WR);
+    reader.join();
+    ::close(sockets[0]);
+    ::close(sockets[1]);
+
+    result._bytes = receivedBytes;
+    return true;
+}
+
+}
+
+int main(int argc, char** argv) {
+    std::mt19937 rng {42};
+    std::uniform_int_distribution<int64_t> intDist {-1'000'000, 1'000'000};
+    std::uniform_real_distribution<double> doubleDist {0.0, 1.0};
+
+    const size_t batchSize = rowCount / batchCount;
+
+    std::vector<std::string> names(batchSize);
+    for (size_t i = 0; i < batchSize; i++) {
+        names[i] = fmt::format("node_name_{}", i);
+    }
+
+    ColumnVector<types::UInt64::Primitive> ids(batchSize);
+    ColumnVector<types::Int64::Primitive> ints(batchSize);
+    ColumnVector<types::Double::Primitive> doubles(batchSize);
+    ColumnVector<types::String::Primitive> strings(batchSize);
+    ColumnOptVector<types::Int64::Primitive> optInts(batchSize);
+
+    for (size_t i = 0; i < batchSize; i++) {
+        ids[i] = i;
+        ints[i] = intDist(rng);
+        doubles[i] = doubleDist(rng);
+        strings[i] = names[i];
+        if (i % 4 != 0) {
+            optInts[i] = intDist(rng);
+        }
+    }
+
+    DataframeManager dfMan;
+    Dataframe df;
+
+    const auto addColumn = [&](Column* col, std::string_view name) {
+        NamedColumn* namedCol = NamedColumn::create(&dfMan, col, dfMan.allocTag());
+        namedCol->rename(name);
+        df.addColumn(namedCol);
+    };
+
+    addColumn(&ids, "id");
+    addColumn(&ints, "int");
+    addColumn(&doubles, "double");
+    addColumn(&strings, "name");
+    addColumn(&optInts, "optional_int");
+
+    BenchResult jsonResult;
+    const bool jsonOk = runBench([&](net::NetWriter& writer) {
+        PayloadWriter payload {&writer};
+        payload.obj();
+        JsonEncoder::writeDataframeHeader(payload, df);
+        payload.key("data");
+        payload.arr();
+
+        for (size_t i = 0; i < batchCount; i++) {
+            JsonEncoder::writeDataframe(payload, df);
+        }
+    }, jsonResult);
+
+    BenchResult columnarResult;
+    const bool columnarOk = runBench([&](net::NetWriter& writer) {
+        ColumnarEncoder encoder {&writer};
+        encoder.writeHeader(df);
+
+        for (size_t i = 0; i < batchCount; i++) {
+            encoder.writeDataframe(df);
+        }
+
+        encoder.writeEnd(0.0);
+    }, columnarResult);
+
+    if (!jsonOk || !columnarOk) {
+        return 1;
+    }
+
+    fmt::println("{} rows in {} batches of {} columns", rowCount, batchCount, df.size());
+    fmt::println("{:<10} {:>14} {:>12} {:>12}", "Format", "Bytes", "Encode (ms)", "MB/s");
+
+    for (const auto& [name, result] : {std::pair {"json", jsonResult},
+                                       std::pair {"columnar", columnarResult}}) {
+        fmt::println("{:<10} {:>14} {:>12.1f} {:>12.1f}",
+                     name,
+                     result._bytes,
+                     result._encodeDur,
+                     result._bytes / (result._encodeDur * 1000.0f));
+    }
+
+    return 0;
+}
@@ -0,0 +1,220 @@
+#include <random>
+#include <unordered_set>
+
+#include <spdlog/fmt/fmt.h>
+
+#include "VecLibAccessor.h"
+#include "VectorSearchQuery.h"
+#include "BatchVectorCreate.h"
+#include "VecLib.h"
+#include "VectorDatabase.h"
+#include "VectorSearchResult.h"
+#include "RandomGenerator.h"
+#include "TuringTime.h"
+
+// Recall and latency of the shard index types against brute force search,
+// on clustered synthetic vectors
+
+namespace {
+
+constexpr vec::Dimension dim = 128;
+constexpr vec::DistanceMetric metric = vec::DistanceMetric::EUCLIDEAN_DIST;
+constexpr size_t vecCount = 50'000;
+constexpr size_t batchSize = 10'000;
+constexpr size_t clusterCount = 64;
+constexpr size_t queryCount = 200;
+constexpr size_t resultCount = 10;
+
+struct BenchConfig {
+    std::string_view _name;
+    vec::IndexType _indexType {vec::IndexType::BRUTE_FORCE};
+    vec::IndexParams _params;
+    size_t _efSearch {0};
+    size_t _probeCount {0};
+};
+
+struct BenchResult {
+    float _buildDur {0};
+    float _searchDur {0};
+    std::vector<std::vector<uint64_t>> _ids;
+};
+
+std::vector<float> generateClusteredVectors(size_t count, std::mt19937& rng) {
+    std::normal_distribution<float> centerDist {0.0f, 1.0f};
+    std::normal_distribution<float> noiseDist {0.0f, 0.1f};
+    std::uniform_int_distribution<size_t> clusterDist {0, clusterCount - 1};
+
+    std::vector<float> centers(clusterCount * dim);
+    for (float& v : centers) {
+        v = centerDist(rng);
+    }
+
+    std::vector<float> data(count * dim);
+    for (size_t i = 0; i < count; i++) {
+        const float* center = centers.data() + clusterDist(rng) * dim;
+        for (size_t j = 0; j < dim; j++) {
+            data[i * dim + j] = center[j] + noiseDist(rng);
+        }
+    }
+
+    return data;
+}
+
+bool runBench(vec::VectorDatabase& db,
+              const BenchConfig& config,
+              std::span<const float> data,
+              std::span<const float> queries,
+              BenchResult& result) {
+    if (db.libraryExists(config._name)) {
+        if (auto res = db.deleteLibrary(config._name); !res) {
+            fmt::println("Could not delete library. {}", res.error().fmtMessage());
+            return false;
+        }
+    }
+
+    const auto createRes = db.createLibrary(config._name, dim, metric,
+                                            config._indexType, config._params);
+    if (!createRes) {
+        fmt::println("Could not create library. {}", createRes.error().fmtMessage());
+        return false;
+    }
+
+    vec::VecLibAccessor lib = db.getLibrary(createRes.value());
+    if (!lib.isValid()) {
+        fmt::println("Library not found");
+        return false;
+    }
+
+    // Build, includes the training of the quantizers
+    auto t0 = Clock::now();
+    {
+        vec::BatchVectorCreate batch = lib.prepareCreateBatch();
+
+        for (size_t first = 0; first < vecCount; first += batchSize) {
+            batch.clear();
+            for (size_t i = first; i < std::min(first + batchSize, vecCount); i++) {
+                batch.addPoint(i, data.subspan(i * dim, dim));
+            }
+
+            if (auto res = lib.addEmbeddings(batch); !res) {
+                fmt::println("Could not add vectors: {}", res.error().fmtMessage());
+                return false;
+            }
+        }
+    }
+    result._buildDur = duration<Milliseconds>(t0, Clock::now());
+
+    // Search
+    vec::VectorSearchQuery query {dim};
+    query.setMaxResultCount(resultCount);
+    query.setEfSearch(config._efSearch);
+    query.setProbeCount(config._probeCount);
+
+    vec::VectorSearchResult results;
+    result._ids.resize(queryCount);
+
+    t0 = Clock::now();
+    for (size_t q = 0; q < queryCount; q++) {
+        query.setVector(queries.subspan(q * dim, dim));
+
+        if (auto res = lib.search(query, results); !res) {
+            fmt::println("Could not search vectors. {}", res.error().fmtMessage());
+            return false;
+        }
+
+        const auto ids = results.ids();
+        result._ids[q].assign(ids.begin(), ids.end());
+    }
+    result._searchDur = duration<Milliseconds>(t0, Clock::now());
+
+    return true;
+}
+
+float computeRecall(const BenchResult& result, const BenchResult& reference) {
+    size_t found = 0;
+    size_t expected = 0;
+
+    for (size_t q = 0; q < queryCount; q++) {
+        const std::unordered_set<uint64_t> refIDs {reference._ids[q].begin(),
+                                                   reference._ids[q].end()};
+        expected += refIDs.size();
+
+        for (const uint64_t id : result._ids[q]) {
+            found += refIDs.contains(id);
+        }
+    }
+
+    return expected == 0 ? 1.0f : (float)found / (float)expected;
+}
+
+}
+
+int main(int argc, char** argv) {
+    const fs::Path rootPath {SAMPLE_DIR "/storage"};
+    vec::RandomGenerator::initialize(1);
+
+    auto dbRes = vec::VectorDatabase::create(rootPath);
+    if (!dbRes) {
+        fmt::println("Could not create database. {}", dbRes.error().fmtMessage());
+        return 1;
+    }
+
+    auto db = std::move(dbRes.value());
+
+    std::mt19937 rng {42};
+    const std::vector<float> data = generateClusteredVectors(vecCount, rng);
+    const std::vector<float> queries = generateClusteredVectors(queryCount, rng);
+
+    vec::IndexParams hnswParams;
+    hnswParams._hnswM = 16;
+    hnswParams._hnswEfConstruction = 64;
+
+    vec::IndexParams ivfParams;
+    ivfParams._ivfListCount = 16;
+    ivfParams._pqSubQuantizerCount = 16;
+    ivfParams._pqBitCount = 8;
+
+    // Compressed indexes searched on their codes only
+    vec::IndexParams ivfCodeParams = ivfParams;
+    ivfCodeParams._rerankFactor = 0;
+
+    vec::IndexParams sq8CodeParams;
+    sq8CodeParams._rerankFactor = 0;
+
+    const std::vector<BenchConfig> configs = {
+        {"bench-flat", vec::IndexType::BRUTE_FORCE, {}, 0, 0},
+        {"bench-hnsw-ef16", vec::IndexType::HNSW, hnswParams, 16, 0},
+        {"bench-hnsw-ef64", vec::IndexType::HNSW, hnswParams, 64, 0},
+        {"bench-ivfpq-nprobe1", vec::IndexType::IVF_PQ, ivfParams, 0, 1},
+        {"bench-ivfpq-nprobe8", vec::IndexType::IVF_PQ, ivfParams, 0, 8},
+        {"bench-ivfpq-nprobe8-nr", vec::IndexType::IVF_PQ, ivfCodeParams, 0, 8},
+        {"bench-sq8", vec::IndexType::SQ8, {}, 0, 0},
+        {"bench-sq8-nr", vec::IndexType::SQ8, sq8CodeParams, 0, 0},
+    };
+
+    fmt::println("{} vectors of dimension {}, {} queries, top {}",
+                 vecCount, dim, queryCount, resultCount);
+    fmt::println("{:<22} {:>12} {:>16} {:>10}",
+                 "Index", "Build (ms)", "Search (us/q)", "Recall");
+
+    BenchResult reference;
+
+    for (const BenchConfig& config : configs) {
+        BenchResult result;
+        if (!runBench(*db, config, data, queries, result)) {
+            return 1;
+        }
+
+        if (config._indexType == vec::IndexType::BRUTE_FORCE) {
+            reference = result;
+        }
+
+        fmt::println("{:<22} {:>12.1f} {:>16.1f} {:>10.3f}",
+                     config._name,
+                     result._buildDur,
+                     result._searchDur * 1000.0f / queryCount,
+                     computeRecall(result, reference));
+    }
+
+    return 0;
+}
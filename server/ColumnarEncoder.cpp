@@ -0,0 +1,521 @@
+#include "ColumnarEncoder.h"
+
+#include <optional>
+#include <string>
+#include <type_traits>
+
+#include "NetWriter.h"
+#include "ID.h"
+#include "metadata/PropertyType.h"
+#include "versioning/Change.h"
+#include "versioning/ChangeID.h"
+#include "versioning/CommitBuilder.h"
+#include "columns/Column.h"
+#include "columns/ColumnConst.h"
+#include "columns/ColumnOptVector.h"
+#include "columns/ColumnVector.h"
+#include "dataframe/Dataframe.h"
+
+#include "Panic.h"
+
+using namespace db;
+
+namespace {
+
+using ColumnType = ColumnarEncoder::ColumnType;
+
+constexpr size_t paddedSize(size_t size) {
+    return (size + 7) & ~(size_t)7;
+}
+
+template <IntegralType T>
+constexpr ColumnType getIntegralColumnType() {
+    if constexpr (std::is_same_v<T, uint64_t>) {
+        return ColumnType::UInt64;
+    } else if constexpr (std::is_same_v<T, int64_t>) {
+        return ColumnType::Int64;
+    } else if constexpr (std::is_same_v<T, uint32_t>) {
+        return ColumnType::UInt32;
+    } else if constexpr (std::is_same_v<T, uint16_t>) {
+        return ColumnType::UInt16;
+    } else {
+        static_assert(sizeof(T) == 0, "Integral type not supported by the columnar encoding");
+    }
+}
+
+// Encoded type of the values of a column, and the conversion of a value to its
+// encoded representation
+template <typename T>
+struct ColumnarValue;
+
+template <IntegralType T, int I>
+struct ColumnarValue<ID<T, I>> {
+    using Raw = T;
+    static constexpr ColumnType Type = getIntegralColumnType<T>();
+    static Raw get(ID<T, I> v) { return v.getValue(); }
+};
+
+template <>
+struct ColumnarValue<uint64_t> {
+    using Raw = uint64_t;
+    static constexpr ColumnType Type = ColumnType::UInt64;
+    static Raw get(uint64_t v) { return v; }
+};
+
+template <>
+struct ColumnarValue<int64_t> {
+    using Raw = int64_t;
+    static constexpr ColumnType Type = ColumnType::Int64;
+    static Raw get(int64_t v) { return v; }
+};
+
+template <>
+struct ColumnarValue<double> {
+    using Raw = double;
+    static constexpr ColumnType Type = ColumnType::Double;
+    static Raw get(double v) { return v; }
+};
+
+template <>
+struct ColumnarValue<CustomBool> {
+    using Raw = uint8_t;
+    static constexpr ColumnType Type = ColumnType::Bool;
+    static Raw get(CustomBool v) { return v._boolean; }
+};
+
+template <>
+struct ColumnarValue<ChangeID> {
+    using Raw = uint64_t;
+    static constexpr ColumnType Type = ColumnType::UInt64;
+    static Raw get(ChangeID v) { return v.get(); }
+};
+
+template <>
+struct ColumnarValue<const CommitBuilder*> {
+    using Raw = uint64_t;
+    static constexpr ColumnType Type = ColumnType::UInt64;
+    static Raw get(const CommitBuilder* v) { return v->hash().get(); }
+};
+
+template <>
+struct ColumnarValue<const Change*> {
+    using Raw = uint64_t;
+    static constexpr ColumnType Type = ColumnType::UInt64;
+    static Raw get(const Change* v) { return v->id().get(); }
+};
+
+template <>
+struct ColumnarValue<std::string_view> {
+    static constexpr ColumnType Type = ColumnType::String;
+    static std::string_view get(std::string_view v) { return v; }
+};
+
+template <>
+struct ColumnarValue<std::string> {
+    static constexpr ColumnType Type = ColumnType::String;
+    static std::string_view get(const std::string& v) { return v; }
+};
+
+template <>
+struct ColumnarValue<ValueType> {
+    static constexpr ColumnType Type = ColumnType::String;
+    static std::string_view get(ValueType v) { return ValueTypeName::value(v); }
+};
+
+template <typename T>
+concept StringValue = ColumnarValue<T>::Type == ColumnType::String;
+
+template <typename T>
+struct IsID : std::false_type {};
+
+template <IntegralType T, int I>
+struct IsID<ID<T, I>> : std::true_type {};
+
+// IDs are nullable, an invalid ID is null
+template <typename T>
+concept IDValue = IsID<T>::value;
+
+// Values stored in memory as they are encoded, written without conversion
+template <typename T>
+concept RawValue = !StringValue<T>
+                && !std::is_pointer_v<T>
+                && std::is_trivially_copyable_v<T>
+                && sizeof(T) == sizeof(typename ColumnarValue<T>::Raw);
+
+template <typename T>
+uint64_t getValuesSize(size_t count, auto&& getString) {
+    if constexpr (StringValue<T>) {
+        size_t dataSize = 0;
+        for (size_t i = 0; i < count; i++) {
+            dataSize += getString(i).size();
+        }
+
+        return (count + 1) * sizeof(uint64_t) + paddedSize(dataSize);
+    } else {
+        return paddedSize(count * sizeof(typename ColumnarValue<T>::Raw));
+    }
+}
+
+template <typename T>
+uint64_t getColumnSize(const ColumnVector<T>& col) {
+    const size_t bitmapSize = IDValue<T> ? paddedSize((col.size() + 7) / 8) : 0;
+    return sizeof(uint64_t) + bitmapSize + getValuesSize<T>(col.size(), [&](size_t i) {
+        return ColumnarValue<T>::get(col[i]);
+    });
+}
+
+template <typename T>
+uint64_t getColumnSize(const ColumnVector<std::optional<T>>& col) {
+    const size_t bitmapSize = paddedSize((col.size() + 7) / 8);
+    return sizeof(uint64_t) + bitmapSize + getValuesSize<T>(col.size(), [&](size_t i) {
+        if constexpr (StringValue<T>) {
+            return col[i] ? ColumnarValue<T>::get(*col[i]) : std::string_view {};
+        } else {
+            return std::string_view {};
+        }
+    });
+}
+
+template <typename T>
+uint64_t getColumnSize(const ColumnConst<T>& col) {
+    return sizeof(uint64_t) + getValuesSize<T>(1, [&](size_t) {
+        return ColumnarValue<T>::get(col.getRaw());
+    });
+}
+
+template <typename T>
+uint8_t getColumnFlags(const ColumnVector<T>&) {
+    return IDValue<T> ? ColumnarEncoder::NULLABLE : 0;
+}
+
+template <typename T>
+uint8_t getColumnFlags(const ColumnVector<std::optional<T>>&) {
+    return ColumnarEncoder::NULLABLE;
+}
+
+template <typename T>
+uint8_t getColumnFlags(const ColumnConst<T>&) {
+    return ColumnarEncoder::CONSTANT;
+}
+
+template <typename T>
+struct ColumnValueType {
+};
+
+template <typename T>
+struct ColumnValueType<ColumnVector<T>> {
+    using Type = T;
+};
+
+template <typename T>
+struct ColumnValueType<ColumnVector<std::optional<T>>> {
+    using Type = T;
+};
+
+template <typename T>
+struct ColumnValueType<ColumnConst<T>> {
+    using Type = T;
+};
+
+#define COLUMNAR_VECTOR_CASE(Type)                             \
+    case ColumnVector<Type>::staticKind(): {                   \
+        func(*static_cast<const ColumnVector<Type>*>(col));    \
+    }                                                          \
+    return;
+
+#define COLUMNAR_TYPE_CASES(Type)                              \
+    COLUMNAR_VECTOR_CASE(Type)                                 \
+    case ColumnOptVector<Type>::staticKind(): {                \
+        func(*static_cast<const ColumnOptVector<Type>*>(col)); \
+    }                                                          \
+    return;                                                    \
+    case ColumnConst<Type>::staticKind(): {                    \
+        func(*static_cast<const ColumnConst<Type>*>(col));     \
+    }                                                          \
+    return;
+
+template <typename Func>
+void visitColumn(const Column* col, Func&& func) {
+    switch (col->getKind()) {
+        COLUMNAR_TYPE_CASES(EntityID)
+        COLUMNAR_TYPE_CASES(NodeID)
+        COLUMNAR_TYPE_CASES(EdgeID)
+        COLUMNAR_TYPE_CASES(LabelID)
+        COLUMNAR_TYPE_CASES(LabelSetID)
+        COLUMNAR_TYPE_CASES(EdgeTypeID)
+        COLUMNAR_TYPE_CASES(PropertyTypeID)
+        COLUMNAR_TYPE_CASES(ValueType)
+        COLUMNAR_TYPE_CASES(ChangeID)
+        COLUMNAR_TYPE_CASES(types::UInt64::Primitive)
+        COLUMNAR_TYPE_CASES(types::Int64::Primitive)
+        COLUMNAR_TYPE_CASES(types::Double::Primitive)
+        COLUMNAR_TYPE_CASES(types::Bool::Primitive)
+        COLUMNAR_TYPE_CASES(types::String::Primitive)
+        COLUMNAR_TYPE_CASES(std::string)
+        COLUMNAR_VECTOR_CASE(const CommitBuilder*)
+        COLUMNAR_VECTOR_CASE(const Change*)
+
+        default: {
+            panic("ColumnarEncoder: columns of kind {} are not supported", col->getKind());
+        }
+    }
+}
+
+#undef COLUMNAR_TYPE_CASES
+#undef COLUMNAR_VECTOR_CASE
+
+class BufferWriter {
+public:
+    BufferWriter(net::NetWriter& writer, std::vector<char>& staging)
+        : _writer(writer),
+        _staging(staging)
+    {
+    }
+
+    void writeBytes(const void* data, size_t size) {
+        _writer.writeBytes(std::string_view {static_cast<const char*>(data), size});
+    }
+
+    void writePadding(size_t size) {
+        static constexpr char zeros[8] {};
+        writeBytes(zeros, paddedSize(size) - size);
+    }
+
+    template <typename T>
+    void writeScalar(T value) {
+        writeBytes(&value, sizeof(T));
+    }
+
+    template <typename T>
+    void writeColumn(const ColumnVector<T>& col) {
+        writeScalar<uint64_t>(col.size());
+
+        if constexpr (IDValue<T>) {
+            writeBitmap(col.size(), [&](size_t i) {
+                return col[i].isValid();
+            });
+
+            using Raw = typename ColumnarValue<T>::Raw;
+            writeConverted(col.size(), [&](size_t i) {
+                return col[i].isValid() ? ColumnarValue<T>::get(col[i]) : Raw {};
+            });
+        } else if constexpr (StringValue<T>) {
+            writeStrings(col.size(), [&](size_t i) {
+                return ColumnarValue<T>::get(col[i]);
+            });
+        } else if constexpr (RawValue<T>) {
+            const size_t size = col.size() * sizeof(T);
+            writeBytes(col.data(), size);
+            writePadding(size);
+        } else {
+            writeConverted(col.size(), [&](size_t i) {
+                return ColumnarValue<T>::get(col[i]);
+            });
+        }
+    }
+
+    template <typename T>
+    void writeColumn(const ColumnVector<std::optional<T>>& col) {
+        const size_t count = col.size();
+        writeScalar<uint64_t>(count);
+
+        writeBitmap(count, [&](size_t i) {
+            return col[i].has_value();
+        });
+
+        if constexpr (StringValue<T>) {
+            writeStrings(count, [&](size_t i) {
+                return col[i] ? ColumnarValue<T>::get(*col[i]) : std::string_view {};
+            });
+        } else {
+            using Raw = typename ColumnarValue<T>::Raw;
+            writeConverted(count, [&](size_t i) {
+                return col[i] ? ColumnarValue<T>::get(*col[i]) : Raw {};
+            });
+        }
+    }
+
+    template <typename T>
+    void writeColumn(const ColumnConst<T>& col) {
+        writeScalar<uint64_t>(1);
+
+        if constexpr (StringValue<T>) {
+            writeStrings(1, [&](size_t) {
+                return ColumnarValue<T>::get(col.getRaw());
+            });
+        } else {
+            writeConverted(1, [&](size_t) {
+                return ColumnarValue<T>::get(col.getRaw());
+            });
+        }
+    }
+
+private:
+    net::NetWriter& _writer;
+    std::vector<char>& _staging;
+
+    // Validity bitmap of the rows of a NULLABLE column
+    template <typename Func>
+    void writeBitmap(size_t count, Func&& isValid) {
+        std::vector<uint8_t> bitmap(paddedSize((count + 7) / 8));
+        for (size_t i = 0; i < count; i++) {
+            if (isValid(i)) {
+                bitmap[i / 8] |= 1 << (i % 8);
+            }
+        }
+
+        writeBytes(bitmap.data(), bitmap.size());
+    }
+
+    // Converts the values in blocks staged before being written
+    template <typename Func>
+    void writeConverted(size_t count, Func&& getValue) {
+        using Raw = std::invoke_result_t<Func, size_t>;
+        static constexpr size_t blockSize = 4096;
+
+        _staging.resize(blockSize * sizeof(Raw));
+        Raw* block = reinterpret_cast<Raw*>(_staging.data());
+
+        for (size_t first = 0; first < count; first += blockSize) {
+            const size_t blockCount = std::min(blockSize, count - first);
+            for (size_t i = 0; i < blockCount; i++) {
+                block[i] = getValue(first + i);
+            }
+
+            writeBytes(block, blockCount * sizeof(Raw));
+        }
+
+        writePadding(count * sizeof(Raw));
+    }
+
+    template <typename Func>
+    void writeStrings(size_t count, Func&& getString) {
+        // Offsets
+        uint64_t offset = 0;
+        writeScalar<uint64_t>(0);
+        writeConverted(count, [&](size_t i) {
+            offset += getString(i).size();
+            return offset;
+        });
+
+        // Data
+        for (size_t i = 0; i < count; i++) {
+            const std::string_view str = getString(i);
+            writeBytes(str.data(), str.size());
+        }
+
+        writePadding(offset);
+    }
+};
+
+std::string getColumnName(const NamedColumn* namedCol) {
+    const std::string_view name = namedCol->getName();
+    if (name.empty()) {
+        return "$" + std::to_string(namedCol->getTag().getValue());
+    }
+
+    return std::string(name);
+}
+
+}
+
+void ColumnarEncoder::writeHeader(const Dataframe& df) {
+    std::vector<std::string> names;
+    names.reserve(df.size());
+
+    uint64_t bodySize = 2 * sizeof(uint32_t);
+    for (const NamedColumn* namedCol : df.cols()) {
+        const std::string& name = names.emplace_back(getColumnName(namedCol));
+        bodySize += 8 + paddedSize(name.size());
+    }
+
+    writeMessageHeader(MessageType::HEADER, bodySize);
+
+    BufferWriter out {*_writer, _staging};
+    out.writeScalar<uint32_t>(VERSION);
+    out.writeScalar<uint32_t>(df.size());
+
+    for (size_t i = 0; i < df.size(); i++) {
+        visitColumn(df.cols()[i]->getColumn(), [&]<typename ColumnT>(const ColumnT& col) {
+            using T = typename ColumnValueType<ColumnT>::Type;
+            out.writeScalar<uint8_t>((uint8_t)ColumnarValue<T>::Type);
+            out.writeScalar<uint8_t>(getColumnFlags(col));
+        });
+
+        out.writeScalar<uint16_t>(0);
+        out.writeScalar<uint32_t>(names[i].size());
+        out.writeBytes(names[i].data(), names[i].size());
+        out.writePadding(names[i].size());
+    }
+
+    _headerWritten = true;
+}
+
+void ColumnarEncoder::writeEmptyHeader() {
+    writeMessageHeader(MessageType::HEADER, 2 * sizeof(uint32_t));
+
+    BufferWriter out {*_writer, _staging};
+    out.writeScalar<uint32_t>(VERSION);
+    out.writeScalar<uint32_t>(0);
+
+    _headerWritten = true;
+}
+
+void ColumnarEncoder::writeDataframe(const Dataframe& df) {
+    if (!_headerWritten) {
+        writeHeader(df);
+    }
+
+    uint64_t bodySize = 2 * sizeof(uint32_t);
+    for (const NamedColumn* namedCol : df.cols()) {
+        visitColumn(namedCol->getColumn(), [&](const auto& col) {
+            bodySize += getColumnSize(col);
+        });
+    }
+
+    writeMessageHeader(MessageType::BATCH, bodySize);
+
+    BufferWriter out {*_writer, _staging};
+    out.writeScalar<uint32_t>(df.size());
+    out.writeScalar<uint32_t>(0);
+
+    for (const NamedColumn* namedCol : df.cols()) {
+        visitColumn(namedCol->getColumn(), [&](const auto& col) {
+            out.writeColumn(col);
+        });
+    }
+}
+
+void ColumnarEncoder::writeEnd(double totalTimeMs) {
+    if (!_headerWritten) {
+        writeEmptyHeader();
+    }
+
+    writeMessageHeader(MessageType::END, sizeof(double));
+
+    BufferWriter out {*_writer, _staging};
+    out.writeScalar<double>(totalTimeMs);
+}
+
+void ColumnarEncoder::writeError(std::string_view error, std::string_view details) {
+    if (!_headerWritten) {
+        writeEmptyHeader();
+    }
+
+    const size_t size = 2 * sizeof(uint32_t) + error.size() + details.size();
+    writeMessageHeader(MessageType::ERROR, paddedSize(size));
+
+    BufferWriter out {*_writer, _staging};
+    out.writeScalar<uint32_t>(error.size());
+    out.writeScalar<uint32_t>(details.size());
+    out.writeBytes(error.data(), error.size());
+    out.writeBytes(details.data(), details.size());
+    out.writePadding(size);
+}
+
+void ColumnarEncoder::writeMessageHeader(MessageType type, uint64_t bodySize) {
+    BufferWriter out {*_writer, _staging};
+    out.writeScalar<uint32_t>((uint32_t)type);
+    out.writeScalar<uint32_t>(0);
+    out.writeScalar<uint64_t>(bodySize);
+}
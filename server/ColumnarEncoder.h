@@ -0,0 +1,100 @@
+#pragma once
+
+#include <stdint.h>
+#include <string_view>
+#include <vector>
+
+namespace net {
+class NetWriter;
+}
+
+namespace db {
+
+class Column;
+class Dataframe;
+
+/**
+ * @brief Binary columnar encoding of query results, requested with format=columnar.
+ *
+ * @detail The column buffers of the dataframes are written as they are laid out in
+ * memory, without formatting values. Integers are little endian and every buffer
+ * is padded to a multiple of 8 bytes. The stream is a sequence of messages:
+ *
+ *   message := u32 type | u32 reserved | u64 bodySize | body
+ *
+ * - HEADER, always first, with a columnCount of 0 if the query returned no dataframe:
+ *     u32 version | u32 columnCount
+ *     per column: u8 type | u8 flags | u16 reserved | u32 nameSize | name | padding
+ * - BATCH, one per dataframe streamed by the query:
+ *     u32 columnCount | u32 reserved
+ *     per column: u64 length | buffers
+ * - END, after the last batch: f64 query time in milliseconds
+ * - ERROR, replaces END if the query failed:
+ *     u32 errorSize | u32 detailsSize | error | details | padding
+ *
+ * The buffers of a column depend on its flags and on its type:
+ * - NULLABLE columns start with a validity bitmap of length bits, the bit of row i
+ *   is bit (i % 8) of byte (i / 8) and is set if the row is not null.
+ *   ID columns are always NULLABLE, their invalid IDs (the nulls of OPTIONAL MATCH)
+ *   are null rows
+ * - Fixed size types then hold length values, null rows hold 0
+ * - Strings hold length + 1 u64 offsets followed by the string data,
+ *   the string of row i is data[offsets[i], offsets[i + 1])
+ * - CONSTANT columns hold a single value shared by all the rows, with a length of 1
+ */
+class ColumnarEncoder {
+public:
+    static constexpr uint32_t VERSION = 1;
+
+    enum class MessageType : uint32_t {
+        HEADER = 1,
+        BATCH,
+        END,
+        ERROR,
+    };
+
+    enum class ColumnType : uint8_t {
+        UInt64 = 0,
+        Int64,
+        Double,
+        Bool, // 1 byte per value
+        String,
+        UInt32,
+        UInt16,
+    };
+
+    enum ColumnFlags : uint8_t {
+        NULLABLE = 1 << 0,
+        CONSTANT = 1 << 1,
+    };
+
+    explicit ColumnarEncoder(net::NetWriter* writer)
+        : _writer(writer)
+    {
+    }
+
+    ColumnarEncoder(const ColumnarEncoder&) = delete;
+    ColumnarEncoder(ColumnarEncoder&&) = delete;
+    ColumnarEncoder& operator=(const ColumnarEncoder&) = delete;
+    ColumnarEncoder& operator=(ColumnarEncoder&&) = delete;
+
+    // The header is written with the first dataframe, or by writeEnd and
+    // writeError if the query returned no dataframe
+    void writeHeader(const Dataframe& df);
+    void writeDataframe(const Dataframe& df);
+    void writeEnd(double totalTimeMs);
+    void writeError(std::string_view error, std::string_view details);
+
+private:
+    net::NetWriter* _writer {nullptr};
+
+    // Staging buffer of the values which are not stored as they are encoded
+    std::vector<char> _staging;
+
+    bool _headerWritten {false};
+
+    void writeEmptyHeader();
+    void writeMessageHeader(MessageType type, uint64_t bodySize);
+};
+
+}
@@ -6,6 +6,7 @@ enum class DBHTTPParams {
     graph = 0,
     commit,
     change,
+    format,
     _SIZE
 };
 
@@ -22,17 +22,23 @@ public:
     uint32_t getPort() const { return _port; }
     uint32_t getWorkerCount() const { return _workerCount; }
     uint32_t getMaxConnections() const { return _maxConnections; }
+    uint32_t getQueryThreadCount() const { return _queryThreadCount; }
+    uint32_t getMaxQueuedQueries() const { return _maxQueuedQueries; }
 
     void setAddress(const std::string& address) { _address = address; }
     void setPort(uint32_t port) { _port = port; }
     void setWorkerCount(uint32_t workerCount) { _workerCount = workerCount; }
     void setMaxConnections(uint32_t maxConnections) { _maxConnections = maxConnections; }
+    void setQueryThreadCount(uint32_t count) { _queryThreadCount = count; }
+    void setMaxQueuedQueries(uint32_t count) { _maxQueuedQueries = count; }
 
 private:
     std::string _address {"127.0.0.1"};
     uint32_t _port {6666};
     uint32_t _workerCount {8};
     uint32_t _maxConnections {1024};
+    uint32_t _queryThreadCount {8};
+    uint32_t _maxQueuedQueries {256};
 };
 
 }
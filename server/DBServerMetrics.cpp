@@ -0,0 +1,240 @@
+#include "DBServerMetrics.h"
+
+#include <iterator>
+#include <string_view>
+#include <vector>
+
+#include <spdlog/fmt/fmt.h>
+
+#include "TuringDB.h"
+#include "SystemManager.h"
+#include "Graph.h"
+#include "DataPart.h"
+#include "DataPartCache.h"
+#include "JobSystem.h"
+#include "HTTPServer.h"
+#include "VectorDatabase.h"
+#include "ShardCache.h"
+
+using namespace db;
+
+namespace {
+
+void writeFamily(std::string& out,
+                 std::string_view name,
+                 std::string_view type,
+                 std::string_view help) {
+    fmt::format_to(std::back_inserter(out), "# HELP {} {}\n", name, help);
+    fmt::format_to(std::back_inserter(out), "# TYPE {} {}\n", name, type);
+}
+
+void writeSample(std::string& out,
+                 std::string_view name,
+                 std::string_view labels,
+                 auto value) {
+    if (labels.empty()) {
+        fmt::format_to(std::back_inserter(out), "{} {}\n", name, value);
+    } else {
+        fmt::format_to(std::back_inserter(out), "{}{{{}}} {}\n", name, labels, value);
+    }
+}
+
+// Label values can not contain raw backslashes, quotes or newlines
+std::string escapeLabel(std::string_view value) {
+    std::string res;
+    res.reserve(value.size());
+
+    for (char c : value) {
+        if (c == '\\') {
+            res += "\\\\";
+        } else if (c == '"') {
+            res += "\\\"";
+        } else if (c == '\n') {
+            res += "\\n";
+        } else {
+            res += c;
+        }
+    }
+
+    return res;
+}
+
+// Writes the buckets, sum and count of a histogram, @param labels are
+// prepended to the le label of the buckets
+void writeHistogram(std::string& out,
+                    std::string_view name,
+                    std::string_view labels,
+                    const DurationHistogram& histogram) {
+    const std::string bucketName = fmt::format("{}_bucket", name);
+    const std::string_view sep = labels.empty() ? "" : ",";
+
+    for (size_t i = 0; i < DurationHistogram::BUCKET_COUNT; i++) {
+        const std::string bucketLabels = fmt::format("{}{}le=\"{}\"",
+                                                     labels, sep,
+                                                     DurationHistogram::BUCKET_BOUNDS[i]);
+        writeSample(out, bucketName, bucketLabels, histogram.getBucketCount(i));
+    }
+
+    const std::string infLabels = fmt::format("{}{}le=\"+Inf\"", labels, sep);
+    writeSample(out, bucketName, infLabels, histogram.getCount());
+    writeSample(out, fmt::format("{}_sum", name), labels, histogram.getSumSeconds());
+    writeSample(out, fmt::format("{}_count", name), labels, histogram.getCount());
+}
+
+}
+
+void DBServerMetrics::queryFinished(QueryStatus::Status status, Milliseconds duration) {
+    _queryDurations[(size_t)status].record(duration);
+    _counters.add((size_t)Counter::QUERIES_FINISHED);
+}
+
+void DBServerMetrics::render(std::string& out, TuringDB& db) const {
+    renderServer(out);
+    renderQueries(out);
+
+    writeFamily(out, "turingdb_job_queue_depth", "gauge",
+                "Jobs waiting for a thread of the job system");
+    writeSample(out, "turingdb_job_queue_depth", "", db.getJobSystem().getQueuedJobCount());
+
+    renderGraphs(out, db);
+    renderVectorCache(out, db);
+}
+
+void DBServerMetrics::renderServer(std::string& out) const {
+    if (!_server) {
+        return;
+    }
+
+    using Counter = net::ServerMetrics::Counter;
+    const net::ServerMetrics& metrics = _server->getMetrics();
+
+    writeFamily(out, "turingdb_connections_accepted_total", "counter",
+                "Client connections accepted");
+    writeSample(out, "turingdb_connections_accepted_total", "",
+                metrics.get(Counter::ACCEPTED_CONNECTIONS));
+
+    writeFamily(out, "turingdb_connections_rejected_total", "counter",
+                "Client connections rejected because the connection limit was reached");
+    writeSample(out, "turingdb_connections_rejected_total", "",
+                metrics.get(Counter::REJECTED_CONNECTIONS));
+
+    writeFamily(out, "turingdb_connections_open", "gauge",
+                "Client connections currently open");
+    writeSample(out, "turingdb_connections_open", "", _server->getConnectionCount());
+
+    writeFamily(out, "turingdb_requests_rejected_total", "counter",
+                "Requests rejected because the execution queue was full");
+    writeSample(out, "turingdb_requests_rejected_total", "",
+                metrics.get(Counter::REJECTED_REQUESTS));
+
+    writeFamily(out, "turingdb_requests_queued", "gauge",
+                "Requests waiting for a thread of the execution pool");
+    writeSample(out, "turingdb_requests_queued", "", _server->getQueuedRequestCount());
+
+    writeFamily(out, "turingdb_sent_bytes_total", "counter",
+                "Bytes sent to the clients");
+    writeSample(out, "turingdb_sent_bytes_total", "", metrics.get(Counter::BYTES_SENT));
+}
+
+void DBServerMetrics::renderQueries(std::string& out) const {
+    // Finished is read first so that the difference is never negative
+    const uint64_t finished = _counters.get((size_t)Counter::QUERIES_FINISHED);
+    const uint64_t started = _counters.get((size_t)Counter::QUERIES_STARTED);
+
+    writeFamily(out, "turingdb_queries_in_flight", "gauge",
+                "Queries currently executing");
+    writeSample(out, "turingdb_queries_in_flight", "",
+                started > finished ? started - finished : 0);
+
+    writeFamily(out, "turingdb_query_duration_seconds", "histogram",
+                "Duration of the queries by status");
+    for (size_t i = 0; i < _queryDurations.size(); i++) {
+        const auto status = (QueryStatus::Status)i;
+        const std::string labels = fmt::format("status=\"{}\"",
+                                               QueryStatusDescription::value(status));
+        writeHistogram(out, "turingdb_query_duration_seconds", labels, _queryDurations[i]);
+    }
+}
+
+void DBServerMetrics::renderGraphs(std::string& out, TuringDB& db) const {
+    SystemManager& sysMan = db.getSystemManager();
+
+    std::vector<std::string_view> names;
+    sysMan.listGraphs(names);
+
+    std::vector<std::pair<std::string, const Graph*>> graphs;
+    for (std::string_view name : names) {
+        if (const Graph* graph = sysMan.getGraph(std::string(name))) {
+            graphs.emplace_back(fmt::format("graph=\"{}\"", escapeLabel(name)), graph);
+        }
+    }
+
+    writeFamily(out, "turingdb_graph_memory_bytes", "gauge",
+                "Estimated memory used by the graphs loaded in memory");
+    for (const auto& [labels, graph] : graphs) {
+        // Lazily loaded graphs are reported by the datapart cache
+        if (graph->getDataPartCache()) {
+            continue;
+        }
+
+        const DataPartMemoryUsage usage = graph->getMemoryUsage();
+        writeSample(out, "turingdb_graph_memory_bytes",
+                    fmt::format("{},kind=\"dataparts\"", labels), usage._containers);
+        writeSample(out, "turingdb_graph_memory_bytes",
+                    fmt::format("{},kind=\"properties\"", labels), usage._properties);
+        writeSample(out, "turingdb_graph_memory_bytes",
+                    fmt::format("{},kind=\"string_indexes\"", labels), usage._stringIndexes);
+    }
+
+    if (const DataPartCache* cache = sysMan.getDataPartCache()) {
+        writeFamily(out, "turingdb_datapart_cache_resident_bytes", "gauge",
+                    "Size of the dumps of the dataparts resident in the cache");
+        for (const auto& [labels, graph] : graphs) {
+            if (graph->getDataPartCache()) {
+                writeSample(out, "turingdb_datapart_cache_resident_bytes", labels,
+                            cache->getResidentSize(graph->getName()));
+            }
+        }
+
+        writeFamily(out, "turingdb_datapart_cache_evictions_total", "counter",
+                    "Dataparts evicted from the cache");
+        writeSample(out, "turingdb_datapart_cache_evictions_total", "",
+                    cache->getEvictionCount());
+    }
+
+    writeFamily(out, "turingdb_commit_duration_seconds", "histogram",
+                "Duration of the commits submitted to main");
+    for (const auto& [labels, graph] : graphs) {
+        writeHistogram(out, "turingdb_commit_duration_seconds", labels,
+                       graph->getCommitDurations());
+    }
+
+    writeFamily(out, "turingdb_merge_duration_seconds", "histogram",
+                "Duration of the datapart merges");
+    for (const auto& [labels, graph] : graphs) {
+        writeHistogram(out, "turingdb_merge_duration_seconds", labels,
+                       graph->getMergeDurations());
+    }
+}
+
+void DBServerMetrics::renderVectorCache(std::string& out, TuringDB& db) const {
+    const vec::VectorDatabase* vectorDB = db.getSystemManager().getVectorDatabase();
+    if (!vectorDB) {
+        return;
+    }
+
+    const vec::ShardCache& cache = vectorDB->getShardCache();
+
+    writeFamily(out, "turingdb_vector_shard_cache_hits_total", "counter",
+                "Vector shard lookups served from the cache");
+    writeSample(out, "turingdb_vector_shard_cache_hits_total", "", cache.getHitCount());
+
+    writeFamily(out, "turingdb_vector_shard_cache_misses_total", "counter",
+                "Vector shard lookups that loaded the shard from disk");
+    writeSample(out, "turingdb_vector_shard_cache_misses_total", "", cache.getMissCount());
+
+    writeFamily(out, "turingdb_vector_shard_cache_evictions_total", "counter",
+                "Vector shards evicted from the cache");
+    writeSample(out, "turingdb_vector_shard_cache_evictions_total", "",
+                cache.getEvictionCount());
+}
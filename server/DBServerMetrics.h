@@ -0,0 +1,61 @@
+#pragma once
+
+#include <array>
+#include <string>
+
+#include "QueryStatus.h"
+#include "DurationHistogram.h"
+#include "ThreadCounters.h"
+#include "TuringTime.h"
+
+namespace net {
+class HTTPServer;
+}
+
+namespace db {
+
+class TuringDB;
+
+/**
+ * @brief Metrics of the database server, exposed in the Prometheus text format
+ * by the /metrics endpoint.
+ *
+ * @detail The query counters are recorded by the request handlers. The other
+ * metrics are read from the HTTP server, the job system, the graphs and the caches
+ * when the metrics are rendered.
+ */
+class DBServerMetrics {
+public:
+    DBServerMetrics() = default;
+    ~DBServerMetrics() = default;
+
+    DBServerMetrics(const DBServerMetrics&) = delete;
+    DBServerMetrics(DBServerMetrics&&) = delete;
+    DBServerMetrics& operator=(const DBServerMetrics&) = delete;
+    DBServerMetrics& operator=(DBServerMetrics&&) = delete;
+
+    void setServer(const net::HTTPServer* server) { _server = server; }
+
+    void queryStarted() { _counters.add((size_t)Counter::QUERIES_STARTED); }
+    void queryFinished(QueryStatus::Status status, Milliseconds duration);
+
+    void render(std::string& out, TuringDB& db) const;
+
+private:
+    enum class Counter : size_t {
+        QUERIES_STARTED = 0,
+        QUERIES_FINISHED,
+        _SIZE
+    };
+
+    const net::HTTPServer* _server {nullptr};
+    std::array<DurationHistogram, (size_t)QueryStatus::Status::_SIZE> _queryDurations;
+    ThreadCounters<(size_t)Counter::_SIZE> _counters;
+
+    void renderServer(std::string& out) const;
+    void renderQueries(std::string& out) const;
+    void renderGraphs(std::string& out, TuringDB& db) const;
+    void renderVectorCache(std::string& out, TuringDB& db) const;
+};
+
+}
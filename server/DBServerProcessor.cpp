@@ -1,10 +1,16 @@
 #include "DBServerProcessor.h"
 
+#include <limits>
+
 #include <nlohmann/json.hpp>
+#include <spdlog/fmt/fmt.h>
 
 #include "TuringDB.h"
+#include "QueryParams.h"
+#include "QueryProfile.h"
 #include "Graph.h"
 #include "reader/GraphReader.h"
+#include "reader/NodeNeighborhoods.h"
 #include "versioning/Transaction.h"
 #include "views/EdgeView.h"
 #include "SystemManager.h"
@@ -14,6 +20,7 @@
 #include "ExploreNodeEdgesExecutor.h"
 
 #include "DBThreadContext.h"
+#include "DBServerMetrics.h"
 #include "HTTPParser.h"
 #include "DBURIParser.h"
 #include "Endpoints.h"
@@ -21,6 +28,7 @@
 #include "HTTPResponseWriter.h"
 #include "TCPConnection.h"
 #include "JsonEncoder.h"
+#include "ColumnarEncoder.h"
 
 using namespace db;
 
@@ -42,12 +50,147 @@ void sanitizeJsonString(const std::string& input, std::string& res) {
     }
 }
 
+// The body of /query is either the text of the query or a json object
+// {"query": "...", "parameters": {"name": value, ...}}
+bool parseQueryBody(std::string_view body,
+                    std::string_view& query,
+                    std::string& queryStorage,
+                    QueryParams& params,
+                    std::string& error) {
+    const size_t first = body.find_first_not_of(" \t\r\n");
+    if (first == std::string_view::npos || body[first] != '{') {
+        query = body;
+        return true;
+    }
+
+    const auto json = nlohmann::json::parse(body, nullptr, false);
+    if (json.is_discarded() || !json.is_object()) {
+        error = "Could not parse the query body";
+        return false;
+    }
+
+    const auto queryIt = json.find("query");
+    if (queryIt == json.end() || !queryIt->is_string()) {
+        error = "The query body must have a 'query' string";
+        return false;
+    }
+
+    queryStorage = queryIt->get<std::string>();
+    query = queryStorage;
+
+    const auto paramsIt = json.find("parameters");
+    if (paramsIt == json.end()) {
+        return true;
+    }
+
+    if (!paramsIt->is_object()) {
+        error = "'parameters' must be an object";
+        return false;
+    }
+
+    for (const auto& [name, value] : paramsIt->items()) {
+        if (value.is_null()) {
+            params.set(name, QueryParams::Null {});
+        } else if (value.is_boolean()) {
+            params.set(name, value.get<bool>());
+        } else if (value.is_number_unsigned()) {
+            const uint64_t v = value.get<uint64_t>();
+            if (v > (uint64_t)std::numeric_limits<int64_t>::max()) {
+                error = fmt::format("Parameter '{}' is out of the integer range", name);
+                return false;
+            }
+            params.set(name, (int64_t)v);
+        } else if (value.is_number_integer()) {
+            params.set(name, value.get<int64_t>());
+        } else if (value.is_number_float()) {
+            params.set(name, value.get<double>());
+        } else if (value.is_string()) {
+            params.set(name, value.get<std::string>());
+        } else if (value.is_array()) {
+            QueryParams::Vector vector;
+            vector.reserve(value.size());
+            for (const auto& element : value) {
+                if (!element.is_number()) {
+                    error = fmt::format("Parameter '{}' must be a list of numbers", name);
+                    return false;
+                }
+                vector.push_back(element.get<float>());
+            }
+            params.set(name, std::move(vector));
+        } else {
+            error = fmt::format("Parameter '{}' must be a null, a boolean, a number, "
+                                "a string or a list of numbers", name);
+            return false;
+        }
+    }
+
+    return true;
+}
+
+void writeProfileOperator(PayloadWriter& payload, const QueryProfile& profile, size_t index) {
+    const QueryProfile::Operator& op = profile.operators()[index];
+
+    payload.obj();
+    payload.key("name");
+    payload.value(op._name);
+
+    payload.key("estimated_rows");
+    if (op._estimatedRows >= 0) {
+        payload.value(op._estimatedRows);
+    } else {
+        payload.nullValue();
+    }
+
+    if (profile.isExecuted()) {
+        payload.key("rows_in");
+        payload.value(op._rowsIn);
+        payload.key("rows_out");
+        payload.value(op._rowsOut);
+        payload.key("chunks");
+        payload.value(op._chunks);
+        payload.key("executions");
+        payload.value(op._executions);
+        payload.key("time");
+        payload.value(op._time.count());
+        payload.key("memory");
+        payload.value(op._memoryBytes);
+        payload.key("dataparts");
+        payload.value(op._dataparts);
+    }
+
+    payload.key("children");
+    payload.arr();
+    for (size_t child : op._children) {
+        writeProfileOperator(payload, profile, child);
+    }
+    payload.end();
+
+    payload.end();
+}
+
+// Operator tree of EXPLAIN and PROFILE queries
+void writeProfile(PayloadWriter& payload, const QueryProfile& profile) {
+    payload.key("profile");
+    payload.obj();
+    payload.key("executed");
+    payload.value(profile.isExecuted());
+    payload.key("operators");
+    payload.arr();
+    for (size_t root : profile.roots()) {
+        writeProfileOperator(payload, profile, root);
+    }
+    payload.end();
+    payload.end();
+}
+
 }
 
 DBServerProcessor::DBServerProcessor(TuringDB& db,
+                                     DBServerMetrics& metrics,
                                      net::TCPConnection& connection)
     : _writer(&connection.getWriter()),
     _db(db),
+    _metrics(metrics),
     _connection(connection)
 {
 }
@@ -60,6 +203,13 @@ void DBServerProcessor::process(net::AbstractThreadContext* abstractContext) {
     auto& parser = _connection.getParser<net::HTTPParser<DBURIParser>>();
 
     const auto& httpInfo = parser.getHttpInfo();
+
+    // Prometheus scrapes the metrics with GET requests
+    if ((Endpoint)httpInfo._endpoint == Endpoint::METRICS) {
+        metrics();
+        return;
+    }
+
     if (httpInfo._method != net::HTTP::Method::POST) {
         _writer.writeHttpError(net::HTTP::Status::METHOD_NOT_ALLOWED);
         return;
@@ -163,10 +313,12 @@ const net::HTTP::Info& DBServerProcessor::getHttpInfo() const {
 }
 
 void DBServerProcessor::query() {
-    LocalMemory& mem = _threadContext->getLocalMemory();
     const auto& httpInfo = getHttpInfo();
 
-    const auto transactionInfo = getTransactionInfo();
+    if (httpInfo._params[(size_t)DBHTTPParams::format] == "columnar") {
+        queryColumnar();
+        return;
+    }
 
     const auto header = _writer.startHeader(net::HTTP::Status::OK,
                                             !_connection.isCloseRequired());
@@ -187,13 +339,7 @@ void DBServerProcessor::query() {
         JsonEncoder::writeDataframe(payload, *df);
     };
 
-    const auto res = _db.query(
-        httpInfo._payload,
-        transactionInfo.graphName,
-        &mem,
-        queryCallback,
-        transactionInfo.commit,
-        transactionInfo.change);
+    const auto res = executeQuery(queryCallback);
 
     if (!res.isOk()) {
         while (payload.currentNestingLevel() > 1) {
@@ -216,14 +362,87 @@ void DBServerProcessor::query() {
         return;
     }
 
-    payload.end();
+    // The data array is only opened if the query returned a dataframe
+    if (!isFirstExec) {
+        payload.end();
+    }
+
+    if (const QueryProfile* profile = res.getProfile()) {
+        writeProfile(payload, *profile);
+    }
 
     payload.key("time");
     payload.value(res.getTotalTime().count());
 
+    payload.key("memory");
+    payload.obj();
+    payload.key("used");
+    payload.value(res.getMemoryUsed());
+    payload.key("reserved");
+    payload.value(res.getMemoryReserved());
+    payload.key("peak");
+    payload.value(res.getMemoryPeak());
+    payload.end();
+
     payload.end();
 }
 
+void DBServerProcessor::queryColumnar() {
+    const auto header = _writer.startHeader(net::HTTP::Status::OK,
+                                            !_connection.isCloseRequired(),
+                                            net::ContentType::BINARY);
+
+    ColumnarEncoder encoder(_writer.getWriter());
+
+    // The encoder writes the header, with no column if no dataframe is returned
+    const QueryCallbackV2 queryCallback = [&](const Dataframe* df) {
+        encoder.writeDataframe(*df);
+    };
+
+    const auto res = executeQuery(queryCallback);
+
+    if (!res.isOk()) {
+        const std::string& errorMsg =
+            res.getError().empty() ? "No error message available." : res.getError();
+
+        encoder.writeError(QueryStatusDescription::value(res.getStatus()), errorMsg);
+        return;
+    }
+
+    encoder.writeEnd(res.getTotalTime().count());
+}
+
+QueryStatus DBServerProcessor::executeQuery(const QueryCallbackV2& callback) {
+    LocalMemory& mem = _threadContext->getLocalMemory();
+    const auto& httpInfo = getHttpInfo();
+    const auto transactionInfo = getTransactionInfo();
+
+    std::string_view query;
+    std::string queryStorage;
+    QueryParams params;
+    std::string error;
+
+    _metrics.queryStarted();
+    const auto t0 = Clock::now();
+
+    if (!parseQueryBody(httpInfo._payload, query, queryStorage, params, error)) {
+        _metrics.queryFinished(QueryStatus::Status::PARSE_ERROR, Clock::now() - t0);
+        return QueryStatus(QueryStatus::Status::PARSE_ERROR, error);
+    }
+
+    const auto res = _db.query(query,
+                               transactionInfo.graphName,
+                               &mem,
+                               callback,
+                               transactionInfo.commit,
+                               transactionInfo.change,
+                               &params);
+
+    _metrics.queryFinished(res.getStatus(), Clock::now() - t0);
+
+    return res;
+}
+
 void DBServerProcessor::load_graph() {
     auto& sys = _db.getSystemManager();
 
@@ -860,7 +1079,6 @@ void DBServerProcessor::get_node_properties() {
 }
 
 void DBServerProcessor::get_neighbors() {
-    LocalMemory& mem = _threadContext->getLocalMemory();
     const auto& httpInfo = getHttpInfo();
 
     const auto header = _writer.startHeader(net::HTTP::Status::OK,
@@ -883,8 +1101,7 @@ void DBServerProcessor::get_neighbors() {
 
     const auto reader = transaction.value().readGraph();
 
-    ColumnVector<NodeID>* allNodeIDs = mem.alloc<ColumnVector<NodeID>>();
-    ColumnVector<NodeID>* nodeIDs = mem.alloc<ColumnVector<NodeID>>();
+    std::vector<NodeID> nodeIDs;
     size_t limitPerNode = std::numeric_limits<size_t>::max();
 
     try {
@@ -899,10 +1116,7 @@ void DBServerProcessor::get_neighbors() {
         }
 
         const auto& vec = nodeIDsIt->get<std::vector<NodeID::Type>>();
-        allNodeIDs->reserve(vec.size());
-        for (const NodeID::Type nodeID : vec) {
-            allNodeIDs->push_back(nodeID);
-        }
+        nodeIDs.assign(vec.begin(), vec.end());
 
         if (auto it = json.find("limitPerNode"); it != json.end()) {
             limitPerNode = it->get<size_t>();
@@ -914,39 +1128,29 @@ void DBServerProcessor::get_neighbors() {
         return;
     }
 
+    // All the nodes are expanded with a single sweep of the dataparts
+    NodeNeighborhoods neighborhoods;
+    neighborhoods.collect(reader.getView(), nodeIDs, limitPerNode);
+
     payload.key("data");
     payload.obj();
 
-    nodeIDs->resize(1); // One node at a time
-
-    for (auto nodeID : *allNodeIDs) {
-        payload.key(nodeID);
+    for (size_t i = 0; i < neighborhoods.size(); i++) {
+        payload.key(neighborhoods.nodeIDs()[i]);
         payload.obj();
         payload.key("outs");
         payload.obj();
         payload.key("edges");
         payload.obj();
 
-        bool reachedEnd = true;
-
-        (*nodeIDs)[0] = nodeID;
-
-        size_t j = 0;
-        for (const auto& edge : reader.getOutEdges(nodeIDs)) {
-            if (j > limitPerNode) {
-                reachedEnd = false;
-                break;
-            }
-
-            j++;
-
+        for (const EdgeRecord& edge : neighborhoods.getOutEdges(i)) {
             payload.key(edge._edgeID);
             payload.value<EdgeDir::Out>(edge);
         }
 
         payload.end(); // edges
         payload.key("reachedEnd");
-        payload.value(reachedEnd);
+        payload.value(neighborhoods.hasAllOutEdges(i));
         payload.end(); // outs
 
         payload.key("ins");
@@ -954,25 +1158,14 @@ void DBServerProcessor::get_neighbors() {
         payload.key("edges");
         payload.obj();
 
-        reachedEnd = true;
-        (*nodeIDs)[0] = nodeID;
-
-        j = 0;
-        for (const auto& edge : reader.getInEdges(nodeIDs)) {
-            if (j > limitPerNode) {
-                reachedEnd = false;
-                break;
-            }
-
-            j++;
-
+        for (const EdgeRecord& edge : neighborhoods.getInEdges(i)) {
             payload.key(edge._edgeID);
             payload.value<EdgeDir::In>(edge);
         }
 
         payload.end(); // edges
         payload.key("reachedEnd");
-        payload.value(reachedEnd);
+        payload.value(neighborhoods.hasAllInEdges(i));
         payload.end(); // ins
         payload.end(); // Node
     }
@@ -1447,6 +1640,16 @@ void DBServerProcessor::get_edges() {
     }
 }
 
+void DBServerProcessor::metrics() {
+    std::string text;
+    _metrics.render(text, _db);
+
+    const auto header = _writer.startHeader(net::HTTP::Status::OK,
+                                            !_connection.isCloseRequired(),
+                                            net::ContentType::TEXT);
+    _writer.write(text);
+}
+
 DBServerProcessor::TransactionInfo DBServerProcessor::getTransactionInfo() const {
     auto& parser = _connection.getParser<net::HTTPParser<DBURIParser>>();
     const auto& httpInfo = parser.getHttpInfo();
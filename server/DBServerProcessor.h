@@ -1,6 +1,8 @@
 #pragma once
 
 #include "HTTPResponseWriter.h"
+#include "QueryStatus.h"
+#include "QueryCallback.h"
 #include "versioning/ChangeID.h"
 #include "versioning/CommitHash.h"
 
@@ -16,12 +18,14 @@ namespace HTTP { struct Info; }
 namespace db {
 
 class DBThreadContext;
+class DBServerMetrics;
 class TuringDB;
 class Graph;
 
 class DBServerProcessor {
 public:
     DBServerProcessor(TuringDB& db,
+                      DBServerMetrics& metrics,
                       net::TCPConnection& connection);
     ~DBServerProcessor();
 
@@ -39,6 +43,7 @@ private:
 
     HTTPResponseWriter _writer;
     TuringDB& _db;
+    DBServerMetrics& _metrics;
     net::TCPConnection& _connection;
     DBThreadContext* _threadContext {nullptr};
 
@@ -46,6 +51,8 @@ private:
     const net::HTTP::Info& getHttpInfo() const;
 
     void query();
+    void queryColumnar();
+    QueryStatus executeQuery(const QueryCallbackV2& callback);
     void load_graph();
     void history();
     void get_graph_status();
@@ -63,6 +70,7 @@ private:
     void get_node_edges();
     void get_edges();
     void explore_node_edges();
+    void metrics();
 
     struct TransactionInfo {
         std::string graphName;
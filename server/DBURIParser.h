@@ -53,6 +53,8 @@ public:
                 params[(size_t)DBHTTPParams::commit] = v;
             } else if (k == "change") {
                 params[(size_t)DBHTTPParams::change] = v;
+            } else if (k == "format") {
+                params[(size_t)DBHTTPParams::format] = v;
             }
         };
 
@@ -102,6 +104,7 @@ private:
     static constexpr std::string_view STR_GET_EDGES = "/get_edges";
     static constexpr std::string_view STR_EXPLORE_NODE_EDGES = "/explore_node_edges";
     static constexpr std::string_view HISTORY = "/history";
+    static constexpr std::string_view STR_METRICS = "/metrics";
 
     static net::HTTP::Result<net::HTTP::EndpointIndex> getEndpointIndex(std::string_view path) {
         using EndpointMap = std::unordered_map<net::HTTP::Path, net::HTTP::EndpointIndex>;
@@ -124,6 +127,7 @@ private:
             {STR_GET_EDGES,           (size_t)Endpoint::GET_EDGES          },
             {STR_EXPLORE_NODE_EDGES,  (size_t)Endpoint::EXPLORE_NODE_EDGES },
             {HISTORY,                 (size_t)Endpoint::HISTORY            },
+            {STR_METRICS,             (size_t)Endpoint::METRICS            },
         };
 
         auto endpointIt = endpoints.find(path);
@@ -52,6 +52,7 @@ enum class Endpoint : int64_t {
     GET_EDGES,
     EXPLORE_NODE_EDGES,
     HISTORY,
+    METRICS,
 };
 
 }
@@ -218,22 +218,20 @@ private:
                     continue;
                 }
 
-                const EdgeView outv = _reader.getEdgeView(out._edgeID);
-                if (!matchesEdgeProperties<FiltersT>(outv)) {
-                    continue;
+                if constexpr ((FiltersT & (uint64_t)Filters::EdgeProperties) != 0) {
+                    if (!matchesEdgeProperties<FiltersT>(_reader.getEdgeView(out._edgeID))) {
+                        continue;
+                    }
                 }
 
                 outCount++;
 
-                if (outCount <= _skip) {
-                    continue;
-                }
-
-                if (outCount > _skip + _limit) {
+                // Edges outside of the page are only counted
+                if (outCount <= _skip || outCount > _skip + _limit) {
                     continue;
                 }
 
-                _w.value(outv);
+                _w.value(_reader.getEdgeView(out._edgeID));
             }
 
             _w.end(); // outs
@@ -257,22 +255,20 @@ private:
                     continue;
                 }
 
-                const EdgeView inv = _reader.getEdgeView(in._edgeID);
-                if (!matchesEdgeProperties<FiltersT>(inv)) {
-                    continue;
+                if constexpr ((FiltersT & (uint64_t)Filters::EdgeProperties) != 0) {
+                    if (!matchesEdgeProperties<FiltersT>(_reader.getEdgeView(in._edgeID))) {
+                        continue;
+                    }
                 }
 
                 inCount++;
 
-                if (inCount <= _skip) {
-                    continue;
-                }
-
-                if (inCount > _skip + _limit) {
+                // Edges outside of the page are only counted
+                if (inCount <= _skip || inCount > _skip + _limit) {
                     continue;
                 }
 
-                _w.value(inv);
+                _w.value(_reader.getEdgeView(in._edgeID));
             }
 
             _w.end(); // ins
@@ -22,10 +22,11 @@ public:
 
         Header(HTTPResponseWriter& w,
                net::HTTP::Status status,
-               bool keepAlive)
+               bool keepAlive,
+               net::ContentType contentType)
             : _w(w)
         {
-            _w.writeHeader(status, keepAlive);
+            _w.writeHeader(status, keepAlive, contentType);
         }
 
         ~Header() {
@@ -184,11 +185,13 @@ public:
     {
     }
 
-    HTTPResponseWriter& writeHeader(net::HTTP::Status status, bool keepAlive = true) {
+    HTTPResponseWriter& writeHeader(net::HTTP::Status status,
+                                    bool keepAlive = true,
+                                    net::ContentType contentType = net::ContentType::JSON) {
         _writer->setFirstLine(status);
         _writer->addConnection(net::getConnectionHeader(!keepAlive));
         _writer->addChunkedTransferEncoding();
-        _writer->addContentType(net::ContentType::JSON);
+        _writer->addContentType(contentType);
         _writer->endHeader();
         _writer->flushHeader();
         return *this;
@@ -206,8 +209,10 @@ public:
 
     void flush() { _writer->flush(); }
 
-    [[nodiscard]] Header startHeader(net::HTTP::Status status, bool keepAlive = false) {
-        return Header(*this, status, keepAlive);
+    [[nodiscard]] Header startHeader(net::HTTP::Status status,
+                                     bool keepAlive = false,
+                                     net::ContentType contentType = net::ContentType::JSON) {
+        return Header(*this, status, keepAlive, contentType);
     }
 
     [[nodiscard]] Body startBody() { return Body(*this); }
@@ -235,6 +235,12 @@ private:
 
     template <std::integral T, int I>
     void write(db::ID<T, I> id) {
+        // Invalid IDs are the nulls of optional matches
+        if (!id.isValid()) {
+            _writer->write("null");
+            return;
+        }
+
         _writer->write(id.getValue());
     }
 
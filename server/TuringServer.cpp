@@ -9,8 +9,12 @@
 #include "HTTPParser.h"
 #include "DBThreadContext.h"
 #include "DBServerProcessor.h"
+#include "DBServerMetrics.h"
 #include "DBURIParser.h"
 #include "DBServerConfig.h"
+#include "DBHTTPParams.h"
+#include "Endpoints.h"
+#include "TCPConnection.h"
 
 using namespace db;
 
@@ -29,7 +33,8 @@ void signalHandler(int signum) {
 
 TuringServer::TuringServer(const DBServerConfig& config, TuringDB& db)
     : _config(config),
-    _db(db)
+    _db(db),
+    _metrics(std::make_unique<DBServerMetrics>())
 {
 }
 
@@ -43,7 +48,7 @@ void TuringServer::start() {
     net::HTTPServer::Functions functions {
         ._processor =
             [&](net::AbstractThreadContext* threadContext, net::TCPConnection& connection) {
-                DBServerProcessor processor(_db, connection);
+                DBServerProcessor processor(_db, *_metrics, connection);
                 processor.process(threadContext);
             },
         ._createThreadContext =
@@ -54,13 +59,31 @@ void TuringServer::start() {
             [](net::NetBuffer* inputBuffer) {
                 return std::unique_ptr<net::AbstractHTTPParser>(new net::HTTPParser<DBURIParser>(inputBuffer));
             },
+        // Queries are executed on the execution pool with one queue per graph,
+        // the other endpoints are cheap and answered by the I/O threads
+        ._dispatcher =
+            [](net::TCPConnection& connection) {
+                const auto& parser = connection.getParser<net::HTTPParser<DBURIParser>>();
+                const auto& httpInfo = parser.getHttpInfo();
+
+                net::RequestDispatch dispatch;
+                if ((Endpoint)httpInfo._endpoint == Endpoint::QUERY) {
+                    dispatch._async = true;
+                    dispatch._queue = httpInfo._params[(size_t)DBHTTPParams::graph];
+                }
+
+                return dispatch;
+            },
     };
 
     _server = std::make_unique<net::HTTPServer>(std::move(functions));
+    _metrics->setServer(_server.get());
     _server->setAddress(_config.getAddress().c_str());
     _server->setPort(_config.getPort());
     _server->setWorkerCount(_config.getWorkerCount());
     _server->setMaxConnections(_config.getMaxConnections());
+    _server->setExecutorCount(_config.getQueryThreadCount());
+    _server->setMaxQueuedRequests(_config.getMaxQueuedQueries());
 
     const auto initRes = _server->initialize();
     if (initRes != net::FlowStatus::OK) {
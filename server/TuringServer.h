@@ -10,6 +10,7 @@ namespace net {
 namespace db {
 
 class DBServerConfig;
+class DBServerMetrics;
 class TuringDB;
 
 class TuringServer {
@@ -26,6 +27,7 @@ private:
     const DBServerConfig& _config;
     TuringDB& _db;
     std::unique_ptr<net::HTTPServer> _server;
+    std::unique_ptr<DBServerMetrics> _metrics;
     std::thread _serverThread;
 
     void setupSignals();
@@ -8,6 +8,7 @@
 #include <string>
 
 #include "ID.h"
+#include "DataPartCache.h"
 #include "NodeContainer.h"
 #include "EdgeContainer.h"
 #include "TuringException.h"
@@ -16,6 +17,8 @@
 #include "indexes/StringIndex.h"
 #include "metadata/PropertyType.h"
 #include "properties/PropertyContainer.h"
+#include "properties/PropertyManager.h"
+#include "statistics/GraphStatistics.h"
 #include "views/GraphView.h"
 #include "reader/GraphReader.h"
 #include "writers/DataPartBuilder.h"
@@ -38,7 +41,22 @@ DataPart::DataPart(NodeID firstNodeID,
 {
 }
 
-DataPart::~DataPart() = default;
+DataPart::~DataPart() {
+    if (_cache) {
+        _cache->unregisterPart(*this);
+    }
+}
+
+void DataPart::evict() {
+    _nodes.reset();
+    _edges.reset();
+    _nodeProperties.reset();
+    _edgeProperties.reset();
+    _edgeIndexer.reset();
+    _nodeStrPropIdx = std::make_unique<StringPropertyIndexer>();
+    _edgeStrPropIdx = std::make_unique<StringPropertyIndexer>();
+    _resident = false;
+}
 
 bool DataPart::load(const GraphView& view, JobSystem& jobSystem, DataPartBuilder& builder) {
     Profile profile {"DataPart::load"};
@@ -228,6 +246,8 @@ bool DataPart::load(const GraphView& view, JobSystem& jobSystem, DataPartBuilder
 
     jobs.wait();
 
+    _statistics = GraphStatistics::createFromDataPart(*this, &patchNodeLabelSets);
+
     _initialized = true;
 
     return true;
@@ -274,3 +294,26 @@ const StringPropertyIndexer& DataPart::getEdgeStrPropIndexer() const {
     }
     return *_edgeStrPropIdx;
 }
+
+DataPartMemoryUsage DataPart::getMemoryUsage() const {
+    DataPartMemoryUsage usage;
+    if (!_resident || !_nodes) {
+        return usage;
+    }
+
+    usage._containers = _nodes->getMemoryUsage()
+                      + _edges->getMemoryUsage()
+                      + _edgeIndexer->getMemoryUsage();
+    usage._properties = _nodeProperties->getMemoryUsage()
+                      + _edgeProperties->getMemoryUsage();
+
+    if (_nodeStrPropIdx) {
+        usage._stringIndexes += _nodeStrPropIdx->getMemoryUsage();
+    }
+
+    if (_edgeStrPropIdx) {
+        usage._stringIndexes += _edgeStrPropIdx->getMemoryUsage();
+    }
+
+    return usage;
+}
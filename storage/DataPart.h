@@ -1,5 +1,6 @@
 #pragma once
 
+#include <atomic>
 #include <memory>
 
 #include "ID.h"
@@ -19,12 +20,28 @@ class GraphReader;
 class EdgeIndexer;
 class DataPartLoader;
 class DataPartRebaser;
+class DataPartCache;
 class JobSystem;
 class StringIndex;
 template <SupportedType T>
 class TypedPropertyContainer;
 class PropertyContainer;
 class StringPropertyIndexer;
+class GraphStatistics;
+
+// Approximate number of bytes allocated for the content of dataparts
+struct DataPartMemoryUsage {
+    size_t _containers {0};
+    size_t _properties {0};
+    size_t _stringIndexes {0};
+
+    DataPartMemoryUsage& operator+=(const DataPartMemoryUsage& other) {
+        _containers += other._containers;
+        _properties += other._properties;
+        _stringIndexes += other._stringIndexes;
+        return *this;
+    }
+};
 
 class DataPart {
 public:
@@ -62,6 +79,13 @@ public:
     bool hasNode(NodeID nodeID) const;
     bool hasEdge(EdgeID edgeID) const;
 
+    /**
+     * @brief Returns false if the content of the datapart is not loaded.
+     * @detail Dataparts loaded lazily from a dump are only resident while
+     * pinned by a transaction, or until evicted by the @ref DataPartCache.
+     */
+    bool isResident() const { return _resident; }
+
     const NodeContainer& nodes() const { return *_nodes; }
     const PropertyManager& nodeProperties() const { return *_nodeProperties; }
     const PropertyManager& edgeProperties() const { return *_edgeProperties; }
@@ -70,13 +94,30 @@ public:
     const StringPropertyIndexer& getNodeStrPropIndexer() const;
     const StringPropertyIndexer& getEdgeStrPropIndexer() const;
 
+    /**
+     * @brief Returns the statistics of the content of the datapart.
+     * @detail Kept when the datapart is evicted. Null for the dataparts
+     * of old dumps until their content is loaded.
+     */
+    const GraphStatistics* statistics() const { return _statistics.get(); }
+
+    /**
+     * @brief Returns an estimate of the memory used by the nodes, edges,
+     * properties and string indexes of the datapart.
+     * @detail Must only be called while the datapart is resident.
+     */
+    DataPartMemoryUsage getMemoryUsage() const;
+
 private:
     friend DataPartInfoLoader;
     friend GraphReader;
     friend DataPartLoader;
     friend DataPartRebaser;
+    friend DataPartCache;
 
     bool _initialized {false};
+    std::atomic<bool> _resident {true};
+    DataPartCache* _cache {nullptr};
     NodeID _firstNodeID {0};
     EdgeID _firstEdgeID {0};
 
@@ -87,6 +128,10 @@ private:
     std::unique_ptr<EdgeIndexer> _edgeIndexer;
     std::unique_ptr<StringPropertyIndexer> _nodeStrPropIdx;
     std::unique_ptr<StringPropertyIndexer> _edgeStrPropIdx;
+    std::unique_ptr<GraphStatistics> _statistics;
+
+    // Releases the content of the datapart, keeping its info
+    void evict();
 };
 
 }
@@ -0,0 +1,241 @@
+#include "DataPartCache.h"
+
+#include <spdlog/spdlog.h>
+
+#include "DataPart.h"
+#include "dump/DataPartLoader.h"
+
+using namespace db;
+
+namespace {
+
+// The resident size of a datapart is approximated by the size of its dump
+size_t getDumpSize(const fs::Path& dumpPath) {
+    auto files = dumpPath.listDir();
+    if (!files) {
+        return 0;
+    }
+
+    size_t size = 0;
+    for (const fs::Path& file : files.value()) {
+        if (auto info = file.getFileInfo()) {
+            size += info->_size;
+        }
+    }
+
+    return size;
+}
+
+}
+
+DataPartPin::DataPartPin(DataPartCache& cache, std::vector<const DataPart*>&& parts)
+    : _cache(cache),
+    _parts(std::move(parts))
+{
+}
+
+DataPartPin::~DataPartPin() {
+    _cache.unpin(_parts);
+}
+
+DataPartCache::DataPartCache(size_t memoryBudget)
+    : _memoryBudget(memoryBudget)
+{
+}
+
+DataPartCache::~DataPartCache() {
+    std::scoped_lock lock {_mutex};
+    for (auto& [part, entry] : _entries) {
+        entry->_part->_cache = nullptr;
+    }
+}
+
+void DataPartCache::registerPart(DataPart& part,
+                                 const std::string& graphName,
+                                 const fs::Path& dumpPath,
+                                 const GraphMetadata& metadata) {
+    auto entry = std::make_unique<Entry>();
+    entry->_part = &part;
+    entry->_graphName = graphName;
+    entry->_dumpPath = dumpPath;
+    entry->_metadata = &metadata;
+    entry->_size = getDumpSize(dumpPath);
+
+    std::scoped_lock lock {_mutex};
+    part._cache = this;
+    part._resident = false;
+    _entries[&part] = std::move(entry);
+}
+
+void DataPartCache::unregisterPart(DataPart& part) {
+    std::scoped_lock lock {_mutex};
+
+    const auto it = _entries.find(&part);
+    if (it == _entries.end()) {
+        return;
+    }
+
+    Entry& entry = *it->second;
+    if (entry._inLRU) {
+        _lru.erase(entry._lruIt);
+    }
+
+    if (part._resident) {
+        _residentSize -= entry._size;
+        _graphResidentSizes[entry._graphName] -= entry._size;
+    }
+
+    part._cache = nullptr;
+    _entries.erase(it);
+}
+
+std::shared_ptr<const DataPartPin> DataPartCache::pin(DataPartSpan parts) {
+    std::vector<const DataPart*> partPtrs;
+    partPtrs.reserve(parts.size());
+    for (const WeakArc<DataPart>& part : parts) {
+        partPtrs.push_back(part.get());
+    }
+
+    if (!pin(partPtrs)) {
+        return nullptr;
+    }
+
+    return std::make_shared<const DataPartPin>(*this, std::move(partPtrs));
+}
+
+bool DataPartCache::pin(const std::vector<const DataPart*>& parts) {
+    std::vector<Entry*> pinned;
+    pinned.reserve(parts.size());
+
+    {
+        std::scoped_lock lock {_mutex};
+        for (const DataPart* part : parts) {
+            const auto it = _entries.find(part);
+            if (it == _entries.end()) {
+                // Not loaded from a dump, always resident
+                continue;
+            }
+
+            Entry& entry = *it->second;
+            if (entry._pinCount++ == 0 && entry._inLRU) {
+                _lru.erase(entry._lruIt);
+                entry._inLRU = false;
+            }
+
+            pinned.push_back(&entry);
+        }
+    }
+
+    // Loading outside of the cache lock, pinned entries can not be evicted
+    bool success = true;
+    for (Entry* entry : pinned) {
+        if (!load(*entry)) {
+            success = false;
+            break;
+        }
+    }
+
+    std::scoped_lock lock {_mutex};
+
+    if (!success) {
+        for (Entry* entry : pinned) {
+            unpinLocked(*entry);
+        }
+    }
+
+    evictToBudgetLocked();
+
+    return success;
+}
+
+void DataPartCache::unpin(const std::vector<const DataPart*>& parts) {
+    std::scoped_lock lock {_mutex};
+
+    for (const DataPart* part : parts) {
+        const auto it = _entries.find(part);
+        if (it != _entries.end()) {
+            unpinLocked(*it->second);
+        }
+    }
+
+    evictToBudgetLocked();
+}
+
+void DataPartCache::setMemoryBudget(size_t memoryBudget) {
+    std::scoped_lock lock {_mutex};
+    _memoryBudget = memoryBudget;
+    evictToBudgetLocked();
+}
+
+size_t DataPartCache::getMemoryBudget() const {
+    std::scoped_lock lock {_mutex};
+    return _memoryBudget;
+}
+
+size_t DataPartCache::getResidentSize() const {
+    std::scoped_lock lock {_mutex};
+    return _residentSize;
+}
+
+size_t DataPartCache::getResidentSize(const std::string& graphName) const {
+    std::scoped_lock lock {_mutex};
+
+    const auto it = _graphResidentSizes.find(graphName);
+    return it != _graphResidentSizes.end() ? it->second : 0;
+}
+
+size_t DataPartCache::getEvictionCount() const {
+    std::scoped_lock lock {_mutex};
+    return _evictionCount;
+}
+
+bool DataPartCache::load(Entry& entry) {
+    std::scoped_lock loadLock {entry._loadMutex};
+
+    DataPart& part = *entry._part;
+    if (part._resident) {
+        return true;
+    }
+
+    auto res = DataPartLoader::loadContent(entry._dumpPath, *entry._metadata, part);
+    if (!res) {
+        spdlog::error("Could not load datapart {}: {}",
+                      entry._dumpPath.get(), res.error().fmtMessage());
+        part.evict();
+        return false;
+    }
+
+    std::scoped_lock lock {_mutex};
+    part._resident = true;
+    _residentSize += entry._size;
+    _graphResidentSizes[entry._graphName] += entry._size;
+
+    return true;
+}
+
+void DataPartCache::unpinLocked(Entry& entry) {
+    if (--entry._pinCount != 0 || !entry._part->_resident) {
+        return;
+    }
+
+    _lru.push_front(entry._part);
+    entry._lruIt = _lru.begin();
+    entry._inLRU = true;
+}
+
+void DataPartCache::evictToBudgetLocked() {
+    if (_memoryBudget == UNLIMITED_BUDGET) {
+        return;
+    }
+
+    while (_residentSize > _memoryBudget && !_lru.empty()) {
+        Entry& entry = *_entries.at(_lru.back());
+        _lru.pop_back();
+        entry._inLRU = false;
+
+        entry._part->evict();
+        _residentSize -= entry._size;
+        _graphResidentSizes[entry._graphName] -= entry._size;
+        _evictionCount++;
+    }
+}
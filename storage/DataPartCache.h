@@ -0,0 +1,117 @@
+#pragma once
+
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "DataPartSpan.h"
+#include "Path.h"
+
+namespace db {
+
+class DataPart;
+class DataPartCache;
+class GraphMetadata;
+
+/**
+ * @brief Keeps dataparts resident until destroyed.
+ */
+class DataPartPin {
+public:
+    DataPartPin(DataPartCache& cache, std::vector<const DataPart*>&& parts);
+    ~DataPartPin();
+
+    DataPartPin(const DataPartPin&) = delete;
+    DataPartPin(DataPartPin&&) = delete;
+    DataPartPin& operator=(const DataPartPin&) = delete;
+    DataPartPin& operator=(DataPartPin&&) = delete;
+
+private:
+    DataPartCache& _cache;
+    std::vector<const DataPart*> _parts;
+};
+
+/**
+ * @brief Keeps track of the dataparts loaded from dumps and of their residency.
+ *
+ * @detail Dataparts registered in the cache are loaded lazily: only their info
+ * is read when the graph is loaded, their content is read from the dump the
+ * first time a transaction pins them. Once unpinned, a datapart becomes a
+ * candidate for eviction, the least recently used dataparts are evicted first
+ * whenever the resident size goes above the memory budget.
+ *
+ * The cache must outlive the graphs of the registered dataparts.
+ */
+class DataPartCache {
+public:
+    static constexpr size_t UNLIMITED_BUDGET = 0;
+
+    explicit DataPartCache(size_t memoryBudget = UNLIMITED_BUDGET);
+    ~DataPartCache();
+
+    DataPartCache(const DataPartCache&) = delete;
+    DataPartCache(DataPartCache&&) = delete;
+    DataPartCache& operator=(const DataPartCache&) = delete;
+    DataPartCache& operator=(DataPartCache&&) = delete;
+
+    // Registers a datapart whose content is not loaded yet.
+    // metadata must outlive the datapart
+    void registerPart(DataPart& part,
+                      const std::string& graphName,
+                      const fs::Path& dumpPath,
+                      const GraphMetadata& metadata);
+
+    // Called when a registered datapart is destroyed
+    void unregisterPart(DataPart& part);
+
+    // Loads the non-resident dataparts and protects them from eviction until
+    // the pin is destroyed. Returns nullptr if a datapart could not be loaded
+    [[nodiscard]] std::shared_ptr<const DataPartPin> pin(DataPartSpan parts);
+
+    void setMemoryBudget(size_t memoryBudget);
+    size_t getMemoryBudget() const;
+
+    size_t getResidentSize() const;
+    size_t getResidentSize(const std::string& graphName) const;
+    size_t getEvictionCount() const;
+
+private:
+    friend DataPartPin;
+
+    struct Entry {
+        DataPart* _part {nullptr};
+        std::string _graphName;
+        fs::Path _dumpPath;
+        const GraphMetadata* _metadata {nullptr};
+        size_t _size {0};
+        size_t _pinCount {0};
+
+        // Serialises the loads of the datapart
+        std::mutex _loadMutex;
+
+        // Position in _lru when resident and unpinned
+        std::list<const DataPart*>::iterator _lruIt;
+        bool _inLRU {false};
+    };
+
+    mutable std::mutex _mutex;
+    size_t _memoryBudget {UNLIMITED_BUDGET};
+    size_t _residentSize {0};
+    size_t _evictionCount {0};
+    std::unordered_map<const DataPart*, std::unique_ptr<Entry>> _entries;
+    std::unordered_map<std::string, size_t> _graphResidentSizes;
+
+    // Unpinned resident dataparts, most recently used first
+    std::list<const DataPart*> _lru;
+
+    bool pin(const std::vector<const DataPart*>& parts);
+    void unpin(const std::vector<const DataPart*>& parts);
+    bool load(Entry& entry);
+    void unpinLocked(Entry& entry);
+    void evictToBudgetLocked();
+};
+
+}
@@ -35,6 +35,11 @@ public:
     NodeID getFirstNodeID() const { return _firstNodeID; }
     size_t size() const { return _outEdges.size(); }
 
+    // Approximate number of bytes allocated for the edge records
+    size_t getMemoryUsage() const {
+        return (_outEdges.capacity() + _inEdges.capacity()) * sizeof(EdgeRecord);
+    }
+
     std::span<const EdgeRecord> getOuts() const {
         return _outEdges;
     }
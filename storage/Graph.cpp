@@ -29,6 +29,32 @@ CommitHash Graph::getHeadHash() const {
     return _versionController->getHeadHash();
 }
 
+DataPartMemoryUsage Graph::getMemoryUsage() const {
+    DataPartMemoryUsage usage;
+    if (_dataPartCache) {
+        return usage;
+    }
+
+    const FrozenCommitTx transaction = openTransaction();
+    if (!transaction.isValid()) {
+        return usage;
+    }
+
+    for (const auto& part : transaction.viewGraph().dataparts()) {
+        usage += part->getMemoryUsage();
+    }
+
+    return usage;
+}
+
+const DurationHistogram& Graph::getCommitDurations() const {
+    return _versionController->getCommitDurations();
+}
+
+const DurationHistogram& Graph::getMergeDurations() const {
+    return _versionController->getMergeDurations();
+}
+
 std::unique_ptr<Graph> Graph::create() {
     auto* graph = new Graph();
     graph->_versionController->createFirstCommit();
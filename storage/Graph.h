@@ -25,6 +25,9 @@ class CommitBuilder;
 class FrozenCommitTx;
 class GraphSerializer;
 class GraphWriter;
+class WALReplayer;
+class DataPartCache;
+class DurationHistogram;
 
 class Graph {
 public:
@@ -47,6 +50,23 @@ public:
     [[nodiscard]] GraphID getID() const { return _graphID; }
     [[nodiscard]] CommitHash getHeadHash() const;
     [[nodiscard]] const GraphSerializer& getSerializer() const { return *_serializer; }
+    [[nodiscard]] GraphSerializer& getSerializer() { return *_serializer; }
+
+    // When set, the dataparts are loaded lazily from the dumps and pinned
+    // by the transactions
+    void setDataPartCache(DataPartCache* cache) { _dataPartCache = cache; }
+    [[nodiscard]] DataPartCache* getDataPartCache() const { return _dataPartCache; }
+
+    /**
+     * @brief Returns an estimate of the memory used by the dataparts of the head commit.
+     * @detail Returns nothing for the graphs loaded lazily, opening a transaction
+     * would load all their dataparts. Their size is reported by the @ref DataPartCache.
+     */
+    [[nodiscard]] DataPartMemoryUsage getMemoryUsage() const;
+
+    // Durations of the commits to main and of the datapart merges
+    [[nodiscard]] const DurationHistogram& getCommitDurations() const;
+    [[nodiscard]] const DurationHistogram& getMergeDurations() const;
 
     [[nodiscard]] static std::unique_ptr<Graph> create();
     [[nodiscard]] static std::unique_ptr<Graph> create(const std::string& name, const fs::Path& path);
@@ -61,6 +81,8 @@ private:
     friend CommitBuilder;
     friend GraphLoader;
     friend GraphWriter;
+    friend GraphSerializer;
+    friend WALReplayer;
 
     GraphID _graphID;
     std::string _graphName;
@@ -68,6 +90,7 @@ private:
 
     std::unique_ptr<VersionController> _versionController;
     std::unique_ptr<GraphSerializer> _serializer;
+    DataPartCache* _dataPartCache {nullptr};
 
     explicit Graph();
     explicit Graph(const std::string& name, const fs::Path& path);
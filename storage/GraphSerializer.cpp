@@ -1,10 +1,17 @@
 #include "GraphSerializer.h"
 
+#include <chrono>
 #include <spdlog/spdlog.h>
 
 #include "Graph.h"
+#include "dump/DumpConfig.h"
 #include "dump/GraphLoader.h"
 #include "dump/GraphDumper.h"
+#include "versioning/VersionController.h"
+#include "wal/WALReplayer.h"
+#include "wal/WriteAheadLog.h"
+
+#include "Profiler.h"
 
 using namespace db;
 
@@ -13,12 +20,159 @@ GraphSerializer::GraphSerializer(Graph* graph)
 {
 }
 
+GraphSerializer::~GraphSerializer() {
+    if (!_wal) {
+        return;
+    }
+
+    if (_checkpointThread.joinable()) {
+        {
+            std::scoped_lock lock {_checkpointThreadMutex};
+            _stopCheckpoints = true;
+        }
+
+        _checkpointCond.notify_one();
+        _checkpointThread.join();
+    }
+
+    // Last conversion of the log, whatever is left is replayed on the next load
+    if (auto res = checkpoint(); !res) {
+        spdlog::error("Could not checkpoint graph {}: {}",
+                      _graph->getName(), res.error().fmtMessage());
+    }
+
+    _graph->_versionController->setWriteAheadLog(nullptr);
+}
+
 DumpResult<void> GraphSerializer::load() const {
     spdlog::info("Loading graph {}", _graph->getName());
     return GraphLoader::load(_graph, _graph->getPath());
 }
 
 DumpResult<void> GraphSerializer::dump() const {
+    std::scoped_lock lock {_dumpMutex};
+
     spdlog::info("Dumping graph {}", _graph->getName());
     return GraphDumper::dump(*_graph, _graph->getPath());
 }
+
+DumpResult<void> GraphSerializer::openWriteAheadLog() {
+    Profile profile {"GraphSerializer::openWriteAheadLog"};
+
+    if (_wal) {
+        return {};
+    }
+
+    auto wal = std::make_unique<WriteAheadLog>(_graph->getPath() / "wal");
+    if (auto res = wal->open(); !res) {
+        return res;
+    }
+
+    if (auto res = WALReplayer::replay(*_graph, *wal); !res) {
+        return res;
+    }
+
+    _wal = std::move(wal);
+    _graph->_versionController->setWriteAheadLog(_wal.get());
+
+    // Dump the replayed commits right away, so that the old segments can be removed
+    std::scoped_lock lock {_checkpointMutex};
+    return runCheckpoint();
+}
+
+void GraphSerializer::startBackgroundCheckpoints() {
+    if (!_wal || _checkpointThread.joinable()) {
+        return;
+    }
+
+    _checkpointThread = std::thread {&GraphSerializer::runCheckpointLoop, this};
+}
+
+DumpResult<void> GraphSerializer::sync() {
+    if (!_wal) {
+        return dump();
+    }
+
+    if (_wal->getActiveSegmentSize() >= DumpConfig::WAL_SEGMENT_SIZE) {
+        _checkpointCond.notify_one();
+    }
+
+    // Commits which could not be logged are only durable once dumped
+    const uint64_t unloggedCount = _graph->_versionController->getUnloggedCommitCount();
+    if (unloggedCount <= _checkpointedUnloggedCount.load()) {
+        return {};
+    }
+
+    std::scoped_lock lock {_checkpointMutex};
+
+    // Another thread may have dumped them while we were waiting
+    if (unloggedCount <= _checkpointedUnloggedCount.load()) {
+        return {};
+    }
+
+    return runCheckpoint();
+}
+
+DumpResult<void> GraphSerializer::checkpoint() {
+    if (!_wal) {
+        return {};
+    }
+
+    std::scoped_lock lock {_checkpointMutex};
+
+    const uint64_t unloggedCount = _graph->_versionController->getUnloggedCommitCount();
+    if (_wal->getActiveSegmentSize() == 0
+        && unloggedCount == _checkpointedUnloggedCount.load()) {
+        return {};
+    }
+
+    return runCheckpoint();
+}
+
+// NOTE: Called with _checkpointMutex locked
+DumpResult<void> GraphSerializer::runCheckpoint() {
+    Profile profile {"GraphSerializer::runCheckpoint"};
+
+    // Read before dumping: commits are added after being counted
+    const uint64_t unloggedCount = _graph->_versionController->getUnloggedCommitCount();
+
+    // Records are appended before their commit is published, so every commit
+    // logged in the sealed segments is visible to the dump below once the
+    // submissions pending at the rotation are published
+    const auto activeSegment = _wal->rotate();
+    if (!activeSegment) {
+        return activeSegment.get_unexpected();
+    }
+
+    _graph->_versionController->waitSubmittedCommits();
+
+    if (auto res = dump(); !res) {
+        return res;
+    }
+
+    _checkpointedUnloggedCount.store(unloggedCount);
+
+    return _wal->removeSegmentsBefore(activeSegment.value());
+}
+
+void GraphSerializer::runCheckpointLoop() {
+    const auto period = std::chrono::milliseconds {DumpConfig::WAL_CHECKPOINT_PERIOD_MS};
+
+    std::unique_lock lock {_checkpointThreadMutex};
+
+    while (!_stopCheckpoints) {
+        _checkpointCond.wait_for(lock, period);
+        if (_stopCheckpoints) {
+            break;
+        }
+
+        lock.unlock();
+
+        if (auto res = checkpoint(); !res) {
+            spdlog::error("Could not checkpoint graph {}: {}",
+                          _graph->getName(), res.error().fmtMessage());
+        }
+
+        lock.lock();
+    }
+}
@@ -1,5 +1,11 @@
 #pragma once
 
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+
 #include "dump/DumpResult.h"
 
 namespace db {
@@ -7,11 +13,12 @@ namespace db {
 class VersionController;
 class Graph;
 class Commit;
+class WriteAheadLog;
 
 class GraphSerializer {
 public:
     explicit GraphSerializer(Graph* graph);
-    ~GraphSerializer() = default;
+    ~GraphSerializer();
 
     GraphSerializer(const GraphSerializer&) = delete;
     GraphSerializer(GraphSerializer&&) = delete;
@@ -21,8 +28,50 @@ public:
     DumpResult<void> load() const;
     DumpResult<void> dump() const;
 
+    /**
+     * @brief Replays the write-ahead log of the graph, and logs the commits
+     * submitted from now on.
+     */
+    DumpResult<void> openWriteAheadLog();
+
+    /**
+     * @brief Starts converting the write-ahead log into commit dumps in the
+     * background, periodically or when the log grows too large.
+     */
+    void startBackgroundCheckpoints();
+
+    /**
+     * @brief Makes sure that the commits submitted so far are persisted.
+     * @detail Without a write-ahead log, this dumps the missing commits. With a log,
+     * submitted commits are already durable, and only the commits which could not
+     * be logged need to be dumped.
+     */
+    DumpResult<void> sync();
+
+    /**
+     * @brief Dumps the commits which are only in the write-ahead log, and truncates it.
+     */
+    DumpResult<void> checkpoint();
+
+    bool hasWriteAheadLog() const { return _wal != nullptr; }
+    WriteAheadLog* getWriteAheadLog() { return _wal.get(); }
+
 private:
     Graph* _graph {nullptr};
+    mutable std::mutex _dumpMutex;
+
+    std::unique_ptr<WriteAheadLog> _wal;
+    std::mutex _checkpointMutex;
+    std::atomic<uint64_t> _checkpointedUnloggedCount {0};
+
+    // Background conversion of the log into dumps
+    std::mutex _checkpointThreadMutex;
+    std::condition_variable _checkpointCond;
+    bool _stopCheckpoints {false};
+    std::thread _checkpointThread;
+
+    DumpResult<void> runCheckpoint();
+    void runCheckpointLoop();
 };
 
 }
@@ -30,6 +30,9 @@ public:
 
     size_t size() const { return _nodeCount; }
 
+    // Approximate number of bytes allocated for the node records
+    size_t getMemoryUsage() const { return _nodes.capacity() * sizeof(NodeRecord); }
+
     LabelSetHandle getNodeLabelSet(NodeID nodeID) const {
         if (!hasEntity(nodeID)) {
             return LabelSetHandle {};
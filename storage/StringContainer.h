@@ -97,6 +97,12 @@ public:
 
     const ViewVector& get() const { return _views; }
     size_t bucketCount() const { return _buckets.size(); }
+
+    // Approximate number of bytes allocated for the buckets and views
+    size_t getMemoryUsage() const {
+        return _buckets.size() * StringBucket::BUCKET_SIZE
+             + _views.capacity() * sizeof(std::string_view);
+    }
     size_t countInBucket(size_t bucket) const { return _buckets[bucket].strCount(); }
 
     const StringBucket& bucket(size_t i) const {
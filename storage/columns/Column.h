@@ -15,6 +15,12 @@ public:
 
     virtual size_t size() const = 0;
 
+    // Bytes allocated for the values of the column, 0 if unknown
+    virtual size_t getAllocatedBytes() const { return 0; }
+
+    // Bytes of a row of the column, 0 if the column does not grow with the rows
+    virtual size_t getRowBytes() const { return 0; }
+
     virtual void assign(const Column* other) = 0;
     virtual void assignFromLine(const Column* other, size_t startLine, size_t rowCount) = 0;
 
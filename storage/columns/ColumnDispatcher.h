@@ -235,6 +235,23 @@ struct ColumnTypeFromKind<ColumnVector<const Change*>::staticKind()> {
         }                                                                                \
     }
 
+#define CONST_COLUMN_CONST_SWITCH(col)                                                   \
+    switch ((col)->getKind()) {                                                          \
+        CONST_COL_CASE(ColumnConst<NodeID>)                                              \
+        CONST_COL_CASE(ColumnConst<EdgeID>)                                              \
+        CONST_COL_CASE(ColumnConst<EntityID>)                                            \
+        CONST_COL_CASE(ColumnConst<types::UInt64::Primitive>)                            \
+        CONST_COL_CASE(ColumnConst<types::Int64::Primitive>)                             \
+        CONST_COL_CASE(ColumnConst<types::Double::Primitive>)                            \
+        CONST_COL_CASE(ColumnConst<types::String::Primitive>)                            \
+        CONST_COL_CASE(ColumnConst<types::Bool::Primitive>)                              \
+                                                                                         \
+        default: {                                                                       \
+            throw FatalException(fmt::format(                                            \
+                "Can not check result for column of kind {}", (col)->getKind()));        \
+        }                                                                                \
+    }
+
 template <typename F>
 inline decltype(auto) dispatchColumnVector(Column* col, const F& f) {
     COLUMN_VECTOR_SWITCH(col);
@@ -245,4 +262,14 @@ inline decltype(auto) dispatchColumnVector(const Column* col, const F& f) {
     CONST_COLUMN_VECTOR_SWITCH(col);
 }
 
+template <typename F>
+inline decltype(auto) dispatchColumnConst(const Column* col, const F& f) {
+    CONST_COLUMN_CONST_SWITCH(col);
+}
+
+inline bool isColumnConst(const Column* col) {
+    return ColumnKind::extractContainerKind(col->getKind())
+        == ContainerKind::code<ColumnConst<NodeID>>();
+}
+
 }
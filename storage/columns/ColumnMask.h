@@ -86,6 +86,8 @@ public:
 
     bool empty() const { return _data.empty(); }
     size_t size() const override { return _data.size(); }
+    size_t getAllocatedBytes() const override { return _data.capacity() * sizeof(Bool_t); }
+    size_t getRowBytes() const override { return sizeof(Bool_t); }
     const Bool_t* data() const { return _data.data(); }
     Bool_t* data() { return _data.data(); }
 
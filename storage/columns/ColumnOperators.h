@@ -404,11 +404,25 @@ public:
     static void applyMask(const ColumnVector<T>* src, 
                           const ColumnMask* mask,
                           ColumnVector<T>* dest) {
+        dest->clear();
+        appendMask(src, mask, dest);
+    }
+
+    /**
+     * @brief Appends the rows of @param src selected by @param mask
+     * after the rows already in @param dest
+     */
+    template <typename T>
+    static void appendMask(const ColumnVector<T>* src,
+                           const ColumnMask* mask,
+                           ColumnVector<T>* dest) {
         bioassert(src->size() == mask->size(), "src and mask must have same size");
         const size_t size = src->size();
 
-        dest->clear();
-        dest->reserve(size);
+        // Reserving on each append would defeat the geometric growth of the vector
+        if (dest->empty()) {
+            dest->reserve(size);
+        }
 
         const auto* srcd = src->data();
         const auto* maskd = mask->data();
@@ -65,6 +65,8 @@ public:
 
     bool empty() const { return _data.empty(); }
     size_t size() const override { return _data.size(); }
+    size_t getAllocatedBytes() const override { return _data.capacity() * sizeof(T); }
+    size_t getRowBytes() const override { return sizeof(T); }
 
     T* data() { return _data.data(); }
     const T* data() const { return _data.data(); }
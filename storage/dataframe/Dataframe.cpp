@@ -27,6 +27,15 @@ size_t Dataframe::getRowCount() const {
     return _cols[0]->getColumn()->size();
 }
 
+size_t Dataframe::getRowBytes() const {
+    size_t rowBytes = 0;
+    for (const NamedColumn* col : _cols) {
+        rowBytes += col->getColumn()->getRowBytes();
+    }
+
+    return rowBytes;
+}
+
 void Dataframe::dump(std::ostream& out) const {
     if (_cols.empty()) {
         return;
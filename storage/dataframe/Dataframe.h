@@ -29,6 +29,9 @@ public:
 
     size_t getRowCount() const;
 
+    // Bytes of a row of the dataframe, see Column::getRowBytes
+    size_t getRowBytes() const;
+
     const NamedColumns& cols() const { return _cols; }
 
     void addColumn(NamedColumn* column);
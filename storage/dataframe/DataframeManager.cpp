@@ -4,14 +4,20 @@
 
 using namespace db;
 
-DataframeManager::DataframeManager()
+DataframeManager::DataframeManager(Arena* arena)
+    : _arena(arena ? arena : &_localArena)
 {
 }
 
 DataframeManager::~DataframeManager() {
+    clear();
+}
+
+void DataframeManager::clear() {
     for (NamedColumn* col : _columns) {
-        delete col;
+        col->~NamedColumn();
     }
+    _columns.clear();
 }
 
 void DataframeManager::addColumn(NamedColumn* column) {
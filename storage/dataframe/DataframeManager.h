@@ -3,6 +3,7 @@
 #include <vector>
 
 #include "ColumnTagManager.h"
+#include "Arena.h"
 
 namespace db {
 
@@ -12,15 +13,22 @@ class DataframeManager {
 public:
     friend NamedColumn;
 
-    DataframeManager();
+    // The named columns are allocated in the given arena,
+    // or in an arena owned by the manager if there is none
+    explicit DataframeManager(Arena* arena = nullptr);
     ~DataframeManager();
 
     ColumnTagManager& getTagManager() { return _tagManager; }
 
     ColumnTag allocTag() { return _tagManager.allocTag(); }
 
+    // Destroys the named columns, their memory is given back with the arena
+    void clear();
+
 private:
     ColumnTagManager _tagManager;
+    Arena _localArena;
+    Arena* _arena {nullptr};
     std::vector<NamedColumn*> _columns;
 
     void addColumn(NamedColumn* column);
@@ -7,11 +7,15 @@ using namespace db;
 NamedColumn* NamedColumn::create(DataframeManager* dfMan,
                                  Column* column,
                                  ColumnTag tag) {
-    NamedColumn* namedCol = new NamedColumn(dfMan, tag, column);
+    NamedColumn* namedCol = new (dfMan) NamedColumn(dfMan, tag, column);
     dfMan->addColumn(namedCol);
     return namedCol;
 }
 
+void* NamedColumn::operator new(size_t size, DataframeManager* dfMan) {
+    return dfMan->_arena->alloc(size);
+}
+
 std::string_view NamedColumn::getName() const {
     return _dfMan->getTagManager().getName(_tag);
 }
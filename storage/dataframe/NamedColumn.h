@@ -2,6 +2,7 @@
 
 #include <type_traits>
 #include <string_view>
+#include <stddef.h>
 
 #include "ColumnTag.h"
 
@@ -37,6 +38,11 @@ private:
     ColumnTag _tag;
     Column* _column {nullptr};
 
+    // Named columns live in the arena of their dataframe manager
+    static void* operator new(size_t size, DataframeManager* dfMan);
+    static void operator delete(void*, DataframeManager*) {}
+    static void operator delete(void*) {}
+
     NamedColumn(DataframeManager* dfMan,
                 ColumnTag tag,
                 Column* column)
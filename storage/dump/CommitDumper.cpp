@@ -23,6 +23,42 @@ using namespace db;
 namespace rg = ranges;
 namespace rv = rg::views;
 
+namespace {
+
+// Returns the data of the commit preceding @param commit if @param commit can be
+// dumped as a delta on top of it, nullptr if a full checkpoint is required
+const CommitData* getDeltaBase(const Commit& commit) {
+    const auto commits = commit.history().commits();
+    const size_t commitIndex = commits.size() - 1;
+
+    if (commits.size() < 2 || commitIndex % DumpConfig::CHECKPOINT_INTERVAL == 0) {
+        return nullptr;
+    }
+
+    // Merge commits reassign entity IDs and reset the tombstones
+    if (commit.isMergeCommit()) {
+        return nullptr;
+    }
+
+    const CommitData& prevData = commits[commitIndex - 1].data();
+    const GraphMetadata& prevMetadata = prevData.metadata();
+    const GraphMetadata& metadata = commit.data().metadata();
+
+    // Metadata maps are append-only, a delta only makes sense on a prefix
+    const bool isPrefix = prevMetadata.labels().getCount() <= metadata.labels().getCount()
+        && prevMetadata.edgeTypes().getCount() <= metadata.edgeTypes().getCount()
+        && prevMetadata.propTypes().getCount() <= metadata.propTypes().getCount()
+        && prevMetadata.labelsets().getCount() <= metadata.labelsets().getCount();
+
+    if (!isPrefix) {
+        return nullptr;
+    }
+
+    return &prevData;
+}
+
+}
+
 DumpResult<void> CommitDumper::dump(const Commit& commit, const fs::Path& path) {
     Profile profile {"CommitDumper::dump"};
     if (path.exists()) {
@@ -35,6 +71,19 @@ DumpResult<void> CommitDumper::dump(const Commit& commit, const fs::Path& path)
 
     const auto& metadata = commit.data().metadata();
 
+    // Delta commits only store what was added on top of the previous commit
+    const CommitData* deltaBase = getDeltaBase(commit);
+    const GraphMetadata* baseMetadata = deltaBase ? &deltaBase->metadata() : nullptr;
+
+    if (deltaBase) {
+        Profile profile {"CommitDumper::dump <delta>"};
+        const fs::Path deltaPath = path / "delta";
+        auto writerRes = fs::FilePageWriter::open(deltaPath, DumpConfig::PAGE_SIZE);
+        if (!writerRes) {
+            return DumpError::result(DumpErrorType::CANNOT_OPEN_DELTA, writerRes.error());
+        }
+    }
+
     // Dumping labels
     {
         Profile profile {"CommitDumper::dump <labels>"};
@@ -47,7 +96,8 @@ DumpResult<void> CommitDumper::dump(const Commit& commit, const fs::Path& path)
 
         LabelMapDumper dumper {writer.value()};
 
-        if (auto res = dumper.dump(metadata.labels()); !res) {
+        const size_t first = baseMetadata ? baseMetadata->labels().getCount() : 0;
+        if (auto res = dumper.dump(metadata.labels(), first); !res) {
             return res;
         }
     }
@@ -64,7 +114,8 @@ DumpResult<void> CommitDumper::dump(const Commit& commit, const fs::Path& path)
 
         EdgeTypeMapDumper dumper {writer.value()};
 
-        if (auto res = dumper.dump(metadata.edgeTypes()); !res) {
+        const size_t first = baseMetadata ? baseMetadata->edgeTypes().getCount() : 0;
+        if (auto res = dumper.dump(metadata.edgeTypes(), first); !res) {
             return res;
         }
     }
@@ -81,7 +132,8 @@ DumpResult<void> CommitDumper::dump(const Commit& commit, const fs::Path& path)
 
         PropertyTypeMapDumper dumper {writer.value()};
 
-        if (auto res = dumper.dump(metadata.propTypes()); !res) {
+        const size_t first = baseMetadata ? baseMetadata->propTypes().getCount() : 0;
+        if (auto res = dumper.dump(metadata.propTypes(), first); !res) {
             return res;
         }
     }
@@ -98,7 +150,8 @@ DumpResult<void> CommitDumper::dump(const Commit& commit, const fs::Path& path)
 
         LabelSetMapDumper dumper {writer.value()};
 
-        if (auto res = dumper.dump(metadata.labelsets()); !res) {
+        const size_t first = baseMetadata ? baseMetadata->labelsets().getCount() : 0;
+        if (auto res = dumper.dump(metadata.labelsets(), first); !res) {
             return res;
         }
     }
@@ -134,7 +187,9 @@ DumpResult<void> CommitDumper::dump(const Commit& commit, const fs::Path& path)
         const Tombstones& tombstones = commit.data().tombstones();
 
         TombstonesDumper dumper(writerRes.value());
-        if (auto res = dumper.dump(tombstones); !res) {
+        auto res = deltaBase ? dumper.dumpDelta(tombstones, deltaBase->tombstones())
+                             : dumper.dump(tombstones);
+        if (!res) {
             return res;
         }
     }
@@ -12,11 +12,13 @@
 #include "DumpConfig.h"
 
 #include "DataPart.h"
+#include "DataPartCache.h"
 #include "Graph.h"
 #include "Path.h"
 #include "dump/TombstonesLoader.h"
 #include "versioning/Commit.h"
 #include "versioning/CommitHash.h"
+#include "versioning/CommitView.h"
 #include "versioning/CommitHistoryBuilder.h"
 #include "versioning/VersionController.h"
 
@@ -68,6 +70,23 @@ public:
 
         auto& metadata = commit->_data->_metadata;
 
+        // Delta commits only store what they added on top of the previous commit.
+        // The previous commit was itself replayed from the nearest checkpoint.
+        const auto deltaIt = std::ranges::find_if(files.value(),
+                                                  [&](const fs::Path& path) {
+                                                      return path.filename() == "delta";
+                                                  });
+
+        if (deltaIt != files->end()) {
+            if (!prevHistory || prevHistory->commits().empty()) {
+                return DumpError::result(DumpErrorType::NO_CHECKPOINT);
+            }
+
+            const CommitView prevCommit = prevHistory->commits().back();
+            metadata = prevCommit.metadata();
+            commit->_data->_tombstones = prevCommit.tombstones();
+        }
+
         // Loading metadata
         {
             Profile profile {"CommitLoader::load <metadata>"};
@@ -138,8 +157,13 @@ public:
             datapartPaths.emplace(partIndex.value(), child);
         }
 
+        DataPartCache* dataPartCache = graph.getDataPartCache();
+
         for (auto& [partIndex, path] : datapartPaths) {
-            auto res = DataPartLoader::load(path, metadata, *versionController);
+            auto res = dataPartCache
+                         ? DataPartLoader::loadLazy(path, metadata, *versionController,
+                                                    *dataPartCache, graph.getName())
+                         : DataPartLoader::load(path, metadata, *versionController);
 
             if (!res) {
                 return res.get_unexpected();
@@ -14,6 +14,7 @@
 #include "EdgeContainerDumper.h"
 #include "PropertyContainerDumper.h"
 #include "PropertyIndexerDumper.h"
+#include "GraphStatisticsDumper.h"
 #include "Panic.h"
 
 using namespace db;
@@ -95,6 +96,22 @@ DumpResult<void> DataPartDumper::dump(const DataPart& part, const fs::Path& path
         }
     }
 
+    // Dumping statistics
+    if (const GraphStatistics* statistics = part.statistics()) {
+        const fs::Path statisticsPath = path / "statistics";
+
+        auto writer = fs::FilePageWriter::open(statisticsPath, DumpConfig::PAGE_SIZE);
+        if (!writer) {
+            return DumpError::result(DumpErrorType::CANNOT_OPEN_DATAPART_STATISTICS, writer.error());
+        }
+
+        GraphStatisticsDumper dumper {writer.value()};
+
+        if (auto res = dumper.dump(*statistics); !res) {
+            return res.get_unexpected();
+        }
+    }
+
     // Dumping nodes
     const auto& nodes = part.nodes();
     if (nodes.size() != 0) {
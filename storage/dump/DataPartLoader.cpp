@@ -1,6 +1,7 @@
 #include "DataPartLoader.h"
 
 #include "DataPart.h"
+#include "DataPartCache.h"
 #include "DumpConfig.h"
 #include "DumpResult.h"
 #include "FilePageReader.h"
@@ -18,6 +19,8 @@
 #include "EdgeContainerLoader.h"
 #include "PropertyContainerLoader.h"
 #include "PropertyIndexerLoader.h"
+#include "GraphStatisticsLoader.h"
+#include "statistics/GraphStatistics.h"
 #include "versioning/VersionController.h"
 
 #include "BioAssert.h"
@@ -29,6 +32,38 @@ DumpResult<WeakArc<DataPart>> DataPartLoader::load(const fs::Path& path,
                                                    VersionController& versionController) {
     Profile profile {"DataPartLoader::load"};
 
+    auto part = loadInfo(path, versionController);
+    if (!part) {
+        return part.get_unexpected();
+    }
+
+    if (auto res = loadContent(path, metadata, *part.value()); !res) {
+        return res.get_unexpected();
+    }
+
+    return part;
+}
+
+DumpResult<WeakArc<DataPart>> DataPartLoader::loadLazy(const fs::Path& path,
+                                                       const GraphMetadata& metadata,
+                                                       VersionController& versionController,
+                                                       DataPartCache& cache,
+                                                       const std::string& graphName) {
+    Profile profile {"DataPartLoader::loadLazy"};
+
+    auto part = loadInfo(path, versionController);
+    if (!part) {
+        return part.get_unexpected();
+    }
+
+    part.value()->evict();
+    cache.registerPart(*part.value(), graphName, path, metadata);
+
+    return part;
+}
+
+DumpResult<WeakArc<DataPart>> DataPartLoader::loadInfo(const fs::Path& path,
+                                                       VersionController& versionController) {
     if (!path.exists()) {
         return DumpError::result(DumpErrorType::DATAPART_DOES_NOT_EXIST);
     }
@@ -53,6 +88,32 @@ DumpResult<WeakArc<DataPart>> DataPartLoader::load(const fs::Path& path,
         }
     }
 
+    // Loading statistics, kept while the content is evicted
+    const fs::Path statisticsPath = path / "statistics";
+    if (statisticsPath.exists()) {
+        Profile profile {"DataPartLoader::load <statistics>"};
+
+        auto reader = fs::FilePageReader::open(statisticsPath, DumpConfig::PAGE_SIZE);
+        if (!reader) {
+            return DumpError::result(DumpErrorType::CANNOT_OPEN_DATAPART_STATISTICS, reader.error());
+        }
+
+        auto statistics = std::make_unique<GraphStatistics>();
+        GraphStatisticsLoader loader {reader.value()};
+
+        if (auto res = loader.load(*statistics); !res) {
+            return res.get_unexpected();
+        }
+
+        part->_statistics = std::move(statistics);
+    }
+
+    return part;
+}
+
+DumpResult<void> DataPartLoader::loadContent(const fs::Path& path,
+                                             const GraphMetadata& metadata,
+                                             DataPart& part) {
     // Loading nodes
     const fs::Path nodesPath = path / "nodes";
     if (nodesPath.exists()) {
@@ -68,10 +129,10 @@ DumpResult<WeakArc<DataPart>> DataPartLoader::load(const fs::Path& path,
             return res.get_unexpected();
         }
 
-        part->_nodes = std::move(res.value());
+        part._nodes = std::move(res.value());
     } else {
-        auto* ptr = new NodeContainer(part->_firstNodeID, 0);
-        part->_nodes = std::unique_ptr<NodeContainer> {ptr};
+        auto* ptr = new NodeContainer(part._firstNodeID, 0);
+        part._nodes = std::unique_ptr<NodeContainer> {ptr};
     }
 
     // Loading edges
@@ -89,11 +150,11 @@ DumpResult<WeakArc<DataPart>> DataPartLoader::load(const fs::Path& path,
             return res.get_unexpected();
         }
 
-        part->_edges = std::move(res.value());
-        part->_firstEdgeID = part->_edges->getFirstEdgeID();
+        part._edges = std::move(res.value());
+        part._firstEdgeID = part._edges->getFirstEdgeID();
     } else {
-        auto* ptr = new EdgeContainer(part->_firstNodeID, part->_firstEdgeID, {}, {});
-        part->_edges = std::unique_ptr<EdgeContainer> {ptr};
+        auto* ptr = new EdgeContainer(part._firstNodeID, part._firstEdgeID, {}, {});
+        part._edges = std::unique_ptr<EdgeContainer> {ptr};
     }
 
     // Loading edge indexer
@@ -106,12 +167,12 @@ DumpResult<WeakArc<DataPart>> DataPartLoader::load(const fs::Path& path,
 
         EdgeIndexerLoader loader {reader.value()};
 
-        auto res = loader.load(metadata, *part->_edges);
+        auto res = loader.load(metadata, *part._edges);
         if (!res) {
             return res.get_unexpected();
         }
 
-        part->_edgeIndexer = std::move(res.value());
+        part._edgeIndexer = std::move(res.value());
     }
 
     // Listing files in the folder
@@ -120,8 +181,8 @@ DumpResult<WeakArc<DataPart>> DataPartLoader::load(const fs::Path& path,
         return DumpError::result(DumpErrorType::CANNOT_LIST_DATAPART_FILES, files.error());
     }
 
-    part->_nodeProperties = std::make_unique<PropertyManager>();
-    part->_edgeProperties = std::make_unique<PropertyManager>();
+    part._nodeProperties = std::make_unique<PropertyManager>();
+    part._edgeProperties = std::make_unique<PropertyManager>();
 
     // Loading properties
     const auto loadProperties = [&](PropertyManager& manager,
@@ -240,7 +301,7 @@ DumpResult<WeakArc<DataPart>> DataPartLoader::load(const fs::Path& path,
 
         PropertyIndexerLoader loader {reader.value()};
 
-        auto res = loader.load(metadata, part->_nodeProperties->_indexers);
+        auto res = loader.load(metadata, part._nodeProperties->_indexers);
         if (!res) {
             return res.get_unexpected();
         }
@@ -259,7 +320,7 @@ DumpResult<WeakArc<DataPart>> DataPartLoader::load(const fs::Path& path,
 
         PropertyIndexerLoader loader {reader.value()};
 
-        auto res = loader.load(metadata, part->_edgeProperties->_indexers);
+        auto res = loader.load(metadata, part._edgeProperties->_indexers);
         if (!res) {
             return res.get_unexpected();
         }
@@ -272,13 +333,13 @@ DumpResult<WeakArc<DataPart>> DataPartLoader::load(const fs::Path& path,
             Profile profile {"DataPartLoader::load <node-props>"};
 
             // node properties
-            if (auto res = loadProperties(*part->_nodeProperties, *part->_nodeStrPropIdx, childStr); !res) {
+            if (auto res = loadProperties(*part._nodeProperties, *part._nodeStrPropIdx, childStr); !res) {
                 return res.get_unexpected();
             }
         } else if (childStr.find(EDGE_PROPS_PREFIX) != std::string::npos) {
             Profile profile {"DataPartLoader::load <edge-props>"};
             // edge properties
-            if (auto res = loadProperties(*part->_edgeProperties, *part->_edgeStrPropIdx, childStr); !res) {
+            if (auto res = loadProperties(*part._edgeProperties, *part._edgeStrPropIdx, childStr); !res) {
                 return res.get_unexpected();
             }
         }
@@ -315,7 +376,7 @@ DumpResult<WeakArc<DataPart>> DataPartLoader::load(const fs::Path& path,
                 DumpErrorType::CANNOT_OPEN_DATAPART_NODE_STR_PROP_INDEXER);
         }
 
-        part->_nodeStrPropIdx = std::move(res.value());
+        part._nodeStrPropIdx = std::move(res.value());
     }
 
     // Dump edge StringIndexer
@@ -349,10 +410,16 @@ DumpResult<WeakArc<DataPart>> DataPartLoader::load(const fs::Path& path,
                 DumpErrorType::CANNOT_OPEN_DATAPART_EDGE_STR_PROP_INDEXER);
         }
 
-        part->_edgeStrPropIdx = std::move(res.value());
+        part._edgeStrPropIdx = std::move(res.value());
     }
 
-    part->_initialized = true;
+    // Dumps written before the statistics, the labelsets of the nodes
+    // of previous dataparts are unknown
+    if (!part._statistics) {
+        part._statistics = GraphStatistics::createFromDataPart(part, nullptr);
+    }
 
-    return part;
+    part._initialized = true;
+
+    return {};
 }
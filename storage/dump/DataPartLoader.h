@@ -7,6 +7,7 @@
 namespace db {
 
 class DataPart;
+class DataPartCache;
 class PropertyManager;
 class VersionController;
 class GraphMetadata;
@@ -17,7 +18,22 @@ public:
                                                             const GraphMetadata& metadata,
                                                             VersionController& versionController);
 
+    // Only loads the info of the datapart, its content is loaded by the cache
+    // the first time the datapart is pinned
+    [[nodiscard]] static DumpResult<WeakArc<DataPart>> loadLazy(const fs::Path& path,
+                                                                const GraphMetadata& metadata,
+                                                                VersionController& versionController,
+                                                                DataPartCache& cache,
+                                                                const std::string& graphName);
+
+    [[nodiscard]] static DumpResult<void> loadContent(const fs::Path& path,
+                                                      const GraphMetadata& metadata,
+                                                      DataPart& part);
+
 private:
+    [[nodiscard]] static DumpResult<WeakArc<DataPart>> loadInfo(const fs::Path& path,
+                                                                VersionController& versionController);
+
     static constexpr std::string_view NODE_PROPS_PREFIX = "node-props-";
     static constexpr std::string_view EDGE_PROPS_PREFIX = "edge-props-";
     static constexpr size_t PREFIX_SIZE = NODE_PROPS_PREFIX.size();
@@ -14,6 +14,15 @@ public:
     static constexpr uint64_t UP_TO_DATE_VERSION = 1761936116;
     static constexpr uint64_t PAGE_SIZE = fs::DEFAULT_PAGE_SIZE;
 
+    // Every CHECKPOINT_INTERVAL commits, the full metadata and tombstones are dumped.
+    // Other commits only dump what they added on top of the previous commit.
+    static constexpr uint64_t CHECKPOINT_INTERVAL = 64;
+
+    // The write-ahead log is converted into commit dumps in the background, either
+    // periodically or as soon as the active segment grows past WAL_SEGMENT_SIZE
+    static constexpr uint64_t WAL_SEGMENT_SIZE = 64ull * 1024 * 1024;
+    static constexpr uint64_t WAL_CHECKPOINT_PERIOD_MS = 5000;
+
     static constexpr size_t SIZEOF_ONE_BAD_CAFE = sizeof(decltype(ONE_BAD_CAFE));
     static constexpr size_t SIZEOF_VERSION = sizeof(decltype(VERSION));
     static constexpr size_t SIZEOF_UP_TO_DATE_VERSION = sizeof(decltype(UP_TO_DATE_VERSION));
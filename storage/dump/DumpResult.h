@@ -17,6 +17,7 @@ enum class DumpErrorType : uint8_t {
     NOT_TURING_FILE,
     OUTDATED,
     NO_COMMITS,
+    NO_CHECKPOINT,
 
     GRAPH_DIR_ALREADY_EXISTS,
     COMMIT_ALREADY_EXISTS,
@@ -39,6 +40,7 @@ enum class DumpErrorType : uint8_t {
     CANNOT_OPEN_JOURNAL,
     CANNOT_OPEN_TOMBSTONES,
     CANNOT_OPEN_MERGE,
+    CANNOT_OPEN_DELTA,
 
     CANNOT_LIST_COMMITS,
     CANNOT_LIST_COMMIT_FILES,
@@ -57,6 +59,7 @@ enum class DumpErrorType : uint8_t {
 
     CANNOT_OPEN_DATAPART_NODE_STR_PROP_INDEXER,
     CANNOT_OPEN_DATAPART_EDGE_STR_PROP_INDEXER,
+    CANNOT_OPEN_DATAPART_STATISTICS,
 
     INCORRECT_PROPERTY_TYPE_ID,
 
@@ -71,6 +74,7 @@ enum class DumpErrorType : uint8_t {
     COULD_NOT_WRITE_EDGE_INDEXER,
     COULD_NOT_WRITE_PROPS,
     COULD_NOT_WRITE_PROP_INDEXER,
+    COULD_NOT_WRITE_STATISTICS,
 
     COULD_NOT_READ_GRAPH_INFO,
     COULD_NOT_READ_DATAPART_INFO,
@@ -86,9 +90,18 @@ enum class DumpErrorType : uint8_t {
     COULD_NOT_READ_STR_PROP_INDEXER,
     COULD_NOT_READ_JOURNAL,
     COULD_NOT_READ_TOMBSTONES,
+    COULD_NOT_READ_STATISTICS,
 
     COULD_NOT_READ_VECTOR,
 
+    CANNOT_OPEN_WAL,
+    CANNOT_LIST_WAL_SEGMENTS,
+    CANNOT_REMOVE_WAL_SEGMENT,
+    COULD_NOT_WRITE_WAL,
+    COULD_NOT_SYNC_WAL,
+    COULD_NOT_READ_WAL,
+    WAL_REPLAY_FAILED,
+
     _SIZE
 };
 
@@ -97,6 +110,7 @@ using DumpErrorTypeDescription = EnumToString<DumpErrorType>::Create<
     EnumStringPair<DumpErrorType::NOT_TURING_FILE, "Not a turing file">,
     EnumStringPair<DumpErrorType::OUTDATED, "File outdated">,
     EnumStringPair<DumpErrorType::NO_COMMITS, "Graph does not have commits">,
+    EnumStringPair<DumpErrorType::NO_CHECKPOINT, "Delta commit without a previous checkpoint">,
     EnumStringPair<DumpErrorType::GRAPH_DIR_ALREADY_EXISTS, "Graph directory already exists">,
     EnumStringPair<DumpErrorType::COMMIT_ALREADY_EXISTS, "Commit already exists">,
     EnumStringPair<DumpErrorType::DATAPART_ALREADY_EXISTS, "Datapart already exists">,
@@ -116,6 +130,7 @@ using DumpErrorTypeDescription = EnumToString<DumpErrorType>::Create<
     EnumStringPair<DumpErrorType::CANNOT_OPEN_JOURNAL, "Cannot open commit journal">,
     EnumStringPair<DumpErrorType::CANNOT_OPEN_TOMBSTONES, "Cannot open commit tombstones">,
     EnumStringPair<DumpErrorType::CANNOT_OPEN_MERGE, "Cannot open merge file">,
+    EnumStringPair<DumpErrorType::CANNOT_OPEN_DELTA, "Cannot open delta file">,
     EnumStringPair<DumpErrorType::CANNOT_LIST_COMMITS, "Cannot list commits">,
     EnumStringPair<DumpErrorType::CANNOT_LIST_COMMIT_FILES, "Cannot list commit files">,
     EnumStringPair<DumpErrorType::CANNOT_LIST_DATAPARTS, "Cannot list dataparts">,
@@ -130,6 +145,7 @@ using DumpErrorTypeDescription = EnumToString<DumpErrorType>::Create<
     EnumStringPair<DumpErrorType::CANNOT_OPEN_DATAPART_EDGE_PROP_INDEXER, "Cannot open datapart edge property indexer">,
     EnumStringPair<DumpErrorType::CANNOT_OPEN_DATAPART_NODE_STR_PROP_INDEXER, "Cannot open datapart node string property indexer">,
     EnumStringPair<DumpErrorType::CANNOT_OPEN_DATAPART_EDGE_STR_PROP_INDEXER, "Cannot open datapart edge string property indexer">,
+    EnumStringPair<DumpErrorType::CANNOT_OPEN_DATAPART_STATISTICS, "Cannot open datapart statistics">,
     EnumStringPair<DumpErrorType::INCORRECT_PROPERTY_TYPE_ID, "Incorrect property type id">,
     EnumStringPair<DumpErrorType::COULD_NOT_WRITE_GRAPH_INFO, "Could not write graph info">,
     EnumStringPair<DumpErrorType::COULD_NOT_WRITE_DATAPART_INFO, "Could not write datapart info">,
@@ -142,6 +158,7 @@ using DumpErrorTypeDescription = EnumToString<DumpErrorType>::Create<
     EnumStringPair<DumpErrorType::COULD_NOT_WRITE_EDGE_INDEXER, "Could not write edge indexer">,
     EnumStringPair<DumpErrorType::COULD_NOT_WRITE_PROPS, "Could not write entity properties">,
     EnumStringPair<DumpErrorType::COULD_NOT_WRITE_PROP_INDEXER, "Could not write entity property indexer">,
+    EnumStringPair<DumpErrorType::COULD_NOT_WRITE_STATISTICS, "Could not write datapart statistics">,
     EnumStringPair<DumpErrorType::COULD_NOT_READ_GRAPH_INFO, "Could not read graph info">,
     EnumStringPair<DumpErrorType::COULD_NOT_READ_DATAPART_INFO, "Could not read datapart info">,
     EnumStringPair<DumpErrorType::COULD_NOT_READ_PROP_TYPES, "Could not read property types">,
@@ -156,7 +173,15 @@ using DumpErrorTypeDescription = EnumToString<DumpErrorType>::Create<
     EnumStringPair<DumpErrorType::COULD_NOT_READ_STR_PROP_INDEXER, "Could not read entity string property indexer">,
     EnumStringPair<DumpErrorType::COULD_NOT_READ_JOURNAL, "Could not read commit journal">,
     EnumStringPair<DumpErrorType::COULD_NOT_READ_TOMBSTONES, "Could not read commit tombstones">,
-    EnumStringPair<DumpErrorType::COULD_NOT_READ_VECTOR, "Could not read vector">>;
+    EnumStringPair<DumpErrorType::COULD_NOT_READ_STATISTICS, "Could not read datapart statistics">,
+    EnumStringPair<DumpErrorType::COULD_NOT_READ_VECTOR, "Could not read vector">,
+    EnumStringPair<DumpErrorType::CANNOT_OPEN_WAL, "Cannot open write-ahead log">,
+    EnumStringPair<DumpErrorType::CANNOT_LIST_WAL_SEGMENTS, "Cannot list write-ahead log segments">,
+    EnumStringPair<DumpErrorType::CANNOT_REMOVE_WAL_SEGMENT, "Cannot remove write-ahead log segment">,
+    EnumStringPair<DumpErrorType::COULD_NOT_WRITE_WAL, "Could not write to write-ahead log">,
+    EnumStringPair<DumpErrorType::COULD_NOT_SYNC_WAL, "Could not sync write-ahead log">,
+    EnumStringPair<DumpErrorType::COULD_NOT_READ_WAL, "Could not read write-ahead log">,
+    EnumStringPair<DumpErrorType::WAL_REPLAY_FAILED, "Could not replay write-ahead log record">>;
 
 class DumpError {
 public:
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <ranges>
+
 #include "metadata/EdgeTypeMap.h"
 #include "GraphDumpHelper.h"
 
@@ -18,7 +20,11 @@ public:
     {
     }
 
-    [[nodiscard]] DumpResult<void> dump(const EdgeTypeMap& edgeTypes) {
+    /**
+     * @brief Dumps the edge types of @param edgeTypes starting at offset @param first.
+     * @detail The header always stores the total edge type count.
+     */
+    [[nodiscard]] DumpResult<void> dump(const EdgeTypeMap& edgeTypes, size_t first = 0) {
         // Page metadata
         static constexpr size_t PAGE_HEADER_STRIDE = sizeof(uint64_t);
 
@@ -34,7 +40,7 @@ public:
         uint64_t pageCount = 1;
 
         auto* buffer = &_writer.buffer();
-        for (const auto& [i, name] : edgeTypes) {
+        for (const auto& [i, name] : edgeTypes | std::views::drop(first)) {
             const uint64_t strsize = name->size();
             const size_t stride = EDGE_TYPE_BASE_STRIDE + strsize;
 
@@ -52,6 +52,7 @@ DumpResult<void> GraphDumper::dump(const Graph& graph, const fs::Path& path) {
             }
 
             // Graph is already dumped, only dump what's missing
+            lock.unlock();
             return GraphDumper::dumpMissingCommits(graph, path);
         }
 
@@ -82,7 +83,8 @@ DumpResult<void> GraphDumper::dump(const Graph& graph, const fs::Path& path) {
     }
 
     // Dumping commits
-    for (const auto& [i, commit] : graph._versionController->_commits | rv::enumerate) {
+    // The commits waiting for their records to be durable are not dumped
+    for (const auto& [i, commit] : graph._versionController->getPublishedCommits() | rv::enumerate) {
         const std::string fileName = fmt::format("commit-{}-{}", i, commit->hash().get());
         const fs::Path commitPath = path / fileName;
 
@@ -95,7 +97,21 @@ DumpResult<void> GraphDumper::dump(const Graph& graph, const fs::Path& path) {
 }
 
 DumpResult<void> GraphDumper::dumpMissingCommits(const Graph& graph, const fs::Path& path) {
-    for (const auto& [i, commit] : graph._versionController->_commits | rv::enumerate) {
+    Profile profile {"GraphDumper::dumpMissingCommits"};
+
+    // Commits are immutable once added, the lock is only held to snapshot them so
+    // that new commits can be submitted while dumping
+    std::vector<const Commit*> commits;
+    {
+        auto lock = graph._versionController->lock();
+        const Commit::CommitSpan published = graph._versionController->getPublishedCommits();
+        commits.reserve(published.size());
+        for (const auto& commit : published) {
+            commits.push_back(commit.get());
+        }
+    }
+
+    for (const auto& [i, commit] : commits | rv::enumerate) {
         const std::string fileName = fmt::format("commit-{}-{}", i, commit->hash().get());
         const fs::Path commitPath = path / fileName;
 
@@ -110,4 +126,3 @@ DumpResult<void> GraphDumper::dumpMissingCommits(const Graph& graph, const fs::P
 
     return {};
 }
-
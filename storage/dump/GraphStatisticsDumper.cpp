@@ -0,0 +1,32 @@
+#include "GraphStatisticsDumper.h"
+
+#include "GraphDumpHelper.h"
+
+#include "statistics/GraphStatistics.h"
+#include "dump/DumpUtils.h"
+
+using namespace db;
+
+DumpResult<void> GraphStatisticsDumper::dump(const GraphStatistics& statistics) {
+    GraphDumpHelper::writeFileHeader(_writer);
+
+    std::vector<uint8_t> data;
+    statistics.serialize(data);
+
+    const size_t dataSize = data.size();
+
+    DumpUtils::ensureDumpSpace(sizeof(dataSize), _writer);
+    _writer.writeToCurrentPage(dataSize);
+
+    if (auto res = DumpUtils::dumpRange(data, _writer); !res) {
+        return res;
+    }
+
+    _writer.finish();
+
+    if (_writer.errorOccured()) {
+        return DumpError::result(DumpErrorType::COULD_NOT_WRITE_STATISTICS, _writer.error().value());
+    }
+
+    return {};
+}
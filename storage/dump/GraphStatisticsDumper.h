@@ -0,0 +1,26 @@
+#pragma once
+
+#include "DumpResult.h"
+
+namespace fs {
+class FilePageWriter;
+}
+
+namespace db {
+
+class GraphStatistics;
+
+class GraphStatisticsDumper {
+public:
+    explicit GraphStatisticsDumper(fs::FilePageWriter& writer)
+        : _writer(writer)
+    {
+    }
+
+    [[nodiscard]] DumpResult<void> dump(const GraphStatistics& statistics);
+
+private:
+    fs::FilePageWriter& _writer;
+};
+
+}
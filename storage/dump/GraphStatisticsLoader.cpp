@@ -0,0 +1,38 @@
+#include "GraphStatisticsLoader.h"
+
+#include "LoadUtils.h"
+#include "GraphDumpHelper.h"
+#include "statistics/GraphStatistics.h"
+
+using namespace db;
+
+DumpResult<void> GraphStatisticsLoader::load(GraphStatistics& statistics) {
+    _reader.nextPage();
+
+    if (_reader.errorOccured()) {
+        return DumpError::result(DumpErrorType::COULD_NOT_READ_STATISTICS,
+                                 _reader.error().value());
+    }
+
+    auto it = _reader.begin();
+    LoadUtils::ensureIteratorReadPage(it);
+
+    if (auto res = GraphDumpHelper::checkFileHeader(it); !res) {
+        return res.get_unexpected();
+    }
+
+    LoadUtils::ensureLoadSpace(sizeof(size_t), _reader, it);
+    const size_t dataSize = it.get<size_t>();
+
+    std::vector<uint8_t> data;
+    data.reserve(dataSize);
+    if (auto res = LoadUtils::loadVector(data, dataSize, _reader, it); !res) {
+        return res;
+    }
+
+    if (!statistics.deserialize(data)) {
+        return DumpError::result(DumpErrorType::COULD_NOT_READ_STATISTICS);
+    }
+
+    return {};
+}
@@ -0,0 +1,26 @@
+#pragma once
+
+#include "dump/DumpResult.h"
+
+namespace fs {
+class FilePageReader;
+}
+
+namespace db {
+
+class GraphStatistics;
+
+class GraphStatisticsLoader {
+public:
+    explicit GraphStatisticsLoader(fs::FilePageReader& reader)
+        : _reader(reader)
+    {
+    }
+
+    [[nodiscard]] DumpResult<void> load(GraphStatistics& statistics);
+
+private:
+    fs::FilePageReader& _reader;
+};
+
+}
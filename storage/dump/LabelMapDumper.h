@@ -1,5 +1,7 @@
 #pragma once
 
+#include <ranges>
+
 #include "GraphDumpHelper.h"
 #include "metadata/LabelMap.h"
 
@@ -12,7 +14,12 @@ public:
     {
     }
 
-    [[nodiscard]] DumpResult<void> dump(const LabelMap& labels) {
+    /**
+     * @brief Dumps the labels of @param labels starting at offset @param first.
+     * @detail The header always stores the total label count, so that a delta
+     * dump can be checked once applied on top of the previous commit's labels.
+     */
+    [[nodiscard]] DumpResult<void> dump(const LabelMap& labels, size_t first = 0) {
         // Page metadata
         static constexpr size_t PAGE_HEADER_STRIDE = sizeof(uint64_t);
 
@@ -28,7 +35,7 @@ public:
         uint64_t pageCount = 1;
 
         auto* buffer = &_writer.buffer();
-        for (const auto& [i, name]: labels) {
+        for (const auto& [i, name] : labels | std::views::drop(first)) {
             const uint64_t strsize = name->size();
             const size_t stride = LABEL_BASE_STRIDE + strsize;
 
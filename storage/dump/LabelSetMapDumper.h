@@ -30,12 +30,17 @@ public:
     // Count per page
     static constexpr size_t COUNT_PER_PAGE = PAGE_AVAIL / LABELSET_STRIDE;
 
-    [[nodiscard]] DumpResult<void> dump(const LabelSetMap& labelsets) {
+    /**
+     * @brief Dumps the labelsets of @param labelsets starting at offset @param first.
+     * @detail The header always stores the total labelset count.
+     */
+    [[nodiscard]] DumpResult<void> dump(const LabelSetMap& labelsets, size_t first = 0) {
         GraphDumpHelper::writeFileHeader(_writer);
 
         const uint64_t labelsetCount = labelsets.getCount();
+        const uint64_t dumpedCount = labelsetCount - first;
         const uint64_t pageCount = GraphDumpHelper::getPageCountForItems(
-            labelsetCount, COUNT_PER_PAGE);
+            dumpedCount, COUNT_PER_PAGE);
 
         // Metadata
         _writer.writeToCurrentPage((uint64_t)LabelSet::IntegerSize);
@@ -44,9 +49,9 @@ public:
         _writer.writeToCurrentPage(pageCount);
 
         // Data
-        const size_t remainder = labelsetCount % COUNT_PER_PAGE;
+        const size_t remainder = dumpedCount % COUNT_PER_PAGE;
 
-        size_t offset = 0;
+        size_t offset = first;
         for (size_t i = 0; i < pageCount; i++) {
             // New page
             _writer.nextPage();
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <ranges>
+
 #include "metadata/PropertyTypeMap.h"
 #include "GraphDumpHelper.h"
 
@@ -12,7 +14,11 @@ public:
     {
     }
 
-    [[nodiscard]] DumpResult<void> dump(const PropertyTypeMap& propTypes) {
+    /**
+     * @brief Dumps the property types of @param propTypes starting at offset
+     * @param first. The header always stores the total property type count.
+     */
+    [[nodiscard]] DumpResult<void> dump(const PropertyTypeMap& propTypes, size_t first = 0) {
         // Page metadata
         static constexpr size_t PAGE_HEADER_STRIDE = sizeof(uint64_t);
 
@@ -28,7 +34,7 @@ public:
         uint64_t pageCount = 1;
 
         auto* buffer = &_writer.buffer();
-        for (const auto& [pt, name] : propTypes) {
+        for (const auto& [pt, name] : propTypes | std::views::drop(first)) {
             const uint64_t strsize = name->size();
             const size_t stride = PROPERTY_TYPE_BASE_STRIDE + strsize;
 
@@ -32,3 +32,49 @@ DumpResult<void> TombstonesDumper::dump(const Tombstones& tombstones) {
 
     return {};
 }
+
+DumpResult<void> TombstonesDumper::dumpDelta(const Tombstones& tombstones,
+                                             const Tombstones& base) {
+    GraphDumpHelper::writeFileHeader(_writer);
+
+    { // Dump node tombstones added since base
+        std::vector<NodeID> addedNodes;
+
+        // Tombstones only grow between two commits, same size means no new deletion
+        if (tombstones.numNodes() != base.numNodes()) {
+            for (const NodeID node : tombstones.nodeTombstones()) {
+                if (!base.containsNode(node)) {
+                    addedNodes.push_back(node);
+                }
+            }
+        }
+
+        const size_t nodesSize = addedNodes.size();
+
+        DumpUtils::ensureDumpSpace(sizeof(nodesSize), _writer);
+        _writer.writeToCurrentPage(nodesSize);
+
+        DumpUtils::dumpRange(addedNodes, _writer);
+    }
+
+    { // Dump edge tombstones added since base
+        std::vector<EdgeID> addedEdges;
+
+        if (tombstones.numEdges() != base.numEdges()) {
+            for (const EdgeID edge : tombstones.edgeTombstones()) {
+                if (!base.containsEdge(edge)) {
+                    addedEdges.push_back(edge);
+                }
+            }
+        }
+
+        const size_t edgesSize = addedEdges.size();
+
+        DumpUtils::ensureDumpSpace(sizeof(edgesSize), _writer);
+        _writer.writeToCurrentPage(edgesSize);
+
+        DumpUtils::dumpRange(addedEdges, _writer);
+    }
+
+    return {};
+}
@@ -18,7 +18,16 @@ public:
     }
 
     [[nodiscard]] DumpResult<void> dump(const Tombstones& tombstones);
-    
+
+    /**
+     * @brief Dumps only the tombstones of @param tombstones which are not already
+     * contained in @param base, the tombstones of the previous commit.
+     * @detail The file layout is the same as @ref dump, so that @ref TombstonesLoader
+     * can insert the delta on top of a copy of the previous commit's tombstones.
+     */
+    [[nodiscard]] DumpResult<void> dumpDelta(const Tombstones& tombstones,
+                                             const Tombstones& base);
+
 private:
     fs::FilePageWriter& _writer;
 };
@@ -54,6 +54,11 @@ public:
         return _patchNodes.size();
     }
 
+    // Approximate number of bytes allocated for the per-node edge data
+    size_t getMemoryUsage() const {
+        return _nodes.capacity() * sizeof(NodeEdgeData);
+    }
+
     std::span<const NodeEdgeData> getNodeData() const {
         return _nodes;
     }
@@ -32,6 +32,16 @@ public:
 
     size_t size() const { return _indexer.size(); }
 
+    // Approximate number of bytes allocated for the prefix trees
+    size_t getMemoryUsage() const {
+        size_t bytes = 0;
+        for (const auto& [ptID, index] : _indexer) {
+            bytes += index->getMemoryUsage();
+        }
+
+        return bytes;
+    }
+
     void setInitialised() { _initialised = true; }
 
     bool isInitialised() const { return _initialised; }
@@ -182,6 +182,21 @@ StringIndex::StringIndexIterator StringIndex::find(std::string_view sv) const {
     return StringIndexIterator{node, res};
 }
 
+size_t StringIndex::getMemoryUsage() const {
+    size_t bytes = _nodeManager.capacity() * sizeof(std::unique_ptr<PrefixTreeNode>);
+    for (const auto& node : _nodeManager) {
+        if (!node) {
+            continue;
+        }
+
+        bytes += sizeof(PrefixTreeNode)
+               + node->getChildren().capacity() * sizeof(PrefixTreeNode*)
+               + node->getOwners().capacity() * sizeof(EntityID);
+    }
+
+    return bytes;
+}
+
 void StringIndex::print(std::ostream& out) const {
     printTree(_root, -1, "", false, out);
 }
@@ -139,6 +139,9 @@ public:
 
     size_t getNodeCount() const { return _nodeManager.size(); }
 
+    // Approximate number of bytes allocated for the prefix tree
+    size_t getMemoryUsage() const;
+
 private:
     size_t _nextFreeID {std::numeric_limits<size_t>::max()};
     std::vector<std::unique_ptr<PrefixTreeNode>> _nodeManager;
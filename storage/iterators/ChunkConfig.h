@@ -1,5 +1,6 @@
 #pragma once
 
+#include <algorithm>
 #include <stddef.h>
 
 namespace db {
@@ -7,6 +8,21 @@ namespace db {
 class ChunkConfig {
 public:
     static constexpr size_t CHUNK_SIZE = 64ull*1024;
+
+    // Smallest chunk of a stage sized from its row width
+    static constexpr size_t MIN_CHUNK_SIZE = 1024;
+
+    // Bytes of a chunk that should stay in the L2 cache of a core
+    static constexpr size_t L2_BUDGET = 1024ull*1024;
+
+    // Rows of the chunks whose rows are rowBytes wide that fit in the L2 budget
+    static constexpr size_t getChunkSize(size_t rowBytes) {
+        if (rowBytes == 0) {
+            return CHUNK_SIZE;
+        }
+
+        return std::clamp(L2_BUDGET / rowBytes, MIN_CHUNK_SIZE, CHUNK_SIZE);
+    }
 };
 
 }
@@ -0,0 +1,51 @@
+#pragma once
+
+#include <span>
+#include <stdint.h>
+#include <vector>
+
+#include "ID.h"
+
+namespace db {
+
+/**
+ * @brief Bitset of edge types, tested while iterating the edges of a node.
+ * @detail A bit is set for each accepted edge type, so that an expansion over
+ * several edge types (e.g. -[:A|B|C]->) filters its edges in a single pass over
+ * the edge spans of the EdgeIndexer. Invalid edge type IDs are never accepted.
+ */
+class EdgeTypeFilter {
+public:
+    EdgeTypeFilter() = default;
+
+    explicit EdgeTypeFilter(std::span<const EdgeTypeID> edgeTypes) {
+        for (const EdgeTypeID edgeType : edgeTypes) {
+            add(edgeType);
+        }
+    }
+
+    void add(EdgeTypeID edgeType) {
+        if (!edgeType.isValid()) {
+            return;
+        }
+
+        const size_t word = edgeType.getValue() / 64;
+        if (word >= _bits.size()) {
+            _bits.resize(word + 1, 0);
+        }
+
+        _bits[word] |= 1ull << (edgeType.getValue() % 64);
+    }
+
+    bool empty() const { return _bits.empty(); }
+
+    bool contains(EdgeTypeID edgeType) const {
+        const size_t word = edgeType.getValue() / 64;
+        return word < _bits.size() && (_bits[word] >> (edgeType.getValue() % 64)) & 1;
+    }
+
+private:
+    std::vector<uint64_t> _bits;
+};
+
+}
@@ -68,9 +68,7 @@ void GetEdgesIterator::goToPart(size_t partIdx) {
 
 void GetEdgesIterator::advancePartIterator(size_t n) {
     // Advance n dataparts forward
-    for (size_t i = 0; i < n && _partIt.isNotEnd(); i++) {
-        _partIt.next();
-    }
+    _partIt.advance(n);
 
     // If we have not reached the end, update the _node members
     if (_partIt.isNotEnd()) {
@@ -156,6 +154,39 @@ void GetEdgesChunkWriter::filterTombstones() {
     _filter.reset();
 }
 
+void GetEdgesChunkWriter::fillEdgeTypes(size_t maxCount) {
+    size_t remainingToMax = maxCount;
+
+    // Edges are tested one by one against the edge type bitset,
+    // so that all the edge types are expanded in a single pass over the edge spans
+    while (isValid() && remainingToMax > 0) {
+        const size_t index = std::distance(_inputNodeIDs->cbegin(), _nodeIt);
+
+        for (; _edgeIt != _edges.end() && remainingToMax > 0; ++_edgeIt) {
+            const EdgeRecord& edge = *_edgeIt;
+            if (!_edgeTypeFilter->contains(edge._edgeTypeID)) {
+                continue;
+            }
+
+            _indices->push_back(index);
+
+            if (_edgeIDs) {
+                _edgeIDs->push_back(edge._edgeID);
+            }
+            if (_others) {
+                _others->push_back(edge._otherID);
+            }
+            if (_types) {
+                _types->push_back(edge._edgeTypeID);
+            }
+
+            remainingToMax--;
+        }
+
+        nextValid();
+    }
+}
+
 static constexpr size_t NColumns = 3;
 static constexpr size_t NCombinations = 1 << NColumns;
 
@@ -226,18 +257,22 @@ void GetEdgesChunkWriter::fill(size_t maxCount) {
         };
     };
 
-    switch (bitmask::create(_edgeIDs, _others, _types)) {
-        CASE(0);
-        CASE(1);
-        CASE(2);
-        CASE(3);
-        CASE(4);
-        CASE(5);
-        CASE(6);
-        CASE(7);
-
-        default:
-            bioassert(false, "Unexpected column combination");
+    if (_edgeTypeFilter && !_edgeTypeFilter->empty()) {
+        fillEdgeTypes(maxCount);
+    } else {
+        switch (bitmask::create(_edgeIDs, _others, _types)) {
+            CASE(0);
+            CASE(1);
+            CASE(2);
+            CASE(3);
+            CASE(4);
+            CASE(5);
+            CASE(6);
+            CASE(7);
+
+            default:
+                bioassert(false, "Unexpected column combination");
+        }
     }
 
     // Base column is _edgeIDs: only need to check if there are edge tombstones
@@ -7,6 +7,7 @@
 #include "PartIterator.h"
 #include "ChunkWriter.h"
 #include "TombstoneFilter.h"
+#include "EdgeTypeFilter.h"
 #include "columns/ColumnEdgeTypes.h"
 #include "columns/ColumnIDs.h"
 #include "EdgeRecord.h"
@@ -85,6 +86,9 @@ public:
     void setOtherIDs(ColumnNodeIDs* others) { _others = others; }
     void setEdgeTypes(ColumnEdgeTypes* types) { _types = types; }
 
+    // Only writes the edges whose type is in the filter, if not empty
+    void setEdgeTypeFilter(const EdgeTypeFilter* filter) { _edgeTypeFilter = filter; }
+
 private:
     ColumnVector<size_t>* _indices {nullptr};
     ColumnEdgeIDs* _edgeIDs {nullptr};
@@ -92,8 +96,10 @@ private:
     ColumnEdgeTypes* _types {nullptr};
 
     TombstoneFilter _filter;
+    const EdgeTypeFilter* _edgeTypeFilter {nullptr};
 
     void filterTombstones();
+    void fillEdgeTypes(size_t maxCount);
 };
 
 struct GetEdgesRange {
@@ -56,9 +56,7 @@ void GetInEdgesIterator::goToPart(size_t partIdx) {
 
 void GetInEdgesIterator::advancePartIterator(size_t n) {
     // Advance n dataparts forward
-    for (size_t i = 0; i < n && _partIt.isNotEnd(); i++) {
-        _partIt.next();
-    }
+    _partIt.advance(n);
     // If we have not reached the end, update the _node members
     if (_partIt.isNotEnd()) {
         _nodeIt = _inputNodeIDs->cbegin();
@@ -125,6 +123,39 @@ void GetInEdgesChunkWriter::filterTombstones() {
     _filter.reset();
 }
 
+void GetInEdgesChunkWriter::fillEdgeTypes(size_t maxCount) {
+    size_t remainingToMax = maxCount;
+
+    // Edges are tested one by one against the edge type bitset,
+    // so that all the edge types are expanded in a single pass over the edge spans
+    while (isValid() && remainingToMax > 0) {
+        const size_t index = std::distance(_inputNodeIDs->cbegin(), _nodeIt);
+
+        for (; _edgeIt != _edges.end() && remainingToMax > 0; ++_edgeIt) {
+            const EdgeRecord& edge = *_edgeIt;
+            if (!_edgeTypeFilter->contains(edge._edgeTypeID)) {
+                continue;
+            }
+
+            _indices->push_back(index);
+
+            if (_edgeIDs) {
+                _edgeIDs->push_back(edge._edgeID);
+            }
+            if (_srcs) {
+                _srcs->push_back(edge._otherID);
+            }
+            if (_types) {
+                _types->push_back(edge._edgeTypeID);
+            }
+
+            remainingToMax--;
+        }
+
+        nextValid();
+    }
+}
+
 static constexpr size_t NColumns = 3;
 static constexpr size_t NCombinations = 1 << NColumns;
 
@@ -193,15 +224,19 @@ void GetInEdgesChunkWriter::fill(size_t maxCount) {
         };
     };
 
-    switch (bitmask::create(_edgeIDs, _srcs, _types)) {
-        CASE(0);
-        CASE(1);
-        CASE(2);
-        CASE(3);
-        CASE(4);
-        CASE(5);
-        CASE(6);
-        CASE(7);
+    if (_edgeTypeFilter && !_edgeTypeFilter->empty()) {
+        fillEdgeTypes(maxCount);
+    } else {
+        switch (bitmask::create(_edgeIDs, _srcs, _types)) {
+            CASE(0);
+            CASE(1);
+            CASE(2);
+            CASE(3);
+            CASE(4);
+            CASE(5);
+            CASE(6);
+            CASE(7);
+        }
     }
 
     if (_view.tombstones().hasEdges()) {
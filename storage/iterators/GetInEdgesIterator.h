@@ -6,6 +6,7 @@
 #include "ChunkWriter.h"
 #include "PartIterator.h"
 #include "TombstoneFilter.h"
+#include "EdgeTypeFilter.h"
 #include "EdgeRecord.h"
 #include "columns/ColumnEdgeTypes.h"
 #include "columns/ColumnIDs.h"
@@ -78,6 +79,9 @@ public:
     void setSrcIDs(ColumnNodeIDs* srcs) { _srcs = srcs; }
     void setEdgeTypes(ColumnEdgeTypes* types) { _types = types; }
 
+    // Only writes the edges whose type is in the filter, if not empty
+    void setEdgeTypeFilter(const EdgeTypeFilter* filter) { _edgeTypeFilter = filter; }
+
 private:
     ColumnVector<size_t>* _indices {nullptr};
     ColumnEdgeIDs* _edgeIDs {nullptr};
@@ -85,8 +89,10 @@ private:
     ColumnEdgeTypes* _types {nullptr};
 
     TombstoneFilter _filter;
+    const EdgeTypeFilter* _edgeTypeFilter {nullptr};
 
     void filterTombstones();
+    void fillEdgeTypes(size_t maxCount);
 };
 
 struct GetInEdgesRange {
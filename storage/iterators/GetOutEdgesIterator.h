@@ -7,6 +7,7 @@
 #include "PartIterator.h"
 #include "ChunkWriter.h"
 #include "TombstoneFilter.h"
+#include "EdgeTypeFilter.h"
 #include "columns/ColumnEdgeTypes.h"
 #include "columns/ColumnIDs.h"
 #include "EdgeRecord.h"
@@ -79,6 +80,9 @@ public:
     void setTgtIDs(ColumnNodeIDs* tgts) { _tgts = tgts; }
     void setEdgeTypes(ColumnEdgeTypes* types) { _types = types; }
 
+    // Only writes the edges whose type is in the filter, if not empty
+    void setEdgeTypeFilter(const EdgeTypeFilter* filter) { _edgeTypeFilter = filter; }
+
 private:
     ColumnVector<size_t>* _indices {nullptr};
     ColumnEdgeIDs* _edgeIDs {nullptr};
@@ -86,8 +90,10 @@ private:
     ColumnEdgeTypes* _types {nullptr};
 
     TombstoneFilter _filter;
+    const EdgeTypeFilter* _edgeTypeFilter {nullptr};
 
     void filterTombstones();
+    void fillEdgeTypes(size_t maxCount);
 };
 
 struct GetOutEdgesRange {
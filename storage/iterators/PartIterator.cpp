@@ -1,5 +1,8 @@
 #include "PartIterator.h"
 
+#include <algorithm>
+#include <iterator>
+
 #include "DataPart.h"
 
 using namespace db;
@@ -8,6 +11,17 @@ PartIterator::PartIterator(const GraphView& view)
     : _it(view.dataparts().begin()),
     _itEnd(view.dataparts().end())
 {
+    enterPart();
+}
+
+void PartIterator::advance(size_t n) {
+    if (n == 0) {
+        return;
+    }
+
+    const size_t remaining = std::distance(_it, _itEnd);
+    _it += std::min(n, remaining);
+    enterPart();
 }
 
 void PartIterator::skipEmptyParts() {
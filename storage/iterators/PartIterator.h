@@ -18,14 +18,21 @@ public:
     PartIterator& operator=(PartIterator&&) = default;
     ~PartIterator() = default;
 
-    inline const DataPart* get() const { return _it->get(); }
+    inline const DataPart* get() const {
+        return _it->get();
+    }
+
     inline DataPartIterator getIterator() const { return _it; }
     inline DataPartIterator getEndIterator() const { return _itEnd; }
 
     inline void next() {
         ++_it;
+        enterPart();
     }
 
+    // Moves n dataparts forward, or to the end if there are less than n left
+    void advance(size_t n);
+
     bool isNotEnd() const {
         return _it != _itEnd;
     }
@@ -36,6 +43,7 @@ public:
 
     inline PartIterator& operator++() {
         ++_it;
+        enterPart();
         return *this;
     }
 
@@ -45,9 +53,22 @@ public:
         _it = _itEnd;
     }
 
+    // Number of dataparts the part iterators of the calling thread moved onto,
+    // read before and after each processor execution by the query profiler.
+    // Counted when switching parts, so that reading a part costs nothing
+    static size_t getVisitedPartCount() { return _visitedParts; }
+
 private:
     DataPartIterator _it;
     DataPartIterator _itEnd;
+
+    static inline thread_local size_t _visitedParts {0};
+
+    inline void enterPart() {
+        if (_it != _itEnd) {
+            _visitedParts++;
+        }
+    }
 };
 
 }
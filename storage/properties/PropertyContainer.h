@@ -46,6 +46,10 @@ public:
     virtual size_t size() const = 0;
 
     virtual bool has(EntityID entityID) const = 0;
+
+    // Approximate number of bytes allocated for the ids and values
+    virtual size_t getMemoryUsage() const = 0;
+
     ValueType getValueType() const { return _valueType; }
 
     IDs& ids() { return _ids; }
@@ -136,6 +140,11 @@ public:
         return _values.size();
     }
 
+    size_t getMemoryUsage() const override {
+        return _ids.capacity() * sizeof(EntityID)
+             + _values.capacity() * sizeof(typename T::Primitive);
+    }
+
     void sort() override {
         ranges::sort(
             ranges::views::zip(_ids, _values),
@@ -236,6 +245,10 @@ public:
         return _values.size();
     }
 
+    size_t getMemoryUsage() const override {
+        return _ids.capacity() * sizeof(EntityID) + _values.getMemoryUsage();
+    }
+
     void sort() override {
         StringContainer newValues;
         if (_ids.empty()) {
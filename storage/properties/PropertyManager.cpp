@@ -15,6 +15,50 @@ PropertyManager::PropertyManager()
 PropertyManager::~PropertyManager() {
 }
 
+void PropertyManager::addContainer(PropertyTypeID ptID,
+                                   std::unique_ptr<PropertyContainer> container) {
+    if (_map.find(ptID) != _map.end()) {
+        throw FatalException("Trying to register a type that was already registered");
+    }
+
+    PropertyContainer* ptr = container.get();
+
+    switch (ptr->getValueType()) {
+        case ValueType::UInt64: {
+            _uint64s.emplace(ptID, ptr);
+        }
+        break;
+
+        case ValueType::Int64: {
+            _int64s.emplace(ptID, ptr);
+        }
+        break;
+
+        case ValueType::Double: {
+            _doubles.emplace(ptID, ptr);
+        }
+        break;
+
+        case ValueType::String: {
+            _strings.emplace(ptID, ptr);
+        }
+        break;
+
+        case ValueType::Bool: {
+            _bools.emplace(ptID, ptr);
+        }
+        break;
+
+        case ValueType::Invalid:
+        case ValueType::_SIZE: {
+            throw FatalException("Trying to register a container with an invalid type");
+        }
+        break;
+    }
+
+    _map.emplace(ptID, std::move(container));
+}
+
 void PropertyManager::fillEntityPropertyView(EntityID entityID,
                                              const LabelSetHandle& labelset,
                                              EntityPropertyView& view) const {
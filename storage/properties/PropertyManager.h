@@ -53,6 +53,12 @@ public:
         }
     }
 
+    /**
+     * @brief Registers @param container, already filled with values, as the container
+     * of the property type @param ptID.
+     */
+    void addContainer(PropertyTypeID ptID, std::unique_ptr<PropertyContainer> container);
+
     template <SupportedType T, typename... Args>
     void add(PropertyTypeID ptID, EntityID entityID, Args&&... args) {
         TypedPropertyContainer<T>& container = getMutableContainer<T>(ptID);
@@ -149,6 +155,16 @@ public:
         return _map.size();
     }
 
+    // Approximate number of bytes allocated for the property containers
+    size_t getMemoryUsage() const {
+        size_t bytes = 0;
+        for (const auto& [ptID, container] : _map) {
+            bytes += container->getMemoryUsage();
+        }
+
+        return bytes;
+    }
+
     bool isEmpty() const {
         return _map.empty();
     }
@@ -0,0 +1,90 @@
+#include "NodeNeighborhoods.h"
+
+#include <algorithm>
+
+#include "DataPart.h"
+#include "indexers/EdgeIndexer.h"
+#include "views/GraphView.h"
+
+using namespace db;
+
+void NodeNeighborhoods::collect(const GraphView& view,
+                                std::span<const NodeID> nodeIDs,
+                                size_t limitPerNode) {
+    _nodeIDs.assign(nodeIDs.begin(), nodeIDs.end());
+    std::ranges::sort(_nodeIDs);
+    const auto duplicates = std::ranges::unique(_nodeIDs);
+    _nodeIDs.erase(duplicates.begin(), duplicates.end());
+
+    collectEdges(view, &EdgeIndexer::getNodeOutEdges, limitPerNode, _outs);
+    collectEdges(view, &EdgeIndexer::getNodeInEdges, limitPerNode, _ins);
+}
+
+void NodeNeighborhoods::collectEdges(const GraphView& view,
+                                     GetNodeEdges getNodeEdges,
+                                     size_t limitPerNode,
+                                     Edges& edges) {
+    const size_t nodeCount = _nodeIDs.size();
+
+    _segments.clear();
+    _counts.assign(nodeCount, 0);
+    edges._truncated.assign(nodeCount, false);
+
+    // Sweep, keeps the spans of edges of each datapart up to the limit
+    for (const auto& part : view.dataparts()) {
+        const EdgeIndexer& indexer = part->edgeIndexer();
+
+        const auto visit = [&](size_t i) {
+            const std::span<const EdgeRecord> nodeEdges = (indexer.*getNodeEdges)(_nodeIDs[i]);
+            if (nodeEdges.empty()) {
+                return;
+            }
+
+            const size_t kept = std::min(nodeEdges.size(), limitPerNode - _counts[i]);
+            if (kept < nodeEdges.size()) {
+                edges._truncated[i] = true;
+            }
+
+            if (kept != 0) {
+                _counts[i] += kept;
+                _segments.push_back({i, nodeEdges.first(kept)});
+            }
+        };
+
+        // Core nodes of the datapart are a contiguous range of the sorted IDs
+        const NodeID firstNodeID = indexer.getFirstNodeID();
+        const NodeID endNodeID = firstNodeID.getValue() + indexer.getCoreNodeCount();
+        const auto coreBegin = std::ranges::lower_bound(_nodeIDs, firstNodeID);
+        const auto coreEnd = std::lower_bound(coreBegin, _nodeIDs.end(), endNodeID);
+
+        const size_t coreBeginIndex = std::distance(_nodeIDs.begin(), coreBegin);
+        const size_t coreEndIndex = std::distance(_nodeIDs.begin(), coreEnd);
+
+        // Patched nodes were created in previous dataparts
+        if (indexer.getPatchNodeCount() != 0) {
+            for (size_t i = 0; i < coreBeginIndex; i++) {
+                visit(i);
+            }
+        }
+
+        for (size_t i = coreBeginIndex; i < coreEndIndex; i++) {
+            visit(i);
+        }
+    }
+
+    // Groups the edges per node, keeping the order of the dataparts
+    edges._offsets.resize(nodeCount + 1);
+    edges._offsets[0] = 0;
+    for (size_t i = 0; i < nodeCount; i++) {
+        edges._offsets[i + 1] = edges._offsets[i] + _counts[i];
+    }
+
+    edges._edges.resize(edges._offsets[nodeCount]);
+
+    // Reuses the counts as write positions
+    std::copy(edges._offsets.begin(), edges._offsets.end() - 1, _counts.begin());
+    for (const Segment& segment : _segments) {
+        std::ranges::copy(segment._edges, edges._edges.begin() + _counts[segment._node]);
+        _counts[segment._node] += segment._edges.size();
+    }
+}
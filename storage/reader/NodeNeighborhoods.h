@@ -0,0 +1,78 @@
+#pragma once
+
+#include <limits>
+#include <span>
+#include <vector>
+
+#include "ID.h"
+#include "EdgeRecord.h"
+
+namespace db {
+
+class GraphView;
+class EdgeIndexer;
+
+/**
+ * @brief Out and in edges of a batch of nodes, collected with a single sweep
+ * of the dataparts.
+ *
+ * @detail The requested IDs are sorted so that the core nodes of each datapart
+ * are found with a binary search, only patched nodes are looked up one by one.
+ * Edges are grouped per node, in the order of the dataparts, and at most
+ * limitPerNode edges are kept per node and direction.
+ */
+class NodeNeighborhoods {
+public:
+    NodeNeighborhoods() = default;
+
+    void collect(const GraphView& view,
+                 std::span<const NodeID> nodeIDs,
+                 size_t limitPerNode = std::numeric_limits<size_t>::max());
+
+    // Number of distinct requested nodes
+    size_t size() const { return _nodeIDs.size(); }
+
+    // Requested nodes, sorted and without duplicates
+    std::span<const NodeID> nodeIDs() const { return _nodeIDs; }
+
+    std::span<const EdgeRecord> getOutEdges(size_t i) const { return _outs.getEdges(i); }
+    std::span<const EdgeRecord> getInEdges(size_t i) const { return _ins.getEdges(i); }
+
+    // False if edges were dropped because of the limit
+    bool hasAllOutEdges(size_t i) const { return !_outs._truncated[i]; }
+    bool hasAllInEdges(size_t i) const { return !_ins._truncated[i]; }
+
+private:
+    struct Edges {
+        // Edges of node i are in [_offsets[i], _offsets[i + 1])
+        std::vector<EdgeRecord> _edges;
+        std::vector<size_t> _offsets;
+        std::vector<bool> _truncated;
+
+        std::span<const EdgeRecord> getEdges(size_t i) const {
+            return std::span(_edges).subspan(_offsets[i], _offsets[i + 1] - _offsets[i]);
+        }
+    };
+
+    struct Segment {
+        size_t _node {0};
+        std::span<const EdgeRecord> _edges;
+    };
+
+    using GetNodeEdges = std::span<const EdgeRecord> (EdgeIndexer::*)(NodeID) const;
+
+    std::vector<NodeID> _nodeIDs;
+    Edges _outs;
+    Edges _ins;
+
+    // Scratch buffers of the sweep
+    std::vector<Segment> _segments;
+    std::vector<size_t> _counts;
+
+    void collectEdges(const GraphView& view,
+                      GetNodeEdges getNodeEdges,
+                      size_t limitPerNode,
+                      Edges& edges);
+};
+
+}
@@ -0,0 +1,552 @@
+#include "GraphStatistics.h"
+
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <string_view>
+
+#include "DataPart.h"
+#include "NodeContainer.h"
+#include "EdgeContainer.h"
+#include "properties/PropertyContainer.h"
+#include "properties/PropertyManager.h"
+#include "versioning/MetadataRebaser.h"
+
+using namespace db;
+
+namespace {
+
+// Version of the serialized statistics, older versions are ignored
+constexpr uint32_t STATISTICS_VERSION = 1;
+
+// Longer strings are truncated in the ranges
+constexpr size_t MAX_RANGE_STRING_SIZE = 64;
+
+class ByteWriter {
+public:
+    explicit ByteWriter(std::vector<uint8_t>& out)
+        : _out(out)
+    {
+    }
+
+    template <typename T>
+    void write(const T& value) {
+        const size_t offset = _out.size();
+        _out.resize(offset + sizeof(T));
+        std::memcpy(_out.data() + offset, &value, sizeof(T));
+    }
+
+    void writeBytes(std::span<const uint8_t> bytes) {
+        _out.insert(_out.end(), bytes.begin(), bytes.end());
+    }
+
+    void writeString(std::string_view str) {
+        write<uint64_t>(str.size());
+        _out.insert(_out.end(), str.begin(), str.end());
+    }
+
+private:
+    std::vector<uint8_t>& _out;
+};
+
+class ByteReader {
+public:
+    explicit ByteReader(std::span<const uint8_t> data)
+        : _data(data)
+    {
+    }
+
+    template <typename T>
+    T read() {
+        T value {};
+        if (!checkSize(sizeof(T))) {
+            return value;
+        }
+
+        std::memcpy(&value, _data.data() + _offset, sizeof(T));
+        _offset += sizeof(T);
+        return value;
+    }
+
+    void readBytes(std::span<uint8_t> bytes) {
+        if (!checkSize(bytes.size())) {
+            return;
+        }
+
+        std::memcpy(bytes.data(), _data.data() + _offset, bytes.size());
+        _offset += bytes.size();
+    }
+
+    std::string readString() {
+        const uint64_t size = read<uint64_t>();
+        if (!checkSize(size)) {
+            return {};
+        }
+
+        std::string str {reinterpret_cast<const char*>(_data.data() + _offset), size};
+        _offset += size;
+        return str;
+    }
+
+    bool isValid() const { return _valid; }
+
+private:
+    std::span<const uint8_t> _data;
+    size_t _offset {0};
+    bool _valid {true};
+
+    bool checkSize(size_t size) {
+        if (!_valid || size > _data.size() - _offset) {
+            _valid = false;
+        }
+
+        return _valid;
+    }
+};
+
+uint64_t hashValue(std::string_view value) {
+    return HyperLogLog::hash(std::hash<std::string_view> {}(value));
+}
+
+template <typename T>
+uint64_t hashValue(const T& value) {
+    if constexpr (std::is_same_v<T, double>) {
+        return HyperLogLog::hash(std::bit_cast<uint64_t>(value));
+    } else {
+        return HyperLogLog::hash((uint64_t)value);
+    }
+}
+
+template <SupportedType T>
+void addValues(PropertyStatistics& stats, const PropertyContainer& container) {
+    const auto& values = container.cast<T>();
+    const size_t count = values.size();
+
+    for (size_t i = 0; i < count; i++) {
+        const auto& value = values.get(i);
+        stats._distinct.add(hashValue(value));
+
+        if constexpr (std::is_same_v<T, types::String>) {
+            const std::string_view str = value.substr(0, MAX_RANGE_STRING_SIZE);
+            if (!stats._hasRange) {
+                stats._minString = str;
+                stats._maxString = str;
+            } else if (str < stats._minString) {
+                stats._minString = str;
+            } else if (str > stats._maxString) {
+                stats._maxString = str;
+            }
+        } else {
+            const double number = (double)value;
+            if (!stats._hasRange) {
+                stats._min = number;
+                stats._max = number;
+            } else {
+                stats._min = std::min(stats._min, number);
+                stats._max = std::max(stats._max, number);
+            }
+        }
+
+        stats._hasRange = true;
+    }
+
+    stats._count += count;
+}
+
+void writeHistograms(ByteWriter& writer, const GraphStatistics::DegreeHistograms& histograms) {
+    writer.write<uint64_t>(histograms.size());
+    for (const auto& [edgeType, histogram] : histograms) {
+        writer.write<uint64_t>(edgeType.getValue());
+        writer.write<uint64_t>(histogram._nodeCount);
+        writer.write<uint64_t>(histogram._edgeCount);
+        for (const uint64_t bucket : histogram._buckets) {
+            writer.write<uint64_t>(bucket);
+        }
+    }
+}
+
+void readHistograms(ByteReader& reader, GraphStatistics::DegreeHistograms& histograms) {
+    const uint64_t count = reader.read<uint64_t>();
+    for (uint64_t i = 0; i < count && reader.isValid(); i++) {
+        DegreeHistogram& histogram = histograms[reader.read<uint64_t>()];
+        histogram._nodeCount = reader.read<uint64_t>();
+        histogram._edgeCount = reader.read<uint64_t>();
+        for (uint64_t& bucket : histogram._buckets) {
+            bucket = reader.read<uint64_t>();
+        }
+    }
+}
+
+void writeProperties(ByteWriter& writer, const GraphStatistics::PropertyStatisticsMap& properties) {
+    writer.write<uint64_t>(properties.size());
+    for (const auto& [ptID, stats] : properties) {
+        writer.write<uint16_t>(ptID.getValue());
+        writer.write<uint8_t>((uint8_t)stats._valueType);
+        writer.write<uint64_t>(stats._count);
+        writer.writeBytes(stats._distinct.registers());
+        writer.write<uint8_t>(stats._hasRange);
+        writer.write<double>(stats._min);
+        writer.write<double>(stats._max);
+        writer.writeString(stats._minString);
+        writer.writeString(stats._maxString);
+    }
+}
+
+void readProperties(ByteReader& reader, GraphStatistics::PropertyStatisticsMap& properties) {
+    const uint64_t count = reader.read<uint64_t>();
+    for (uint64_t i = 0; i < count && reader.isValid(); i++) {
+        PropertyStatistics& stats = properties[reader.read<uint16_t>()];
+        stats._valueType = (ValueType)reader.read<uint8_t>();
+        stats._count = reader.read<uint64_t>();
+        reader.readBytes(stats._distinct.registers());
+        stats._hasRange = reader.read<uint8_t>() != 0;
+        stats._min = reader.read<double>();
+        stats._max = reader.read<double>();
+        stats._minString = reader.readString();
+        stats._maxString = reader.readString();
+    }
+}
+
+}
+
+void DegreeHistogram::add(uint64_t degree) {
+    if (degree == 0) {
+        return;
+    }
+
+    const size_t bucket = std::min<size_t>(std::bit_width(degree) - 1, BUCKET_COUNT - 1);
+    _buckets[bucket]++;
+    _nodeCount++;
+    _edgeCount += degree;
+}
+
+void DegreeHistogram::merge(const DegreeHistogram& other) {
+    for (size_t i = 0; i < BUCKET_COUNT; i++) {
+        _buckets[i] += other._buckets[i];
+    }
+
+    _nodeCount += other._nodeCount;
+    _edgeCount += other._edgeCount;
+}
+
+void PropertyStatistics::merge(const PropertyStatistics& other) {
+    if (_valueType == ValueType::Invalid) {
+        _valueType = other._valueType;
+    }
+
+    _distinct.merge(other._distinct);
+
+    if (other._hasRange) {
+        if (!_hasRange) {
+            _min = other._min;
+            _max = other._max;
+            _minString = other._minString;
+            _maxString = other._maxString;
+        } else {
+            _min = std::min(_min, other._min);
+            _max = std::max(_max, other._max);
+            _minString = std::min(_minString, other._minString);
+            _maxString = std::max(_maxString, other._maxString);
+        }
+
+        _hasRange = true;
+    }
+
+    _count += other._count;
+}
+
+uint64_t PropertyStatistics::distinctCount() const {
+    return std::min(_distinct.estimate(), _count);
+}
+
+std::unique_ptr<GraphStatistics> GraphStatistics::createFromDataPart(
+    const DataPart& part,
+    const std::map<NodeID, LabelSetHandle>* patchNodeLabelSets) {
+    auto stats = std::make_unique<GraphStatistics>();
+
+    const NodeContainer& nodes = part.nodes();
+    const EdgeContainer& edges = part.edges();
+
+    stats->_nodeCount = nodes.size();
+    stats->_edgeCount = edges.size();
+
+    for (const auto& [labelset, range] : nodes.getLabelSetIndexer()) {
+        stats->_nodeCounts[labelset.getID()] += range._count;
+    }
+
+    const auto getLabelSetID = [&](NodeID nodeID) -> LabelSetID {
+        if (nodes.hasEntity(nodeID)) {
+            return nodes.getNodeLabelSet(nodeID).getID();
+        }
+
+        if (patchNodeLabelSets) {
+            const auto it = patchNodeLabelSets->find(nodeID);
+            if (it != patchNodeLabelSets->end()) {
+                return it->second.getID();
+            }
+        }
+
+        return LabelSetID {};
+    };
+
+    // Out edges are sorted by source node and in edges by target node
+    const auto addDegrees = [](std::span<const EdgeRecord> records,
+                               DegreeHistograms& histograms) {
+        std::unordered_map<EdgeTypeID, uint64_t> degrees;
+        NodeID currentNode;
+
+        const auto flush = [&]() {
+            for (const auto& [edgeType, degree] : degrees) {
+                histograms[edgeType].add(degree);
+            }
+            degrees.clear();
+        };
+
+        for (const EdgeRecord& record : records) {
+            if (record._nodeID != currentNode) {
+                flush();
+                currentNode = record._nodeID;
+            }
+
+            degrees[record._edgeTypeID]++;
+        }
+
+        flush();
+    };
+
+    for (const EdgeRecord& edge : edges.getOuts()) {
+        const EdgePatternKey key {
+            ._sourceLabelSet = getLabelSetID(edge._nodeID),
+            ._edgeType = edge._edgeTypeID,
+            ._targetLabelSet = getLabelSetID(edge._otherID),
+        };
+
+        stats->_edgeCounts[key]++;
+    }
+
+    addDegrees(edges.getOuts(), stats->_outDegrees);
+    addDegrees(edges.getIns(), stats->_inDegrees);
+
+    addProperties(stats->_nodeProperties, part.nodeProperties());
+    addProperties(stats->_edgeProperties, part.edgeProperties());
+
+    return stats;
+}
+
+void GraphStatistics::addProperties(PropertyStatisticsMap& stats, const PropertyManager& properties) {
+    for (const auto& [ptID, container] : properties) {
+        PropertyStatistics& propStats = stats[ptID];
+        propStats._valueType = container->getValueType();
+
+        switch (container->getValueType()) {
+            case ValueType::Int64:
+                addValues<types::Int64>(propStats, *container);
+                break;
+            case ValueType::UInt64:
+                addValues<types::UInt64>(propStats, *container);
+                break;
+            case ValueType::Double:
+                addValues<types::Double>(propStats, *container);
+                break;
+            case ValueType::String:
+                addValues<types::String>(propStats, *container);
+                break;
+            case ValueType::Bool:
+                addValues<types::Bool>(propStats, *container);
+                break;
+            case ValueType::Invalid:
+            case ValueType::_SIZE:
+                break;
+        }
+    }
+}
+
+void GraphStatistics::merge(const GraphStatistics& other) {
+    _nodeCount += other._nodeCount;
+    _edgeCount += other._edgeCount;
+
+    for (const auto& [labelset, count] : other._nodeCounts) {
+        _nodeCounts[labelset] += count;
+    }
+
+    for (const auto& [key, count] : other._edgeCounts) {
+        _edgeCounts[key] += count;
+    }
+
+    for (const auto& [edgeType, histogram] : other._outDegrees) {
+        _outDegrees[edgeType].merge(histogram);
+    }
+
+    for (const auto& [edgeType, histogram] : other._inDegrees) {
+        _inDegrees[edgeType].merge(histogram);
+    }
+
+    for (const auto& [ptID, stats] : other._nodeProperties) {
+        _nodeProperties[ptID].merge(stats);
+    }
+
+    for (const auto& [ptID, stats] : other._edgeProperties) {
+        _edgeProperties[ptID].merge(stats);
+    }
+}
+
+void GraphStatistics::rebase(const MetadataRebaser& metadata) {
+    const auto rebaseLabelSet = [&](LabelSetID labelset) -> LabelSetID {
+        if (!metadata.labelsetsChanged() || !labelset.isValid()) {
+            return labelset;
+        }
+
+        return metadata.getLabelSetMapping(labelset).getID();
+    };
+
+    const auto rebaseEdgeType = [&](EdgeTypeID edgeType) -> EdgeTypeID {
+        if (!metadata.edgeTypesChanged()) {
+            return edgeType;
+        }
+
+        return metadata.getEdgeTypeMapping(edgeType);
+    };
+
+    NodeCounts nodeCounts;
+    for (const auto& [labelset, count] : _nodeCounts) {
+        nodeCounts[rebaseLabelSet(labelset)] += count;
+    }
+    _nodeCounts = std::move(nodeCounts);
+
+    EdgeCounts edgeCounts;
+    for (const auto& [key, count] : _edgeCounts) {
+        const EdgePatternKey newKey {
+            ._sourceLabelSet = rebaseLabelSet(key._sourceLabelSet),
+            ._edgeType = rebaseEdgeType(key._edgeType),
+            ._targetLabelSet = rebaseLabelSet(key._targetLabelSet),
+        };
+
+        edgeCounts[newKey] += count;
+    }
+    _edgeCounts = std::move(edgeCounts);
+
+    const auto rebaseHistograms = [&](DegreeHistograms& histograms) {
+        DegreeHistograms rebased;
+        for (const auto& [edgeType, histogram] : histograms) {
+            rebased[rebaseEdgeType(edgeType)].merge(histogram);
+        }
+        histograms = std::move(rebased);
+    };
+
+    rebaseHistograms(_outDegrees);
+    rebaseHistograms(_inDegrees);
+
+    if (!metadata.propTypesChanged()) {
+        return;
+    }
+
+    const auto rebaseProperties = [&](PropertyStatisticsMap& properties) {
+        PropertyStatisticsMap rebased;
+        for (const auto& [ptID, stats] : properties) {
+            rebased[metadata.getPropertyTypeMapping(ptID)._id].merge(stats);
+        }
+        properties = std::move(rebased);
+    };
+
+    rebaseProperties(_nodeProperties);
+    rebaseProperties(_edgeProperties);
+}
+
+uint64_t GraphStatistics::getNodeCount(LabelSetID labelset) const {
+    const auto it = _nodeCounts.find(labelset);
+    return it != _nodeCounts.end() ? it->second : 0;
+}
+
+const PropertyStatistics* GraphStatistics::getNodeProperty(PropertyTypeID ptID) const {
+    const auto it = _nodeProperties.find(ptID);
+    return it != _nodeProperties.end() ? &it->second : nullptr;
+}
+
+const PropertyStatistics* GraphStatistics::getEdgeProperty(PropertyTypeID ptID) const {
+    const auto it = _edgeProperties.find(ptID);
+    return it != _edgeProperties.end() ? &it->second : nullptr;
+}
+
+double GraphStatistics::getNodePropertyNullFraction(PropertyTypeID ptID) const {
+    const PropertyStatistics* stats = getNodeProperty(ptID);
+    if (!stats || _nodeCount == 0) {
+        return 1.0;
+    }
+
+    return 1.0 - std::min(1.0, (double)stats->_count / _nodeCount);
+}
+
+double GraphStatistics::getEdgePropertyNullFraction(PropertyTypeID ptID) const {
+    const PropertyStatistics* stats = getEdgeProperty(ptID);
+    if (!stats || _edgeCount == 0) {
+        return 1.0;
+    }
+
+    return 1.0 - std::min(1.0, (double)stats->_count / _edgeCount);
+}
+
+void GraphStatistics::serialize(std::vector<uint8_t>& out) const {
+    ByteWriter writer {out};
+
+    writer.write<uint32_t>(STATISTICS_VERSION);
+    writer.write<uint64_t>(_nodeCount);
+    writer.write<uint64_t>(_edgeCount);
+
+    writer.write<uint64_t>(_nodeCounts.size());
+    for (const auto& [labelset, count] : _nodeCounts) {
+        writer.write<uint32_t>(labelset.getValue());
+        writer.write<uint64_t>(count);
+    }
+
+    writer.write<uint64_t>(_edgeCounts.size());
+    for (const auto& [key, count] : _edgeCounts) {
+        writer.write<uint32_t>(key._sourceLabelSet.getValue());
+        writer.write<uint64_t>(key._edgeType.getValue());
+        writer.write<uint32_t>(key._targetLabelSet.getValue());
+        writer.write<uint64_t>(count);
+    }
+
+    writeHistograms(writer, _outDegrees);
+    writeHistograms(writer, _inDegrees);
+    writeProperties(writer, _nodeProperties);
+    writeProperties(writer, _edgeProperties);
+}
+
+bool GraphStatistics::deserialize(std::span<const uint8_t> data) {
+    ByteReader reader {data};
+    *this = GraphStatistics {};
+
+    if (reader.read<uint32_t>() != STATISTICS_VERSION) {
+        return false;
+    }
+
+    _nodeCount = reader.read<uint64_t>();
+    _edgeCount = reader.read<uint64_t>();
+
+    const uint64_t labelsetCount = reader.read<uint64_t>();
+    for (uint64_t i = 0; i < labelsetCount && reader.isValid(); i++) {
+        const LabelSetID labelset = reader.read<uint32_t>();
+        _nodeCounts[labelset] = reader.read<uint64_t>();
+    }
+
+    const uint64_t patternCount = reader.read<uint64_t>();
+    for (uint64_t i = 0; i < patternCount && reader.isValid(); i++) {
+        EdgePatternKey key;
+        key._sourceLabelSet = reader.read<uint32_t>();
+        key._edgeType = reader.read<uint64_t>();
+        key._targetLabelSet = reader.read<uint32_t>();
+        _edgeCounts[key] = reader.read<uint64_t>();
+    }
+
+    readHistograms(reader, _outDegrees);
+    readHistograms(reader, _inDegrees);
+    readProperties(reader, _nodeProperties);
+    readProperties(reader, _edgeProperties);
+
+    if (!reader.isValid()) {
+        *this = GraphStatistics {};
+        return false;
+    }
+
+    return true;
+}
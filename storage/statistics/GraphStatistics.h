@@ -0,0 +1,149 @@
+#pragma once
+
+#include <array>
+#include <map>
+#include <memory>
+#include <span>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "ID.h"
+#include "metadata/LabelSetHandle.h"
+#include "metadata/PropertyType.h"
+#include "statistics/HyperLogLog.h"
+
+namespace db {
+
+class DataPart;
+class MetadataRebaser;
+class PropertyManager;
+
+// Degrees of the nodes having at least one edge of a given type
+struct DegreeHistogram {
+    // Bucket i counts the nodes with a degree in [2^i, 2^(i+1))
+    static constexpr size_t BUCKET_COUNT = 32;
+
+    std::array<uint64_t, BUCKET_COUNT> _buckets {};
+    uint64_t _nodeCount {0};
+    uint64_t _edgeCount {0};
+
+    void add(uint64_t degree);
+    void merge(const DegreeHistogram& other);
+
+    [[nodiscard]] double averageDegree() const {
+        return _nodeCount == 0 ? 0.0 : (double)_edgeCount / _nodeCount;
+    }
+};
+
+struct PropertyStatistics {
+    ValueType _valueType {ValueType::Invalid};
+
+    // Number of entities having the property
+    uint64_t _count {0};
+    HyperLogLog _distinct;
+
+    // Range of the values, numbers for the trivial types and strings otherwise
+    bool _hasRange {false};
+    double _min {0};
+    double _max {0};
+    std::string _minString;
+    std::string _maxString;
+
+    void merge(const PropertyStatistics& other);
+
+    [[nodiscard]] uint64_t distinctCount() const;
+};
+
+struct EdgePatternKey {
+    LabelSetID _sourceLabelSet;
+    EdgeTypeID _edgeType;
+    LabelSetID _targetLabelSet;
+
+    bool operator==(const EdgePatternKey& other) const = default;
+
+    struct Hash {
+        size_t operator()(const EdgePatternKey& key) const {
+            return HyperLogLog::hash(key._sourceLabelSet.getValue())
+                 ^ HyperLogLog::hash(key._edgeType.getValue() << 1)
+                 ^ HyperLogLog::hash((uint64_t)key._targetLabelSet.getValue() << 2);
+        }
+    };
+};
+
+/**
+ * @brief Data statistics of a graph, used to estimate the cardinalities of
+ * the query plans.
+ *
+ * @detail Each datapart holds the statistics of its content, computed when it is
+ * built and stored in its dump. The statistics of a commit are the merge of the
+ * ones of its dataparts. Deleted entities are not subtracted, and the degrees of
+ * the nodes whose edges span several dataparts are counted in each datapart.
+ */
+class GraphStatistics {
+public:
+    using NodeCounts = std::unordered_map<LabelSetID, uint64_t>;
+    using EdgeCounts = std::unordered_map<EdgePatternKey, uint64_t, EdgePatternKey::Hash>;
+    using DegreeHistograms = std::unordered_map<EdgeTypeID, DegreeHistogram>;
+    using PropertyStatisticsMap = std::unordered_map<PropertyTypeID, PropertyStatistics>;
+
+    GraphStatistics() = default;
+    ~GraphStatistics() = default;
+
+    GraphStatistics(const GraphStatistics&) = default;
+    GraphStatistics(GraphStatistics&&) noexcept = default;
+    GraphStatistics& operator=(const GraphStatistics&) = default;
+    GraphStatistics& operator=(GraphStatistics&&) noexcept = default;
+
+    /**
+     * @brief Computes the statistics of the content of @param part.
+     *
+     * @detail @param patchNodeLabelSets gives the labelsets of the nodes of previous
+     * dataparts, edges to nodes of unknown labelsets are counted with an invalid one.
+     */
+    [[nodiscard]] static std::unique_ptr<GraphStatistics> createFromDataPart(
+        const DataPart& part,
+        const std::map<NodeID, LabelSetHandle>* patchNodeLabelSets);
+
+    void merge(const GraphStatistics& other);
+
+    // Remaps the labelsets, edge types and property types of a rebased datapart
+    void rebase(const MetadataRebaser& metadata);
+
+    [[nodiscard]] uint64_t nodeCount() const { return _nodeCount; }
+    [[nodiscard]] uint64_t edgeCount() const { return _edgeCount; }
+    [[nodiscard]] uint64_t getNodeCount(LabelSetID labelset) const;
+
+    [[nodiscard]] const NodeCounts& nodeCounts() const { return _nodeCounts; }
+    [[nodiscard]] const EdgeCounts& edgeCounts() const { return _edgeCounts; }
+    [[nodiscard]] const DegreeHistograms& outDegrees() const { return _outDegrees; }
+    [[nodiscard]] const DegreeHistograms& inDegrees() const { return _inDegrees; }
+    [[nodiscard]] const PropertyStatisticsMap& nodeProperties() const { return _nodeProperties; }
+    [[nodiscard]] const PropertyStatisticsMap& edgeProperties() const { return _edgeProperties; }
+
+    [[nodiscard]] const PropertyStatistics* getNodeProperty(PropertyTypeID ptID) const;
+    [[nodiscard]] const PropertyStatistics* getEdgeProperty(PropertyTypeID ptID) const;
+
+    // Fraction of the nodes without the property
+    [[nodiscard]] double getNodePropertyNullFraction(PropertyTypeID ptID) const;
+
+    // Fraction of the edges without the property
+    [[nodiscard]] double getEdgePropertyNullFraction(PropertyTypeID ptID) const;
+
+    void serialize(std::vector<uint8_t>& out) const;
+    [[nodiscard]] bool deserialize(std::span<const uint8_t> data);
+
+private:
+    uint64_t _nodeCount {0};
+    uint64_t _edgeCount {0};
+    NodeCounts _nodeCounts;
+    EdgeCounts _edgeCounts;
+    DegreeHistograms _outDegrees;
+    DegreeHistograms _inDegrees;
+    PropertyStatisticsMap _nodeProperties;
+    PropertyStatisticsMap _edgeProperties;
+
+    static void addProperties(PropertyStatisticsMap& stats, const PropertyManager& properties);
+};
+
+}
@@ -0,0 +1,80 @@
+#pragma once
+
+#include <array>
+#include <bit>
+#include <cmath>
+#include <span>
+#include <stdint.h>
+
+namespace db {
+
+/**
+ * @brief Sketch estimating the number of distinct values of a set.
+ *
+ * @detail Uses 2^PRECISION registers of one byte, the standard error of the
+ * estimate is about 1.04 / sqrt(2^PRECISION). Sketches of two sets are merged
+ * into the sketch of their union.
+ */
+class HyperLogLog {
+public:
+    static constexpr uint8_t PRECISION = 10;
+    static constexpr size_t REGISTER_COUNT = size_t {1} << PRECISION;
+
+    // Values must be hashed with a good bit mixing, see @ref hash
+    void add(uint64_t hash) {
+        const size_t index = hash >> (64 - PRECISION);
+        const uint64_t rest = (hash << PRECISION) | (uint64_t {1} << (PRECISION - 1));
+        const uint8_t rank = std::countl_zero(rest) + 1;
+
+        if (rank > _registers[index]) {
+            _registers[index] = rank;
+        }
+    }
+
+    void merge(const HyperLogLog& other) {
+        for (size_t i = 0; i < REGISTER_COUNT; i++) {
+            if (other._registers[i] > _registers[i]) {
+                _registers[i] = other._registers[i];
+            }
+        }
+    }
+
+    [[nodiscard]] uint64_t estimate() const {
+        constexpr double m = REGISTER_COUNT;
+        constexpr double alpha = 0.7213 / (1.0 + 1.079 / m);
+
+        double sum = 0.0;
+        size_t zeroCount = 0;
+        for (const uint8_t reg : _registers) {
+            sum += std::ldexp(1.0, -reg);
+            zeroCount += reg == 0;
+        }
+
+        const double estimate = alpha * m * m / sum;
+
+        // Linear counting is more accurate on small sets
+        if (estimate <= 2.5 * m && zeroCount != 0) {
+            return std::llround(m * std::log(m / zeroCount));
+        }
+
+        return std::llround(estimate);
+    }
+
+    [[nodiscard]] std::span<const uint8_t> registers() const { return _registers; }
+    [[nodiscard]] std::span<uint8_t> registers() { return _registers; }
+
+    // Mixes the bits of @param value (splitmix64 finalizer)
+    [[nodiscard]] static uint64_t hash(uint64_t value) {
+        value ^= value >> 30;
+        value *= 0xbf58476d1ce4e5b9ull;
+        value ^= value >> 27;
+        value *= 0x94d049bb133111ebull;
+        value ^= value >> 31;
+        return value;
+    }
+
+private:
+    std::array<uint8_t, REGISTER_COUNT> _registers {};
+};
+
+}
@@ -17,11 +17,11 @@ Change::~Change() = default;
 Change::Change(VersionController* versionController, ChangeID id, CommitHash base)
     : _id(id),
     _versionController(versionController),
-    _base(versionController->openTransaction(base).commitData())
+    _base(versionController->openTransaction(base))
 {
     auto tip = CommitBuilder::prepare(*_versionController,
                                       this,
-                                      GraphView {*_base});
+                                      _base.viewGraph());
     _tip = tip.get();
     _commitOffsets.emplace(_tip->hash(), _commits.size());
     _commits.emplace_back(std::move(tip));
@@ -86,9 +86,10 @@ CommitResult<void> Change::commit(JobSystem& jobsystem) {
 CommitResult<void> Change::rebase([[maybe_unused]] JobSystem& jobsystem) {
     Profile profile {"Change::rebase"};
 
-    // Get the state of main at time of rebase
-    const WeakArc<const CommitData> currentMainHead =
-        _versionController->openTransaction().commitData();
+    // Get the state of main at time of rebase, including the submitted commits
+    // which are not durable yet
+    FrozenCommitTx currentMainTx = _versionController->openTipTransaction();
+    const WeakArc<const CommitData>& currentMainHead = currentMainTx.commitData();
     // CommitData of current head of main
     const CommitData* currentHeadCommitData = currentMainHead.get();
     // CommitHistory of current head of main
@@ -96,7 +97,7 @@ CommitResult<void> Change::rebase([[maybe_unused]] JobSystem& jobsystem) {
 
     // Read the graph as it was when this change was created
     const GraphReader branchTimeReader =
-        _base->commits().back().openTransaction().readGraph();
+        _base.commitData()->commits().back().openTransaction().readGraph();
     // Read the graph as it is now on main
     const GraphReader mainReader =
         currentMainHead->commits().back().openTransaction().readGraph();
@@ -120,13 +121,18 @@ CommitResult<void> Change::rebase([[maybe_unused]] JobSystem& jobsystem) {
     }
 
     // Update the base commit to be main
-    _base = currentMainHead;
+    _base = std::move(currentMainTx);
 
     return {};
 }
 
+CommitResult<void> Change::rebaseOnTip(JobSystem& jobsystem) {
+    auto lock = _versionController->lock();
+    return rebase(jobsystem);
+}
+
 CommitHash Change::baseHash() const {
-    return _base->hash();
+    return _base.commitData()->hash();
 }
 
 CommitResult<void> Change::submit(JobSystem& jobsystem) {
@@ -9,6 +9,7 @@
 #include "versioning/CommitResult.h"
 #include "versioning/ChangeID.h"
 #include "versioning/ChangeAccessor.h"
+#include "versioning/Transaction.h"
 #include "views/GraphView.h"
 
 namespace db {
@@ -18,7 +19,6 @@ class DataPartBuilder;
 class CommitBuilder;
 class Commit;
 class JobSystem;
-class FrozenCommitTx;
 class ChangeManager;
 class PendingCommitWriteTx;
 class PendingCommitReadTx;
@@ -53,7 +53,8 @@ private:
 
     ChangeID _id;
     VersionController* _versionController {nullptr};
-    WeakArc<const CommitData> _base;
+    // Keeps the dataparts of the base commit resident while the change is open
+    FrozenCommitTx _base;
 
     // Committed
     std::vector<std::unique_ptr<CommitBuilder>> _commits;
@@ -65,6 +66,8 @@ private:
 
     [[nodiscard]] CommitResult<void> commit(JobSystem& jobsystem);
     [[nodiscard]] CommitResult<void> rebase(JobSystem& jobsystem);
+    // Rebase outside of a submission, takes the lock of the version controller
+    [[nodiscard]] CommitResult<void> rebaseOnTip(JobSystem& jobsystem);
     [[nodiscard]] CommitResult<void> submit(JobSystem& jobsystem);
 
     [[nodiscard]] GraphView viewGraph(CommitHash commitHash) const;
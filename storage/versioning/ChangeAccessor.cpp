@@ -22,7 +22,7 @@ CommitResult<void> ChangeAccessor::commit(JobSystem& jobsystem) {
 }
 
 CommitResult<void> ChangeAccessor::rebase(JobSystem& jobsystem) {
-    return _change->rebase(jobsystem);
+    return _change->rebaseOnTip(jobsystem);
 }
 
 CommitResult<void> ChangeAccessor::submit(JobSystem& jobsystem) {
@@ -104,11 +104,11 @@ void ChangeRebaser::rebaseCommitBuilder(CommitBuilder& commitBuilder) {
     // Rebase the history, including any committed dataparts
     historyRebaser.rebase(_metadataRebaser, _dataPartRebaser, *_currentHeadHistory);
 
-    // If we have not yet flushed, we must rebase the write buffer prior to it being flushed
-    if (!commitBuilder.writeBuffer().isFlushed()) {
-        CommitWriteBufferRebaser wbRb(&_entityIDRebaser, commitBuilder.writeBuffer());
-        wbRb.rebase();
-    }
+    // If we have not yet flushed, we must rebase the write buffer prior to it being
+    // flushed. Flushed buffers are rebased as well, so that the write-ahead log
+    // records them with the IDs of main.
+    CommitWriteBufferRebaser wbRb(&_entityIDRebaser, commitBuilder.writeBuffer());
+    wbRb.rebase();
 
     _currentHeadCommitData = &commitBuilder.commitData();
     _currentHeadHistory = &_currentHeadCommitData->history();
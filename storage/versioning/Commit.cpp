@@ -1,5 +1,7 @@
 #include "Commit.h"
 
+#include "DataPartCache.h"
+#include "Graph.h"
 #include "VersionController.h"
 #include "Transaction.h"
 
@@ -22,7 +24,18 @@ bool Commit::isHead() const {
 }
 
 FrozenCommitTx Commit::openTransaction() const {
-    return FrozenCommitTx {_data};
+    const Graph* graph = _controller ? _controller->getGraph() : nullptr;
+    DataPartCache* cache = graph ? graph->getDataPartCache() : nullptr;
+    if (!cache) {
+        return FrozenCommitTx {_data};
+    }
+
+    auto pin = cache->pin(_data->allDataparts());
+    if (!pin) {
+        return FrozenCommitTx {}; // Could not load the dataparts
+    }
+
+    return FrozenCommitTx {_data, std::move(pin)};
 }
 
 CommitView Commit::view() const {
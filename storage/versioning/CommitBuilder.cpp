@@ -29,8 +29,15 @@ CommitBuilder::~CommitBuilder() {
 std::unique_ptr<CommitBuilder> CommitBuilder::prepare(VersionController& controller,
                                                       Change* change,
                                                       const GraphView& view) {
+    return prepare(controller, change, view, CommitHash::create());
+}
+
+std::unique_ptr<CommitBuilder> CommitBuilder::prepare(VersionController& controller,
+                                                      Change* change,
+                                                      const GraphView& view,
+                                                      CommitHash hash) {
     auto* ptr = new CommitBuilder {controller, change, view};
-    ptr->initialize();
+    ptr->initialize(hash);
     return std::unique_ptr<CommitBuilder> {ptr};
 }
 
@@ -123,7 +130,11 @@ void CommitBuilder::flushWriteBuffer([[maybe_unused]] JobSystem& jobsystem) {
         // We create a single datapart when flushing the buffer,
         // to ensure it is synced with the metadata provided when rebasing main
         DataPartBuilder& dpBuilder = newBuilder();
-        wb.buildPending(dpBuilder);
+
+        // The write-ahead log encodes the buffer when the change is submitted, so its
+        // properties must outlive the flush
+        wb.buildPending(dpBuilder, _controller->hasWriteAheadLog());
+        _writeBufferPartCount++;
     }
 
     wb.setFlushed();
@@ -136,7 +147,7 @@ CommitBuilder::CommitBuilder(VersionController& controller, Change* change, cons
 {
 }
 
-void CommitBuilder::initialize() {
+void CommitBuilder::initialize(CommitHash hash) {
     Profile profile {"CommitBuilder::initialize"};
 
     auto reader = _view.read();
@@ -154,7 +165,7 @@ void CommitBuilder::initialize() {
     const CommitView prevCommit = reader.commits().back();
 
     // Create new commit data
-    _commitData = _controller->createCommitData(CommitHash::create());
+    _commitData = _controller->createCommitData(hash);
     _commit = Commit::createNextCommit(_controller, _commitData, prevCommit);
 
     // Create metadata builder
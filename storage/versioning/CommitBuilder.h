@@ -34,6 +34,11 @@ public:
                                                                 Change* change,
                                                                 const GraphView& view);
 
+    [[nodiscard]] static std::unique_ptr<CommitBuilder> prepare(VersionController& controller,
+                                                                Change* change,
+                                                                const GraphView& view,
+                                                                CommitHash hash);
+
     [[nodiscard]] static std::unique_ptr<CommitBuilder> prepareMerge(VersionController& controller,
                                                                      Change* change,
                                                                      const GraphView& view);
@@ -70,6 +75,10 @@ public:
     bool isEmpty() const { return _datapartCount == 0; }
     size_t dpCount() const { return _datapartCount; }
 
+    // True if all the dataparts of this commit were built from its write buffer,
+    // meaning that the commit can be fully described by the write buffer content
+    bool isBuiltFromWriteBuffer() const { return _datapartCount == _writeBufferPartCount; }
+
 private:
     friend CommitWriteBuffer;
     friend VersionController;
@@ -94,12 +103,13 @@ private:
     std::unique_ptr<Commit> _commit;
 
     size_t _datapartCount {0};
+    size_t _writeBufferPartCount {0};
 
     std::vector<std::unique_ptr<DataPartBuilder>> _builders;
 
     explicit CommitBuilder(VersionController&, Change* change, const GraphView&);
 
-    void initialize();
+    void initialize(CommitHash hash);
     void initializeMerge();
 };
 }
@@ -1,4 +1,38 @@
 #include "CommitData.h"
 
+#include "DataPart.h"
+#include "statistics/GraphStatistics.h"
+
 using namespace db;
 
+std::shared_ptr<const GraphStatistics> CommitData::statistics() const {
+    std::scoped_lock lock {_statisticsMutex};
+
+    const DataPartSpan parts = allDataparts();
+    if (_statistics && _statisticsPartCount == parts.size()) {
+        return _statistics;
+    }
+
+    auto statistics = _statistics ? std::make_shared<GraphStatistics>(*_statistics)
+                                  : std::make_shared<GraphStatistics>();
+
+    // Dataparts of old dumps have no statistics until their content is loaded,
+    // the merge is not cached until all the dataparts have some
+    bool complete = true;
+    for (size_t i = _statisticsPartCount; i < parts.size(); i++) {
+        const GraphStatistics* partStatistics = parts[i]->statistics();
+        if (!partStatistics) {
+            complete = false;
+            continue;
+        }
+
+        statistics->merge(*partStatistics);
+    }
+
+    if (complete) {
+        _statistics = statistics;
+        _statisticsPartCount = parts.size();
+    }
+
+    return statistics;
+}
@@ -1,5 +1,8 @@
 #pragma once
 
+#include <memory>
+#include <mutex>
+
 #include "versioning/CommitHash.h"
 #include "versioning/CommitHistory.h"
 #include "metadata/GraphMetadata.h"
@@ -14,6 +17,7 @@ class GraphLoader;
 class VersionController;
 class Change;
 class ChangeRebaser;
+class GraphStatistics;
 
 class CommitData {
 public:
@@ -38,6 +42,13 @@ public:
     [[nodiscard]] CommitHash hash() const { return _hash; }
     [[nodiscard]] const Tombstones& tombstones() const { return _tombstones; }
 
+    /**
+     * @brief Returns the statistics of the dataparts of the commit.
+     * @detail Merged on first use and cached, only the dataparts added since
+     * the last call are merged again.
+     */
+    [[nodiscard]] std::shared_ptr<const GraphStatistics> statistics() const;
+
 private:
     friend CommitBuilder;
     friend CommitLoader;
@@ -51,6 +62,10 @@ private:
     CommitHistory _history;
     GraphMetadata _metadata;
     Tombstones _tombstones;
+
+    mutable std::mutex _statisticsMutex;
+    mutable std::shared_ptr<const GraphStatistics> _statistics;
+    mutable size_t _statisticsPartCount {0};
 };
 
 }
@@ -15,6 +15,7 @@ enum class CommitErrorType : uint8_t {
     CHANGE_NEEDS_REBASE,
     BUILD_DATAPART_FAILED,
     NO_PENDING_COMMIT,
+    WAL_WRITE_FAILED,
 
     _SIZE,
 };
@@ -26,7 +27,8 @@ using CommitErrorTypeDescription = EnumToString<CommitErrorType>::Create<
     EnumStringPair<CommitErrorType::COMMIT_NEEDS_REBASE, "Commit needs rebase">,
     EnumStringPair<CommitErrorType::CHANGE_NEEDS_REBASE, "Change needs rebase">,
     EnumStringPair<CommitErrorType::BUILD_DATAPART_FAILED, "Could not build datapart">,
-    EnumStringPair<CommitErrorType::NO_PENDING_COMMIT, "No pending commit">>;
+    EnumStringPair<CommitErrorType::NO_PENDING_COMMIT, "No pending commit">,
+    EnumStringPair<CommitErrorType::WAL_WRITE_FAILED, "Could not write commit to the write-ahead log">>;
 
 class CommitError {
 public:
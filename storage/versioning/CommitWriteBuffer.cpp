@@ -14,8 +14,55 @@
 #include "writers/DataPartBuilder.h"
 #include "Tombstones.h"
 
+#include "FatalException.h"
+
 using namespace db;
 
+namespace {
+
+template <SupportedType T, typename MapID>
+std::unique_ptr<PropertyContainer> copyTypedColumn(const PropertyContainer& column,
+                                                   MapID&& mapID) {
+    const TypedPropertyContainer<T>& typed = column.cast<T>();
+    auto copy = std::make_unique<TypedPropertyContainer<T>>();
+    copy->ids().reserve(typed.size());
+
+    for (size_t i = 0; i < typed.size(); i++) {
+        const EntityID id = mapID(typed.ids()[i]);
+        if (id.isValid()) {
+            copy->add(id, typed.get(i));
+        }
+    }
+
+    return copy;
+}
+
+// Copies the values of @param column, replacing each pending offset by the ID
+// returned by @param mapID. Values mapped to an invalid ID are dropped.
+template <typename MapID>
+std::unique_ptr<PropertyContainer> copyColumn(const PropertyContainer& column,
+                                              MapID&& mapID) {
+    switch (column.getValueType()) {
+        case ValueType::Int64:
+            return copyTypedColumn<types::Int64>(column, mapID);
+        case ValueType::UInt64:
+            return copyTypedColumn<types::UInt64>(column, mapID);
+        case ValueType::Double:
+            return copyTypedColumn<types::Double>(column, mapID);
+        case ValueType::String:
+            return copyTypedColumn<types::String>(column, mapID);
+        case ValueType::Bool:
+            return copyTypedColumn<types::Bool>(column, mapID);
+        case ValueType::Invalid:
+        case ValueType::_SIZE:
+            break;
+    }
+
+    throw FatalException("Pending property column with invalid type.");
+}
+
+}
+
 CommitWriteBuffer::CommitWriteBuffer(CommitJournal& journal)
     : _journal(journal)
 {
@@ -25,6 +72,14 @@ CommitWriteBuffer::PendingNode& CommitWriteBuffer::newPendingNode() {
     return _pendingNodes.emplace_back();
 }
 
+CommitWriteBuffer::PendingNodeOffset CommitWriteBuffer::newPendingNodes(
+    const LabelSetHandle& labelset,
+    size_t count) {
+    const PendingNodeOffset first = _pendingNodes.size();
+    _pendingNodes.resize(first + count, PendingNode {labelset});
+    return first;
+}
+
 CommitWriteBuffer::PendingEdge& CommitWriteBuffer::newPendingEdge(ExistingOrPendingNode src,
                                                                   ExistingOrPendingNode tgt) {
     auto& pendingEdge = _pendingEdges.emplace_back(); // Create an empty edge
@@ -84,53 +139,45 @@ void CommitWriteBuffer::addHangingEdges(const GraphView& view) {
     }
 }
 
-void CommitWriteBuffer::buildPendingNode(DataPartBuilder& builder,
-                                         const PendingNode& node) {
-    const NodeID nodeID = builder.addNode(node.labelsetHandle);
-
-    // Adding node properties
-    for (const auto& [id, value] : node.properties) {
-        std::visit(
-            [&](auto&& val) {
-                using T = std::decay_t<decltype(val)>;
-
-                if constexpr (std::is_same_v<T, types::Int64::Primitive>) {
-                    builder.addNodeProperty<types::Int64>(nodeID, id, val);
-                } else if constexpr (std::is_same_v<T, types::UInt64::Primitive>) {
-                    builder.addNodeProperty<types::UInt64>(nodeID, id, val);
-                } else if constexpr (std::is_same_v<T, types::Double::Primitive>) {
-                    builder.addNodeProperty<types::Double>(nodeID, id, val);
-                } else if constexpr (std::is_same_v<T, std::string>) {
-                    builder.addNodeProperty<types::String>(
-                        nodeID, id, std::forward<decltype(val)>(val));
-                } else if constexpr (std::is_same_v<T, types::Bool::Primitive>) {
-                    builder.addNodeProperty<types::Bool>(nodeID, id, val);
-                }
-            },
-            value);
+void CommitWriteBuffer::buildPendingNodes(DataPartBuilder& builder, bool keepProperties) {
+    for (const PendingNode& node : pendingNodes()) {
+        const NodeID nodeID = builder.addNode(node.labelsetHandle);
+        _journal.addWrittenNode(nodeID);
     }
 
-    _journal.addWrittenNode(nodeID);
-}
+    // WARN: PendingNodes are added to the builder in the order that they appear in the
+    // PendingNodes vector, so the node at offset i is given the ID firstNodeID + i
+    const EntityID firstNodeID = builder.firstNodeID().getValue();
+
+    for (auto& [ptID, column] : _pendingNodeProperties) {
+        if (keepProperties) {
+            auto copy = copyColumn(*column, [&](EntityID offset) {
+                return offset + firstNodeID;
+            });
 
-void CommitWriteBuffer::buildPendingNodes(DataPartBuilder& builder) {
-    for (const auto& node : pendingNodes()) {
-        buildPendingNode(builder, node);
+            builder.addNodePropertyColumn(ptID, std::move(copy));
+        } else {
+            for (EntityID& id : column->ids()) {
+                id += firstNodeID;
+            }
+
+            builder.addNodePropertyColumn(ptID, std::move(column));
+        }
     }
 }
 
-void CommitWriteBuffer::buildPendingEdge(DataPartBuilder& builder,
-                                         const PendingEdge& edge) {
+EdgeID CommitWriteBuffer::buildPendingEdge(DataPartBuilder& builder,
+                                           const PendingEdge& edge) {
     // If this edge has source or target which is a node in a previous datapart, check
     // if it has been deleted.
     if (const NodeID* srcID = std::get_if<NodeID>(&edge.src)) {
         if (deletedNodes().contains(*srcID)) {
-            return;
+            return EdgeID {};
         }
     }
     if (const NodeID* tgtID = std::get_if<NodeID>(&edge.tgt)) {
         if (deletedNodes().contains(*tgtID)) {
-            return;
+            return EdgeID {};
         }
     }
 
@@ -151,47 +198,57 @@ void CommitWriteBuffer::buildPendingEdge(DataPartBuilder& builder,
             ? std::get<NodeID>(edge.tgt)
             : NodeID { std::get<CommitWriteBuffer::PendingNodeOffset>(edge.tgt) } + builder.firstNodeID();
 
-    EdgeTypeID edgeTypeID = edge.edgeType;
-    const EdgeRecord newEdgeRecord = builder.addEdge(edgeTypeID, srcID, tgtID);
-
+    const EdgeRecord& newEdgeRecord = builder.addEdge(edge.edgeType, srcID, tgtID);
     const EdgeID newEdgeID = newEdgeRecord._edgeID;
 
-    for (const auto& [id, value] : edge.properties) {
-        std::visit(
-            [&](const auto& val) {
-                using T = std::decay_t<decltype(val)>;
-                if constexpr (std::is_same_v<T, types::Int64::Primitive>) {
-                    builder.addEdgeProperty<types::Int64>(
-                        {newEdgeID, srcID, tgtID, edgeTypeID}, id, val);
-                } else if constexpr (std::is_same_v<T, types::UInt64::Primitive>) {
-                    builder.addEdgeProperty<types::UInt64>(
-                        {newEdgeID, srcID, tgtID, edgeTypeID}, id, val);
-                } else if constexpr (std::is_same_v<T, types::Double::Primitive>) {
-                    builder.addEdgeProperty<types::Double>(
-                        {newEdgeID, srcID, tgtID, edgeTypeID}, id, val);
-                } else if constexpr (std::is_same_v<T, std::string>) {
-                    builder.addEdgeProperty<types::String>(
-                        {newEdgeID, srcID, tgtID, edgeTypeID}, id, val);
-                } else if constexpr (std::is_same_v<T, types::Bool::Primitive>) {
-                    builder.addEdgeProperty<types::Bool>(
-                        {newEdgeID, srcID, tgtID, edgeTypeID}, id, val);
-                }
-            },
-            value);
-    }
-
     _journal.addWrittenEdge(newEdgeID);
+
+    return newEdgeID;
 }
 
-void CommitWriteBuffer::buildPendingEdges(DataPartBuilder& builder) {
+void CommitWriteBuffer::buildPendingEdges(DataPartBuilder& builder, bool keepProperties) {
+    // ID of the edge created for each pending edge, invalid if the edge was dropped
+    std::vector<EdgeID> edgeIDs;
+    edgeIDs.reserve(_pendingEdges.size());
+
+    bool droppedEdges = false;
     for (const PendingEdge& edge : pendingEdges()) {
-        buildPendingEdge(builder, edge);
+        const EdgeID edgeID = buildPendingEdge(builder, edge);
+        droppedEdges |= !edgeID.isValid();
+        edgeIDs.push_back(edgeID);
+    }
+
+    const EntityID firstEdgeID = builder.firstEdgeID().getValue();
+
+    for (auto& [ptID, column] : _pendingEdgeProperties) {
+        if (keepProperties || droppedEdges) {
+            // Dropped edges shift the IDs of the following ones, so the columns are
+            // filtered through the IDs of the created edges
+            auto copy = copyColumn(*column, [&](EntityID offset) {
+                return EntityID {edgeIDs[offset.getValue()].getValue()};
+            });
+
+            builder.addEdgePropertyColumn(ptID, std::move(copy));
+        } else {
+            for (EntityID& id : column->ids()) {
+                id += firstEdgeID;
+            }
+
+            builder.addEdgePropertyColumn(ptID, std::move(column));
+        }
     }
 }
 
-void CommitWriteBuffer::buildPending(DataPartBuilder& builder) {
-    buildPendingNodes(builder);
-    buildPendingEdges(builder);
+void CommitWriteBuffer::buildPending(DataPartBuilder& builder, bool keepProperties) {
+    buildPendingNodes(builder, keepProperties);
+    buildPendingEdges(builder, keepProperties);
+
+    if (!keepProperties) {
+        _releasedProperties = !_pendingNodeProperties.empty()
+                           || !_pendingEdgeProperties.empty();
+        _pendingNodeProperties.clear();
+        _pendingEdgeProperties.clear();
+    }
 }
 
 void CommitWriteBuffer::applyDeletions(Tombstones& tombstones) {
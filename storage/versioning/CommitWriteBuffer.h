@@ -1,11 +1,16 @@
 #pragma once
 
+#include <memory>
+#include <unordered_map>
 #include <unordered_set>
 #include <variant>
 #include <vector>
 
 #include "DataPart.h"
 #include "ID.h"
+#include "properties/PropertyContainer.h"
+
+#include "BioAssert.h"
 
 namespace db {
 
@@ -22,30 +27,18 @@ class CommitWriteBuffer {
 public:
     CommitWriteBuffer(CommitJournal& journal);
 
-    using SupportedTypeVariant =
-        std::variant<types::Int64::Primitive, types::UInt64::Primitive,
-                     types::Double::Primitive, std::string,
-                     types::Bool::Primitive>;
-
-     struct UntypedProperty {
-        PropertyTypeID propertyID;
-        SupportedTypeVariant value;
-     };
-
-     using UntypedProperties = std::vector<UntypedProperty>;
      using PendingNodeOffset = size_t;
+     using PendingEdgeOffset = size_t;
      using ExistingOrPendingNode = std::variant<NodeID, PendingNodeOffset>;
 
      struct PendingNode {
          LabelSetHandle labelsetHandle;
-         UntypedProperties properties;
      };
 
      struct PendingEdge {
          ExistingOrPendingNode src;
          ExistingOrPendingNode tgt;
          EdgeTypeID edgeType;
-         UntypedProperties properties;
     };
 
      // A node: either exists in previous commit (materialised as NodeID),
@@ -55,12 +48,81 @@ public:
      using DeletedNodes = std::unordered_set<NodeID>;
      using DeletedEdges = std::unordered_set<EdgeID>;
 
+     // Properties of pending entities, stored as one typed column per property type.
+     // The IDs of each column are offsets in @ref _pendingNodes or @ref _pendingEdges
+     using PendingProperties = std::unordered_map<PropertyTypeID,
+                                                  std::unique_ptr<PropertyContainer>>;
+
      /**
       * @brief Adds a pending node to this WriteBuffer with empty properties and
       * labels.
       */
      PendingNode& newPendingNode();
 
+     /**
+      * @brief Adds @param count pending nodes with the labelset @param labelset.
+      * Returns the offset of the first added node.
+      */
+     PendingNodeOffset newPendingNodes(const LabelSetHandle& labelset, size_t count);
+
+     /**
+      * @brief Returns the column holding the values of the property type @param ptID
+      * of pending nodes, creating it if this is the first value of this type.
+      */
+     template <SupportedType T>
+     TypedPropertyContainer<T>& getOrCreateNodePropertyColumn(PropertyTypeID ptID) {
+         return getOrCreatePropertyColumn<T>(_pendingNodeProperties, ptID);
+     }
+
+     /**
+      * @brief Returns the column holding the values of the property type @param ptID
+      * of pending edges, creating it if this is the first value of this type.
+      */
+     template <SupportedType T>
+     TypedPropertyContainer<T>& getOrCreateEdgePropertyColumn(PropertyTypeID ptID) {
+         return getOrCreatePropertyColumn<T>(_pendingEdgeProperties, ptID);
+     }
+
+     /**
+      * @brief Moves @param container in as the column of the property type @param ptID
+      * of pending nodes, replacing any previous column for this type.
+      */
+     void setNodePropertyColumn(PropertyTypeID ptID,
+                                std::unique_ptr<PropertyContainer> container) {
+         _pendingNodeProperties[ptID] = std::move(container);
+     }
+
+     /**
+      * @brief Moves @param container in as the column of the property type @param ptID
+      * of pending edges, replacing any previous column for this type.
+      */
+     void setEdgePropertyColumn(PropertyTypeID ptID,
+                                std::unique_ptr<PropertyContainer> container) {
+         _pendingEdgeProperties[ptID] = std::move(container);
+     }
+
+     /**
+      * @brief Adds the value @param value of the property type @param ptID to the
+      * pending node at offset @param node.
+      */
+     template <SupportedType T>
+     void addPendingNodeProperty(PendingNodeOffset node,
+                                 PropertyTypeID ptID,
+                                 T::Primitive value) {
+         getOrCreateNodePropertyColumn<T>(ptID).add(node, std::move(value));
+     }
+
+     /**
+      * @brief Adds the value @param value of the property type @param ptID to the
+      * pending edge at offset @param edge.
+      */
+     template <SupportedType T>
+     void addPendingEdgeProperty(PendingEdgeOffset edge,
+                                 PropertyTypeID ptID,
+                                 T::Primitive value) {
+         getOrCreateEdgePropertyColumn<T>(ptID).add(edge, std::move(value));
+     }
+
      /**
       * @brief Adds a pending edge to this WriteBuffer with provided source and target
       * nodes and empty properties and labels.
@@ -71,8 +133,17 @@ public:
       * @brief Adds the pending nodes and edges to the provided datapart builder, as well
       * as registering all newly created nodes/edges in the associated @ref WriteSet of
       * @ref _journal
+      * @detail Property columns are moved into the builder, unless @param keepProperties
+      * is set, in which case they are copied so that the buffer can still be read.
+      */
+     void buildPending(DataPartBuilder& builder, bool keepProperties = false);
+
+     /**
+      * @brief Whether the property columns of this buffer were moved to a datapart
+      * builder, in which case @ref pendingNodeProperties and @ref pendingEdgeProperties
+      * are empty.
       */
-     void buildPending(DataPartBuilder& builder);
+     bool hasReleasedProperties() const { return _releasedProperties; }
 
      size_t numPendingNodes() const { return _pendingNodes.size(); }
      size_t numPendingEdges() const { return _pendingEdges.size(); }
@@ -86,6 +157,14 @@ public:
      const PendingNodes& pendingNodes() const { return _pendingNodes; }
      const PendingEdges& pendingEdges() const { return _pendingEdges; }
 
+     const PendingProperties& pendingNodeProperties() const {
+         return _pendingNodeProperties;
+     }
+
+     const PendingProperties& pendingEdgeProperties() const {
+         return _pendingEdgeProperties;
+     }
+
      const DeletedNodes& deletedNodes() const { return _deletedNodes; }
      const DeletedEdges& deletedEdges() const { return _deletedEdges; }
 
@@ -141,6 +220,7 @@ private:
     friend MetadataRebaser;
 
     bool _flushed {false};
+    bool _releasedProperties {false};
 
     CommitJournal& _journal;
 
@@ -150,6 +230,10 @@ private:
     // Edges to be created when this commit commits
     std::vector<PendingEdge> _pendingEdges;
 
+    // Properties of the nodes and edges to be created
+    PendingProperties _pendingNodeProperties;
+    PendingProperties _pendingEdgeProperties;
+
     // Nodes to be deleted when this commit commits
     std::unordered_set<NodeID> _deletedNodes;
 
@@ -158,13 +242,32 @@ private:
 
     PendingNodes& pendingNodes() { return _pendingNodes; }
     PendingEdges& pendingEdges() { return _pendingEdges; }
+    PendingProperties& pendingNodeProperties() { return _pendingNodeProperties; }
+    PendingProperties& pendingEdgeProperties() { return _pendingEdgeProperties; }
+
+    template <SupportedType T>
+    static TypedPropertyContainer<T>& getOrCreatePropertyColumn(PendingProperties& props,
+                                                                PropertyTypeID ptID) {
+        std::unique_ptr<PropertyContainer>& container = props[ptID];
+        if (!container) {
+            container = std::make_unique<TypedPropertyContainer<T>>();
+        }
+
+        bioassert(container->getValueType() == T::_valueType,
+                  "Property column has a different value type");
+
+        return container->cast<T>();
+    }
 
     // Collection of methods to write the buffer to the provided datapart builder
-    void buildPendingNodes(DataPartBuilder& builder);
-    void buildPendingEdges(DataPartBuilder& builder);
+    void buildPendingNodes(DataPartBuilder& builder, bool keepProperties);
+    void buildPendingEdges(DataPartBuilder& builder, bool keepProperties);
 
-    void buildPendingNode(DataPartBuilder& builder, const PendingNode& node);
-    void buildPendingEdge(DataPartBuilder& builder, const PendingEdge& edge);
+    /**
+     * @brief Adds @param edge to @param builder, returns an invalid ID if the edge
+     * is dropped because its source or target is deleted.
+     */
+    EdgeID buildPendingEdge(DataPartBuilder& builder, const PendingEdge& edge);
 };
 
 class CommitWriteBufferRebaser {
@@ -9,6 +9,7 @@
 #include "properties/PropertyContainer.h"
 #include "properties/PropertyManager.h"
 #include "indexers/PropertyIndexer.h"
+#include "statistics/GraphStatistics.h"
 
 #include "Profiler.h"
 #include "BioAssert.h"
@@ -271,5 +272,9 @@ bool DataPartRebaser::rebase(const MetadataRebaser& metadata,
         }
     }
 
+    if (part._statistics) {
+        part._statistics->rebase(metadata);
+    }
+
     return true;
 }
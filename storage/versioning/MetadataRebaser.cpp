@@ -123,21 +123,27 @@ bool MetadataRebaser::rebase(const GraphMetadata& theirs,
             }
         }
         node.labelsetHandle = newLabelsets.getOrCreate(newLabelset);
-
-        for (auto& [id, value] : node.properties) {
-             id = _propTypeMapping[id]._id;
-        }
     }
 
     // Rebase WriteBuffer edge metadata
     auto& pendingEdges = cwb.pendingEdges();
     for (auto&& edge : pendingEdges) {
         edge.edgeType = _edgeTypeMapping[edge.edgeType]; // EdgeTypes remapped
-        for (auto& [id, value] : edge.properties) {
-            id = _propTypeMapping[id]._id; // PropertyTypeIDs remapped
-        }
     }
 
+    // Property columns of the WriteBuffer are keyed by PropertyTypeID, remap the keys
+    const auto rebaseProperties = [&](CommitWriteBuffer::PendingProperties& props) {
+        CommitWriteBuffer::PendingProperties rebased;
+        rebased.reserve(props.size());
+        for (auto& [id, column] : props) {
+            rebased.emplace(_propTypeMapping[id]._id, std::move(column));
+        }
+        props.swap(rebased);
+    };
+
+    rebaseProperties(cwb.pendingNodeProperties());
+    rebaseProperties(cwb.pendingEdgeProperties());
+
     ours._metadata->_labelMap = std::move(newLabels);
     ours._metadata->_labelsetMap = std::move(newLabelsets);
     ours._metadata->_edgeTypeMap = std::move(newEdgeTypes);
@@ -1,5 +1,6 @@
 #include "Transaction.h"
 
+#include "DataPartCache.h"
 #include "views/GraphView.h"
 #include "reader/GraphReader.h"
 #include "versioning/CommitBuilder.h"
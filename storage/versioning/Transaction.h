@@ -1,5 +1,6 @@
 #pragma once
 
+#include <memory>
 #include <variant>
 
 #include "ArcManager.h"
@@ -13,6 +14,7 @@ class GraphReader;
 class VersionController;
 class CommitBuilder;
 class DataPartBuilder;
+class DataPartPin;
 
 class FrozenCommitTx {
 public:
@@ -24,6 +26,15 @@ public:
     {
     }
 
+    // The pin keeps the dataparts of the commit resident for the lifetime
+    // of the transaction and of its copies
+    FrozenCommitTx(const WeakArc<const CommitData>& data,
+                   std::shared_ptr<const DataPartPin>&& pin)
+        : _data(data),
+        _pin(std::move(pin))
+    {
+    }
+
     FrozenCommitTx(const FrozenCommitTx&) = default;
     FrozenCommitTx(FrozenCommitTx&&) = default;
     FrozenCommitTx& operator=(const FrozenCommitTx&) = default;
@@ -37,6 +48,9 @@ public:
 
 private:
     WeakArc<const CommitData> _data;
+
+    // Released before the commit data
+    std::shared_ptr<const DataPartPin> _pin;
 };
 
 class PendingCommitReadTx {
@@ -1,6 +1,7 @@
 #include "VersionController.h"
 
 #include <range/v3/view/enumerate.hpp>
+#include <spdlog/spdlog.h>
 
 #include "JobSystem.h"
 #include "Graph.h"
@@ -13,6 +14,8 @@
 #include "versioning/DataPartRebaser.h"
 #include "versioning/Transaction.h"
 #include "CommitJournal.h"
+#include "wal/WALRecord.h"
+#include "wal/WriteAheadLog.h"
 
 #include "Profiler.h"
 #include "BioAssert.h"
@@ -44,8 +47,20 @@ void VersionController::createFirstCommit() {
 
 DataPartMergeResult<void> VersionController::mergeDataParts(JobSystem& jobSystem) {
     Profile profile {"VersionController::mergeDataParts"};
+    const auto t0 = Clock::now();
+
+    // The merge replaces the head, the submitted commits must be published first
+    std::unique_lock lock(_mutex);
+    _publishCond.wait(lock, [&] { return _publishedCount == _commits.size(); });
+
     Commit* mainState = _head.load();
 
+    // Loads the dataparts to merge if the graph is loaded lazily
+    const FrozenCommitTx mainTx = mainState->openTransaction();
+    if (!mainTx.isValid()) {
+        return DataPartMergeError::result(DataPartMergeErrorType::MERGE_GRAPH_FAILED);
+    }
+
     auto newTip = CommitBuilder::prepareMerge(*this,
                                               nullptr,
                                               GraphView {mainState->data()});
@@ -59,7 +74,12 @@ DataPartMergeResult<void> VersionController::mergeDataParts(JobSystem& jobSystem
         return DataPartMergeError::result(DataPartMergeErrorType::MERGE_GRAPH_FAILED);
     }
 
+    if (_wal) {
+        _unloggedCommitCount.fetch_add(1);
+    }
+
     addCommit(std::move(buildRes.value()));
+    _mergeDurations.record(Clock::now() - t0);
 
     return {};
 }
@@ -72,8 +92,8 @@ FrozenCommitTx VersionController::openTransaction(CommitHash hash) const {
     std::scoped_lock lock {_mutex};
 
     auto it = _offsets.find(hash);
-    if (it == _offsets.end()) {
-        return FrozenCommitTx {}; // Invalid hash
+    if (it == _offsets.end() || it->second >= _publishedCount) {
+        return FrozenCommitTx {}; // Invalid or not yet durable hash
     }
 
     return _commits[it->second]->openTransaction();
@@ -90,19 +110,40 @@ CommitHash VersionController::getHeadHash() const {
 
 CommitResult<void> VersionController::submitChange(Change* change, JobSystem& jobSystem) {
     Profile profile {"VersionController::submitChange"};
+    const auto t0 = Clock::now();
 
-    std::scoped_lock lock(_mutex);
+    std::unique_lock lock(_mutex);
 
-    // atomic load main
-    Commit* mainState = _head.load();
+    // The base of the change was discarded after a failed sync of the log
+    if (getCommitIndex(change->baseHash()) == -1) {
+        return CommitError::result(CommitErrorType::COMMIT_HASH_NOT_EXISTS);
+    }
+
+    // Submissions build on the commits which are not durable yet
+    const Commit* tip = _commits.back().get();
 
     // rebase if main has changed under us
-    if (mainState->hash() != change->baseHash()) {
+    if (tip->hash() != change->baseHash()) {
         if (auto res = change->rebase(jobSystem); !res) {
             return res;
         }
     }
 
+    WriteAheadLog* wal = _wal.load();
+    const uint64_t startLSN = wal ? wal->getWrittenLSN() : 0;
+    uint64_t walLSN = 0;
+
+    std::vector<std::unique_ptr<Commit>> newCommits;
+    newCommits.reserve(change->_commits.size());
+
+    // NOTE: Called within locked-context
+    const auto discardRecords = [&] {
+        if (auto res = wal->truncate(startLSN); !res) {
+            spdlog::error("Could not discard the WAL records of a failed submission: {}",
+                          res.error().fmtMessage());
+        }
+    };
+
     for (auto& commitBuilder : change->_commits) {
         // If this Change has modifications which were not applied by a "COMMIT" command,
         // then flush them now
@@ -112,15 +153,79 @@ CommitResult<void> VersionController::submitChange(Change* change, JobSystem& jo
 
         auto buildRes = commitBuilder->build(jobSystem);
         if (!buildRes) {
+            if (walLSN != 0) {
+                discardRecords();
+            }
             return buildRes.get_unexpected();
         }
 
-        auto& newCommit = buildRes.value();
+        if (wal) {
+            const Commit& parent = newCommits.empty() ? *tip : *newCommits.back();
+            if (auto res = logCommit(*commitBuilder, parent, walLSN); !res) {
+                if (walLSN != 0) {
+                    discardRecords();
+                }
+                return res;
+            }
+        }
 
-        addCommit(std::move(newCommit));
+        newCommits.push_back(std::move(buildRes.value()));
     }
 
-    return {};
+    // The commits are the base of the next submissions from now on,
+    // but stay hidden from readers until they are published
+    const uint64_t seq = _nextSubmitSeq++;
+    const size_t firstIndex = _commits.size();
+    for (auto& newCommit : newCommits) {
+        _offsets.emplace(newCommit->hash(), _commits.size());
+        _commits.emplace_back(std::move(newCommit));
+    }
+    const size_t endIndex = _commits.size();
+
+    // The lock is released while syncing, so that the submissions appending
+    // records meanwhile are made durable by the same sync
+    DumpResult<void> syncRes;
+    if (walLSN != 0) {
+        lock.unlock();
+        syncRes = wal->waitDurable(walLSN);
+        lock.lock();
+    }
+
+    // Publish in the order of the records
+    _publishCond.wait(lock, [&] { return _publishSeq == seq; });
+
+    CommitResult<void> res;
+    if (seq < _discardedSeqEnd) {
+        // Built on commits discarded by a previous submission
+        res = CommitError::result(CommitErrorType::WAL_WRITE_FAILED);
+    } else if (!syncRes) {
+        // The submissions after this one are built on its commits, and their
+        // records follow its records, they are discarded as well
+        spdlog::error(syncRes.error().fmtMessage());
+        discardRecords();
+        discardCommitsFrom(firstIndex);
+        _discardedSeqEnd = _nextSubmitSeq;
+        res = CommitError::result(CommitErrorType::WAL_WRITE_FAILED);
+    } else if (endIndex > firstIndex) {
+        _publishedCount = endIndex;
+        _head.store(_commits[endIndex - 1].get());
+    }
+
+    _publishSeq++;
+    lock.unlock();
+    _publishCond.notify_all();
+
+    if (res) {
+        _commitDurations.record(Clock::now() - t0);
+    }
+
+    return res;
+}
+
+void VersionController::waitSubmittedCommits() {
+    std::unique_lock lock(_mutex);
+    const uint64_t seq = _nextSubmitSeq;
+    _publishCond.wait(lock, [&] { return _publishSeq >= seq; });
 }
 
 std::unique_ptr<Change> VersionController::newChange(CommitHash base) {
@@ -136,9 +241,52 @@ void VersionController::addCommit(std::unique_ptr<Commit> commit) {
 
     _offsets.emplace(commit->hash(), _commits.size());
     _commits.emplace_back(std::move(commit));
+    _publishedCount = _commits.size();
     _head.store(ptr);
 }
 
+// NOTE: Called within locked-context
+FrozenCommitTx VersionController::openTipTransaction() const {
+    return _commits.back()->openTransaction();
+}
+
+// NOTE: Called within locked-context
+void VersionController::discardCommitsFrom(size_t index) {
+    for (size_t i = index; i < _commits.size(); i++) {
+        _offsets.erase(_commits[i]->hash());
+        _discardedCommits.emplace_back(std::move(_commits[i]));
+    }
+
+    _commits.resize(index);
+}
+
+// NOTE: Called within locked-context, before the commit is added
+CommitResult<void> VersionController::logCommit(CommitBuilder& builder,
+                                                const Commit& parent,
+                                                uint64_t& lsn) {
+    // The log only holds write buffers, commits with other dataparts can only be
+    // persisted by a dump. So are write buffers which released their properties
+    // when flushed before logging was enabled
+    if (!builder.isBuiltFromWriteBuffer()
+        || builder.writeBuffer().hasReleasedProperties()) {
+        _unloggedCommitCount.fetch_add(1);
+        return {};
+    }
+
+    std::string record;
+    WALRecord::encode(builder, parent.hash(), parent.data().metadata(), record);
+
+    auto res = _wal.load()->append(record);
+    if (!res) {
+        spdlog::error(res.error().fmtMessage());
+        return CommitError::result(CommitErrorType::WAL_WRITE_FAILED);
+    }
+
+    lsn = res.value();
+
+    return {};
+}
+
 ssize_t VersionController::getCommitIndex(CommitHash hash) const {
     auto it = _offsets.find(hash);
 
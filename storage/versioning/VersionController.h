@@ -4,10 +4,12 @@
 #include <memory>
 #include <mutex>
 #include <atomic>
+#include <condition_variable>
 #include <ArcManager.h>
 
 #include "ID.h"
 #include "Profiler.h"
+#include "DurationHistogram.h"
 #include "versioning/Change.h"
 #include "versioning/CommitResult.h"
 #include "mergers/DataPartMergeResult.h"
@@ -23,6 +25,9 @@ class GraphLoader;
 class GraphDumper;
 class JobSystem;
 class FrozenCommitTx;
+class WriteAheadLog;
+class WALReplayer;
+class CommitBuilder;
 
 struct EntityIDPair {
     NodeID _nodeID;
@@ -51,6 +56,31 @@ public:
 
     ssize_t getCommitIndex(CommitHash hash) const;
 
+    /**
+     * @brief Logs the commits submitted from now on in @param wal.
+     * Passing nullptr disables logging.
+     */
+    void setWriteAheadLog(WriteAheadLog* wal) { _wal.store(wal); }
+
+    bool hasWriteAheadLog() const { return _wal.load() != nullptr; }
+
+    /**
+     * @brief Number of commits that were added while logging was enabled, but
+     * could not be written to the write-ahead log (merges and commits with
+     * dataparts built outside of the write buffer). These must be dumped.
+     */
+    uint64_t getUnloggedCommitCount() const { return _unloggedCommitCount.load(); }
+
+    /**
+     * @brief Waits until the submissions whose records were written to the
+     * write-ahead log so far are published, or discarded if the log failed to sync.
+     */
+    void waitSubmittedCommits();
+
+    // Durations of the successful commits to main and datapart merges
+    const DurationHistogram& getCommitDurations() const { return _commitDurations; }
+    const DurationHistogram& getMergeDurations() const { return _mergeDurations; }
+
     WeakArc<CommitData> createCommitData(CommitHash hash) {
         Profile profile("VersionController::createCommitData");
         return _dataManager->create(hash);
@@ -66,6 +96,7 @@ private:
     friend GraphDumper;
     friend Change;
     friend Graph;
+    friend WALReplayer;
 
     Graph* _graph {nullptr};
 
@@ -75,13 +106,47 @@ private:
     mutable std::mutex _mutex;
     Commit::CommitVector _commits;
     CommitMap _offsets;
+
+    // Group commit: the commits of a submission are added to @ref _commits once
+    // their records are written to the log, so that the next submissions build on
+    // them, but they are only published (visible to readers, dumped) once their
+    // records are durable. Submissions are published in the order of their
+    // records, the first _publishedCount commits are published.
+    std::condition_variable _publishCond;
+    size_t _publishedCount {0};
+    uint64_t _nextSubmitSeq {0};
+    uint64_t _publishSeq {0};
+    // Submissions before this one were discarded after a failed sync of the log
+    uint64_t _discardedSeqEnd {0};
+    // Discarded commits, changes rebased on them can still read their base
+    Commit::CommitVector _discardedCommits;
     std::unique_ptr<ArcManager<CommitData>> _dataManager;
     std::unique_ptr<ArcManager<DataPart>> _partManager;
 
+    std::atomic<WriteAheadLog*> _wal {nullptr};
+    std::atomic<uint64_t> _unloggedCommitCount {0};
+
+    DurationHistogram _commitDurations;
+    DurationHistogram _mergeDurations;
+
     std::unique_lock<std::mutex> lock();
 
     void addCommit(std::unique_ptr<Commit> commit);
 
+    // The head, or the last commit waiting for its records to be durable
+    [[nodiscard]] FrozenCommitTx openTipTransaction() const;
+
+    [[nodiscard]] Commit::CommitSpan getPublishedCommits() const {
+        return {_commits.data(), _publishedCount};
+    }
+
+    void discardCommitsFrom(size_t index);
+
+    // @param parent is the previous commit of the same change, or the head
+    [[nodiscard]] CommitResult<void> logCommit(CommitBuilder& builder,
+                                               const Commit& parent,
+                                               uint64_t& lsn);
+
     [[nodiscard]] CommitResult<void> submitChange(Change* change, JobSystem&);
 
     [[nodiscard]] Commit::CommitSpan getCommitsSinceCommitHash(CommitHash from) const;
@@ -25,6 +25,7 @@ public:
     [[nodiscard]] DataPartSpan commitDataparts() const { return _data->commitDataparts(); }
     [[nodiscard]] const Tombstones& tombstones() const { return _data->tombstones(); }
     [[nodiscard]] const GraphMetadata& metadata() const { return _data->metadata(); }
+    [[nodiscard]] std::shared_ptr<const GraphStatistics> statistics() const { return _data->statistics(); }
 
 private:
     friend GraphReader;
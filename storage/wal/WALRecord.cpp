@@ -0,0 +1,341 @@
+#include "WALRecord.h"
+
+#include <string.h>
+#include <algorithm>
+#include <array>
+#include <memory>
+#include <ranges>
+#include <type_traits>
+
+#include "metadata/GraphMetadata.h"
+#include "versioning/CommitBuilder.h"
+
+using namespace db;
+
+namespace {
+
+class RecordEncoder {
+public:
+    explicit RecordEncoder(std::string& out)
+        : _out(out)
+    {
+    }
+
+    template <typename T>
+        requires std::is_trivially_copyable_v<T>
+    void write(const T& value) {
+        _out.append(reinterpret_cast<const char*>(&value), sizeof(T));
+    }
+
+    void write(std::string_view str) {
+        write((uint64_t)str.size());
+        _out.append(str);
+    }
+
+    void writeColumns(const CommitWriteBuffer::PendingProperties& columns) {
+        write((uint64_t)columns.size());
+        for (const auto& [ptID, column] : columns) {
+            write(ptID.getValue());
+            write(column->getValueType());
+            write((uint64_t)column->size());
+
+            for (const EntityID id : column->ids()) {
+                write(id.getValue());
+            }
+
+            switch (column->getValueType()) {
+                case ValueType::Int64: writeValues(column->cast<types::Int64>()); break;
+                case ValueType::UInt64: writeValues(column->cast<types::UInt64>()); break;
+                case ValueType::Double: writeValues(column->cast<types::Double>()); break;
+                case ValueType::String: writeValues(column->cast<types::String>()); break;
+                case ValueType::Bool: writeValues(column->cast<types::Bool>()); break;
+                case ValueType::Invalid:
+                case ValueType::_SIZE: break;
+            }
+        }
+    }
+
+    void writeNode(const CommitWriteBuffer::ExistingOrPendingNode& node) {
+        write((uint8_t)node.index());
+        std::visit([this](const auto& v) { write((uint64_t)getRawValue(v)); }, node);
+    }
+
+private:
+    std::string& _out;
+
+    template <SupportedType T>
+    void writeValues(const TypedPropertyContainer<T>& column) {
+        for (const auto& value : column.all()) {
+            write(value);
+        }
+    }
+
+    static uint64_t getRawValue(NodeID id) { return id.getValue(); }
+    static uint64_t getRawValue(CommitWriteBuffer::PendingNodeOffset offset) {
+        return offset;
+    }
+};
+
+class RecordDecoder {
+public:
+    explicit RecordDecoder(std::string_view data)
+        : _data(data)
+    {
+    }
+
+    bool valid() const { return _valid; }
+    bool consumed() const { return _offset == _data.size(); }
+
+    template <typename T>
+        requires std::is_trivially_copyable_v<T>
+    T read() {
+        T value {};
+        if (_offset + sizeof(T) > _data.size()) {
+            _valid = false;
+            return value;
+        }
+
+        memcpy(&value, _data.data() + _offset, sizeof(T));
+        _offset += sizeof(T);
+        return value;
+    }
+
+    std::string readString() {
+        const uint64_t size = read<uint64_t>();
+        if (!_valid || _offset + size > _data.size()) {
+            _valid = false;
+            return {};
+        }
+
+        std::string str {reinterpret_cast<const char*>(_data.data() + _offset), size};
+        _offset += size;
+        return str;
+    }
+
+    // Counts are bounded by the remaining bytes so that a corrupted record
+    // cannot trigger huge allocations
+    uint64_t readCount() {
+        const uint64_t count = read<uint64_t>();
+        if (count > _data.size() - _offset) {
+            _valid = false;
+            return 0;
+        }
+
+        return count;
+    }
+
+    void readColumns(CommitWriteBuffer::PendingProperties& columns) {
+        const uint64_t count = readCount();
+
+        for (uint64_t i = 0; i < count && _valid; i++) {
+            const PropertyTypeID ptID = read<PropertyTypeID::Type>();
+
+            switch (read<ValueType>()) {
+                case ValueType::Int64: columns[ptID] = readColumn<types::Int64>(); break;
+                case ValueType::UInt64: columns[ptID] = readColumn<types::UInt64>(); break;
+                case ValueType::Double: columns[ptID] = readColumn<types::Double>(); break;
+                case ValueType::String: columns[ptID] = readColumn<types::String>(); break;
+                case ValueType::Bool: columns[ptID] = readColumn<types::Bool>(); break;
+                default: _valid = false; break;
+            }
+        }
+    }
+
+    CommitWriteBuffer::ExistingOrPendingNode readNode() {
+        const uint8_t index = read<uint8_t>();
+        const uint64_t value = read<uint64_t>();
+
+        if (index == 0) {
+            return NodeID {value};
+        } else if (index == 1) {
+            return CommitWriteBuffer::PendingNodeOffset {value};
+        }
+
+        _valid = false;
+        return NodeID {};
+    }
+
+private:
+    std::string_view _data;
+    size_t _offset {0};
+    bool _valid {true};
+
+    template <SupportedType T>
+    std::unique_ptr<PropertyContainer> readColumn() {
+        auto column = std::make_unique<TypedPropertyContainer<T>>();
+
+        std::vector<EntityID> ids(readCount());
+        for (EntityID& id : ids) {
+            id = read<EntityID::Type>();
+        }
+
+        for (const EntityID id : ids) {
+            if (!_valid) {
+                break;
+            }
+
+            if constexpr (std::is_same_v<T, types::String>) {
+                column->add(id, readString());
+            } else {
+                column->add(id, read<typename T::Primitive>());
+            }
+        }
+
+        return column;
+    }
+};
+
+}
+
+void WALRecord::encode(CommitBuilder& builder,
+                       CommitHash parent,
+                       const GraphMetadata& parentMetadata,
+                       std::string& out) {
+    static_assert((size_t)ValueType::_SIZE == 6,
+                  "WALRecord encoding must be updated with the supported types");
+
+    RecordEncoder encoder {out};
+
+    const GraphMetadata& metadata = builder.commitData().metadata();
+    const CommitWriteBuffer& wb = builder.writeBuffer();
+
+    encoder.write(parent.get());
+    encoder.write(builder.hash().get());
+
+    // Metadata maps are append-only, only encode what was added by this commit
+    const uint64_t firstLabel = parentMetadata.labels().getCount();
+    encoder.write(firstLabel);
+    encoder.write((uint64_t)(metadata.labels().getCount() - firstLabel));
+    for (const auto& [id, name] : metadata.labels() | std::views::drop(firstLabel)) {
+        encoder.write(*name);
+    }
+
+    const uint64_t firstEdgeType = parentMetadata.edgeTypes().getCount();
+    encoder.write(firstEdgeType);
+    encoder.write((uint64_t)(metadata.edgeTypes().getCount() - firstEdgeType));
+    for (const auto& [id, name] : metadata.edgeTypes() | std::views::drop(firstEdgeType)) {
+        encoder.write(*name);
+    }
+
+    const uint64_t firstPropType = parentMetadata.propTypes().getCount();
+    encoder.write(firstPropType);
+    encoder.write((uint64_t)(metadata.propTypes().getCount() - firstPropType));
+    for (const auto& [pt, name] : metadata.propTypes() | std::views::drop(firstPropType)) {
+        encoder.write(pt._valueType);
+        encoder.write(*name);
+    }
+
+    const uint64_t firstLabelSet = parentMetadata.labelsets().getCount();
+    encoder.write(firstLabelSet);
+    encoder.write((uint64_t)(metadata.labelsets().getCount() - firstLabelSet));
+    for (const auto& [id, labelset] : metadata.labelsets() | std::views::drop(firstLabelSet)) {
+        for (const auto integer : labelset->integers()) {
+            encoder.write(integer);
+        }
+    }
+
+    // Write buffer
+    encoder.write((uint64_t)wb.numPendingNodes());
+    for (const auto& node : wb.pendingNodes()) {
+        encoder.write(node.labelsetHandle.getID().getValue());
+    }
+
+    encoder.write((uint64_t)wb.numPendingEdges());
+    for (const auto& edge : wb.pendingEdges()) {
+        encoder.writeNode(edge.src);
+        encoder.writeNode(edge.tgt);
+        encoder.write(edge.edgeType.getValue());
+    }
+
+    encoder.writeColumns(wb.pendingNodeProperties());
+    encoder.writeColumns(wb.pendingEdgeProperties());
+
+    encoder.write((uint64_t)wb.deletedNodes().size());
+    for (const NodeID node : wb.deletedNodes()) {
+        encoder.write(node.getValue());
+    }
+
+    encoder.write((uint64_t)wb.deletedEdges().size());
+    for (const EdgeID edge : wb.deletedEdges()) {
+        encoder.write(edge.getValue());
+    }
+}
+
+bool WALRecord::decode(std::string_view data, WALRecord& record) {
+    RecordDecoder decoder {data};
+
+    record._parent = CommitHash {decoder.read<CommitHash::ValueType>()};
+    record._hash = CommitHash {decoder.read<CommitHash::ValueType>()};
+
+    record._firstLabel = decoder.read<uint64_t>();
+    record._labels.resize(decoder.readCount());
+    for (auto& name : record._labels) {
+        name = decoder.readString();
+    }
+
+    record._firstEdgeType = decoder.read<uint64_t>();
+    record._edgeTypes.resize(decoder.readCount());
+    for (auto& name : record._edgeTypes) {
+        name = decoder.readString();
+    }
+
+    record._firstPropType = decoder.read<uint64_t>();
+    record._propTypes.resize(decoder.readCount());
+    for (auto& entry : record._propTypes) {
+        entry._valueType = decoder.read<ValueType>();
+        entry._name = decoder.readString();
+    }
+
+    record._firstLabelSet = decoder.read<uint64_t>();
+    record._labelsets.resize(decoder.readCount());
+    for (auto& labelset : record._labelsets) {
+        std::array<LabelSet::IntegerType, LabelSet::IntegerCount> integers {};
+        for (auto& integer : integers) {
+            integer = decoder.read<LabelSet::IntegerType>();
+        }
+
+        labelset = LabelSet::fromIntegers(integers);
+    }
+
+    record._nodes.resize(decoder.readCount());
+    for (auto& labelset : record._nodes) {
+        labelset = decoder.read<LabelSetID::Type>();
+    }
+
+    record._edges.resize(decoder.readCount());
+    for (auto& edge : record._edges) {
+        edge.src = decoder.readNode();
+        edge.tgt = decoder.readNode();
+        edge.edgeType = decoder.read<EdgeTypeID::Type>();
+    }
+
+    decoder.readColumns(record._nodeProperties);
+    decoder.readColumns(record._edgeProperties);
+
+    record._deletedNodes.resize(decoder.readCount());
+    for (auto& node : record._deletedNodes) {
+        node = decoder.read<NodeID::Type>();
+    }
+
+    record._deletedEdges.resize(decoder.readCount());
+    for (auto& edge : record._deletedEdges) {
+        edge = decoder.read<EdgeID::Type>();
+    }
+
+    if (!decoder.valid() || !decoder.consumed()) {
+        return false;
+    }
+
+    // Property columns can only refer to the pending entities of the record
+    const auto hasValidIDs = [](const CommitWriteBuffer::PendingProperties& columns,
+                                size_t entityCount) {
+        return std::ranges::all_of(columns, [&](const auto& entry) {
+            return std::ranges::all_of(entry.second->ids(), [&](EntityID id) {
+                return id.getValue() < entityCount;
+            });
+        });
+    };
+
+    return hasValidIDs(record._nodeProperties, record._nodes.size())
+        && hasValidIDs(record._edgeProperties, record._edges.size());
+}
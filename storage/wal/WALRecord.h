@@ -0,0 +1,68 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "ID.h"
+#include "metadata/LabelSet.h"
+#include "metadata/PropertyType.h"
+#include "versioning/CommitHash.h"
+#include "versioning/CommitWriteBuffer.h"
+
+namespace db {
+
+class CommitBuilder;
+class GraphMetadata;
+
+/**
+ * @brief A commit as stored in the write-ahead log.
+ *
+ * @detail A record holds the metadata the commit added on top of its parent and the
+ * content of its write buffer, with IDs expressed in the ID space of the parent.
+ * Replaying the record on top of the parent commit rebuilds the same commit.
+ */
+struct WALRecord {
+    struct PropertyTypeEntry {
+        std::string _name;
+        ValueType _valueType {};
+    };
+
+    CommitHash _parent;
+    CommitHash _hash;
+
+    // Metadata created by this commit, starting at the given IDs
+    uint64_t _firstLabel {0};
+    uint64_t _firstEdgeType {0};
+    uint64_t _firstPropType {0};
+    uint64_t _firstLabelSet {0};
+    std::vector<std::string> _labels;
+    std::vector<std::string> _edgeTypes;
+    std::vector<PropertyTypeEntry> _propTypes;
+    std::vector<LabelSet> _labelsets;
+
+    // Write buffer content, pending nodes are stored as their labelset
+    std::vector<LabelSetID> _nodes;
+    CommitWriteBuffer::PendingEdges _edges;
+    CommitWriteBuffer::PendingProperties _nodeProperties;
+    CommitWriteBuffer::PendingProperties _edgeProperties;
+    std::vector<NodeID> _deletedNodes;
+    std::vector<EdgeID> _deletedEdges;
+
+    /**
+     * @brief Encodes the commit being built by @param builder, on top of the commit
+     * @param parent holding @param parentMetadata, and appends it to @param out.
+     */
+    static void encode(CommitBuilder& builder,
+                       CommitHash parent,
+                       const GraphMetadata& parentMetadata,
+                       std::string& out);
+
+    /**
+     * @brief Decodes a record previously written by @ref encode.
+     * Returns false if @param data does not hold a valid record.
+     */
+    [[nodiscard]] static bool decode(std::string_view data, WALRecord& record);
+};
+
+}
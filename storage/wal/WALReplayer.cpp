@@ -0,0 +1,167 @@
+#include "WALReplayer.h"
+
+#include <spdlog/spdlog.h>
+
+#include "Graph.h"
+#include "JobSystem.h"
+#include "WALRecord.h"
+#include "WriteAheadLog.h"
+#include "metadata/GraphMetadata.h"
+#include "versioning/Commit.h"
+#include "versioning/CommitBuilder.h"
+#include "versioning/Transaction.h"
+#include "versioning/VersionController.h"
+#include "writers/MetadataBuilder.h"
+
+#include "Profiler.h"
+
+using namespace db;
+
+DumpResult<void> WALReplayer::replay(Graph& graph, const WriteAheadLog& wal) {
+    Profile profile {"WALReplayer::replay"};
+
+    auto segments = wal.listSegments();
+    if (!segments) {
+        return segments.get_unexpected();
+    }
+
+    if (segments->empty()) {
+        return {};
+    }
+
+    VersionController& controller = *graph._versionController;
+    auto jobSystem = JobSystem::create();
+
+    size_t replayedCount = 0;
+    std::vector<std::string> payloads;
+
+    for (const WriteAheadLog::SegmentID segment : segments.value()) {
+        payloads.clear();
+        if (auto res = wal.readSegment(segment, payloads); !res) {
+            return res;
+        }
+
+        for (const std::string& payload : payloads) {
+            WALRecord record;
+            if (!WALRecord::decode(payload, record)) {
+                return DumpError::result(DumpErrorType::COULD_NOT_READ_WAL);
+            }
+
+            // Already dumped before the log was truncated
+            if (controller.getCommitIndex(record._hash) != -1) {
+                continue;
+            }
+
+            if (controller.getHeadHash() != record._parent) {
+                spdlog::warn("Stopping WAL replay of graph {}: commit {:x} does not "
+                             "follow the head of the graph",
+                             graph.getName(), record._hash.get());
+                return {};
+            }
+
+            if (auto res = replayRecord(controller, record, *jobSystem); !res) {
+                return res;
+            }
+
+            replayedCount++;
+        }
+    }
+
+    spdlog::info("Replayed {} commits from the write-ahead log of graph {}",
+                 replayedCount, graph.getName());
+
+    return {};
+}
+
+DumpResult<void> WALReplayer::replayRecord(VersionController& controller,
+                                           WALRecord& record,
+                                           JobSystem& jobSystem) {
+    auto lock = controller.lock();
+
+    // The transaction pins the dataparts of the head for the whole replay
+    // of the record, they may otherwise be evicted from the datapart cache
+    const Commit* head = controller._head.load();
+    const FrozenCommitTx headTx = head->openTransaction();
+    if (!headTx.isValid()) {
+        return DumpError::result(DumpErrorType::WAL_REPLAY_FAILED);
+    }
+
+    auto builder = CommitBuilder::prepare(controller,
+                                          nullptr,
+                                          headTx.viewGraph(),
+                                          record._hash);
+
+    // Metadata, IDs must match the ones of the logged commit
+    MetadataBuilder& metadataBuilder = builder->metadata();
+    const GraphMetadata& metadata = builder->commitData().metadata();
+
+    if (metadata.labels().getCount() != record._firstLabel
+        || metadata.edgeTypes().getCount() != record._firstEdgeType
+        || metadata.propTypes().getCount() != record._firstPropType
+        || metadata.labelsets().getCount() != record._firstLabelSet) {
+        return DumpError::result(DumpErrorType::WAL_REPLAY_FAILED);
+    }
+
+    for (const std::string& label : record._labels) {
+        metadataBuilder.getOrCreateLabel(label);
+    }
+
+    for (const std::string& edgeType : record._edgeTypes) {
+        metadataBuilder.getOrCreateEdgeType(edgeType);
+    }
+
+    for (const auto& propType : record._propTypes) {
+        metadataBuilder.getOrCreatePropertyType(propType._name, propType._valueType);
+    }
+
+    for (const LabelSet& labelset : record._labelsets) {
+        metadataBuilder.getOrCreateLabelSet(labelset);
+    }
+
+    if (metadata.labels().getCount() != record._firstLabel + record._labels.size()
+        || metadata.edgeTypes().getCount() != record._firstEdgeType + record._edgeTypes.size()
+        || metadata.propTypes().getCount() != record._firstPropType + record._propTypes.size()
+        || metadata.labelsets().getCount() != record._firstLabelSet + record._labelsets.size()) {
+        return DumpError::result(DumpErrorType::WAL_REPLAY_FAILED);
+    }
+
+    // Write buffer
+    CommitWriteBuffer& wb = builder->writeBuffer();
+
+    for (const LabelSetID labelsetID : record._nodes) {
+        const auto labelset = metadata.labelsets().getValue(labelsetID);
+        if (!labelset) {
+            return DumpError::result(DumpErrorType::WAL_REPLAY_FAILED);
+        }
+
+        auto& pendingNode = wb.newPendingNode();
+        pendingNode.labelsetHandle = labelset.value();
+    }
+
+    for (const auto& edge : record._edges) {
+        auto& pendingEdge = wb.newPendingEdge(edge.src, edge.tgt);
+        pendingEdge.edgeType = edge.edgeType;
+    }
+
+    for (auto& [ptID, column] : record._nodeProperties) {
+        wb.setNodePropertyColumn(ptID, std::move(column));
+    }
+
+    for (auto& [ptID, column] : record._edgeProperties) {
+        wb.setEdgePropertyColumn(ptID, std::move(column));
+    }
+
+    wb.addDeletedNodes(record._deletedNodes);
+    wb.addDeletedEdges(record._deletedEdges);
+
+    builder->flushWriteBuffer(jobSystem);
+
+    auto commit = builder->build(jobSystem);
+    if (!commit) {
+        return DumpError::result(DumpErrorType::WAL_REPLAY_FAILED);
+    }
+
+    controller.addCommit(std::move(commit.value()));
+
+    return {};
+}
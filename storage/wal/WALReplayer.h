@@ -0,0 +1,30 @@
+#pragma once
+
+#include "dump/DumpResult.h"
+
+namespace db {
+
+class Graph;
+class JobSystem;
+class VersionController;
+class WriteAheadLog;
+struct WALRecord;
+
+class WALReplayer {
+public:
+    /**
+     * @brief Replays the records of @param wal on top of the commits of @param graph.
+     *
+     * @detail Records of commits which are already part of the graph (because they
+     * were dumped before the log was truncated) are skipped. Replay stops at the first
+     * record which does not follow the head of the graph.
+     */
+    [[nodiscard]] static DumpResult<void> replay(Graph& graph, const WriteAheadLog& wal);
+
+private:
+    [[nodiscard]] static DumpResult<void> replayRecord(VersionController& controller,
+                                                       WALRecord& record,
+                                                       JobSystem& jobSystem);
+};
+
+}
@@ -0,0 +1,311 @@
+#include "WriteAheadLog.h"
+
+#include <string.h>
+#include <algorithm>
+#include <charconv>
+#include <thread>
+#include <spdlog/spdlog.h>
+
+#include "File.h"
+
+#include "Profiler.h"
+
+using namespace db;
+
+namespace {
+
+constexpr std::string_view SEGMENT_PREFIX = "wal-";
+
+struct RecordHeader {
+    uint64_t _size {0};
+    uint64_t _checksum {0};
+};
+
+// FNV-1a
+uint64_t computeChecksum(std::span<const char> data) {
+    uint64_t hash = 0xcbf29ce484222325ull;
+    for (const char c : data) {
+        hash ^= static_cast<uint8_t>(c);
+        hash *= 0x100000001b3ull;
+    }
+
+    return hash;
+}
+
+}
+
+WriteAheadLog::WriteAheadLog(const fs::Path& dir)
+    : _dir(dir)
+{
+}
+
+WriteAheadLog::~WriteAheadLog() {
+}
+
+DumpResult<void> WriteAheadLog::open() {
+    if (!_dir.exists()) {
+        if (auto res = _dir.mkdir(); !res) {
+            return DumpError::result(DumpErrorType::CANNOT_OPEN_WAL, res.error());
+        }
+
+        if (auto res = _dir.parent().syncDir(); !res) {
+            return DumpError::result(DumpErrorType::COULD_NOT_SYNC_WAL, res.error());
+        }
+    }
+
+    auto segments = listSegments();
+    if (!segments) {
+        return segments.get_unexpected();
+    }
+
+    // Never append to an existing segment: it may end with a torn record
+    const SegmentID nextID = segments->empty() ? 0 : segments->back() + 1;
+
+    std::scoped_lock lock {_writeMutex};
+    return openSegment(nextID);
+}
+
+DumpResult<std::vector<WriteAheadLog::SegmentID>> WriteAheadLog::listSegments() const {
+    auto files = _dir.listDir();
+    if (!files) {
+        return DumpError::result(DumpErrorType::CANNOT_LIST_WAL_SEGMENTS, files.error());
+    }
+
+    std::vector<SegmentID> segments;
+    for (const fs::Path& file : files.value()) {
+        const std::string_view name = file.filename();
+        if (!name.starts_with(SEGMENT_PREFIX)) {
+            continue;
+        }
+
+        const std::string_view idStr = name.substr(SEGMENT_PREFIX.size());
+        SegmentID id {0};
+        const auto res = std::from_chars(idStr.data(), idStr.data() + idStr.size(), id);
+        if (res.ec != std::errc {} || res.ptr != idStr.data() + idStr.size()) {
+            continue;
+        }
+
+        segments.push_back(id);
+    }
+
+    std::sort(segments.begin(), segments.end());
+
+    return segments;
+}
+
+DumpResult<void> WriteAheadLog::readSegment(SegmentID id,
+                                            std::vector<std::string>& records) const {
+    Profile profile {"WriteAheadLog::readSegment"};
+
+    const fs::Path path = getSegmentPath(id);
+
+    auto file = fs::File::open(path);
+    if (!file) {
+        return DumpError::result(DumpErrorType::CANNOT_OPEN_WAL, file.error());
+    }
+
+    const size_t size = file->getInfo()._size;
+    std::string content(size, '\0');
+
+    if (auto res = file->read(content.data(), size); !res) {
+        return DumpError::result(DumpErrorType::COULD_NOT_READ_WAL, res.error());
+    }
+
+    size_t offset = 0;
+    while (offset + sizeof(RecordHeader) <= size) {
+        RecordHeader header;
+        memcpy(&header, content.data() + offset, sizeof(RecordHeader));
+        offset += sizeof(RecordHeader);
+
+        if (header._size > size - offset) {
+            break;
+        }
+
+        const std::span<const char> payload {content.data() + offset, header._size};
+        if (computeChecksum(payload) != header._checksum) {
+            break;
+        }
+
+        records.emplace_back(payload.data(), payload.size());
+        offset += header._size;
+    }
+
+    if (offset != size) {
+        spdlog::warn("Ignoring incomplete record at the end of WAL segment {}", path.get());
+    }
+
+    return {};
+}
+
+DumpResult<WriteAheadLog::LSN> WriteAheadLog::append(std::span<const char> payload) {
+    Profile profile {"WriteAheadLog::append"};
+
+    const RecordHeader header {
+        ._size = payload.size(),
+        ._checksum = computeChecksum(payload),
+    };
+
+    // Header and payload are written with a single write
+    std::string record;
+    record.reserve(sizeof(RecordHeader) + payload.size());
+    record.append(reinterpret_cast<const char*>(&header), sizeof(RecordHeader));
+    record.append(payload.data(), payload.size());
+
+    std::scoped_lock lock {_writeMutex};
+
+    if (auto res = _segment->write(record.data(), record.size()); !res) {
+        return DumpError::result(DumpErrorType::COULD_NOT_WRITE_WAL, res.error());
+    }
+
+    _segmentSize += record.size();
+    _writtenLSN += record.size();
+
+    return _writtenLSN;
+}
+
+DumpResult<void> WriteAheadLog::waitDurable(LSN lsn) {
+    Profile profile {"WriteAheadLog::waitDurable"};
+
+    std::unique_lock syncLock {_syncMutex};
+
+    while (true) {
+        if (_durableLSN >= lsn) {
+            return {};
+        }
+
+        if (!_syncInProgress) {
+            break;
+        }
+
+        _syncCond.wait(syncLock);
+    }
+
+    // Become the leader: sync everything that was written so far, including the
+    // records of the followers that appended while the previous sync was running
+    _syncInProgress = true;
+    syncLock.unlock();
+
+    const std::chrono::microseconds delay = _groupCommitDelay.load();
+    if (delay.count() > 0) {
+        std::this_thread::sleep_for(delay);
+    }
+
+    std::shared_ptr<fs::File> segment;
+    LSN target {0};
+    {
+        std::scoped_lock lock {_writeMutex};
+        segment = _segment;
+        target = _writtenLSN;
+    }
+
+    // Previous segments are synced on rotation, only the active one needs a sync
+    auto res = segment->sync();
+    _syncCount.fetch_add(1);
+
+    syncLock.lock();
+    _syncInProgress = false;
+    if (res) {
+        _durableLSN = std::max(_durableLSN, target);
+    }
+    syncLock.unlock();
+
+    _syncCond.notify_all();
+
+    if (!res) {
+        return DumpError::result(DumpErrorType::COULD_NOT_SYNC_WAL, res.error());
+    }
+
+    return {};
+}
+
+DumpResult<void> WriteAheadLog::truncate(LSN lsn) {
+    {
+        std::scoped_lock lock {_writeMutex};
+
+        const uint64_t discardedSize = _writtenLSN - lsn;
+        if (lsn > _writtenLSN || discardedSize > _segmentSize) {
+            return DumpError::result(DumpErrorType::COULD_NOT_WRITE_WAL);
+        }
+
+        if (auto res = _segment->truncate(_segmentSize - discardedSize); !res) {
+            return DumpError::result(DumpErrorType::COULD_NOT_WRITE_WAL, res.error());
+        }
+
+        _segmentSize -= discardedSize;
+        _writtenLSN = lsn;
+    }
+
+    // The next records reuse the discarded LSNs, they are not durable yet
+    std::scoped_lock syncLock {_syncMutex};
+    _durableLSN = std::min(_durableLSN, lsn);
+
+    return {};
+}
+
+WriteAheadLog::LSN WriteAheadLog::getWrittenLSN() const {
+    std::scoped_lock lock {_writeMutex};
+    return _writtenLSN;
+}
+
+DumpResult<WriteAheadLog::SegmentID> WriteAheadLog::rotate() {
+    Profile profile {"WriteAheadLog::rotate"};
+
+    std::scoped_lock lock {_writeMutex};
+
+    if (auto res = _segment->sync(); !res) {
+        return DumpError::result(DumpErrorType::COULD_NOT_SYNC_WAL, res.error());
+    }
+
+    if (auto res = openSegment(_segmentID + 1); !res) {
+        return res.get_unexpected();
+    }
+
+    return _segmentID;
+}
+
+DumpResult<void> WriteAheadLog::removeSegmentsBefore(SegmentID id) {
+    auto segments = listSegments();
+    if (!segments) {
+        return segments.get_unexpected();
+    }
+
+    for (const SegmentID segment : segments.value()) {
+        if (segment >= id) {
+            break;
+        }
+
+        if (auto res = getSegmentPath(segment).rm(); !res) {
+            return DumpError::result(DumpErrorType::CANNOT_REMOVE_WAL_SEGMENT, res.error());
+        }
+    }
+
+    return {};
+}
+
+uint64_t WriteAheadLog::getActiveSegmentSize() const {
+    std::scoped_lock lock {_writeMutex};
+    return _segmentSize;
+}
+
+fs::Path WriteAheadLog::getSegmentPath(SegmentID id) const {
+    return _dir / fmt::format("{}{}", SEGMENT_PREFIX, id);
+}
+
+// NOTE: Called within locked-context
+DumpResult<void> WriteAheadLog::openSegment(SegmentID id) {
+    auto file = fs::File::createAndOpen(getSegmentPath(id));
+    if (!file) {
+        return DumpError::result(DumpErrorType::CANNOT_OPEN_WAL, file.error());
+    }
+
+    // The entry of the new segment must be durable before its records are
+    if (auto res = _dir.syncDir(); !res) {
+        return DumpError::result(DumpErrorType::COULD_NOT_SYNC_WAL, res.error());
+    }
+
+    _segment = std::make_shared<fs::File>(std::move(file.value()));
+    _segmentID = id;
+    _segmentSize = 0;
+
+    return {};
+}
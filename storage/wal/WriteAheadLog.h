@@ -0,0 +1,137 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <string>
+#include <vector>
+
+#include "Path.h"
+#include "dump/DumpResult.h"
+
+namespace fs {
+class File;
+}
+
+namespace db {
+
+/**
+ * @brief Append-only log of the commits submitted on a graph.
+ *
+ * @detail The log is split into segments named wal-<id>. Records are framed by
+ * their size and a checksum, so that a torn write at the end of the last segment
+ * is detected and ignored on replay.
+ *
+ * Durability uses group commit: @ref append only writes the record, and
+ * @ref waitDurable syncs the log. The first waiter becomes the leader and syncs
+ * everything written so far, the other waiters are woken up once their record is
+ * covered by the leader's sync.
+ */
+class WriteAheadLog {
+public:
+    // Log sequence number: offset in bytes of the end of a record in the log
+    using LSN = uint64_t;
+    using SegmentID = uint64_t;
+
+    explicit WriteAheadLog(const fs::Path& dir);
+    ~WriteAheadLog();
+
+    WriteAheadLog(const WriteAheadLog&) = delete;
+    WriteAheadLog(WriteAheadLog&&) = delete;
+    WriteAheadLog& operator=(const WriteAheadLog&) = delete;
+    WriteAheadLog& operator=(WriteAheadLog&&) = delete;
+
+    const fs::Path& getPath() const { return _dir; }
+
+    /**
+     * @brief Creates the log directory if needed, and opens a new segment after
+     * the existing ones. Existing segments are left untouched for replay.
+     */
+    [[nodiscard]] DumpResult<void> open();
+
+    /**
+     * @brief Lists the segments of the log, in the order they were written.
+     */
+    [[nodiscard]] DumpResult<std::vector<SegmentID>> listSegments() const;
+
+    /**
+     * @brief Reads the record payloads of segment @param id into @param records.
+     * Reading stops at the first incomplete or corrupted record.
+     */
+    [[nodiscard]] DumpResult<void> readSegment(SegmentID id,
+                                               std::vector<std::string>& records) const;
+
+    /**
+     * @brief Appends a record to the active segment. The record is not durable
+     * until @ref waitDurable returns for the returned LSN.
+     */
+    [[nodiscard]] DumpResult<LSN> append(std::span<const char> payload);
+
+    /**
+     * @brief Blocks until every record up to @param lsn is synced on disk.
+     */
+    [[nodiscard]] DumpResult<void> waitDurable(LSN lsn);
+
+    /**
+     * @brief Makes the leader of a group commit wait @param delay before syncing,
+     * so that the records appended meanwhile are synced with its own. No delay by default.
+     */
+    void setGroupCommitDelay(std::chrono::microseconds delay) { _groupCommitDelay.store(delay); }
+
+    /**
+     * @brief Number of syncs run by @ref waitDurable.
+     */
+    [[nodiscard]] uint64_t getSyncCount() const { return _syncCount.load(); }
+
+    /**
+     * @brief Discards the records appended after @param lsn, so that they are
+     * not replayed. They must all be in the active segment.
+     */
+    [[nodiscard]] DumpResult<void> truncate(LSN lsn);
+
+    /**
+     * @brief LSN of the last record appended to the log.
+     */
+    [[nodiscard]] LSN getWrittenLSN() const;
+
+    /**
+     * @brief Syncs and seals the active segment, and opens a new one.
+     * Returns the ID of the new active segment: all the segments before it are sealed.
+     */
+    [[nodiscard]] DumpResult<SegmentID> rotate();
+
+    /**
+     * @brief Removes the sealed segments with an ID lower than @param id.
+     */
+    [[nodiscard]] DumpResult<void> removeSegmentsBefore(SegmentID id);
+
+    /**
+     * @brief Size in bytes of the active segment.
+     */
+    [[nodiscard]] uint64_t getActiveSegmentSize() const;
+
+private:
+    fs::Path _dir;
+
+    mutable std::mutex _writeMutex;
+    std::shared_ptr<fs::File> _segment;
+    SegmentID _segmentID {0};
+    uint64_t _segmentSize {0};
+    LSN _writtenLSN {0};
+
+    // Group commit
+    std::mutex _syncMutex;
+    std::condition_variable _syncCond;
+    LSN _durableLSN {0};
+    bool _syncInProgress {false};
+    std::atomic<std::chrono::microseconds> _groupCommitDelay {std::chrono::microseconds {0}};
+    std::atomic<uint64_t> _syncCount {0};
+
+    fs::Path getSegmentPath(SegmentID id) const;
+    DumpResult<void> openSegment(SegmentID id);
+};
+
+}
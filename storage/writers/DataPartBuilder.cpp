@@ -1,10 +1,14 @@
 #include "DataPartBuilder.h"
 
+#include <algorithm>
+
 #include "Graph.h"
 #include "ID.h"
 #include "properties/PropertyManager.h"
 #include "writers/MetadataBuilder.h"
 
+#include "BioAssert.h"
+
 using namespace db;
 
 DataPartBuilder::~DataPartBuilder() = default;
@@ -97,6 +101,30 @@ const EdgeRecord& DataPartBuilder::addEdge(EdgeTypeID typeID, NodeID srcID, Node
     return edge;
 }
 
+void DataPartBuilder::addNodePropertyColumn(PropertyTypeID ptID,
+                                            std::unique_ptr<PropertyContainer> container) {
+    bioassert(std::ranges::all_of(container->ids(),
+                                  [&](EntityID id) {
+                                      return id >= _firstNodeID.getValue()
+                                          && id < _nextNodeID.getValue();
+                                  }),
+              "Property column contains nodes which are not part of the datapart");
+
+    _nodeProperties->addContainer(ptID, std::move(container));
+}
+
+void DataPartBuilder::addEdgePropertyColumn(PropertyTypeID ptID,
+                                            std::unique_ptr<PropertyContainer> container) {
+    bioassert(std::ranges::all_of(container->ids(),
+                                  [&](EntityID id) {
+                                      return id >= _firstEdgeID.getValue()
+                                          && id < _nextEdgeID.getValue();
+                                  }),
+              "Property column contains edges which are not part of the datapart");
+
+    _edgeProperties->addContainer(ptID, std::move(container));
+}
+
 #define INSTANTIATE(PType)                                                   \
     template void DataPartBuilder::addNodeProperty<PType>(NodeID,            \
                                                           PropertyTypeID,    \
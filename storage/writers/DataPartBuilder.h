@@ -51,6 +51,20 @@ public:
 
     const EdgeRecord& addEdge(EdgeTypeID typeID, NodeID srcID, NodeID tgtID);
 
+    /**
+     * @brief Moves a whole column of node properties into the builder.
+     * @warn All the IDs of @param container must be nodes created by this builder.
+     */
+    void addNodePropertyColumn(PropertyTypeID ptID,
+                               std::unique_ptr<PropertyContainer> container);
+
+    /**
+     * @brief Moves a whole column of edge properties into the builder.
+     * @warn All the IDs of @param container must be edges created by this builder.
+     */
+    void addEdgePropertyColumn(PropertyTypeID ptID,
+                               std::unique_ptr<PropertyContainer> container);
+
     NodeID firstNodeID() const { return _firstNodeID; }
     EdgeID firstEdgeID() const { return _firstEdgeID; }
     size_t nodeCount() const { return _coreNodeLabelSets.size(); }
@@ -45,21 +45,30 @@ ChangeResult<Change*> ChangeManager::getChange(const Graph* graph, ChangeID chan
 }
 
 ChangeResult<void> ChangeManager::submitChange(ChangeAccessor& access, JobSystem& jobsystem) {
-    std::unique_lock guard(_changesLock);
     const Graph* graph = access.getGraph();
+    const GraphChangePair key {graph, access.getID()};
 
-    const auto findIt = _changes.find(GraphChangePair {graph, access.getID()});
-    if (findIt == _changes.end()) {
-        return ChangeError::result(ChangeErrorType::CHANGE_NOT_FOUND);
+    Change* change = nullptr;
+    {
+        std::shared_lock guard(_changesLock);
+
+        const auto findIt = _changes.find(key);
+        if (findIt == _changes.end()) {
+            return ChangeError::result(ChangeErrorType::CHANGE_NOT_FOUND);
+        }
+
+        change = findIt->second.get();
     }
 
-    auto& change = findIt->second;
+    // The change is locked by the accessor. Other changes can be submitted while
+    // this one waits for its commits to be durable, and share the same sync
     if (auto res = change->submit(jobsystem); !res) {
         return ChangeError::result(ChangeErrorType::COULD_NOT_ACCEPT_CHANGE, res.error());
     }
 
+    std::unique_lock guard(_changesLock);
     access.release();
-    _changes.erase(findIt);
+    _changes.erase(key);
 
     return {};
 }
@@ -3,6 +3,8 @@
 #include <shared_mutex>
 #include <mutex>
 
+#include "DataPartCache.h"
+
 using namespace db;
 
 bool GraphLoadStatus::addLoadingGraph(const std::string& graphName) {
@@ -30,4 +32,12 @@ bool GraphLoadStatus::isGraphLoading(const std::string& graphName) const {
     std::shared_lock lock(_guard);
 
     return _loadingGraphs.contains(graphName);
-} 
+}
+
+size_t GraphLoadStatus::getResidentSize(const std::string& graphName) const {
+    if (!_dataPartCache) {
+        return 0;
+    }
+
+    return _dataPartCache->getResidentSize(graphName);
+}
@@ -7,15 +7,24 @@
 
 namespace db {
 
+class DataPartCache;
+
 class GraphLoadStatus {
 public:
     bool addLoadingGraph(const std::string& graphName);
     void removeLoadingGraph(const std::string& graphName);
     bool isGraphLoading(const std::string& graphName) const;
 
+    void setDataPartCache(const DataPartCache* cache) { _dataPartCache = cache; }
+
+    // Size of the dataparts of the graph loaded in memory, in tiered mode.
+    // Returns 0 for the graphs which are fully loaded
+    size_t getResidentSize(const std::string& graphName) const;
+
 private:
     mutable RWSpinLock _guard;
     std::set<std::string> _loadingGraphs;
+    const DataPartCache* _dataPartCache {nullptr};
 };
 
 } 
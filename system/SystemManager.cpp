@@ -5,6 +5,7 @@
 #include <spdlog/spdlog.h>
 
 #include "ChangeManager.h"
+#include "DataPartCache.h"
 #include "Graph.h"
 #include "Neo4j/Neo4JParserConfig.h"
 #include "Neo4jImporter.h"
@@ -17,6 +18,7 @@
 #include "FileUtils.h"
 #include "TuringConfig.h"
 #include "TuringException.h"
+#include "VectorDatabase.h"
 
 using namespace db;
 
@@ -25,6 +27,10 @@ SystemManager::SystemManager(const TuringConfig* config)
     _changes(std::make_unique<ChangeManager>()),
     _neo4JImporter(std::make_unique<Neo4jImporter>())
 {
+    if (_config->isTieredStorage()) {
+        _dataPartCache = std::make_unique<DataPartCache>(_config->getMemoryBudget());
+        _graphLoadStatus.setDataPartCache(_dataPartCache.get());
+    }
 }
 
 SystemManager::~SystemManager() {
@@ -49,6 +55,16 @@ void SystemManager::init() {
     if (!_defaultGraph) {
         throw TuringException("Could not initialise the default graph");
     }
+
+    // Vector libraries searched by db.vectorSearch, loaded from the vectors directory
+    auto vectorDB = vec::VectorDatabase::create(_config->getVectorsDir());
+    if (!vectorDB) {
+        throw TuringException(fmt::format("Could not open the vector database in '{}': {}",
+                                          _config->getVectorsDir().get(),
+                                          vectorDB.error().fmtMessage()));
+    }
+
+    _vectorDB = std::move(vectorDB.value());
 }
 
 Graph* SystemManager::loadGraph(const std::string& name) {
@@ -57,7 +73,7 @@ Graph* SystemManager::loadGraph(const std::string& name) {
     auto graph = Graph::create(name, graphPath);
     Graph* graphPtr = graph.get();
 
-    if (const auto res = graph->getSerializer().load(); !res) {
+    if (const auto res = loadGraphFromDump(*graph); !res) {
         spdlog::error(res.error().fmtMessage());
         return nullptr;
     }
@@ -97,6 +113,10 @@ Graph* SystemManager::createGraph(const std::string& name) {
 }
 
 bool SystemManager::addGraph(std::unique_ptr<Graph> graph) {
+    if (!openWriteAheadLog(*graph)) {
+        return false;
+    }
+
     std::unique_lock guard(_graphsLock);
 
     const auto& name = graph->getName();
@@ -112,6 +132,32 @@ bool SystemManager::addGraph(std::unique_ptr<Graph> graph) {
     return true;
 }
 
+DumpResult<void> SystemManager::loadGraphFromDump(Graph& graph) {
+    // In tiered mode, only the info of the dataparts is loaded,
+    // their content is loaded when first read
+    graph.setDataPartCache(_dataPartCache.get());
+
+    return graph.getSerializer().load();
+}
+
+bool SystemManager::openWriteAheadLog(Graph& graph) {
+    if (!_config->isSyncedOnDisk() || !_config->isWALEnabled()) {
+        return true;
+    }
+
+    GraphSerializer& serializer = graph.getSerializer();
+
+    if (auto res = serializer.openWriteAheadLog(); !res) {
+        spdlog::error("Could not open the write-ahead log of graph {}: {}",
+                      graph.getName(), res.error().fmtMessage());
+        return false;
+    }
+
+    serializer.startBackgroundCheckpoints();
+
+    return true;
+}
+
 Graph* SystemManager::getDefaultGraph() const {
     std::shared_lock guard(_graphsLock);
     return _defaultGraph;
@@ -205,6 +251,21 @@ DumpResult<void> SystemManager::dumpGraph(const std::string& graphName) {
     return graphIt->second->getSerializer().dump();
 }
 
+DumpResult<void> SystemManager::syncGraph(const std::string& graphName) {
+    std::shared_lock guard(_graphsLock);
+
+    if (!_config->isSyncedOnDisk()) {
+        return {};
+    }
+
+    const auto graphIt = _graphs.find(graphName);
+    if (graphIt == _graphs.end()) {
+        return DumpError::result(DumpErrorType::GRAPH_DOES_NOT_EXIST);
+    }
+
+    return graphIt->second->getSerializer().sync();
+}
+
 std::optional<GraphFileType> SystemManager::getGraphFileType(const fs::Path& graphPath) {
     if (graphPath.extension() == ".gml") {
         return GraphFileType::GML;
@@ -239,7 +300,7 @@ bool SystemManager::loadBinaryDB(const std::string& graphName,
     // in the case of turingDB binaries the path is the same path we load from.
     auto graph = Graph::create(graphName, dbPath);
 
-    if (auto res = graph->getSerializer().load(); !res) {
+    if (auto res = loadGraphFromDump(*graph); !res) {
         spdlog::error("Could not load graph {}: {}", graphName, res.error().fmtMessage());
         _graphLoadStatus.removeLoadingGraph(graphName);
         return false;
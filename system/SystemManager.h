@@ -15,6 +15,10 @@
 #include "mergers/DataPartMergeResult.h"
 #include "dump/DumpResult.h"
 
+namespace vec {
+class VectorDatabase;
+}
+
 namespace db {
 
 class Neo4jImporter;
@@ -25,6 +29,7 @@ class JobSystem;
 class FrozenCommitTx;
 class Transaction;
 class Change;
+class DataPartCache;
 
 class SystemManager {
 public:
@@ -63,8 +68,21 @@ public:
 
     DumpResult<void> dumpGraph(const std::string& graphName);
 
+    /// @brief Makes sure the commits submitted on a graph are persisted. Dumps the
+    /// graph, unless its commits are already durable in its write-ahead log.
+    DumpResult<void> syncGraph(const std::string& graphName);
+
     bool isGraphLoading(const std::string& graphName) const;
 
+    const GraphLoadStatus& getGraphLoadStatus() const { return _graphLoadStatus; }
+
+    // Set in tiered mode only
+    DataPartCache* getDataPartCache() const { return _dataPartCache.get(); }
+
+    // Vector libraries searched by the db.vectorSearch procedure,
+    // opened by init in the vectors directory of the config
+    vec::VectorDatabase* getVectorDatabase() const { return _vectorDB.get(); }
+
     ChangeManager& getChangeManager() { return *_changes; }
     const ChangeManager& getChangeManager() const { return *_changes; }
 
@@ -92,9 +110,13 @@ private:
     const TuringConfig* _config {nullptr};
     Graph* _defaultGraph {nullptr};
     std::unique_ptr<S3::TuringS3Client<S3::AwsS3ClientWrapper<>>> _s3Client {nullptr};
+
+    // Declared before the graphs, which unregister their dataparts on destruction
+    std::unique_ptr<DataPartCache> _dataPartCache;
     std::unordered_map<std::string, std::unique_ptr<Graph>> _graphs;
     std::unique_ptr<ChangeManager> _changes;
     std::unique_ptr<Neo4jImporter> _neo4JImporter;
+    std::unique_ptr<vec::VectorDatabase> _vectorDB;
     GraphLoadStatus _graphLoadStatus;
 
     bool loadNeo4jJsonDB(const std::string& graphName, const fs::Path& dbPath, JobSystem&);
@@ -102,6 +124,8 @@ private:
     bool loadGmlDB(const std::string& graphName, const fs::Path& dbPath, JobSystem&);
     bool loadBinaryDB(const std::string& graphName, const fs::Path& dbPath, JobSystem&);
     bool addGraph(std::unique_ptr<Graph> graph);
+    DumpResult<void> loadGraphFromDump(Graph& graph);
+    bool openWriteAheadLog(Graph& graph);
 };
 
 }
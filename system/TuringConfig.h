@@ -17,17 +17,39 @@ public:
     const fs::Path& getTuringDir() const { return _turingDir; }
     const fs::Path& getGraphsDir() const { return _graphsDir; }
     const fs::Path& getDataDir() const { return _dataDir; }
+    const fs::Path& getVectorsDir() const { return _vectorsDir; }
 
     bool isSyncedOnDisk() const { return _syncedOnDisk; }
     void setTuringDirectory(const fs::Path& turingDir);
     void setSyncedOnDisk(bool syncedOnDisk) { _syncedOnDisk = syncedOnDisk; }
 
+    // Log submitted commits in a write-ahead log instead of dumping them on submit
+    bool isWALEnabled() const { return _walEnabled; }
+    void setWALEnabled(bool enabled) { _walEnabled = enabled; }
+
+    // Load the dataparts of the graphs on demand and evict the least recently
+    // used ones above the memory budget, 0 meaning unlimited
+    bool isTieredStorage() const { return _tieredStorage; }
+    void setTieredStorage(bool enabled) { _tieredStorage = enabled; }
+    size_t getMemoryBudget() const { return _memoryBudget; }
+    void setMemoryBudget(size_t memoryBudget) { _memoryBudget = memoryBudget; }
+
+    // Largest chunk written by the processors of the queries,
+    // 0 meaning the default chunk size
+    size_t getChunkSize() const { return _chunkSize; }
+    void setChunkSize(size_t chunkSize) { _chunkSize = chunkSize; }
+
 private:
     fs::Path _turingDir;
     fs::Path _graphsDir;
     fs::Path _dataDir;
+    fs::Path _vectorsDir;
 
     bool _syncedOnDisk {true};
+    bool _walEnabled {false};
+    bool _tieredStorage {false};
+    size_t _memoryBudget {0};
+    size_t _chunkSize {0};
 };
 
 }
@@ -0,0 +1,76 @@
+#include <gtest/gtest.h>
+
+#include <thread>
+#include <vector>
+
+#include "DurationHistogram.h"
+#include "ThreadCounters.h"
+
+using namespace db;
+
+class DurationHistogramTest : public ::testing::Test {
+};
+
+TEST_F(DurationHistogramTest, CumulativeBuckets) {
+    DurationHistogram histogram;
+    histogram.record(Milliseconds {0.5});
+    histogram.record(Milliseconds {3});
+    histogram.record(Milliseconds {200});
+    histogram.record(Milliseconds {20000});
+
+    ASSERT_EQ(histogram.getCount(), 4);
+
+    // 1ms, 5ms, 250ms and 10s
+    ASSERT_EQ(histogram.getBucketCount(0), 1);
+    ASSERT_EQ(histogram.getBucketCount(2), 2);
+    ASSERT_EQ(histogram.getBucketCount(7), 3);
+    ASSERT_EQ(histogram.getBucketCount(DurationHistogram::BUCKET_COUNT - 1), 3);
+    ASSERT_EQ(histogram.getBucketCount(DurationHistogram::BUCKET_COUNT), 4);
+
+    ASSERT_NEAR(histogram.getSumSeconds(), 20.2035, 1e-3);
+}
+
+TEST_F(DurationHistogramTest, ConcurrentCounters) {
+    constexpr size_t threadCount = 8;
+    constexpr size_t incrementCount = 10000;
+
+    ThreadCounters<2> counters;
+
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < threadCount; i++) {
+        threads.emplace_back([&counters] {
+            for (size_t j = 0; j < incrementCount; j++) {
+                counters.add(0);
+                counters.add(1, 2);
+            }
+        });
+    }
+
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    ASSERT_EQ(counters.get(0), threadCount * incrementCount);
+    ASSERT_EQ(counters.get(1), 2 * threadCount * incrementCount);
+}
+
+TEST_F(DurationHistogramTest, ThreadSlotsOfDestroyedCounters) {
+    using Counters = ThreadCounters<1>;
+
+    Counters live;
+    live.add(0);
+    const size_t slotCount = Counters::getThreadSlotCount();
+
+    // The thread touches many short lived counters, its slot cache does not grow
+    for (size_t i = 0; i < 1000; i++) {
+        Counters counters;
+        counters.add(0, i);
+        ASSERT_EQ(counters.get(0), i);
+        ASSERT_LE(Counters::getThreadSlotCount(), slotCount + 1);
+    }
+
+    // The slot of the live counters is kept
+    live.add(0);
+    ASSERT_EQ(live.get(0), 2);
+    ASSERT_LE(Counters::getThreadSlotCount(), slotCount + 1);
+}
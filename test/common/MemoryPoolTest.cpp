@@ -0,0 +1,135 @@
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "MemoryPool.h"
+
+using namespace db;
+
+namespace {
+
+struct Buffer {
+    using ValueType = int;
+
+    std::vector<int> _data;
+
+    size_t size() const { return _data.size(); }
+    size_t capacity() const { return _data.capacity(); }
+    void clear() { _data.clear(); }
+};
+
+struct Value {
+    int _value {0};
+};
+
+}
+
+class MemoryPoolTest : public ::testing::Test {
+};
+
+TEST_F(MemoryPoolTest, RecycleKeepsBuffers) {
+    MemoryPool<Buffer> pool;
+
+    Buffer* buffer = pool.alloc();
+    buffer->_data.resize(100, 1);
+    const int* data = buffer->_data.data();
+
+    pool.clear();
+
+    // The same object is handed out again, emptied but with its buffer
+    Buffer* recycled = pool.alloc();
+    ASSERT_EQ(recycled, buffer);
+    ASSERT_EQ(recycled->size(), 0);
+    ASSERT_GE(recycled->capacity(), 100);
+    ASSERT_EQ(recycled->_data.data(), data);
+}
+
+TEST_F(MemoryPoolTest, RecycleFreesLargeBuffers) {
+    MemoryPool<Buffer> pool;
+
+    Buffer* buffer = pool.alloc();
+    buffer->_data.resize(MemoryPool<Buffer>::MAX_RETAINED_BYTES / sizeof(int) + 1);
+
+    pool.clear();
+
+    Buffer* recycled = pool.alloc();
+    ASSERT_EQ(recycled, buffer);
+    ASSERT_EQ(recycled->capacity(), 0);
+}
+
+TEST_F(MemoryPoolTest, RecycleWithoutClear) {
+    MemoryPool<Value> pool;
+
+    Value* value = pool.alloc();
+    value->_value = 42;
+
+    pool.clear();
+
+    // Objects without clear are reset to their default value
+    Value* recycled = pool.alloc();
+    ASSERT_EQ(recycled, value);
+    ASSERT_EQ(recycled->_value, 0);
+}
+
+TEST_F(MemoryPoolTest, ClearWithinRetentionBudget) {
+    MemoryPool<Buffer> pool;
+
+    Buffer* first = pool.alloc();
+    Buffer* second = pool.alloc();
+    first->_data.reserve(1000);
+    second->_data.reserve(1000);
+    const size_t firstBytes = first->capacity() * sizeof(int);
+
+    // Only the first buffer fits in the budget
+    size_t retentionBudget = firstBytes + firstBytes / 2;
+    pool.clear(retentionBudget);
+
+    ASSERT_EQ(retentionBudget, firstBytes / 2);
+    ASSERT_EQ(first->capacity() * sizeof(int), firstBytes);
+    ASSERT_EQ(second->capacity(), 0);
+
+    // Buffers of the objects which were not used since the last clear
+    // still count in the budget
+    retentionBudget = 0;
+    pool.clear(retentionBudget);
+    ASSERT_EQ(first->capacity(), 0);
+}
+
+TEST_F(MemoryPoolTest, Stats) {
+    MemoryPool<Buffer> pool;
+
+    Buffer* first = pool.alloc();
+    Buffer* second = pool.alloc();
+    first->_data.resize(10);
+    second->_data.reserve(100);
+
+    MemoryPoolStats stats;
+    pool.addStats(stats);
+
+    const size_t blockBytes = MemoryPool<Buffer>::BLOCK_CAPACITY * sizeof(Buffer);
+    const size_t capacityBytes = (first->capacity() + second->capacity()) * sizeof(int);
+
+    ASSERT_EQ(stats._objectCount, 2);
+    ASSERT_EQ(stats._blockBytes, blockBytes);
+    ASSERT_EQ(stats._usedBytes, 2 * sizeof(Buffer) + 10 * sizeof(int));
+    ASSERT_EQ(stats._reservedBytes, blockBytes + capacityBytes);
+
+    // Recycled objects are no longer used but keep their buffers reserved
+    pool.clear();
+
+    MemoryPoolStats clearedStats;
+    pool.addStats(clearedStats);
+
+    ASSERT_EQ(clearedStats._objectCount, 0);
+    ASSERT_EQ(clearedStats._usedBytes, 0);
+    ASSERT_EQ(clearedStats._reservedBytes, blockBytes + capacityBytes);
+
+    // Released pools hold nothing
+    pool.release();
+
+    MemoryPoolStats releasedStats;
+    pool.addStats(releasedStats);
+
+    ASSERT_EQ(releasedStats._blockBytes, 0);
+    ASSERT_EQ(releasedStats._reservedBytes, 0);
+}
@@ -3,6 +3,7 @@
 #include "DummyDirectory.h"
 #include "Path.h"
 #include "AwsS3ClientWrapper.h"
+#include "JobSystem.h"
 
 using namespace turing::test;
 
@@ -859,6 +860,172 @@ TEST_F(FileCacheTest, UnsuccesfulLoadDataDirectory) {
     }
 }
 
+TEST_F(FileCacheTest, IncrementalSaveGraph) {
+    DummyDirectory dir(_tempTestDir, "FileCacheTest");
+    dir.createSubDir("data");
+    dir.createSubDir("graphs/graph1/commit-0-1");
+    dir.createFile("graphs/graph1/info");
+    dir.createFile("graphs/graph1/commit-0-1/nodes");
+    dir.createFile("graphs/graph1/commit-0-1/edges");
+    fs::Path graphPath = fs::Path(dir.getPath() + "graphs");
+    fs::Path dataPath = fs::Path(dir.getPath() + "data");
+
+    S3::MockS3Client mockClient;
+    S3::AwsS3ClientWrapper<S3::MockS3Client> clientWrapper(mockClient);
+    S3::TuringS3Client<S3::AwsS3ClientWrapper<S3::MockS3Client>> TuringClient(std::move(clientWrapper));
+
+    db::FileCache cache = db::FileCache(graphPath, dataPath, TuringClient);
+
+    // First save uploads the files and the manifest
+    ASSERT_TRUE(cache.saveGraph("graph1"));
+    EXPECT_EQ(mockClient.getPutCount(), 4);
+    EXPECT_TRUE(mockClient.hasObject("turingDefault/graphs/graph1/manifest"));
+    EXPECT_TRUE(mockClient.hasObject("turingDefault/graphs/graph1/commit-0-1/nodes"));
+
+    // Nothing changed
+    mockClient.resetCounts();
+    ASSERT_TRUE(cache.saveGraph("graph1"));
+    EXPECT_EQ(mockClient.getPutCount(), 0);
+
+    // Only the new commit folder and the manifest are uploaded
+    mockClient.resetCounts();
+    dir.createSubDir("graphs/graph1/commit-1-2");
+    dir.createFile("graphs/graph1/commit-1-2/nodes");
+    ASSERT_TRUE(cache.saveGraph("graph1"));
+    EXPECT_EQ(mockClient.getPutCount(), 2);
+    EXPECT_TRUE(mockClient.hasObject("turingDefault/graphs/graph1/commit-1-2/nodes"));
+
+    // Files outside of the commit folders are overwritten when modified
+    mockClient.resetCounts();
+    {
+        std::ofstream info(dir.getPath() + "graphs/graph1/info");
+        info << "modified";
+    }
+    ASSERT_TRUE(cache.saveGraph("graph1"));
+    EXPECT_EQ(mockClient.getPutCount(), 2);
+    EXPECT_EQ(mockClient.getObjectData("turingDefault/graphs/graph1/info"), "modified");
+}
+
+TEST_F(FileCacheTest, ManifestSkipsLocalFiles) {
+    DummyDirectory dir(_tempTestDir, "FileCacheTest");
+    dir.createSubDir("data");
+    dir.createSubDir("graphs/graph1/commit-0-1");
+    dir.createSubDir("graphs/graph1/wal");
+    dir.createFile("graphs/graph1/info");
+    dir.createFile("graphs/graph1/type");
+    dir.createFile("graphs/graph1/commit-0-1/nodes");
+    dir.createFile("graphs/graph1/wal/segment-0");
+    dir.createFile("graphs/graph1/info.tmp");
+    fs::Path graphPath = fs::Path(dir.getPath() + "graphs");
+    fs::Path dataPath = fs::Path(dir.getPath() + "data");
+
+    // The write-ahead log and the other local files are not part of the dump
+    db::GraphManifest manifest;
+    ASSERT_TRUE(db::GraphManifest::build(manifest, dir.getPath() + "graphs/graph1/"));
+    ASSERT_EQ(manifest.entries().size(), 3);
+    EXPECT_TRUE(manifest.find("info"));
+    EXPECT_TRUE(manifest.find("type"));
+    EXPECT_TRUE(manifest.find("commit-0-1/nodes"));
+    EXPECT_FALSE(manifest.find("wal/segment-0"));
+    EXPECT_FALSE(manifest.find("info.tmp"));
+
+    S3::MockS3Client mockClient;
+    S3::AwsS3ClientWrapper<S3::MockS3Client> clientWrapper(mockClient);
+    S3::TuringS3Client<S3::AwsS3ClientWrapper<S3::MockS3Client>> TuringClient(std::move(clientWrapper));
+
+    db::FileCache cache = db::FileCache(graphPath, dataPath, TuringClient);
+
+    ASSERT_TRUE(cache.saveGraph("graph1"));
+    EXPECT_EQ(mockClient.getPutCount(), 4);
+    EXPECT_FALSE(mockClient.hasObject("turingDefault/graphs/graph1/wal/segment-0"));
+
+    // Writing to the log does not trigger an upload
+    mockClient.resetCounts();
+    dir.createFile("graphs/graph1/wal/segment-1");
+    ASSERT_TRUE(cache.saveGraph("graph1"));
+    EXPECT_EQ(mockClient.getPutCount(), 0);
+}
+
+TEST_F(FileCacheTest, IncrementalLoadGraph) {
+    DummyDirectory dir(_tempTestDir, "FileCacheTest");
+    dir.createSubDir("data");
+    dir.createSubDir("graphs/graph1/commit-0-1");
+    dir.createSubDir("graphs/graph1/commit-1-2");
+    dir.createFile("graphs/graph1/info");
+    dir.createFile("graphs/graph1/commit-0-1/nodes");
+    dir.createFile("graphs/graph1/commit-1-2/nodes");
+    dir.createSubDir("replica/graph1/commit-0-1");
+    dir.createFile("replica/graph1/info");
+    dir.createFile("replica/graph1/commit-0-1/nodes");
+    fs::Path graphPath = fs::Path(dir.getPath() + "graphs");
+    fs::Path replicaPath = fs::Path(dir.getPath() + "replica");
+    fs::Path dataPath = fs::Path(dir.getPath() + "data");
+
+    S3::MockS3Client mockClient;
+    S3::AwsS3ClientWrapper<S3::MockS3Client> clientWrapper(mockClient);
+    S3::TuringS3Client<S3::AwsS3ClientWrapper<S3::MockS3Client>> TuringClient(std::move(clientWrapper));
+
+    db::FileCache cache = db::FileCache(graphPath, dataPath, TuringClient);
+    ASSERT_TRUE(cache.saveGraph("graph1"));
+
+    // The replica only misses the second commit
+    db::FileCache replicaCache = db::FileCache(replicaPath, dataPath, TuringClient);
+    mockClient.resetCounts();
+    ASSERT_TRUE(replicaCache.loadGraph("graph1"));
+    EXPECT_EQ(mockClient.getGetCount(), 2);
+    EXPECT_TRUE((replicaPath / "graph1/commit-1-2/nodes").exists());
+
+    // Up to date
+    mockClient.resetCounts();
+    ASSERT_TRUE(replicaCache.loadGraph("graph1"));
+    EXPECT_EQ(mockClient.getGetCount(), 1);
+}
+
+TEST_F(FileCacheTest, MultipartTransfers) {
+    DummyDirectory dir(_tempTestDir, "FileCacheTest");
+    dir.createSubDir("data");
+    dir.createSubDir("graphs/graph1/commit-0-1");
+    fs::Path graphPath = fs::Path(dir.getPath() + "graphs");
+    fs::Path dataPath = fs::Path(dir.getPath() + "data");
+
+    std::string content;
+    for (size_t i = 0; i < 1000; i++) {
+        content += std::to_string(i);
+    }
+
+    {
+        std::ofstream file(dir.getPath() + "graphs/graph1/commit-0-1/nodes", std::ios_base::binary);
+        file << content;
+    }
+
+    auto jobSystem = db::JobSystem::create(4);
+
+    S3::MockS3Client mockClient;
+    S3::AwsS3ClientWrapper<S3::MockS3Client> clientWrapper(mockClient);
+    S3::TuringS3Client<S3::AwsS3ClientWrapper<S3::MockS3Client>> TuringClient(std::move(clientWrapper));
+    TuringClient.setJobSystem(jobSystem.get());
+    TuringClient.setPartSize(256);
+
+    const size_t partCount = (content.size() + 255) / 256;
+
+    db::FileCache cache = db::FileCache(graphPath, dataPath, TuringClient);
+    ASSERT_TRUE(cache.saveGraph("graph1"));
+    EXPECT_EQ(mockClient.getPartCount(), partCount);
+    EXPECT_EQ(mockClient.getObjectData("turingDefault/graphs/graph1/commit-0-1/nodes"), content);
+
+    // Downloaded back by ranges
+    std::filesystem::remove_all(dir.getPath() + "graphs/graph1");
+    mockClient.resetCounts();
+    ASSERT_TRUE(cache.loadGraph("graph1"));
+    EXPECT_EQ(mockClient.getGetCount(), partCount + 1);
+
+    std::ifstream file(dir.getPath() + "graphs/graph1/commit-0-1/nodes", std::ios_base::binary);
+    const std::string loaded {std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>()};
+    EXPECT_EQ(loaded, content);
+
+    jobSystem->terminate();
+}
+
 int main(int argc, char** argv) {
     return turing::test::turingTestMain(argc, argv, [] {
         testing::GTEST_FLAG(repeat) = 4;
@@ -306,6 +306,45 @@ TEST_F(PipelineTest, scanNodesLimit) {
     EXPECT_EQ(resultNodeIds, expectedNodeIDs);
 }
 
+TEST_F(PipelineTest, scanNodesLimitCancelsScan) {
+    LocalMemory mem;
+    PipelineV2 pipeline;
+
+    PipelineBuilder builder(&mem, &pipeline);
+
+    builder.setMaterializeProc(MaterializeProcessor::create(&pipeline, &mem));
+    builder.addScanNodes();
+    builder.addMaterialize();
+    builder.addLimit(3);
+
+    size_t rowCount = 0;
+    auto callback = [&](const Dataframe* df, LambdaProcessor::Operation operation) -> void {
+        rowCount += df->getRowCount();
+    };
+
+    builder.addLambda(callback);
+
+    const auto transaction = _graph->openTransaction();
+    const GraphView view = transaction.viewGraph();
+    ExecutionContext execCtxt(&_env->getSystemManager(), view);
+    execCtxt.setChunkSize(10);
+
+    PipelineExecutor executor(&pipeline, &execCtxt);
+    executor.setProfiling(true);
+    executor.execute();
+
+    EXPECT_EQ(rowCount, 3);
+
+    // The first chunk of the scan is sized to the limit
+    // and the scan is stopped once the limit is reached
+    ASSERT_EQ(pipeline.sources().size(), 1);
+    const Processor* scan = *pipeline.sources().begin();
+    EXPECT_EQ(scan->getRowLimit(), 3);
+    EXPECT_TRUE(scan->isCancelled());
+    EXPECT_EQ(scan->getProfile()._executions, 1);
+    EXPECT_EQ(scan->getProfile()._rowsOut, 3);
+}
+
 TEST_F(PipelineTest, scanNodesSkip) {
     LocalMemory mem;
     PipelineV2 pipeline;
@@ -573,3 +612,52 @@ TEST_F(PipelineTest, abcOverwrite) {
 
     ASSERT_EQ(returnedLines, expectedLines);
 }
+
+TEST_F(PipelineTest, resetAndExecuteAgain) {
+    LocalMemory mem;
+    PipelineV2 pipeline(&mem.getPipelineArena());
+
+    PipelineBuilder builder(&mem, &pipeline);
+
+    builder.setMaterializeProc(MaterializeProcessor::create(&pipeline, &mem));
+    builder.addScanNodes();
+    builder.addMaterialize();
+    builder.addLimit(3);
+    builder.addCount();
+
+    std::vector<size_t> counts;
+    auto callback = [&](const Dataframe* df, LambdaProcessor::Operation operation) -> void {
+        if (operation != LambdaProcessor::Operation::EXECUTE) {
+            return;
+        }
+
+        const auto* count = df->cols().front()->as<ColumnConst<types::UInt64::Primitive>>();
+        ASSERT_TRUE(count != nullptr);
+        counts.push_back(count->getRaw());
+    };
+
+    builder.addLambda(callback);
+
+    const auto transaction = _graph->openTransaction();
+    const GraphView view = transaction.viewGraph();
+    ExecutionContext execCtxt(&_env->getSystemManager(), view);
+    execCtxt.setChunkSize(2);
+
+    {
+        PipelineExecutor executor(&pipeline, &execCtxt);
+        executor.execute();
+    }
+
+    // The counters of the limit and of the count start again from zero
+    pipeline.reset();
+
+    {
+        PipelineExecutor executor(&pipeline, &execCtxt);
+        executor.execute();
+    }
+
+    ASSERT_FALSE(counts.empty());
+    EXPECT_EQ(counts.front(), 3);
+    EXPECT_EQ(counts.back(), 3);
+    EXPECT_TRUE(mem.getPipelineArena().getCapacity() > 0);
+}
@@ -16,6 +16,9 @@
 #include "PlanGraphGenerator.h"
 #include "PlanGraphDebug.h"
 #include "PlanGraphTester.h"
+#include "PlanOptimizer.h"
+#include "nodes/FilterNode.h"
+#include "nodes/JoinNode.h"
 #include "TuringTest.h"
 #include "TuringTestEnv.h"
 
@@ -321,6 +324,87 @@ TEST_F(PlanGenTest, matchMultiTargets1) {
     PlanGraphDebug::dumpMermaid(std::cout, view, planGraph);
 }
 
+TEST_F(PlanGenTest, optimizeTraversalDirection) {
+    const Transaction transaction = _graph->openTransaction();
+    const GraphView view = transaction.viewGraph();
+
+    const std::string queryStr = "MATCH (n)-[e]->(g:Supernatural) RETURN n";
+
+    CypherAST ast(*_procedures, queryStr);
+    CypherParser parser(&ast);
+    ASSERT_NO_THROW(parser.parse(queryStr));
+
+    CypherAnalyzer analyzer(&ast, view);
+    ASSERT_NO_THROW(analyzer.analyze());
+
+    PlanGraphGenerator planGen(ast, view);
+    planGen.generate(ast.queries().front());
+    PlanGraph& planGraph = planGen.getPlanGraph();
+
+    PlanOptimizer optimizer(&planGraph, view);
+    optimizer.optimize();
+
+    std::vector<PlanGraphNode*> roots;
+    planGraph.getRoots(roots);
+    ASSERT_EQ(roots.size(), 1);
+
+    // Only one node is Supernatural, the pattern is expanded from it
+    ASSERT_DOUBLE_EQ(roots.front()->getEstimatedRows(), 1.0);
+
+    PlanGraphTester(roots.front())
+        .expect(PlanGraphOpcode::SCAN_NODES_BY_LABEL)
+        .expectVar("g")
+        .expect(PlanGraphOpcode::GET_IN_EDGES)
+        .expect(PlanGraphOpcode::FILTER_EDGE)
+        .expectVar("e")
+        .expect(PlanGraphOpcode::GET_EDGE_TARGET)
+        .expect(PlanGraphOpcode::FILTER_NODE)
+        .expectVar("n")
+        .expect(PlanGraphOpcode::PRODUCE_RESULTS)
+        .validateComplete();
+}
+
+TEST_F(PlanGenTest, optimizeValueJoin) {
+    const Transaction transaction = _graph->openTransaction();
+    const GraphView view = transaction.viewGraph();
+
+    const std::string queryStr = "MATCH (n), (m) WHERE n.age = m.age AND n <> m RETURN n, m";
+
+    CypherAST ast(*_procedures, queryStr);
+    CypherParser parser(&ast);
+    ASSERT_NO_THROW(parser.parse(queryStr));
+
+    CypherAnalyzer analyzer(&ast, view);
+    ASSERT_NO_THROW(analyzer.analyze());
+
+    PlanGraphGenerator planGen(ast, view);
+    planGen.generate(ast.queries().front());
+    PlanGraph& planGraph = planGen.getPlanGraph();
+
+    PlanOptimizer optimizer(&planGraph, view);
+    optimizer.optimize();
+
+    const JoinNode* join = nullptr;
+    for (const auto& node : planGraph.nodes()) {
+        ASSERT_NE(node->getOpcode(), PlanGraphOpcode::CARTESIAN_PRODUCT);
+
+        if (node->getOpcode() == PlanGraphOpcode::JOIN) {
+            ASSERT_FALSE(join);
+            join = static_cast<const JoinNode*>(node.get());
+        }
+    }
+
+    ASSERT_TRUE(join);
+    ASSERT_EQ(join->getJoinType(), JoinType::PREDICATE);
+    ASSERT_EQ(join->inputs().size(), 2);
+    ASSERT_EQ(join->outputs().size(), 1);
+
+    // Only n <> m is left to the filter
+    const auto* filter = dynamic_cast<const FilterNode*>(join->outputs().front());
+    ASSERT_TRUE(filter);
+    ASSERT_EQ(filter->getPredicates().size(), 1);
+}
+
 int main(int argc, char** argv) {
     return turingTestMain(argc, argv, [] { testing::GTEST_FLAG(repeat) = 3; });
 }
@@ -4,12 +4,14 @@
 #include <set>
 #include <map>
 #include <vector>
+#include <optional>
 
 #include "TuringDB.h"
 #include "Graph.h"
 #include "SystemManager.h"
 #include "columns/ColumnIDs.h"
 #include "columns/ColumnOptVector.h"
+#include "columns/ColumnConst.h"
 #include "metadata/PropertyType.h"
 #include "ID.h"
 #include "versioning/Transaction.h"
@@ -1289,8 +1291,7 @@ TEST_F(JoinFeatureTest, joinWithPropertyProjection) {
 }
 
 // Test 27: Join with DISTINCT
-// DISABLED: DISTINCT to yet supported.
-TEST_F(JoinFeatureTest, DISABLED_joinWithDistinct) {
+TEST_F(JoinFeatureTest, joinWithDistinct) {
     constexpr std::string_view QUERY = R"(
         MATCH (a:Person)-->(b:Interest)<--(c:Person)
         WHERE a.name <> c.name
@@ -1299,24 +1300,83 @@ TEST_F(JoinFeatureTest, DISABLED_joinWithDistinct) {
 
     using String = types::String::Primitive;
 
+    size_t rowCount = 0;
     std::set<String> distinctInterests;
     auto res = query(QUERY, [&](const Dataframe* df) {
         ASSERT_TRUE(df);
         auto* bNames = findColumn(df, "b.name");
-        if (bNames) {
-            auto* bCol = bNames->as<ColumnOptVector<String>>();
-            if (bCol) {
-                for (size_t i = 0; i < bCol->size(); i++) {
-                    if (bCol->at(i)) {
-                        distinctInterests.insert(*bCol->at(i));
-                    }
-                }
+        ASSERT_TRUE(bNames);
+        auto* bCol = bNames->as<ColumnOptVector<String>>();
+        ASSERT_TRUE(bCol);
+        for (size_t i = 0; i < bCol->size(); i++) {
+            rowCount++;
+            if (bCol->at(i)) {
+                distinctInterests.insert(*bCol->at(i));
             }
         }
     });
     ASSERT_TRUE(res);
+
     // Shared interests: Shared (A,B,C), MegaHub (A,B,C,D,E)
-    // Expected: 2 distinct interests
+    // Expected: 2 distinct interests, each returned once
+    ASSERT_EQ(distinctInterests, (std::set<String> {"MegaHub", "Shared"}));
+    ASSERT_EQ(rowCount, 2);
+}
+
+// Test 27b: count(DISTINCT) after a join
+TEST_F(JoinFeatureTest, joinWithCountDistinct) {
+    constexpr std::string_view QUERY = R"(
+        MATCH (a:Person)-->(b:Interest)<--(c:Person)
+        WHERE a.name <> c.name
+        RETURN count(DISTINCT b)
+    )";
+
+    std::optional<uint64_t> count;
+    auto res = query(QUERY, [&](const Dataframe* df) {
+        ASSERT_TRUE(df);
+        ASSERT_EQ(df->size(), 1);
+        const auto* countCol = dynamic_cast<const ColumnConst<types::UInt64::Primitive>*>(df->cols().front()->getColumn());
+        ASSERT_TRUE(countCol);
+        count = countCol->getRaw();
+    });
+    ASSERT_TRUE(res);
+    ASSERT_EQ(count, 2);
+}
+
+// Test 27c: DISTINCT with a constant key
+TEST_F(JoinFeatureTest, joinWithDistinctConstantKey) {
+    constexpr std::string_view QUERY = R"(
+        MATCH (a:Person)-->(b:Interest)<--(c:Person)
+        WHERE a.name <> c.name
+        RETURN DISTINCT b.name, 1
+    )";
+
+    using String = types::String::Primitive;
+    using Int64 = types::Int64::Primitive;
+
+    size_t rowCount = 0;
+    std::set<String> distinctInterests;
+    auto res = query(QUERY, [&](const Dataframe* df) {
+        ASSERT_TRUE(df);
+        ASSERT_EQ(df->size(), 2);
+        auto* bCol = df->cols().at(0)->as<ColumnOptVector<String>>();
+        auto* constCol = dynamic_cast<const ColumnConst<Int64>*>(df->cols().at(1)->getColumn());
+        ASSERT_TRUE(bCol);
+        ASSERT_TRUE(constCol);
+        EXPECT_EQ(constCol->getRaw(), 1);
+
+        for (size_t i = 0; i < bCol->size(); i++) {
+            rowCount++;
+            if (bCol->at(i)) {
+                distinctInterests.insert(*bCol->at(i));
+            }
+        }
+    });
+    ASSERT_TRUE(res) << res.getError();
+
+    // The constant does not change the distinct rows
+    ASSERT_EQ(distinctInterests, (std::set<String> {"MegaHub", "Shared"}));
+    ASSERT_EQ(rowCount, 2);
 }
 
 // =============================================================================
@@ -3785,6 +3845,605 @@ TEST_F(JoinFeatureTest, commaMatch_categoryChainWithPerson) {
     ASSERT_TRUE(expected.equals(actual));
 }
 
+// =============================================================================
+// CATEGORY 10: OPTIONAL MATCH
+// Left outer expansions from the nodes of a previous MATCH
+// =============================================================================
+
+// Test 59: Persons without a city are kept with a null city
+TEST_F(JoinFeatureTest, optionalMatch_personWithoutCity) {
+    constexpr std::string_view QUERY = R"(
+        MATCH (p:Person)
+        OPTIONAL MATCH (p)-[:LIVES_IN]->(c)
+        RETURN p.name, c.name
+    )";
+
+    using String = types::String::Primitive;
+
+    std::map<String, std::optional<String>> cities;
+    size_t rowCount = 0;
+    auto res = query(QUERY, [&](const Dataframe* df) {
+        ASSERT_TRUE(df);
+        auto* pNames = findColumn(df, "p.name");
+        auto* cNames = findColumn(df, "c.name");
+        ASSERT_TRUE(pNames && cNames);
+        auto* pCol = pNames->as<ColumnOptVector<String>>();
+        auto* cCol = cNames->as<ColumnOptVector<String>>();
+        ASSERT_TRUE(pCol && cCol);
+        for (size_t i = 0; i < pCol->size(); i++) {
+            rowCount++;
+            ASSERT_TRUE(pCol->at(i));
+            cities[*pCol->at(i)] = cCol->at(i);
+        }
+    });
+    ASSERT_TRUE(res);
+
+    // Every person is returned once, F has no LIVES_IN edge
+    ASSERT_EQ(rowCount, 6);
+    const std::map<String, std::optional<String>> expected {
+        {"A", "Paris"},
+        {"B", "Paris"},
+        {"C", "London"},
+        {"D", "London"},
+        {"E", "Berlin"},
+        {"F", std::nullopt},
+    };
+    ASSERT_EQ(cities, expected);
+}
+
+// Test 60: Backward optional expansion, interests without persons get null persons
+TEST_F(JoinFeatureTest, optionalMatch_interestsWithoutPersons) {
+    constexpr std::string_view QUERY = R"(
+        MATCH (i:Interest)
+        OPTIONAL MATCH (i)<-[:INTERESTED_IN]-(p)
+        RETURN i, p
+    )";
+
+    size_t rowCount = 0;
+    size_t nullCount = 0;
+    auto res = query(QUERY, [&](const Dataframe* df) {
+        ASSERT_TRUE(df);
+        auto* pCol = findColumn(df, "p");
+        ASSERT_TRUE(pCol);
+        auto* persons = pCol->as<ColumnNodeIDs>();
+        ASSERT_TRUE(persons);
+        for (const NodeID p : persons->getRaw()) {
+            rowCount++;
+            if (!p.isValid()) {
+                nullCount++;
+            }
+        }
+    });
+    ASSERT_TRUE(res);
+
+    // Shared: 3, Unique: 1, MegaHub: 5, the unnamed interest and Orphan: null
+    ASSERT_EQ(rowCount, 11);
+    ASSERT_EQ(nullCount, 2);
+}
+
+// Test 61: count() of an optional variable does not count the nulls
+TEST_F(JoinFeatureTest, optionalMatch_countOptionalTarget) {
+    constexpr std::string_view QUERY = R"(
+        MATCH (p:Person)
+        OPTIONAL MATCH (p)-[:WORKS_AT]->(c)
+        RETURN count(c)
+    )";
+
+    std::optional<uint64_t> count;
+    auto res = query(QUERY, [&](const Dataframe* df) {
+        ASSERT_TRUE(df);
+        ASSERT_EQ(df->size(), 1);
+        const auto* countCol = dynamic_cast<const ColumnConst<types::UInt64::Primitive>*>(df->cols().front()->getColumn());
+        ASSERT_TRUE(countCol);
+        count = countCol->getRaw();
+    });
+    ASSERT_TRUE(res);
+    ASSERT_EQ(count, 5);
+}
+
+// Test 62: WHERE on the optional target, persons not living in Paris are null-extended
+TEST_F(JoinFeatureTest, optionalMatch_whereOnTarget) {
+    constexpr std::string_view QUERY = R"(
+        MATCH (p:Person)
+        OPTIONAL MATCH (p)-[:LIVES_IN]->(c)
+        WHERE c.name = 'Paris'
+        RETURN p.name, c.name
+    )";
+
+    using String = types::String::Primitive;
+
+    std::map<String, std::optional<String>> cities;
+    size_t rowCount = 0;
+    auto res = query(QUERY, [&](const Dataframe* df) {
+        ASSERT_TRUE(df);
+        auto* pNames = findColumn(df, "p.name");
+        auto* cNames = findColumn(df, "c.name");
+        ASSERT_TRUE(pNames && cNames);
+        auto* pCol = pNames->as<ColumnOptVector<String>>();
+        auto* cCol = cNames->as<ColumnOptVector<String>>();
+        ASSERT_TRUE(pCol && cCol);
+        for (size_t i = 0; i < pCol->size(); i++) {
+            rowCount++;
+            ASSERT_TRUE(pCol->at(i));
+            cities[*pCol->at(i)] = cCol->at(i);
+        }
+    });
+    ASSERT_TRUE(res);
+
+    // The WHERE clause does not drop the persons living elsewhere
+    ASSERT_EQ(rowCount, 6);
+    const std::map<String, std::optional<String>> expected {
+        {"A", "Paris"},
+        {"B", "Paris"},
+        {"C", std::nullopt},
+        {"D", std::nullopt},
+        {"E", std::nullopt},
+        {"F", std::nullopt},
+    };
+    ASSERT_EQ(cities, expected);
+}
+
+// Test 63: Label on the optional target and WHERE on its property
+TEST_F(JoinFeatureTest, optionalMatch_labelAndWhereOnTarget) {
+    constexpr std::string_view QUERY = R"(
+        MATCH (p:Person)
+        OPTIONAL MATCH (p)-->(m:Person)
+        WHERE m.isFrench = true
+        RETURN p.name, m.name
+    )";
+
+    using String = types::String::Primitive;
+    using Row = std::pair<String, std::optional<String>>;
+
+    std::multiset<Row> rows;
+    auto res = query(QUERY, [&](const Dataframe* df) {
+        ASSERT_TRUE(df);
+        auto* pNames = findColumn(df, "p.name");
+        auto* mNames = findColumn(df, "m.name");
+        ASSERT_TRUE(pNames && mNames);
+        auto* pCol = pNames->as<ColumnOptVector<String>>();
+        auto* mCol = mNames->as<ColumnOptVector<String>>();
+        ASSERT_TRUE(pCol && mCol);
+        for (size_t i = 0; i < pCol->size(); i++) {
+            ASSERT_TRUE(pCol->at(i));
+            rows.emplace(*pCol->at(i), mCol->at(i));
+        }
+    });
+    ASSERT_TRUE(res);
+
+    // Only the KNOWS edges reach persons, C and D are not French,
+    // E has no isFrench property so D -> E does not match either
+    const std::multiset<Row> expected {
+        {"A", "B"},
+        {"B", "A"},
+        {"C", "A"},
+        {"D", std::nullopt},
+        {"E", std::nullopt},
+        {"F", std::nullopt},
+    };
+    ASSERT_EQ(rows, expected);
+}
+
+// Test 64: Label and property constraints in the optional pattern
+TEST_F(JoinFeatureTest, optionalMatch_patternConstraintsOnTarget) {
+    constexpr std::string_view QUERY = R"(
+        MATCH (p:Person)
+        OPTIONAL MATCH (p)-[:WORKS_AT]->(c:Company {name: 'DataInc'})
+        RETURN p.name, c.name
+    )";
+
+    using String = types::String::Primitive;
+
+    std::map<String, std::optional<String>> companies;
+    size_t rowCount = 0;
+    auto res = query(QUERY, [&](const Dataframe* df) {
+        ASSERT_TRUE(df);
+        auto* pNames = findColumn(df, "p.name");
+        auto* cNames = findColumn(df, "c.name");
+        ASSERT_TRUE(pNames && cNames);
+        auto* pCol = pNames->as<ColumnOptVector<String>>();
+        auto* cCol = cNames->as<ColumnOptVector<String>>();
+        ASSERT_TRUE(pCol && cCol);
+        for (size_t i = 0; i < pCol->size(); i++) {
+            rowCount++;
+            ASSERT_TRUE(pCol->at(i));
+            companies[*pCol->at(i)] = cCol->at(i);
+        }
+    });
+    ASSERT_TRUE(res);
+
+    ASSERT_EQ(rowCount, 6);
+    const std::map<String, std::optional<String>> expected {
+        {"A", std::nullopt},
+        {"B", std::nullopt},
+        {"C", "DataInc"},
+        {"D", "DataInc"},
+        {"E", std::nullopt},
+        {"F", std::nullopt},
+    };
+    ASSERT_EQ(companies, expected);
+}
+
+// Test 65: WHERE comparing the optional target with the bound node is not supported yet
+TEST_F(JoinFeatureTest, optionalMatch_whereOnBoundNodeNotSupported) {
+    constexpr std::string_view QUERY = R"(
+        MATCH (p:Person)
+        OPTIONAL MATCH (p)-[:LIVES_IN]->(c)
+        WHERE c.name = p.name
+        RETURN p.name, c.name
+    )";
+
+    bool callbackCalled = false;
+    auto res = query(QUERY, [&](const Dataframe*) {
+        callbackCalled = true;
+    });
+    ASSERT_FALSE(res);
+    EXPECT_FALSE(callbackCalled);
+}
+
+// =============================================================================
+// CATEGORY 11: MULTIPLE EDGE TYPES
+// Expansions matching any of several edge types in a single pass
+// =============================================================================
+
+// Test 66: Persons with their cities and companies
+TEST_F(JoinFeatureTest, multiEdgeType_livesInOrWorksAt) {
+    constexpr std::string_view QUERY = R"(
+        MATCH (p:Person)-[:LIVES_IN|WORKS_AT]->(x)
+        RETURN p.name, x.name
+    )";
+
+    using String = types::String::Primitive;
+
+    std::multiset<std::pair<String, String>> pairs;
+    auto res = query(QUERY, [&](const Dataframe* df) {
+        ASSERT_TRUE(df);
+        auto* pNames = findColumn(df, "p.name");
+        auto* xNames = findColumn(df, "x.name");
+        ASSERT_TRUE(pNames && xNames);
+        auto* pCol = pNames->as<ColumnOptVector<String>>();
+        auto* xCol = xNames->as<ColumnOptVector<String>>();
+        ASSERT_TRUE(pCol && xCol);
+        for (size_t i = 0; i < pCol->size(); i++) {
+            ASSERT_TRUE(pCol->at(i) && xCol->at(i));
+            pairs.emplace(*pCol->at(i), *xCol->at(i));
+        }
+    });
+    ASSERT_TRUE(res);
+
+    const std::multiset<std::pair<String, String>> expected {
+        {"A", "Paris"}, {"A", "TechCorp"},
+        {"B", "Paris"}, {"B", "TechCorp"},
+        {"C", "London"}, {"C", "DataInc"},
+        {"D", "London"}, {"D", "DataInc"},
+        {"E", "Berlin"}, {"E", "CloudLtd"},
+    };
+    ASSERT_EQ(pairs, expected);
+}
+
+// Test 67: Backward expansion with the |: syntax, 5 persons and 3 companies
+TEST_F(JoinFeatureTest, multiEdgeType_countIntoCities) {
+    constexpr std::string_view QUERY = R"(
+        MATCH (c:City)<-[:LIVES_IN|:LOCATED_IN]-(x)
+        RETURN count(x)
+    )";
+
+    std::optional<uint64_t> count;
+    auto res = query(QUERY, [&](const Dataframe* df) {
+        ASSERT_TRUE(df);
+        ASSERT_EQ(df->size(), 1);
+        const auto* countCol = dynamic_cast<const ColumnConst<types::UInt64::Primitive>*>(df->cols().front()->getColumn());
+        ASSERT_TRUE(countCol);
+        count = countCol->getRaw();
+    });
+    ASSERT_TRUE(res);
+    ASSERT_EQ(count, 8);
+}
+
+// Test 68: Optional expansion on several edge types, F is kept with a null
+TEST_F(JoinFeatureTest, multiEdgeType_optionalKnowsOrWorksAt) {
+    constexpr std::string_view QUERY = R"(
+        MATCH (p:Person)
+        OPTIONAL MATCH (p)-[:KNOWS|WORKS_AT]->(x)
+        RETURN count(p)
+    )";
+
+    std::optional<uint64_t> count;
+    auto res = query(QUERY, [&](const Dataframe* df) {
+        ASSERT_TRUE(df);
+        ASSERT_EQ(df->size(), 1);
+        const auto* countCol = dynamic_cast<const ColumnConst<types::UInt64::Primitive>*>(df->cols().front()->getColumn());
+        ASSERT_TRUE(countCol);
+        count = countCol->getRaw();
+    });
+    ASSERT_TRUE(res);
+
+    // 7 KNOWS and 5 WORKS_AT edges, plus the row of F
+    ASSERT_EQ(count, 13);
+}
+
+// Test 69: Edge types in both the pattern and the WHERE clause are not supported yet
+TEST_F(JoinFeatureTest, multiEdgeType_patternAndWhereNotSupported) {
+    constexpr std::string_view QUERY = R"(
+        MATCH (p:Person)-[e:LIVES_IN|WORKS_AT]->(x)
+        WHERE e:WORKS_AT
+        RETURN p.name
+    )";
+
+    bool callbackCalled = false;
+    auto res = query(QUERY, [&](const Dataframe*) {
+        callbackCalled = true;
+    });
+    ASSERT_FALSE(res);
+    EXPECT_FALSE(callbackCalled);
+}
+
+// =============================================================================
+// CATEGORY 12: VALUE JOINS
+// Equality predicates between the properties of two comma-separated patterns,
+// joined on the property values by a hash join
+// =============================================================================
+
+namespace {
+
+using String = types::String::Primitive;
+using NameRows = std::multiset<std::pair<String, String>>;
+
+NameRows collectNameRows(const Dataframe* df) {
+    NameRows rows;
+    const auto* aNames = df->cols().at(0)->as<ColumnOptVector<String>>();
+    const auto* bNames = df->cols().at(1)->as<ColumnOptVector<String>>();
+    if (!aNames || !bNames) {
+        return rows;
+    }
+
+    for (size_t i = 0; i < aNames->size(); i++) {
+        if (aNames->at(i) && bNames->at(i)) {
+            rows.emplace(*aNames->at(i), *bNames->at(i));
+        }
+    }
+
+    return rows;
+}
+
+}
+
+// Test 70: Int64 keys with duplicates on both sides, missing keys never match
+TEST_F(JoinFeatureTest, valueJoin_intKeys) {
+    {
+        GraphWriter writer {_graph};
+        const auto addNode = [&](std::string_view label, std::string_view name,
+                                 std::optional<int64_t> key) {
+            const NodeID node = writer.addNode({label});
+            writer.addNodeProperty<types::String>(node, "name", std::string_view {name});
+            if (key) {
+                writer.addNodeProperty<types::Int64>(node, "key", int64_t {*key});
+            }
+        };
+
+        addNode("Left", "L1", 1);
+        addNode("Left", "L2", 2);
+        addNode("Left", "L3", 2);
+        addNode("Left", "L4", std::nullopt);
+        addNode("Left", "L5", 7);
+
+        addNode("Right", "R1", 2);
+        addNode("Right", "R2", 2);
+        addNode("Right", "R3", 1);
+        addNode("Right", "R4", std::nullopt);
+        addNode("Right", "R5", 3);
+
+        ASSERT_TRUE(writer.submit());
+    }
+
+    constexpr std::string_view QUERY = R"(
+        MATCH (a:Left), (b:Right)
+        WHERE a.key = b.key
+        RETURN a.name, b.name
+    )";
+
+    NameRows rows;
+    auto res = query(QUERY, [&](const Dataframe* df) {
+        ASSERT_TRUE(df);
+        ASSERT_EQ(df->cols().size(), 2);
+        rows.merge(collectNameRows(df));
+    });
+    ASSERT_TRUE(res);
+
+    const NameRows expected {
+        {"L1", "R3"},
+        {"L2", "R1"},
+        {"L2", "R2"},
+        {"L3", "R1"},
+        {"L3", "R2"},
+    };
+    ASSERT_EQ(rows, expected);
+}
+
+// Test 71: String keys, the empty string is a value and missing keys never match
+TEST_F(JoinFeatureTest, valueJoin_stringKeys) {
+    {
+        GraphWriter writer {_graph};
+        const auto addNode = [&](std::string_view label, std::string_view name,
+                                 std::optional<std::string_view> key) {
+            const NodeID node = writer.addNode({label});
+            writer.addNodeProperty<types::String>(node, "name", std::string_view {name});
+            if (key) {
+                writer.addNodeProperty<types::String>(node, "code", std::string_view {*key});
+            }
+        };
+
+        addNode("Left", "L1", "x");
+        addNode("Left", "L2", "y");
+        addNode("Left", "L3", "y");
+        addNode("Left", "L4", std::nullopt);
+        addNode("Left", "L5", "");
+
+        addNode("Right", "R1", "y");
+        addNode("Right", "R2", "y");
+        addNode("Right", "R3", "x");
+        addNode("Right", "R4", std::nullopt);
+        addNode("Right", "R5", "");
+        addNode("Right", "R6", "z");
+
+        ASSERT_TRUE(writer.submit());
+    }
+
+    constexpr std::string_view QUERY = R"(
+        MATCH (a:Left), (b:Right)
+        WHERE a.code = b.code
+        RETURN a.name, b.name
+    )";
+
+    NameRows rows;
+    auto res = query(QUERY, [&](const Dataframe* df) {
+        ASSERT_TRUE(df);
+        ASSERT_EQ(df->cols().size(), 2);
+        rows.merge(collectNameRows(df));
+    });
+    ASSERT_TRUE(res);
+
+    const NameRows expected {
+        {"L1", "R3"},
+        {"L2", "R1"},
+        {"L2", "R2"},
+        {"L3", "R1"},
+        {"L3", "R2"},
+        {"L5", "R5"},
+    };
+    ASSERT_EQ(rows, expected);
+}
+
+// Test 72: Keys missing on one whole side give no row
+TEST_F(JoinFeatureTest, valueJoin_missingKeys) {
+    {
+        GraphWriter writer {_graph};
+        for (const std::string_view name : {"L1", "L2"}) {
+            const NodeID node = writer.addNode({"Left"});
+            writer.addNodeProperty<types::String>(node, "name", std::string_view {name});
+        }
+
+        const NodeID right = writer.addNode({"Right"});
+        writer.addNodeProperty<types::String>(right, "name", "R1");
+        writer.addNodeProperty<types::Int64>(right, "key", 1);
+
+        ASSERT_TRUE(writer.submit());
+    }
+
+    constexpr std::string_view QUERY = R"(
+        MATCH (a:Left), (b:Right)
+        WHERE a.key = b.key
+        RETURN a.name, b.name
+    )";
+
+    NameRows rows;
+    auto res = query(QUERY, [&](const Dataframe* df) {
+        ASSERT_TRUE(df);
+        rows.merge(collectNameRows(df));
+    });
+    ASSERT_TRUE(res);
+    ASSERT_TRUE(rows.empty());
+}
+
+// Test 73: A side large enough to split its hash table in several partitions
+TEST_F(JoinFeatureTest, valueJoin_largeSide) {
+    constexpr int64_t rightCount = 100000;
+
+    {
+        GraphWriter writer {_graph};
+        for (int64_t i = 0; i < rightCount; i++) {
+            const NodeID node = writer.addNode({"Right"});
+            writer.addNodeProperty<types::String>(node, "name", fmt::format("R{}", i));
+            writer.addNodeProperty<types::Int64>(node, "key", int64_t {i});
+        }
+
+        // Duplicate of an existing key
+        const NodeID duplicate = writer.addNode({"Right"});
+        writer.addNodeProperty<types::String>(duplicate, "name", "Rdup");
+        writer.addNodeProperty<types::Int64>(duplicate, "key", 5);
+
+        const auto addLeft = [&](std::string_view name, std::optional<int64_t> key) {
+            const NodeID node = writer.addNode({"Left"});
+            writer.addNodeProperty<types::String>(node, "name", std::string_view {name});
+            if (key) {
+                writer.addNodeProperty<types::Int64>(node, "key", int64_t {*key});
+            }
+        };
+
+        addLeft("L1", 5);
+        addLeft("L2", rightCount - 1);
+        addLeft("L3", rightCount);
+        addLeft("L4", std::nullopt);
+
+        ASSERT_TRUE(writer.submit());
+    }
+
+    constexpr std::string_view QUERY = R"(
+        MATCH (a:Left), (b:Right)
+        WHERE a.key = b.key
+        RETURN a.name, b.name
+    )";
+
+    NameRows rows;
+    auto res = query(QUERY, [&](const Dataframe* df) {
+        ASSERT_TRUE(df);
+        rows.merge(collectNameRows(df));
+    });
+    ASSERT_TRUE(res);
+
+    const std::string lastRight = fmt::format("R{}", rightCount - 1);
+    const NameRows expected {
+        {"L1", "R5"},
+        {"L1", "Rdup"},
+        {"L2", lastRight},
+    };
+    ASSERT_EQ(rows, expected);
+}
+
+// Test 74: Double keys, -0.0 and 0.0 are the same key
+TEST_F(JoinFeatureTest, valueJoin_doubleKeys) {
+    {
+        GraphWriter writer {_graph};
+        const auto addNode = [&](std::string_view label, std::string_view name, double value) {
+            const NodeID node = writer.addNode({label});
+            writer.addNodeProperty<types::String>(node, "name", std::string_view {name});
+            writer.addNodeProperty<types::Double>(node, "value", value);
+        };
+
+        addNode("Left", "L1", 0.0);
+        addNode("Left", "L2", -0.0);
+        addNode("Left", "L3", 1.5);
+        addNode("Left", "L4", -2.25);
+
+        addNode("Right", "R1", -0.0);
+        addNode("Right", "R2", 1.5);
+        addNode("Right", "R3", 2.25);
+
+        ASSERT_TRUE(writer.submit());
+    }
+
+    constexpr std::string_view QUERY = R"(
+        MATCH (a:Left), (b:Right)
+        WHERE a.value = b.value
+        RETURN a.name, b.name
+    )";
+
+    NameRows rows;
+    auto res = query(QUERY, [&](const Dataframe* df) {
+        ASSERT_TRUE(df);
+        ASSERT_EQ(df->cols().size(), 2);
+        rows.merge(collectNameRows(df));
+    });
+    ASSERT_TRUE(res);
+
+    const NameRows expected {
+        {"L1", "R1"},
+        {"L2", "R1"},
+        {"L3", "R2"},
+    };
+    ASSERT_EQ(rows, expected);
+}
+
 int main(int argc, char** argv) {
     return turing::test::turingTestMain(argc, argv, [] {
         testing::GTEST_FLAG(repeat) = 3;
@@ -1,6 +1,8 @@
 #include <gtest/gtest.h>
 #include <optional>
 #include <cstdint>
+#include <algorithm>
+#include <vector>
 
 #include "EdgeRecord.h"
 #include "TuringDB.h"
@@ -8,6 +10,7 @@
 #include "SimpleGraph.h"
 #include "SystemManager.h"
 #include "columns/ColumnIDs.h"
+#include "columns/ColumnOptVector.h"
 #include "metadata/PropertyType.h"
 #include "versioning/Change.h"
 #include "versioning/Transaction.h"
@@ -779,6 +782,41 @@ TEST_F(MatchCreateTest, matchManyCreateMany) {
     ASSERT_EQ(read().getTotalNodesAllocated(), nodesBefore + personCount);
 }
 
+TEST_F(MatchCreateTest, matchManyCreateManyWithLimit) {
+    // The LIMIT only applies to the returned rows, CREATE still executes once per MATCH result
+    constexpr std::string_view QUERY = R"(MATCH (n:Person) CREATE (m:LimitedCopy) RETURN n, m LIMIT 1)";
+
+    const size_t nodesBefore = read().getTotalNodesAllocated();
+
+    size_t personCount = 0;
+    {
+        auto res = query(R"(MATCH (n:Person) RETURN n)", [&](const Dataframe* df) {
+            personCount = df->getRowCount();
+        });
+        ASSERT_TRUE(res);
+    }
+    ASSERT_GT(personCount, 1);
+
+    newChange();
+    size_t rowCount = 0;
+    auto res = query(QUERY, [&](const Dataframe* df) {
+        ASSERT_TRUE(df);
+        rowCount += df->getRowCount();
+    });
+    ASSERT_TRUE(res);
+    submitCurrentChange();
+
+    ASSERT_EQ(rowCount, 1);
+    ASSERT_EQ(read().getTotalNodesAllocated(), nodesBefore + personCount);
+
+    size_t copyCount = 0;
+    res = query(R"(MATCH (n:LimitedCopy) RETURN n)", [&](const Dataframe* df) {
+        copyCount += df->getRowCount();
+    });
+    ASSERT_TRUE(res);
+    ASSERT_EQ(copyCount, personCount);
+}
+
 TEST_F(MatchCreateTest, matchCartesianCreate) {
     // MATCH cartesian product - CREATE should multiply
     constexpr std::string_view QUERY = R"(MATCH (a:Person), (b:Interest) CREATE (link:Link) RETURN a, b, link)";
@@ -1242,3 +1280,137 @@ TEST_F(MatchCreateTest, matchCreateWithStaticProperties) {
     EXPECT_EQ(*count, 42) << "count should be 42";
     EXPECT_TRUE(static_cast<bool>(*active)) << "active should be true";
 }
+
+TEST_F(MatchCreateTest, matchManyCreateWithProperties) {
+    // Properties are written as whole columns, one value per MATCH result
+    constexpr std::string_view QUERY =
+        R"(MATCH (n:Person) CREATE (n)-[e:TAGGED{weight:1.5}]->(m:Tag{name:"tag", rank:7}) RETURN n, m)";
+
+    size_t personCount = 0;
+    {
+        auto res = query(R"(MATCH (n:Person) RETURN n)", [&](const Dataframe* df) {
+            personCount = df->getRowCount();
+        });
+        ASSERT_TRUE(res);
+    }
+    ASSERT_GT(personCount, 1);
+
+    newChange();
+    auto res = query(QUERY, [&](const Dataframe* df) {
+        ASSERT_TRUE(df);
+        ASSERT_EQ(df->getRowCount(), personCount);
+    });
+    ASSERT_TRUE(res);
+    submitCurrentChange();
+
+    size_t tagCount = 0;
+    res = query(R"(MATCH (n:Person)-[e:TAGGED]->(m:Tag) RETURN e.weight, m.name, m.rank)",
+                [&](const Dataframe* df) {
+        ASSERT_TRUE(df);
+        ASSERT_EQ(df->size(), 3);
+
+        auto* weights = df->cols().at(0)->as<ColumnOptVector<types::Double::Primitive>>();
+        auto* names = df->cols().at(1)->as<ColumnOptVector<types::String::Primitive>>();
+        auto* ranks = df->cols().at(2)->as<ColumnOptVector<types::Int64::Primitive>>();
+        ASSERT_TRUE(weights);
+        ASSERT_TRUE(names);
+        ASSERT_TRUE(ranks);
+
+        for (size_t i = 0; i < df->getRowCount(); ++i) {
+            ASSERT_TRUE(weights->at(i));
+            ASSERT_TRUE(names->at(i));
+            ASSERT_TRUE(ranks->at(i));
+            EXPECT_EQ(*weights->at(i), 1.5);
+            EXPECT_EQ(*names->at(i), "tag");
+            EXPECT_EQ(*ranks->at(i), 7);
+        }
+
+        tagCount += df->getRowCount();
+    });
+    ASSERT_TRUE(res);
+    ASSERT_EQ(tagCount, personCount);
+}
+
+TEST_F(MatchCreateTest, matchCreateWithMatchedProperties) {
+    // Each created node takes the values of its own MATCH row, Maxime has no age
+    constexpr std::string_view QUERY =
+        R"(MATCH (n:Person) CREATE (m:Copy{name:n.name, age:n.age}) RETURN n.name, n.age, m.name, m.age)";
+
+    using String = types::String::Primitive;
+    using Int64 = types::Int64::Primitive;
+    using Row = std::pair<std::optional<std::string>, std::optional<int64_t>>;
+
+    const auto collectRows = [](const ColumnOptVector<String>* names,
+                                const ColumnOptVector<Int64>* ages,
+                                std::vector<Row>& rows) {
+        for (size_t i = 0; i < names->size(); ++i) {
+            std::optional<std::string> name;
+            std::optional<int64_t> age;
+            if (names->at(i)) {
+                name = std::string(*names->at(i));
+            }
+            if (ages->at(i)) {
+                age = *ages->at(i);
+            }
+            rows.emplace_back(std::move(name), age);
+        }
+    };
+
+    std::vector<Row> personRows;
+    {
+        auto res = query(R"(MATCH (n:Person) RETURN n.name, n.age)", [&](const Dataframe* df) {
+            ASSERT_TRUE(df);
+            ASSERT_EQ(df->size(), 2);
+            auto* names = df->cols().at(0)->as<ColumnOptVector<String>>();
+            auto* ages = df->cols().at(1)->as<ColumnOptVector<Int64>>();
+            ASSERT_TRUE(names);
+            ASSERT_TRUE(ages);
+            collectRows(names, ages, personRows);
+        });
+        ASSERT_TRUE(res);
+    }
+    ASSERT_GT(personRows.size(), 1);
+    ASSERT_TRUE(std::ranges::any_of(personRows, [](const Row& row) { return !row.second; }));
+
+    newChange();
+    std::vector<Row> matchedRows;
+    std::vector<Row> createdRows;
+    auto res = query(QUERY, [&](const Dataframe* df) {
+        ASSERT_TRUE(df);
+        ASSERT_EQ(df->size(), 4);
+        auto* nNames = df->cols().at(0)->as<ColumnOptVector<String>>();
+        auto* nAges = df->cols().at(1)->as<ColumnOptVector<Int64>>();
+        auto* mNames = df->cols().at(2)->as<ColumnOptVector<String>>();
+        auto* mAges = df->cols().at(3)->as<ColumnOptVector<Int64>>();
+        ASSERT_TRUE(nNames);
+        ASSERT_TRUE(nAges);
+        ASSERT_TRUE(mNames);
+        ASSERT_TRUE(mAges);
+        collectRows(nNames, nAges, matchedRows);
+        collectRows(mNames, mAges, createdRows);
+    });
+    ASSERT_TRUE(res) << res.getError();
+    submitCurrentChange();
+
+    // Row by row, the created node holds the values of the matched one
+    ASSERT_EQ(createdRows.size(), matchedRows.size());
+    for (size_t i = 0; i < matchedRows.size(); ++i) {
+        EXPECT_EQ(createdRows[i], matchedRows[i]) << "row " << i;
+    }
+
+    std::vector<Row> copyRows;
+    res = query(R"(MATCH (m:Copy) RETURN m.name, m.age)", [&](const Dataframe* df) {
+        ASSERT_TRUE(df);
+        ASSERT_EQ(df->size(), 2);
+        auto* names = df->cols().at(0)->as<ColumnOptVector<String>>();
+        auto* ages = df->cols().at(1)->as<ColumnOptVector<Int64>>();
+        ASSERT_TRUE(names);
+        ASSERT_TRUE(ages);
+        collectRows(names, ages, copyRows);
+    });
+    ASSERT_TRUE(res);
+
+    std::ranges::sort(personRows);
+    std::ranges::sort(copyRows);
+    EXPECT_EQ(copyRows, personRows);
+}
@@ -0,0 +1,144 @@
+#include <gtest/gtest.h>
+
+#include <string_view>
+
+#include "TuringDB.h"
+#include "Graph.h"
+#include "SystemManager.h"
+#include "dataframe/Dataframe.h"
+#include "writers/GraphWriter.h"
+
+#include "TuringTestEnv.h"
+#include "TuringTest.h"
+#include "QueryStatus.h"
+#include "QueryProfile.h"
+
+using namespace turing::test;
+
+namespace {
+
+class ProfileTestGraph {
+public:
+    static void createGraph(Graph* graph) {
+        GraphWriter writer {graph};
+        writer.setName("profiletest");
+
+        for (std::string_view name : {"A", "B", "C", "D"}) {
+            auto node = writer.addNode({"Person"});
+            writer.addNodeProperty<types::String>(node, "name", std::string_view {name});
+        }
+
+        writer.submit();
+    }
+};
+
+const QueryProfile::Operator* findOperator(const QueryProfile& profile, std::string_view name) {
+    for (const QueryProfile::Operator& op : profile.operators()) {
+        if (op._name == name) {
+            return &op;
+        }
+    }
+
+    return nullptr;
+}
+
+}
+
+class ProfileQueriesTest : public TuringTest {
+public:
+    void initialize() override {
+        _env = TuringTestEnv::create(fs::Path {_outDir} / "turing");
+        _graph = _env->getSystemManager().createGraph(_graphName);
+        ProfileTestGraph::createGraph(_graph);
+        _db = &_env->getDB();
+    }
+
+protected:
+    const std::string _graphName = "profiletest";
+    std::unique_ptr<TuringTestEnv> _env;
+    TuringDB* _db {nullptr};
+    Graph* _graph {nullptr};
+
+    QueryStatus query(std::string_view query, size_t& rowCount) {
+        rowCount = 0;
+        return _db->query(query, _graphName, &_env->getMem(), [&](const Dataframe* df) {
+            rowCount += df->getRowCount();
+        });
+    }
+};
+
+TEST_F(ProfileQueriesTest, explain) {
+    size_t rowCount = 0;
+    const auto res = query("EXPLAIN MATCH (n:Person) RETURN n.name", rowCount);
+    ASSERT_TRUE(res) << res.getError();
+
+    // The pipeline is not executed
+    EXPECT_EQ(rowCount, 0);
+
+    const QueryProfile* profile = res.getProfile();
+    ASSERT_TRUE(profile);
+    EXPECT_FALSE(profile->isExecuted());
+    ASSERT_EQ(profile->roots().size(), 1);
+    ASSERT_FALSE(profile->operators().empty());
+
+    const QueryProfile::Operator* scan = findOperator(*profile, "ScanNodesByLabelProcessor");
+    ASSERT_TRUE(scan);
+    EXPECT_EQ(scan->_executions, 0);
+    EXPECT_EQ(scan->_rowsOut, 0);
+}
+
+TEST_F(ProfileQueriesTest, profile) {
+    size_t rowCount = 0;
+    const auto res = query("PROFILE MATCH (n:Person) RETURN n.name", rowCount);
+    ASSERT_TRUE(res) << res.getError();
+    EXPECT_EQ(rowCount, 4);
+
+    const QueryProfile* profile = res.getProfile();
+    ASSERT_TRUE(profile);
+    EXPECT_TRUE(profile->isExecuted());
+    ASSERT_EQ(profile->roots().size(), 1);
+
+    // The sink reports the rows returned by the query
+    const QueryProfile::Operator& sink = profile->operators()[profile->roots().front()];
+    EXPECT_EQ(sink._depth, 0);
+    EXPECT_EQ(sink._rowsOut, 4);
+    EXPECT_FALSE(sink._children.empty());
+
+    const QueryProfile::Operator* scan = findOperator(*profile, "ScanNodesByLabelProcessor");
+    ASSERT_TRUE(scan);
+    EXPECT_GT(scan->_executions, 0);
+    EXPECT_EQ(scan->_rowsIn, 0);
+    EXPECT_EQ(scan->_rowsOut, 4);
+    EXPECT_GT(scan->_chunks, 0);
+    EXPECT_GE(scan->_dataparts, 1);
+    EXPECT_GT(scan->_memoryBytes, 0);
+}
+
+TEST_F(ProfileQueriesTest, noProfile) {
+    size_t rowCount = 0;
+    const auto res = query("MATCH (n:Person) RETURN n.name", rowCount);
+    ASSERT_TRUE(res) << res.getError();
+    EXPECT_EQ(rowCount, 4);
+    EXPECT_FALSE(res.getProfile());
+}
+
+TEST_F(ProfileQueriesTest, memoryPeakPerQuery) {
+    size_t rowCount = 0;
+    const auto large = query("MATCH (a:Person), (b:Person), (c:Person) "
+                             "RETURN a.name, b.name, c.name", rowCount);
+    ASSERT_TRUE(large) << large.getError();
+    EXPECT_EQ(rowCount, 64);
+    EXPECT_GT(large.getMemoryPeak(), 0);
+    EXPECT_GE(large.getMemoryPeak(), large.getMemoryUsed());
+
+    // The columns are recycled between the queries, as done by the server
+    _env->getMem().clear();
+
+    // The peak of the previous query is not reported again
+    const auto small = query("MATCH (n:Person) RETURN n.name", rowCount);
+    ASSERT_TRUE(small) << small.getError();
+    EXPECT_EQ(rowCount, 4);
+    EXPECT_GT(small.getMemoryPeak(), 0);
+    EXPECT_GE(small.getMemoryPeak(), small.getMemoryUsed());
+    EXPECT_LT(small.getMemoryPeak(), large.getMemoryPeak());
+}
@@ -0,0 +1,204 @@
+#include <gtest/gtest.h>
+
+#include <string_view>
+#include <set>
+
+#include "TuringDB.h"
+#include "Graph.h"
+#include "SystemManager.h"
+#include "PlanCache.h"
+#include "QueryParams.h"
+#include "columns/ColumnOptVector.h"
+#include "dataframe/Dataframe.h"
+#include "writers/GraphWriter.h"
+#include "PipelineV2.h"
+#include "PipelineException.h"
+
+#include "TuringTestEnv.h"
+#include "TuringTest.h"
+#include "QueryStatus.h"
+
+using namespace turing::test;
+
+namespace {
+
+class QueryParamsTestGraph {
+public:
+    static void createGraph(Graph* graph) {
+        GraphWriter writer {graph};
+        writer.setName("queryparamstest");
+
+        const auto addPerson = [&](std::string_view name, int64_t age) {
+            auto node = writer.addNode({"Person"});
+            writer.addNodeProperty<types::String>(node, "name", std::string_view {name});
+            writer.addNodeProperty<types::Int64>(node, "age", int64_t {age});
+        };
+
+        addPerson("A", 20);
+        addPerson("B", 30);
+        addPerson("C", 40);
+        addPerson("D", 50);
+
+        writer.submit();
+    }
+};
+
+}
+
+class QueryParamsTest : public TuringTest {
+public:
+    void initialize() override {
+        _env = TuringTestEnv::create(fs::Path {_outDir} / "turing");
+        _graph = _env->getSystemManager().createGraph(_graphName);
+        QueryParamsTestGraph::createGraph(_graph);
+        _db = &_env->getDB();
+    }
+
+protected:
+    const std::string _graphName = "queryparamstest";
+    std::unique_ptr<TuringTestEnv> _env;
+    TuringDB* _db {nullptr};
+    Graph* _graph {nullptr};
+
+    QueryStatus queryNames(std::string_view query,
+                           const QueryParams& params,
+                           std::set<std::string>& names) {
+        using String = types::String::Primitive;
+
+        names.clear();
+        return _db->query(query, _graphName, &_env->getMem(), [&](const Dataframe* df) {
+            ASSERT_TRUE(df);
+            ASSERT_EQ(df->cols().size(), 1);
+
+            const auto* col = df->cols().front()->as<ColumnOptVector<String>>();
+            ASSERT_TRUE(col);
+
+            for (size_t i = 0; i < col->size(); i++) {
+                if (col->at(i)) {
+                    names.emplace(*col->at(i));
+                }
+            }
+        }, CommitHash::head(), ChangeID::head(), &params);
+    }
+};
+
+TEST_F(QueryParamsTest, bindValues) {
+    std::set<std::string> names;
+
+    QueryParams params;
+    params.set("name", std::string("B"));
+    auto res = queryNames("MATCH (n:Person) WHERE n.name = $name RETURN n.name", params, names);
+    ASSERT_TRUE(res) << res.getError();
+    EXPECT_EQ(names, std::set<std::string>({"B"}));
+
+    params = {};
+    params.set("minAge", (int64_t)35);
+    res = queryNames("MATCH (n:Person) WHERE n.age > $minAge RETURN n.name", params, names);
+    ASSERT_TRUE(res) << res.getError();
+    EXPECT_EQ(names, std::set<std::string>({"C", "D"}));
+
+    params = {};
+    params.set("limit", (int64_t)2);
+    res = queryNames("MATCH (n:Person) RETURN n.name LIMIT $limit", params, names);
+    ASSERT_TRUE(res) << res.getError();
+    EXPECT_EQ(names.size(), 2);
+}
+
+TEST_F(QueryParamsTest, unboundParameter) {
+    std::set<std::string> names;
+
+    const QueryParams params;
+    const auto res = queryNames("MATCH (n:Person) WHERE n.name = $name RETURN n.name", params, names);
+    ASSERT_FALSE(res);
+    EXPECT_EQ(res.getStatus(), QueryStatus::Status::ANALYZE_ERROR);
+}
+
+TEST_F(QueryParamsTest, planCacheReuse) {
+    constexpr std::string_view QUERY = "MATCH (n:Person) WHERE n.age = $age RETURN n.name";
+
+    const PlanCache& cache = _db->getPlanCache();
+    std::set<std::string> names;
+
+    QueryParams params;
+    params.set("age", (int64_t)20);
+    auto res = queryNames(QUERY, params, names);
+    ASSERT_TRUE(res) << res.getError();
+    EXPECT_EQ(names, std::set<std::string>({"A"}));
+
+    const uint64_t hitCount = cache.getHitCount();
+    const uint64_t missCount = cache.getMissCount();
+
+    // Same query with another value and whitespaces, the plan is reused
+    params.set("age", (int64_t)40);
+    res = queryNames("MATCH  (n:Person)\n  WHERE n.age = $age\n  RETURN n.name", params, names);
+    ASSERT_TRUE(res) << res.getError();
+    EXPECT_EQ(names, std::set<std::string>({"C"}));
+    EXPECT_EQ(cache.getHitCount(), hitCount + 1);
+    EXPECT_EQ(cache.getMissCount(), missCount);
+
+    // Another type of value needs another plan
+    params.set("age", std::string("40"));
+    queryNames(QUERY, params, names);
+    EXPECT_EQ(cache.getHitCount(), hitCount + 1);
+    EXPECT_EQ(cache.getMissCount(), missCount + 1);
+}
+
+TEST_F(QueryParamsTest, planCacheRebindsParameters) {
+    constexpr std::string_view QUERY =
+        "MATCH (n:Person) WHERE n.age > $minAge RETURN n.name SKIP $skip LIMIT $limit";
+
+    const PlanCache& cache = _db->getPlanCache();
+    std::set<std::string> names;
+
+    QueryParams params;
+    params.set("minAge", (int64_t)15);
+    params.set("skip", (int64_t)0);
+    params.set("limit", (int64_t)10);
+    auto res = queryNames(QUERY, params, names);
+    ASSERT_TRUE(res) << res.getError();
+    EXPECT_EQ(names, std::set<std::string>({"A", "B", "C", "D"}));
+
+    const uint64_t hitCount = cache.getHitCount();
+    const uint64_t missCount = cache.getMissCount();
+
+    // The cached plan runs with the new values, including the ones read
+    // when building the pipeline
+    params.set("minAge", (int64_t)35);
+    res = queryNames(QUERY, params, names);
+    ASSERT_TRUE(res) << res.getError();
+    EXPECT_EQ(names, std::set<std::string>({"C", "D"}));
+
+    params.set("limit", (int64_t)1);
+    res = queryNames(QUERY, params, names);
+    ASSERT_TRUE(res) << res.getError();
+    EXPECT_EQ(names.size(), 1);
+
+    params.set("minAge", (int64_t)15);
+    params.set("skip", (int64_t)3);
+    params.set("limit", (int64_t)10);
+    res = queryNames(QUERY, params, names);
+    ASSERT_TRUE(res) << res.getError();
+    EXPECT_EQ(names.size(), 1);
+
+    EXPECT_EQ(cache.getHitCount(), hitCount + 3);
+    EXPECT_EQ(cache.getMissCount(), missCount);
+}
+
+TEST_F(QueryParamsTest, pipelineRefusesRebindingBuildParameters) {
+    PipelineV2 pipeline;
+
+    QueryParams params;
+    params.set("limit", (int64_t)2);
+    pipeline.addBuildParameter("limit", *params.get("limit"));
+    EXPECT_NO_THROW(pipeline.bindParameters(params));
+
+    params.set("limit", (int64_t)3);
+    EXPECT_THROW(pipeline.bindParameters(params), PipelineException);
+
+    params = {};
+    EXPECT_THROW(pipeline.bindParameters(params), PipelineException);
+}
+
+int main(int argc, char** argv) {
+    return turing::test::turingTestMain(argc, argv, [] {});
+}
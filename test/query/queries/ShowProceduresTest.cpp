@@ -29,7 +29,7 @@ TEST_F(ShowProceduresTest, showProcedures) {
                                 [&](const Dataframe* df) -> void {
         ASSERT_TRUE(df != nullptr);
         ASSERT_EQ(df->cols().size(), 2);
-        ASSERT_EQ(df->getRowCount(), 5);
+        ASSERT_EQ(df->getRowCount(), 8);
 
         const auto& cols = df->cols();
         const auto* colName = cols.at(0)->as<ColumnVector<types::String::Primitive>>();
@@ -44,6 +44,9 @@ TEST_F(ShowProceduresTest, showProcedures) {
         ASSERT_EQ(colName->at(2), "db.edgeTypes");
         ASSERT_EQ(colName->at(3), "db.history");
         ASSERT_EQ(colName->at(4), "db.procedures");
+        ASSERT_EQ(colName->at(5), "db.vectorSearch");
+        ASSERT_EQ(colName->at(6), "db.vectorSearch");
+        ASSERT_EQ(colName->at(7), "db.statistics");
 
         // Check exact signatures
         ASSERT_EQ(colSignature->at(0), "db.labels() :: (id :: INTEGER, label :: STRING)");
@@ -54,6 +57,15 @@ TEST_F(ShowProceduresTest, showProcedures) {
                   "db.history() :: (commit :: STRING, nodeCount :: INTEGER, edgeCount :: INTEGER, "
                   "partCount :: INTEGER)");
         ASSERT_EQ(colSignature->at(4), "db.procedures() :: (name :: STRING, signature :: STRING)");
+        ASSERT_EQ(colSignature->at(5),
+                  "db.vectorSearch(library :: STRING, embedding :: LIST<FLOAT>, k :: INTEGER) :: "
+                  "(nodeID :: NODE, score :: FLOAT)");
+        ASSERT_EQ(colSignature->at(6),
+                  "db.vectorSearch(library :: STRING, embedding :: LIST<FLOAT>, k :: INTEGER, "
+                  "candidates :: NODE) :: (nodeID :: NODE, score :: FLOAT)");
+        ASSERT_EQ(colSignature->at(7),
+                  "db.statistics() :: (kind :: STRING, entity :: STRING, count :: INTEGER, "
+                  "distinct :: INTEGER, nullFraction :: FLOAT, min :: STRING, max :: STRING)");
 
         executed = true;
     });
@@ -0,0 +1,259 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <random>
+#include <string_view>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "TuringDB.h"
+#include "Graph.h"
+#include "SystemManager.h"
+#include "QueryParams.h"
+#include "columns/ColumnIDs.h"
+#include "columns/ColumnOptVector.h"
+#include "dataframe/Dataframe.h"
+#include "writers/GraphWriter.h"
+
+#include "VectorDatabase.h"
+#include "VecLibAccessor.h"
+#include "BatchVectorCreate.h"
+#include "VectorSearchQuery.h"
+#include "VectorSearchResult.h"
+
+#include "TuringTestEnv.h"
+#include "TuringTest.h"
+#include "QueryStatus.h"
+
+using namespace turing::test;
+
+class VectorSearchTest : public TuringTest {
+public:
+    void initialize() override {
+        _env = TuringTestEnv::create(fs::Path {_outDir} / "turing");
+        _db = &_env->getDB();
+
+        Graph* graph = _env->getSystemManager().createGraph(_graphName);
+        GraphWriter writer {graph};
+        writer.setName(_graphName);
+
+        const auto addPerson = [&](std::string_view name, int64_t age) {
+            auto node = writer.addNode({"Person"});
+            writer.addNodeProperty<types::String>(node, "name", std::string_view {name});
+            writer.addNodeProperty<types::Int64>(node, "age", int64_t {age});
+        };
+
+        addPerson("A", 20);
+        addPerson("B", 30);
+        addPerson("C", 40);
+        addPerson("D", 50);
+
+        writer.submit();
+
+        createEmbeddings();
+    }
+
+protected:
+    const std::string _graphName = "vectorsearchtest";
+    std::unique_ptr<TuringTestEnv> _env;
+    TuringDB* _db {nullptr};
+
+    // The embedding of each person is on a line, in the order of the names
+    void createEmbeddings() {
+        std::unordered_map<std::string, NodeID> nodeIDs;
+        auto res = _db->query("MATCH (n:Person) RETURN n, n.name", _graphName, &_env->getMem(),
+                              [&](const Dataframe* df) {
+            ASSERT_TRUE(df);
+            const auto* ids = df->cols().at(0)->as<ColumnNodeIDs>();
+            const auto* names = df->cols().at(1)->as<ColumnOptVector<types::String::Primitive>>();
+            ASSERT_TRUE(ids);
+            ASSERT_TRUE(names);
+
+            for (size_t i = 0; i < ids->size(); i++) {
+                nodeIDs.emplace(*names->at(i), ids->at(i));
+            }
+        });
+        ASSERT_TRUE(res) << res.getError();
+        ASSERT_EQ(nodeIDs.size(), 4);
+
+        // Opened by the system manager in the turing directory
+        vec::VectorDatabase* vectorDB = _env->getSystemManager().getVectorDatabase();
+        ASSERT_TRUE(vectorDB);
+
+        ASSERT_TRUE(vectorDB->createLibrary("people", 2, vec::DistanceMetric::EUCLIDEAN_DIST));
+
+        vec::VecLibAccessor lib = vectorDB->getLibrary("people");
+        ASSERT_TRUE(lib.isValid());
+
+        vec::BatchVectorCreate batch = lib.prepareCreateBatch();
+        float x = 0.0f;
+        for (const std::string name : {"A", "B", "C", "D"}) {
+            const std::vector<float> embedding {x, 0.0f};
+            batch.addPoint(nodeIDs.at(name).getValue(), embedding);
+            x += 1.0f;
+        }
+        ASSERT_TRUE(lib.addEmbeddings(batch));
+    }
+
+    QueryStatus queryNames(std::string_view query,
+                           const QueryParams& params,
+                           std::vector<std::string>& names) {
+        using String = types::String::Primitive;
+
+        names.clear();
+        return _db->query(query, _graphName, &_env->getMem(), [&](const Dataframe* df) {
+            ASSERT_TRUE(df);
+            ASSERT_EQ(df->cols().size(), 1);
+
+            const auto* col = df->cols().front()->as<ColumnOptVector<String>>();
+            ASSERT_TRUE(col);
+
+            for (size_t i = 0; i < col->size(); i++) {
+                ASSERT_TRUE(col->at(i));
+                names.emplace_back(*col->at(i));
+            }
+        }, CommitHash::head(), ChangeID::head(), &params);
+    }
+};
+
+TEST_F(VectorSearchTest, nearestNodes) {
+    std::vector<std::string> names;
+
+    QueryParams params;
+    params.set("embedding", QueryParams::Vector {0.1f, 0.0f});
+
+    const auto res = queryNames("CALL db.vectorSearch('people', $embedding, 2) "
+                                "YIELD nodeID RETURN nodeID.name",
+                                params, names);
+    ASSERT_TRUE(res) << res.getError();
+    EXPECT_EQ(names, std::vector<std::string>({"A", "B"}));
+}
+
+TEST_F(VectorSearchTest, matchedCandidates) {
+    std::vector<std::string> names;
+
+    QueryParams params;
+    params.set("embedding", QueryParams::Vector {0.1f, 0.0f});
+
+    // The nearest nodes are searched among the matched ones only
+    const auto res = queryNames("MATCH (n:Person) WHERE n.age >= 40 "
+                                "CALL db.vectorSearch('people', $embedding, 1, n) "
+                                "YIELD nodeID RETURN nodeID.name",
+                                params, names);
+    ASSERT_TRUE(res) << res.getError();
+    EXPECT_EQ(names, std::vector<std::string>({"C"}));
+}
+
+TEST_F(VectorSearchTest, unknownLibrary) {
+    std::vector<std::string> names;
+
+    QueryParams params;
+    params.set("embedding", QueryParams::Vector {0.1f, 0.0f});
+
+    const auto res = queryNames("CALL db.vectorSearch('unknown', $embedding, 2) "
+                                "YIELD nodeID RETURN nodeID.name",
+                                params, names);
+    ASSERT_FALSE(res);
+}
+
+TEST_F(VectorSearchTest, nonPositiveK) {
+    std::vector<std::string> names;
+
+    QueryParams params;
+    params.set("embedding", QueryParams::Vector {0.1f, 0.0f});
+
+    for (const std::string_view query : {"CALL db.vectorSearch('people', $embedding, 0) "
+                                         "YIELD nodeID RETURN nodeID.name",
+                                         "CALL db.vectorSearch('people', $embedding, -1) "
+                                         "YIELD nodeID RETURN nodeID.name"}) {
+        const auto res = queryNames(query, params, names);
+        ASSERT_FALSE(res);
+        EXPECT_TRUE(names.empty());
+    }
+}
+
+TEST_F(VectorSearchTest, quantizedRecallAfterIncrementalInserts) {
+    constexpr vec::Dimension dim = 8;
+    constexpr size_t batchSize = 16;
+    constexpr size_t batchCount = 128;
+    constexpr size_t queryCount = 20;
+    constexpr size_t k = 10;
+
+    auto vectorDB = vec::VectorDatabase::create(fs::Path {_outDir} / "quantized");
+    ASSERT_TRUE(vectorDB);
+
+    vec::IndexParams indexParams;
+    indexParams._ivfListCount = 4;
+    indexParams._pqSubQuantizerCount = 4;
+    indexParams._pqBitCount = 4;
+
+    ASSERT_TRUE(vectorDB.value()->createLibrary("quantized", dim,
+                                                vec::DistanceMetric::EUCLIDEAN_DIST,
+                                                vec::IndexType::IVF_PQ,
+                                                indexParams));
+
+    vec::VecLibAccessor lib = vectorDB.value()->getLibrary("quantized");
+    ASSERT_TRUE(lib.isValid());
+
+    // The first batch is much narrower than the next ones, the quantizers
+    // must not be trained on it alone
+    std::mt19937 rng {42};
+    const auto randomVector = [&](float spread) {
+        std::uniform_real_distribution<float> dist {-spread, spread};
+        std::vector<float> vector(dim);
+        for (float& x : vector) {
+            x = 10.0f + dist(rng);
+        }
+        return vector;
+    };
+
+    std::vector<std::vector<float>> vectors;
+    for (size_t b = 0; b < batchCount; b++) {
+        vec::BatchVectorCreate batch = lib.prepareCreateBatch();
+        for (size_t i = 0; i < batchSize; i++) {
+            const uint64_t id = vectors.size();
+            batch.addPoint(id, vectors.emplace_back(randomVector(b == 0 ? 0.01f : 1.0f)));
+        }
+        ASSERT_TRUE(lib.addEmbeddings(batch));
+    }
+
+    size_t foundCount = 0;
+    for (size_t q = 0; q < queryCount; q++) {
+        const std::vector<float> point = randomVector(1.0f);
+
+        // Exact nearest neighbors
+        std::vector<std::pair<float, uint64_t>> distances;
+        for (size_t id = 0; id < vectors.size(); id++) {
+            float dist = 0.0f;
+            for (size_t d = 0; d < dim; d++) {
+                const float diff = vectors[id][d] - point[d];
+                dist += diff * diff;
+            }
+            distances.emplace_back(dist, id);
+        }
+        std::partial_sort(distances.begin(), distances.begin() + k, distances.end());
+
+        vec::VectorSearchQuery query {dim};
+        query.setVector(point);
+        query.setMaxResultCount(k);
+        query.setProbeCount(indexParams._ivfListCount);
+
+        vec::VectorSearchResult result;
+        ASSERT_TRUE(lib.search(query, result));
+
+        const std::unordered_set<uint64_t> found(result.ids().begin(), result.ids().end());
+        for (size_t i = 0; i < k; i++) {
+            foundCount += found.contains(distances[i].second);
+        }
+    }
+
+    const float recall = (float)foundCount / (queryCount * k);
+    EXPECT_GE(recall, 0.8f);
+}
+
+int main(int argc, char** argv) {
+    return turing::test::turingTestMain(argc, argv, [] {
+        testing::GTEST_FLAG(repeat) = 1;
+    });
+}
@@ -0,0 +1,120 @@
+#include <gtest/gtest.h>
+
+#include <memory>
+
+#include "TuringTest.h"
+#include "TuringTestEnv.h"
+
+#include "SystemManager.h"
+#include "Graph.h"
+#include "dump/DumpConfig.h"
+#include "dump/GraphLoader.h"
+#include "comparators/GraphComparator.h"
+#include "versioning/Change.h"
+#include "versioning/Transaction.h"
+#include "Panic.h"
+
+using namespace db;
+using namespace turing::test;
+
+class DeltaCommitSerialisationTest : public TuringTest {
+public:
+    void initialize() override {
+        _env = TuringTestEnv::createSyncedOnDisk(fs::Path {_outDir} / "turing");
+
+        _builtGraph = _env->getSystemManager().createGraph(_workingGraphName);
+
+        submitSmallChanges();
+    }
+
+    // Each change creates a node with a new label, and deletes the node created
+    // by the previous change, so that every commit adds metadata and tombstones
+    void submitSmallChanges() {
+        auto& db = _env->getDB();
+        auto& sysMan = _env->getSystemManager();
+
+        for (size_t i = 0; i < COMMIT_COUNT; i++) {
+            auto res = sysMan.newChange(_workingGraphName);
+            if (!res) {
+                panic("Failed to make change in submitSmallChanges().");
+            }
+            const ChangeID changeID = res.value()->id();
+
+            const std::string createStr = "create (n:Label" + std::to_string(i)
+                                        + "{id:" + std::to_string(i) + "})";
+            ASSERT_TRUE(db.query(createStr, _workingGraphName, &_env->getMem(),
+                                 CommitHash::head(), changeID));
+
+            if (i > 0) {
+                const std::string deleteStr = "match (n{id:" + std::to_string(i - 1)
+                                            + "}) delete n";
+                ASSERT_TRUE(db.query(deleteStr, _workingGraphName, &_env->getMem(),
+                                     CommitHash::head(), changeID));
+            }
+
+            // implicit dump on change submit
+            ASSERT_TRUE(db.query("change submit", _workingGraphName, &_env->getMem(),
+                                 CommitHash::head(), changeID));
+        }
+    }
+
+    bool isDeltaCommit(size_t commitIndex) const {
+        const fs::Path& graphPath = _builtGraph->getPath();
+        const std::string prefix = "commit-" + std::to_string(commitIndex) + "-";
+
+        auto files = graphPath.listDir();
+        if (!files) {
+            panic("Failed to list graph directory.");
+        }
+
+        for (const fs::Path& child : files.value()) {
+            if (child.filename().starts_with(prefix)) {
+                return (child / "delta").exists();
+            }
+        }
+
+        panic("Commit {} was not dumped.", commitIndex);
+        return false;
+    }
+
+protected:
+    const std::string _workingGraphName {"deltagraph"};
+
+    std::unique_ptr<TuringTestEnv> _env;
+    Graph* _builtGraph {nullptr};
+    std::unique_ptr<Graph> _loadedGraph;
+
+    static constexpr size_t COMMIT_COUNT = DumpConfig::CHECKPOINT_INTERVAL + 8;
+};
+
+TEST_F(DeltaCommitSerialisationTest, checkpointsAndDeltas) {
+    const size_t commitCount = _builtGraph->openTransaction().viewGraph().commits().size();
+    ASSERT_GT(commitCount, DumpConfig::CHECKPOINT_INTERVAL);
+
+    ASSERT_FALSE(isDeltaCommit(0));
+    ASSERT_TRUE(isDeltaCommit(1));
+    ASSERT_TRUE(isDeltaCommit(DumpConfig::CHECKPOINT_INTERVAL - 1));
+    ASSERT_FALSE(isDeltaCommit(DumpConfig::CHECKPOINT_INTERVAL));
+    ASSERT_TRUE(isDeltaCommit(DumpConfig::CHECKPOINT_INTERVAL + 1));
+}
+
+TEST_F(DeltaCommitSerialisationTest, replayDeltasThenCompare) {
+    _loadedGraph = Graph::create();
+    const auto res = GraphLoader::load(_loadedGraph.get(), _builtGraph->getPath());
+    ASSERT_TRUE(res);
+
+    ASSERT_TRUE(GraphComparator::same(*_builtGraph, *_loadedGraph));
+
+    const auto commits = _loadedGraph->openTransaction().viewGraph().commits();
+    const CommitView lastCommit = commits.back();
+
+    // Every node but the last one has been deleted
+    ASSERT_EQ(lastCommit.tombstones().numNodes(), COMMIT_COUNT - 1);
+    ASSERT_EQ(lastCommit.metadata().labels().getCount(), COMMIT_COUNT);
+}
+
+int main(int argc, char** argv) {
+    return turingTestMain(argc, argv, [] {
+        testing::GTEST_FLAG(repeat) = 1;
+    });
+}
@@ -0,0 +1,109 @@
+#include <gtest/gtest.h>
+
+#include "TuringTest.h"
+#include "TuringTestEnv.h"
+
+#include "SimpleGraph.h"
+#include "SystemManager.h"
+#include "Graph.h"
+#include "DataPart.h"
+#include "DataPartCache.h"
+#include "dump/GraphDumper.h"
+#include "dump/GraphLoader.h"
+#include "comparators/GraphComparator.h"
+#include "versioning/Transaction.h"
+#include "TuringException.h"
+
+using namespace db;
+using namespace turing::test;
+
+class TieredGraphSerialisationTest : public TuringTest {
+public:
+    void initialize() override {
+        _env = TuringTestEnv::createSyncedOnDisk(fs::Path {_outDir} / "turing");
+
+        _builtGraph = _env->getSystemManager().createGraph("simple");
+        SimpleGraph::createSimpleGraph(_builtGraph);
+        _workingPath = fs::Path {_outDir + "/testfile"};
+
+        GraphDumper dumper;
+        if (auto res = dumper.dump(*_builtGraph, _workingPath); !res) {
+            throw TuringException("Failed to dump graph:\n" + res.error().fmtMessage());
+        }
+    }
+
+    void loadLazily(size_t memoryBudget) {
+        _cache = std::make_unique<DataPartCache>(memoryBudget);
+        _loadedGraph = Graph::create();
+        _loadedGraph->setDataPartCache(_cache.get());
+
+        if (auto res = GraphLoader::load(_loadedGraph.get(), _workingPath); !res) {
+            throw TuringException("Failed to load graph:\n" + res.error().fmtMessage());
+        }
+    }
+
+protected:
+    std::unique_ptr<TuringTestEnv> _env;
+    Graph* _builtGraph {nullptr};
+    fs::Path _workingPath;
+
+    // Must outlive the loaded graph
+    std::unique_ptr<DataPartCache> _cache;
+    std::unique_ptr<Graph> _loadedGraph;
+};
+
+TEST_F(TieredGraphSerialisationTest, loadOnFirstRead) {
+    loadLazily(DataPartCache::UNLIMITED_BUDGET);
+
+    // Only the info of the dataparts is loaded
+    ASSERT_EQ(_cache->getResidentSize(), 0);
+
+    size_t residentSize = 0;
+    {
+        const FrozenCommitTx tx = _loadedGraph->openTransaction();
+        ASSERT_TRUE(tx.isValid());
+
+        const DataPartSpan parts = tx.commitData()->allDataparts();
+        ASSERT_FALSE(parts.empty());
+
+        for (const auto& part : parts) {
+            ASSERT_TRUE(part->isResident());
+        }
+
+        residentSize = _cache->getResidentSize();
+        ASSERT_GT(residentSize, 0);
+        ASSERT_EQ(_cache->getResidentSize(_loadedGraph->getName()), residentSize);
+    }
+
+    // Without budget, the dataparts stay resident
+    ASSERT_EQ(_cache->getResidentSize(), residentSize);
+    ASSERT_EQ(_cache->getEvictionCount(), 0);
+
+    ASSERT_TRUE(GraphComparator::same(*_builtGraph, *_loadedGraph));
+}
+
+TEST_F(TieredGraphSerialisationTest, evictAboveBudget) {
+    loadLazily(1);
+
+    {
+        const FrozenCommitTx tx = _loadedGraph->openTransaction();
+        ASSERT_TRUE(tx.isValid());
+
+        // Pinned dataparts are not evicted, even above the budget
+        for (const auto& part : tx.commitData()->allDataparts()) {
+            ASSERT_TRUE(part->isResident());
+        }
+        ASSERT_GT(_cache->getResidentSize(), 1);
+    }
+
+    // Released by the transaction, then evicted
+    ASSERT_EQ(_cache->getResidentSize(), 0);
+    ASSERT_GT(_cache->getEvictionCount(), 0);
+
+    // Evicted dataparts are loaded again on the next read
+    ASSERT_TRUE(GraphComparator::same(*_builtGraph, *_loadedGraph));
+}
+
+int main(int argc, char** argv) {
+    return turingTestMain(argc, argv, [] { testing::GTEST_FLAG(repeat) = 1; });
+}
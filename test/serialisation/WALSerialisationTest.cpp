@@ -0,0 +1,294 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "TuringTest.h"
+#include "TuringTestEnv.h"
+
+#include "SystemManager.h"
+#include "Graph.h"
+#include "GraphSerializer.h"
+#include "columns/ColumnOptVector.h"
+#include "dataframe/Dataframe.h"
+#include "dump/GraphLoader.h"
+#include "comparators/GraphComparator.h"
+#include "versioning/Change.h"
+#include "versioning/Transaction.h"
+#include "wal/WALReplayer.h"
+#include "wal/WriteAheadLog.h"
+#include "LocalMemory.h"
+#include "Panic.h"
+
+using namespace db;
+using namespace turing::test;
+
+class WALSerialisationTest : public TuringTest {
+public:
+    void initialize() override {
+        _env = TuringTestEnv::createSyncedOnDisk(fs::Path {_outDir} / "turing");
+
+        _builtGraph = _env->getSystemManager().createGraph(_workingGraphName);
+
+        // Background checkpoints are not started, the log is only converted into
+        // dumps when a test asks for it
+        ASSERT_TRUE(_builtGraph->getSerializer().openWriteAheadLog());
+
+        submitChanges();
+    }
+
+    ChangeID newChange() {
+        auto res = _env->getSystemManager().newChange(_workingGraphName);
+        if (!res) {
+            panic("Failed to make change in WALSerialisationTest.");
+        }
+
+        return res.value()->id();
+    }
+
+    void query(const std::string& str, ChangeID changeID) {
+        ASSERT_TRUE(_env->getDB().query(str, _workingGraphName, &_env->getMem(),
+                                        CommitHash::head(), changeID));
+    }
+
+    // Each change creates nodes with properties, an edge to the node of the
+    // previous change, and deletes the temporary node of the previous change.
+    // Every other change is split in two commits.
+    void submitChanges() {
+        for (size_t i = 0; i < CHANGE_COUNT; i++) {
+            const ChangeID changeID = newChange();
+            const std::string id = std::to_string(i);
+
+            query("create (n:Person{id:" + id + ", name:\"p" + id + "\"})", changeID);
+            query("create (t:Temp{tmp:" + id + "})", changeID);
+
+            if (i % 2 == 0) {
+                query("COMMIT", changeID);
+            }
+
+            if (i > 0) {
+                const std::string prevID = std::to_string(i - 1);
+                query("match (n{id:" + prevID + "}) create (n)-[e:KNOWS{weight:1.5}]->(m:Friend)",
+                      changeID);
+                query("match (t{tmp:" + prevID + "}) delete t", changeID);
+            }
+
+            query("change submit", changeID);
+        }
+    }
+
+    std::unique_ptr<Graph> loadDumpsAndReplay() {
+        auto graph = Graph::create();
+        if (!GraphLoader::load(graph.get(), _builtGraph->getPath())) {
+            panic("Failed to load graph in WALSerialisationTest.");
+        }
+
+        const WriteAheadLog wal {_builtGraph->getPath() / "wal"};
+        if (!WALReplayer::replay(*graph, wal)) {
+            panic("Failed to replay the write-ahead log in WALSerialisationTest.");
+        }
+
+        return graph;
+    }
+
+protected:
+    const std::string _workingGraphName {"walgraph"};
+
+    std::unique_ptr<TuringTestEnv> _env;
+    Graph* _builtGraph {nullptr};
+
+    static constexpr size_t CHANGE_COUNT = 16;
+};
+
+TEST_F(WALSerialisationTest, submitDoesNotDump) {
+    auto loadedGraph = Graph::create();
+    ASSERT_TRUE(GraphLoader::load(loadedGraph.get(), _builtGraph->getPath()));
+
+    // Only the first commit was dumped when creating the graph
+    ASSERT_EQ(loadedGraph->openTransaction().viewGraph().commits().size(), 1);
+}
+
+TEST_F(WALSerialisationTest, replayAfterCrash) {
+    auto loadedGraph = loadDumpsAndReplay();
+    ASSERT_TRUE(GraphComparator::same(*_builtGraph, *loadedGraph));
+}
+
+TEST_F(WALSerialisationTest, replayRebasedChange) {
+    // Two changes branched from the same commit, the second one is rebased on
+    // submit, and so are the IDs of its write buffers
+    const ChangeID changeA = newChange();
+    const ChangeID changeB = newChange();
+
+    query("create (n:Person{id:100})", changeA);
+
+    query("create (n:Person{id:200})", changeB);
+    query("COMMIT", changeB);
+    query("match (n{id:0}), (m{id:200}) create (n)-[e:KNOWS]->(m)", changeB);
+    query("match (t{tmp:" + std::to_string(CHANGE_COUNT - 1) + "}) delete t", changeB);
+
+    query("change submit", changeA);
+    query("change submit", changeB);
+
+    auto loadedGraph = loadDumpsAndReplay();
+    ASSERT_TRUE(GraphComparator::same(*_builtGraph, *loadedGraph));
+}
+
+TEST_F(WALSerialisationTest, replayMatchCreate) {
+    // The properties of the created nodes are columns taken from the matched
+    // rows, the log must encode them before the write buffer is flushed
+    const ChangeID changeID = newChange();
+    query("match (n:Person) create (m:Copy{id:n.id, name:n.name})", changeID);
+    query("change submit", changeID);
+
+    using String = types::String::Primitive;
+    using Int64 = types::Int64::Primitive;
+
+    std::vector<std::pair<int64_t, std::string>> copies;
+    const auto res = _env->getDB().query("match (m:Copy) return m.id, m.name", _workingGraphName,
+                                         &_env->getMem(), [&](const Dataframe* df) {
+        ASSERT_TRUE(df);
+        ASSERT_EQ(df->size(), 2);
+        const auto* ids = df->cols().at(0)->as<ColumnOptVector<Int64>>();
+        const auto* names = df->cols().at(1)->as<ColumnOptVector<String>>();
+        ASSERT_TRUE(ids);
+        ASSERT_TRUE(names);
+
+        for (size_t i = 0; i < df->getRowCount(); i++) {
+            ASSERT_TRUE(ids->at(i));
+            ASSERT_TRUE(names->at(i));
+            copies.emplace_back(*ids->at(i), std::string(*names->at(i)));
+        }
+    });
+    ASSERT_TRUE(res);
+
+    // One copy per person, each with the values of its own person
+    std::ranges::sort(copies);
+    ASSERT_EQ(copies.size(), CHANGE_COUNT);
+    for (size_t i = 0; i < CHANGE_COUNT; i++) {
+        EXPECT_EQ(copies[i].first, (int64_t)i);
+        EXPECT_EQ(copies[i].second, "p" + std::to_string(i));
+    }
+
+    auto loadedGraph = loadDumpsAndReplay();
+    ASSERT_TRUE(GraphComparator::same(*_builtGraph, *loadedGraph));
+}
+
+TEST_F(WALSerialisationTest, concurrentSubmitsShareSync) {
+    constexpr size_t submitCount = 8;
+
+    std::vector<ChangeID> changes;
+    for (size_t i = 0; i < submitCount; i++) {
+        const ChangeID changeID = newChange();
+        query("create (n:Concurrent{id:" + std::to_string(1000 + i) + "})", changeID);
+        changes.push_back(changeID);
+    }
+
+    // The first submission syncs late enough for the others to append their records
+    WriteAheadLog* wal = _builtGraph->getSerializer().getWriteAheadLog();
+    ASSERT_TRUE(wal);
+    wal->setGroupCommitDelay(std::chrono::milliseconds {200});
+    const uint64_t syncCount = wal->getSyncCount();
+
+    std::vector<std::thread> threads;
+    for (const ChangeID changeID : changes) {
+        threads.emplace_back([this, changeID] {
+            LocalMemory mem;
+            const auto res = _env->getDB().query("change submit", _workingGraphName, &mem,
+                                                 CommitHash::head(), changeID);
+            EXPECT_TRUE(res) << res.getError();
+        });
+    }
+
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    wal->setGroupCommitDelay(std::chrono::microseconds {0});
+
+    // Several commits were made durable by the same sync
+    EXPECT_GT(wal->getSyncCount(), syncCount);
+    EXPECT_LT(wal->getSyncCount() - syncCount, submitCount);
+
+    size_t nodeCount = 0;
+    const auto res = _env->getDB().query("match (n:Concurrent) return n", _workingGraphName,
+                                         &_env->getMem(), [&](const Dataframe* df) {
+        nodeCount += df->getRowCount();
+    });
+    ASSERT_TRUE(res);
+    ASSERT_EQ(nodeCount, submitCount);
+
+    auto loadedGraph = loadDumpsAndReplay();
+    ASSERT_TRUE(GraphComparator::same(*_builtGraph, *loadedGraph));
+}
+
+TEST_F(WALSerialisationTest, checkpointTruncatesLog) {
+    ASSERT_TRUE(_builtGraph->getSerializer().checkpoint());
+
+    // Every commit was dumped, only the new active segment is left
+    const WriteAheadLog wal {_builtGraph->getPath() / "wal"};
+    const auto segments = wal.listSegments();
+    ASSERT_TRUE(segments);
+    ASSERT_EQ(segments->size(), 1);
+
+    std::vector<std::string> records;
+    ASSERT_TRUE(wal.readSegment(segments->front(), records));
+    ASSERT_TRUE(records.empty());
+
+    auto loadedGraph = Graph::create();
+    ASSERT_TRUE(GraphLoader::load(loadedGraph.get(), _builtGraph->getPath()));
+    ASSERT_TRUE(GraphComparator::same(*_builtGraph, *loadedGraph));
+
+    // Commits submitted after the checkpoint are replayed on top of the dumps
+    const ChangeID changeID = newChange();
+    query("create (n:Person{id:300})", changeID);
+    query("change submit", changeID);
+
+    loadedGraph = loadDumpsAndReplay();
+    ASSERT_TRUE(GraphComparator::same(*_builtGraph, *loadedGraph));
+}
+
+TEST_F(WALSerialisationTest, truncateDiscardsRecords) {
+    WriteAheadLog wal {fs::Path {_outDir} / "truncatedwal"};
+    ASSERT_TRUE(wal.open());
+
+    const auto append = [&](std::string_view payload) {
+        const auto res = wal.append(std::span {payload.data(), payload.size()});
+        ASSERT_TRUE(res);
+    };
+
+    append("first");
+    append("second");
+    const WriteAheadLog::LSN lsn = wal.getWrittenLSN();
+    ASSERT_TRUE(wal.waitDurable(lsn));
+
+    // Records of a failed submission
+    append("discarded");
+    append("discarded too");
+    ASSERT_TRUE(wal.truncate(lsn));
+    ASSERT_EQ(wal.getWrittenLSN(), lsn);
+
+    // The next record reuses the discarded LSNs and must still be synced
+    append("third");
+    ASSERT_TRUE(wal.waitDurable(wal.getWrittenLSN()));
+
+    const auto segments = wal.listSegments();
+    ASSERT_TRUE(segments);
+    ASSERT_EQ(segments->size(), 1);
+
+    std::vector<std::string> records;
+    ASSERT_TRUE(wal.readSegment(segments->front(), records));
+    ASSERT_EQ(records, std::vector<std::string>({"first", "second", "third"}));
+
+    // Records of sealed segments can not be discarded
+    ASSERT_TRUE(wal.rotate());
+    ASSERT_FALSE(wal.truncate(lsn));
+}
+
+int main(int argc, char** argv) {
+    return turingTestMain(argc, argv, [] {
+        testing::GTEST_FLAG(repeat) = 1;
+    });
+}
@@ -0,0 +1,420 @@
+#include <gtest/gtest.h>
+
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <bit>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include "ColumnarEncoder.h"
+#include "NetWriter.h"
+#include "TuringDB.h"
+#include "Graph.h"
+#include "SystemManager.h"
+#include "dataframe/Dataframe.h"
+#include "writers/GraphWriter.h"
+#include "versioning/CommitHash.h"
+#include "versioning/ChangeID.h"
+
+#include "TuringTestEnv.h"
+#include "TuringTest.h"
+
+using namespace db;
+using namespace turing::test;
+
+namespace {
+
+// Column of a columnar stream, fixed size values are widened to u64
+struct DecodedColumn {
+    std::string _name;
+    uint8_t _type {0};
+    uint8_t _flags {0};
+    std::vector<uint64_t> _values;
+    std::vector<std::string> _strings;
+    std::vector<bool> _valid;
+};
+
+const DecodedColumn& getColumn(const std::vector<DecodedColumn>& cols, std::string_view name) {
+    for (const DecodedColumn& col : cols) {
+        if (col._name == name) {
+            return col;
+        }
+    }
+
+    throw std::runtime_error("Column not found");
+}
+
+// Size of the values of fixed size types, 0 for strings
+size_t getValueSize(ColumnarEncoder::ColumnType type) {
+    switch (type) {
+        case ColumnarEncoder::ColumnType::UInt64:
+        case ColumnarEncoder::ColumnType::Int64:
+        case ColumnarEncoder::ColumnType::Double:
+            return 8;
+        case ColumnarEncoder::ColumnType::UInt32:
+            return 4;
+        case ColumnarEncoder::ColumnType::UInt16:
+            return 2;
+        case ColumnarEncoder::ColumnType::Bool:
+            return 1;
+        case ColumnarEncoder::ColumnType::String:
+            break;
+    }
+
+    return 0;
+}
+
+class ColumnarReader {
+public:
+    explicit ColumnarReader(std::string_view data)
+        : _data(data)
+    {
+    }
+
+    template <typename T>
+    T read() {
+        T value {};
+        memcpy(&value, _data.data() + _pos, sizeof(T));
+        _pos += sizeof(T);
+        return value;
+    }
+
+    // Fixed size value of @param size bytes, little endian
+    uint64_t readValue(size_t size) {
+        uint64_t value = 0;
+        memcpy(&value, _data.data() + _pos, size);
+        _pos += size;
+        return value;
+    }
+
+    void skip(size_t size) { _pos += size; }
+    void align() { _pos = (_pos + 7) & ~(size_t)7; }
+    size_t pos() const { return _pos; }
+    bool atEnd() const { return _pos >= _data.size(); }
+
+    std::string readString(size_t size) {
+        std::string str(_data.substr(_pos, size));
+        _pos += size;
+        return str;
+    }
+
+private:
+    std::string_view _data;
+    size_t _pos {0};
+};
+
+// Removes the HTTP chunked framing written by the NetWriter
+std::string dechunk(std::string_view raw) {
+    std::string body;
+    size_t pos = 0;
+    while (pos + 10 <= raw.size()) {
+        const size_t size = std::stoul(std::string(raw.substr(pos, 8)), nullptr, 16);
+        pos += 10;
+        body.append(raw.substr(pos, size));
+        pos += size + 2;
+    }
+
+    return body;
+}
+
+}
+
+class ColumnarEncoderTest : public TuringTest {
+public:
+    void initialize() override {
+        _env = TuringTestEnv::create(fs::Path {_outDir} / "turing");
+        _graph = _env->getSystemManager().createGraph(_graphName);
+
+        GraphWriter writer {_graph};
+        writer.setName(_graphName);
+
+        const auto paris = writer.addNode({"City"});
+        const auto remy = writer.addNode({"Person"});
+        const auto adam = writer.addNode({"Person"});
+        writer.addNode({"Person"});
+
+        // The third person has no properties
+        writer.addNodeProperty<types::String>(remy, "name", std::string_view {"Remy"});
+        writer.addNodeProperty<types::Int64>(remy, "age", (int64_t)-31);
+        writer.addNodeProperty<types::Double>(remy, "score", 1.5);
+        writer.addNodeProperty<types::Bool>(remy, "active", true);
+        writer.addNodeProperty<types::String>(adam, "name", std::string_view {"Adam"});
+        writer.addNodeProperty<types::Int64>(adam, "age", (int64_t)28);
+        writer.addNodeProperty<types::Double>(adam, "score", -2.25);
+        writer.addNodeProperty<types::Bool>(adam, "active", false);
+
+        writer.addEdge("LIVES_IN", remy, paris);
+        writer.addEdge("LIVES_IN", adam, paris);
+        writer.submit();
+
+        _db = &_env->getDB();
+    }
+
+protected:
+    const std::string _graphName = "columnar";
+    std::unique_ptr<TuringTestEnv> _env;
+    TuringDB* _db {nullptr};
+    Graph* _graph {nullptr};
+
+    // Returns the columnar stream written by @param encode
+    template <typename Func>
+    std::string encodeColumnar(Func&& encode) {
+        int sockets[2];
+        EXPECT_EQ(socketpair(AF_UNIX, SOCK_STREAM, 0, sockets), 0);
+
+        std::string raw;
+        std::thread reader([&] {
+            std::vector<char> buffer(1 << 16);
+            while (true) {
+                const ssize_t count = ::read(sockets[1], buffer.data(), buffer.size());
+                if (count <= 0) {
+                    break;
+                }
+
+                raw.append(buffer.data(), count);
+            }
+        });
+
+        {
+            net::NetWriter writer {sockets[0]};
+            ColumnarEncoder encoder {&writer};
+            encode(encoder);
+            writer.flush();
+        }
+
+        ::shutdown(sockets[0], SHUT_WR);
+        reader.join();
+        ::close(sockets[0]);
+        ::close(sockets[1]);
+
+        return dechunk(raw);
+    }
+
+    // Runs the query and returns the columnar stream of its results
+    std::string queryColumnar(std::string_view query) {
+        return encodeColumnar([&](ColumnarEncoder& encoder) {
+            const auto res = _db->query(query, _graphName, &_env->getMem(),
+                                        [&](const Dataframe* df) {
+                                            encoder.writeDataframe(*df);
+                                        },
+                                        CommitHash::head(), ChangeID::head());
+            EXPECT_TRUE(res);
+
+            encoder.writeEnd(0.0);
+        });
+    }
+
+    // Decodes the columns of the batches of a stream, the size of each message
+    // must match the size written in its header
+    static std::vector<DecodedColumn> decode(std::string_view stream) {
+        ColumnarReader in {stream};
+        std::vector<DecodedColumn> cols;
+
+        while (!in.atEnd()) {
+            const auto type = (ColumnarEncoder::MessageType)in.read<uint32_t>();
+            in.skip(sizeof(uint32_t));
+            const uint64_t bodySize = in.read<uint64_t>();
+            const size_t bodyStart = in.pos();
+
+            if (type == ColumnarEncoder::MessageType::HEADER) {
+                EXPECT_EQ(in.read<uint32_t>(), ColumnarEncoder::VERSION);
+                const uint32_t columnCount = in.read<uint32_t>();
+
+                for (uint32_t i = 0; i < columnCount; i++) {
+                    DecodedColumn& col = cols.emplace_back();
+                    col._type = in.read<uint8_t>();
+                    col._flags = in.read<uint8_t>();
+                    in.skip(sizeof(uint16_t));
+
+                    const uint32_t nameSize = in.read<uint32_t>();
+                    col._name = in.readString(nameSize);
+                    in.align();
+                }
+            } else if (type == ColumnarEncoder::MessageType::BATCH) {
+                const uint32_t columnCount = in.read<uint32_t>();
+                in.skip(sizeof(uint32_t));
+                EXPECT_EQ(columnCount, cols.size());
+
+                for (uint32_t i = 0; i < columnCount; i++) {
+                    DecodedColumn& col = cols[i];
+                    const uint64_t length = in.read<uint64_t>();
+
+                    std::vector<uint8_t> bitmap((length + 7) / 8, 0xff);
+                    if (col._flags & ColumnarEncoder::NULLABLE) {
+                        for (uint8_t& byte : bitmap) {
+                            byte = in.read<uint8_t>();
+                        }
+                        in.align();
+                    }
+
+                    for (uint64_t row = 0; row < length; row++) {
+                        col._valid.push_back((bitmap[row / 8] >> (row % 8)) & 1);
+                    }
+
+                    const size_t valueSize = getValueSize((ColumnarEncoder::ColumnType)col._type);
+                    if (valueSize == 0) {
+                        std::vector<uint64_t> offsets(length + 1);
+                        for (uint64_t& offset : offsets) {
+                            offset = in.read<uint64_t>();
+                        }
+
+                        for (uint64_t row = 0; row < length; row++) {
+                            col._strings.push_back(in.readString(offsets[row + 1] - offsets[row]));
+                        }
+                    } else {
+                        for (uint64_t row = 0; row < length; row++) {
+                            col._values.push_back(in.readValue(valueSize));
+                        }
+                    }
+
+                    in.align();
+                }
+            } else {
+                in.skip(bodySize);
+            }
+
+            EXPECT_EQ(in.pos() - bodyStart, bodySize);
+        }
+
+        return cols;
+    }
+};
+
+TEST_F(ColumnarEncoderTest, optionalMatchNullIDs) {
+    const std::string stream = queryColumnar(R"(
+        MATCH (p:Person)
+        OPTIONAL MATCH (p)-[e:LIVES_IN]->(c)
+        RETURN p, e, c
+    )");
+
+    const auto cols = decode(stream);
+    ASSERT_EQ(cols.size(), 3);
+
+    // ID columns are nullable, whether or not they hold nulls
+    for (const DecodedColumn& col : cols) {
+        EXPECT_EQ(col._type, (uint8_t)ColumnarEncoder::ColumnType::UInt64) << col._name;
+        EXPECT_TRUE(col._flags & ColumnarEncoder::NULLABLE) << col._name;
+        ASSERT_EQ(col._values.size(), 3) << col._name;
+    }
+
+    const DecodedColumn& persons = getColumn(cols, "p");
+    const DecodedColumn& edges = getColumn(cols, "e");
+    const DecodedColumn& cities = getColumn(cols, "c");
+
+    size_t nullCount = 0;
+    for (size_t row = 0; row < 3; row++) {
+        EXPECT_TRUE(persons._valid[row]);
+        EXPECT_EQ(edges._valid[row], cities._valid[row]);
+
+        if (!cities._valid[row]) {
+            // Null rows hold 0, not the sentinel of invalid IDs
+            EXPECT_EQ(edges._values[row], 0);
+            EXPECT_EQ(cities._values[row], 0);
+            nullCount++;
+        }
+    }
+
+    // The third person does not live anywhere
+    EXPECT_EQ(nullCount, 1);
+}
+
+TEST_F(ColumnarEncoderTest, propertyColumns) {
+    using ColumnType = ColumnarEncoder::ColumnType;
+
+    const std::string stream = queryColumnar(R"(
+        MATCH (p:Person)
+        RETURN p.name, p.age, p.score, p.active
+    )");
+
+    const auto cols = decode(stream);
+    ASSERT_EQ(cols.size(), 4);
+
+    EXPECT_EQ(cols[0]._type, (uint8_t)ColumnType::String);
+    EXPECT_EQ(cols[1]._type, (uint8_t)ColumnType::Int64);
+    EXPECT_EQ(cols[2]._type, (uint8_t)ColumnType::Double);
+    EXPECT_EQ(cols[3]._type, (uint8_t)ColumnType::Bool);
+
+    // Properties are nullable, the third person has none
+    for (const DecodedColumn& col : cols) {
+        EXPECT_EQ(col._flags, ColumnarEncoder::NULLABLE) << col._name;
+        ASSERT_EQ(col._valid, std::vector<bool>({true, true, false})) << col._name;
+    }
+
+    EXPECT_EQ(cols[0]._strings, std::vector<std::string>({"Remy", "Adam", ""}));
+    EXPECT_EQ(std::bit_cast<int64_t>(cols[1]._values[0]), -31);
+    EXPECT_EQ(std::bit_cast<int64_t>(cols[1]._values[1]), 28);
+    EXPECT_EQ(std::bit_cast<double>(cols[2]._values[0]), 1.5);
+    EXPECT_EQ(std::bit_cast<double>(cols[2]._values[1]), -2.25);
+    EXPECT_EQ(cols[3]._values, std::vector<uint64_t>({1, 0, 0}));
+
+    // Null rows hold 0
+    EXPECT_EQ(cols[1]._values[2], 0);
+    EXPECT_EQ(cols[2]._values[2], 0);
+}
+
+TEST_F(ColumnarEncoderTest, constantColumn) {
+    const std::string stream = queryColumnar("MATCH (p:Person) RETURN count(p)");
+
+    const auto cols = decode(stream);
+    ASSERT_EQ(cols.size(), 1);
+
+    // The count is a single value shared by all the rows
+    const DecodedColumn& count = cols.front();
+    EXPECT_EQ(count._type, (uint8_t)ColumnarEncoder::ColumnType::UInt64);
+    EXPECT_EQ(count._flags, ColumnarEncoder::CONSTANT);
+    EXPECT_EQ(count._values, std::vector<uint64_t>({3}));
+}
+
+TEST_F(ColumnarEncoderTest, errorMessage) {
+    const std::string stream = encodeColumnar([](ColumnarEncoder& encoder) {
+        encoder.writeError("Query failed", "details");
+    });
+
+    ColumnarReader in {stream};
+    ASSERT_EQ((ColumnarEncoder::MessageType)in.read<uint32_t>(),
+              ColumnarEncoder::MessageType::HEADER);
+    in.skip(sizeof(uint32_t));
+    in.skip(in.read<uint64_t>());
+
+    // The error replaces the END message
+    ASSERT_EQ((ColumnarEncoder::MessageType)in.read<uint32_t>(),
+              ColumnarEncoder::MessageType::ERROR);
+    in.skip(sizeof(uint32_t));
+    EXPECT_EQ(in.read<uint64_t>(), 32);
+
+    const uint32_t errorSize = in.read<uint32_t>();
+    const uint32_t detailsSize = in.read<uint32_t>();
+    EXPECT_EQ(in.readString(errorSize), "Query failed");
+    EXPECT_EQ(in.readString(detailsSize), "details");
+    in.align();
+    EXPECT_TRUE(in.atEnd());
+}
+
+TEST_F(ColumnarEncoderTest, headerWithoutDataframe) {
+    // EXPLAIN returns no dataframe, the stream still starts with a header
+    const std::string stream = queryColumnar("EXPLAIN MATCH (p:Person) RETURN p");
+
+    ColumnarReader in {stream};
+    ASSERT_EQ((ColumnarEncoder::MessageType)in.read<uint32_t>(),
+              ColumnarEncoder::MessageType::HEADER);
+    in.skip(sizeof(uint32_t));
+    ASSERT_EQ(in.read<uint64_t>(), 2 * sizeof(uint32_t));
+    EXPECT_EQ(in.read<uint32_t>(), ColumnarEncoder::VERSION);
+    EXPECT_EQ(in.read<uint32_t>(), 0);
+
+    ASSERT_EQ((ColumnarEncoder::MessageType)in.read<uint32_t>(),
+              ColumnarEncoder::MessageType::END);
+    in.skip(sizeof(uint32_t));
+    ASSERT_EQ(in.read<uint64_t>(), sizeof(double));
+    in.skip(sizeof(double));
+    EXPECT_TRUE(in.atEnd());
+}
+
+int main(int argc, char** argv) {
+    return turing::test::turingTestMain(argc, argv, [] {});
+}
@@ -0,0 +1,178 @@
+#include <gtest/gtest.h>
+
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "ExecutionPool.h"
+#include "AbstractThreadContext.h"
+
+#include "TuringTest.h"
+
+using namespace turing::test;
+
+// Blocks the thread of the pool until the test opens it
+class Gate {
+public:
+    void enter() {
+        std::unique_lock lock(_mutex);
+        _entered = true;
+        _cv.notify_all();
+        _cv.wait(lock, [this] { return _open; });
+    }
+
+    void waitEntered() {
+        std::unique_lock lock(_mutex);
+        _cv.wait(lock, [this] { return _entered; });
+    }
+
+    void open() {
+        std::unique_lock lock(_mutex);
+        _open = true;
+        _cv.notify_all();
+    }
+
+private:
+    std::mutex _mutex;
+    std::condition_variable _cv;
+    bool _entered {false};
+    bool _open {false};
+};
+
+class ExecutionPoolTest : public TuringTest {
+public:
+    void initialize() override {
+        _createThreadContext = [] {
+            return std::make_unique<net::AbstractThreadContext>();
+        };
+    }
+
+protected:
+    net::CreateThreadContext _createThreadContext;
+    Gate _gate;
+
+    std::mutex _mutex;
+    std::condition_variable _cv;
+    std::vector<std::string> _executed;
+    std::vector<std::string> _cancelled;
+
+    // Occupies the single thread of @param pool until the gate is opened
+    void block(net::ExecutionPool& pool) {
+        ASSERT_TRUE(pool.submit("block",
+                                [this](net::AbstractThreadContext*) { _gate.enter(); },
+                                [] {}));
+        _gate.waitEntered();
+    }
+
+    bool submit(net::ExecutionPool& pool, std::string_view queue, const std::string& name) {
+        return pool.submit(
+            queue,
+            [this, name](net::AbstractThreadContext*) {
+                std::unique_lock lock(_mutex);
+                _executed.push_back(name);
+                _cv.notify_all();
+            },
+            [this, name] {
+                std::unique_lock lock(_mutex);
+                _cancelled.push_back(name);
+            });
+    }
+
+    void waitExecuted(size_t count) {
+        std::unique_lock lock(_mutex);
+        _cv.wait(lock, [&] { return _executed.size() >= count; });
+    }
+};
+
+TEST_F(ExecutionPoolTest, queuesTakeTurns) {
+    net::ExecutionPool pool(_createThreadContext, 1, 16);
+    pool.start(0);
+    block(pool);
+
+    // A busy queue does not delay the tasks of the other queues
+    for (const char* name : {"a1", "a2", "a3", "a4"}) {
+        ASSERT_TRUE(submit(pool, "a", name));
+    }
+
+    for (const char* name : {"b1", "b2"}) {
+        ASSERT_TRUE(submit(pool, "b", name));
+    }
+
+    EXPECT_EQ(pool.getQueuedTaskCount(), 6);
+
+    _gate.open();
+    waitExecuted(6);
+    pool.terminate();
+
+    const std::vector<std::string> expected {"a1", "b1", "a2", "b2", "a3", "a4"};
+    EXPECT_EQ(_executed, expected);
+    EXPECT_TRUE(_cancelled.empty());
+    EXPECT_EQ(pool.getQueuedTaskCount(), 0);
+}
+
+TEST_F(ExecutionPoolTest, boundedQueue) {
+    net::ExecutionPool pool(_createThreadContext, 1, 2);
+    pool.start(0);
+    block(pool);
+
+    // The tasks of all the queues count towards the limit
+    ASSERT_TRUE(submit(pool, "a", "a1"));
+    ASSERT_TRUE(submit(pool, "b", "b1"));
+
+    // Refused, the connection manager answers 503 Service Unavailable
+    EXPECT_FALSE(submit(pool, "c", "c1"));
+    EXPECT_EQ(pool.getQueuedTaskCount(), 2);
+
+    _gate.open();
+    waitExecuted(2);
+
+    // Room is made once queued tasks are executed
+    ASSERT_TRUE(submit(pool, "c", "c2"));
+    waitExecuted(3);
+    pool.terminate();
+
+    const std::vector<std::string> expected {"a1", "b1", "c2"};
+    EXPECT_EQ(_executed, expected);
+
+    // A refused task is not cancelled, the caller rejects it itself
+    EXPECT_TRUE(_cancelled.empty());
+}
+
+TEST_F(ExecutionPoolTest, terminateCancelsQueuedTasks) {
+    net::ExecutionPool pool(_createThreadContext, 1, 1 << 16);
+    pool.start(0);
+    block(pool);
+
+    for (const char* name : {"a1", "a2", "b1"}) {
+        ASSERT_TRUE(submit(pool, name[0] == 'a' ? "a" : "b", name));
+    }
+
+    std::thread terminateThread([&] { pool.terminate(); });
+
+    // Submissions fail as soon as the pool stops running,
+    // the running task is only released afterwards
+    size_t probeCount = 0;
+    while (submit(pool, "probe", "probe")) {
+        probeCount++;
+        std::this_thread::yield();
+    }
+
+    _gate.open();
+    terminateThread.join();
+
+    // The running task completed, the queued ones were cancelled instead
+    EXPECT_TRUE(_executed.empty());
+    EXPECT_EQ(_cancelled.size(), 3 + probeCount);
+    EXPECT_EQ(pool.getQueuedTaskCount(), 0);
+
+    EXPECT_FALSE(submit(pool, "a", "a3"));
+    EXPECT_EQ(_cancelled.size(), 3 + probeCount);
+}
+
+int main(int argc, char** argv) {
+    return turing::test::turingTestMain(argc, argv, [] {
+        testing::GTEST_FLAG(repeat) = 1;
+    });
+}
@@ -1,9 +1,13 @@
 #include <gtest/gtest.h>
 
 #include "columns/ColumnIDs.h"
+#include "columns/ColumnConst.h"
+#include "columns/ColumnOptVector.h"
 #include "dataframe/DataframeManager.h"
 #include "dataframe/Dataframe.h"
 #include "dataframe/NamedColumn.h"
+#include "iterators/ChunkConfig.h"
+#include "metadata/PropertyType.h"
 
 #include "TuringException.h"
 
@@ -41,6 +45,29 @@ TEST_F(DataframeTest, testOneCol) {
     }
 }
 
+TEST_F(DataframeTest, rowBytes) {
+    DataframeManager dfMan;
+    Dataframe df;
+    ASSERT_EQ(df.getRowBytes(), 0);
+
+    ColumnNodeIDs nodes;
+    ColumnOptVector<types::Int64::Primitive> values;
+    ColumnConst<types::Int64::Primitive> constant;
+
+    df.addColumn(NamedColumn::create(&dfMan, &nodes, dfMan.allocTag()));
+    df.addColumn(NamedColumn::create(&dfMan, &values, dfMan.allocTag()));
+    df.addColumn(NamedColumn::create(&dfMan, &constant, dfMan.allocTag()));
+
+    // Constant columns do not grow with the rows
+    ASSERT_EQ(df.getRowBytes(), sizeof(NodeID) + sizeof(std::optional<int64_t>));
+
+    // Chunks are bounded by the L2 budget and the default chunk size
+    ASSERT_EQ(ChunkConfig::getChunkSize(0), ChunkConfig::CHUNK_SIZE);
+    ASSERT_EQ(ChunkConfig::getChunkSize(sizeof(NodeID)), ChunkConfig::CHUNK_SIZE);
+    ASSERT_EQ(ChunkConfig::getChunkSize(64), ChunkConfig::L2_BUDGET / 64);
+    ASSERT_EQ(ChunkConfig::getChunkSize(1024ull * 1024), ChunkConfig::MIN_CHUNK_SIZE);
+}
+
 TEST_F(DataframeTest, anonymous) {
     DataframeManager dfMan;
 
@@ -0,0 +1,175 @@
+#include "TuringTest.h"
+
+#include "Graph.h"
+#include "DataPart.h"
+#include "statistics/GraphStatistics.h"
+#include "statistics/HyperLogLog.h"
+#include "versioning/Transaction.h"
+#include "views/GraphView.h"
+#include "writers/GraphWriter.h"
+
+using namespace turing::test;
+using namespace db;
+
+class GraphStatisticsTest : public TuringTest {
+protected:
+    // Two dataparts, the second one with an edge to a node of the first one
+    std::unique_ptr<Graph> createGraph() {
+        auto graph = Graph::create();
+        GraphWriter writer {graph.get()};
+
+        const NodeID paris = writer.addNode({"City"});
+        writer.addNodeProperty<types::String>(paris, "name", "Paris");
+        const NodeID london = writer.addNode({"City"});
+        writer.addNodeProperty<types::String>(london, "name", "London");
+
+        for (int64_t i = 0; i < 10; i++) {
+            const NodeID person = writer.addNode({"Person"});
+            writer.addNodeProperty<types::Int64>(person, "age", 20 + i % 5);
+
+            const EdgeRecord edge = writer.addEdge("LIVES_IN", person, i < 8 ? paris : london);
+            writer.addEdgeProperty<types::Int64>(edge, "since", 2000 + i);
+        }
+
+        writer.submit();
+
+        const NodeID person = writer.addNode({"Person"});
+        writer.addNodeProperty<types::Int64>(person, "age", 50);
+        writer.addEdge("LIVES_IN", person, london);
+
+        writer.submit();
+
+        return graph;
+    }
+
+    static LabelSetID getLabelSetID(const GraphView& view, std::string_view label) {
+        const LabelID labelID = view.metadata().labels().get(label).value();
+        return view.metadata().labelsets().get(LabelSet::fromList({labelID})).value();
+    }
+};
+
+TEST_F(GraphStatisticsTest, hyperLogLogEstimate) {
+    for (const uint64_t count : {10, 100, 1000, 100000}) {
+        HyperLogLog sketch;
+
+        // Duplicates do not change the estimate
+        for (size_t repeat = 0; repeat < 2; repeat++) {
+            for (uint64_t i = 0; i < count; i++) {
+                sketch.add(HyperLogLog::hash(i));
+            }
+        }
+
+        const double error = std::abs((double)sketch.estimate() - (double)count) / count;
+        ASSERT_LT(error, 0.1);
+    }
+}
+
+TEST_F(GraphStatisticsTest, hyperLogLogMerge) {
+    HyperLogLog first;
+    HyperLogLog second;
+
+    for (uint64_t i = 0; i < 20000; i++) {
+        first.add(HyperLogLog::hash(i));
+        second.add(HyperLogLog::hash(i + 10000));
+    }
+
+    first.merge(second);
+
+    const double error = std::abs((double)first.estimate() - 30000.0) / 30000.0;
+    ASSERT_LT(error, 0.1);
+}
+
+TEST_F(GraphStatisticsTest, graphStatistics) {
+    auto graph = createGraph();
+
+    const FrozenCommitTx tx = graph->openTransaction();
+    const GraphView view = tx.viewGraph();
+
+    ASSERT_EQ(view.dataparts().size(), 2);
+    for (const auto& part : view.dataparts()) {
+        ASSERT_NE(part->statistics(), nullptr);
+    }
+
+    const auto stats = view.statistics();
+    ASSERT_NE(stats, nullptr);
+
+    // Cached until new dataparts are added
+    ASSERT_EQ(stats, view.statistics());
+
+    const LabelSetID city = getLabelSetID(view, "City");
+    const LabelSetID person = getLabelSetID(view, "Person");
+    const EdgeTypeID livesIn = view.metadata().edgeTypes().get("LIVES_IN").value();
+
+    ASSERT_EQ(stats->nodeCount(), 13);
+    ASSERT_EQ(stats->edgeCount(), 11);
+    ASSERT_EQ(stats->getNodeCount(city), 2);
+    ASSERT_EQ(stats->getNodeCount(person), 11);
+
+    // The labelset of the target of the second datapart's edge comes from the first one
+    const EdgePatternKey key {
+        ._sourceLabelSet = person,
+        ._edgeType = livesIn,
+        ._targetLabelSet = city,
+    };
+    ASSERT_EQ(stats->edgeCounts().size(), 1);
+    ASSERT_EQ(stats->edgeCounts().at(key), 11);
+
+    const DegreeHistogram& outDegrees = stats->outDegrees().at(livesIn);
+    ASSERT_EQ(outDegrees._nodeCount, 11);
+    ASSERT_EQ(outDegrees._edgeCount, 11);
+    ASSERT_EQ(outDegrees._buckets[0], 11);
+
+    // London is counted once per datapart
+    const DegreeHistogram& inDegrees = stats->inDegrees().at(livesIn);
+    ASSERT_EQ(inDegrees._nodeCount, 3);
+    ASSERT_EQ(inDegrees._edgeCount, 11);
+
+    const PropertyTypeID age = view.metadata().propTypes().get("age")->_id;
+    const PropertyStatistics* ageStats = stats->getNodeProperty(age);
+    ASSERT_NE(ageStats, nullptr);
+    ASSERT_EQ(ageStats->_count, 11);
+    ASSERT_EQ(ageStats->distinctCount(), 6);
+    ASSERT_EQ(ageStats->_min, 20);
+    ASSERT_EQ(ageStats->_max, 50);
+    ASSERT_NEAR(stats->getNodePropertyNullFraction(age), 2.0 / 13.0, 1e-9);
+
+    const PropertyTypeID name = view.metadata().propTypes().get("name")->_id;
+    const PropertyStatistics* nameStats = stats->getNodeProperty(name);
+    ASSERT_NE(nameStats, nullptr);
+    ASSERT_EQ(nameStats->_minString, "London");
+    ASSERT_EQ(nameStats->_maxString, "Paris");
+
+    const PropertyTypeID since = view.metadata().propTypes().get("since")->_id;
+    ASSERT_NEAR(stats->getEdgePropertyNullFraction(since), 1.0 / 11.0, 1e-9);
+}
+
+TEST_F(GraphStatisticsTest, serialize) {
+    auto graph = createGraph();
+
+    const FrozenCommitTx tx = graph->openTransaction();
+    const auto stats = tx.viewGraph().statistics();
+
+    std::vector<uint8_t> data;
+    stats->serialize(data);
+
+    GraphStatistics loaded;
+    ASSERT_TRUE(loaded.deserialize(data));
+
+    ASSERT_EQ(loaded.nodeCount(), stats->nodeCount());
+    ASSERT_EQ(loaded.edgeCount(), stats->edgeCount());
+    ASSERT_EQ(loaded.nodeCounts(), stats->nodeCounts());
+    ASSERT_EQ(loaded.edgeCounts(), stats->edgeCounts());
+
+    for (const auto& [ptID, propStats] : stats->nodeProperties()) {
+        const PropertyStatistics* loadedStats = loaded.getNodeProperty(ptID);
+        ASSERT_NE(loadedStats, nullptr);
+        ASSERT_EQ(loadedStats->_count, propStats._count);
+        ASSERT_EQ(loadedStats->distinctCount(), propStats.distinctCount());
+        ASSERT_EQ(loadedStats->_minString, propStats._minString);
+    }
+
+    // Truncated data is rejected
+    data.resize(data.size() / 2);
+    ASSERT_FALSE(loaded.deserialize(data));
+    ASSERT_EQ(loaded.nodeCount(), 0);
+}
@@ -8,6 +8,7 @@
 #include "versioning/Transaction.h"
 #include "views/GraphView.h"
 #include "reader/GraphReader.h"
+#include "reader/NodeNeighborhoods.h"
 #include "metadata/GraphMetadata.h"
 #include "versioning/CommitBuilder.h"
 #include "versioning/Change.h"
@@ -697,6 +698,57 @@ TEST_F(IteratorsTest, GetEdgesIteratorTest) {
     ASSERT_EQ(count, compareSet.size());
 }
 
+TEST_F(IteratorsTest, NodeNeighborhoodsTest) {
+    const FrozenCommitTx transaction = _graph->openTransaction();
+    const GraphReader reader = transaction.readGraph();
+
+    // Unsorted, with duplicates and with a node that does not exist
+    const std::vector<NodeID> requested {8, 3, 0, 2, 3, 1, 4, 1000};
+
+    std::vector<NodeID> expectedNodes = requested;
+    std::ranges::sort(expectedNodes);
+    expectedNodes.erase(std::ranges::unique(expectedNodes).begin(), expectedNodes.end());
+
+    for (const size_t limit : {(size_t)0, (size_t)1, (size_t)2, std::numeric_limits<size_t>::max()}) {
+        NodeNeighborhoods neighborhoods;
+        neighborhoods.collect(reader.getView(), requested, limit);
+
+        ASSERT_EQ(neighborhoods.size(), expectedNodes.size());
+
+        for (size_t i = 0; i < neighborhoods.size(); i++) {
+            const NodeID nodeID = neighborhoods.nodeIDs()[i];
+            ASSERT_EQ(nodeID.getValue(), expectedNodes[i].getValue());
+
+            ColumnNodeIDs nodeIDs = {nodeID};
+
+            const auto compare = [&](const auto& range,
+                                     std::span<const EdgeRecord> edges,
+                                     bool hasAllEdges) {
+                std::vector<EdgeRecord> expected;
+                for (const EdgeRecord& edge : range) {
+                    expected.push_back(edge);
+                }
+
+                ASSERT_EQ(edges.size(), std::min(expected.size(), limit));
+                ASSERT_EQ(hasAllEdges, expected.size() <= limit);
+
+                for (size_t j = 0; j < edges.size(); j++) {
+                    ASSERT_EQ(edges[j]._edgeID.getValue(), expected[j]._edgeID.getValue());
+                    ASSERT_EQ(edges[j]._nodeID.getValue(), expected[j]._nodeID.getValue());
+                    ASSERT_EQ(edges[j]._otherID.getValue(), expected[j]._otherID.getValue());
+                }
+            };
+
+            compare(reader.getOutEdges(&nodeIDs),
+                    neighborhoods.getOutEdges(i),
+                    neighborhoods.hasAllOutEdges(i));
+            compare(reader.getInEdges(&nodeIDs),
+                    neighborhoods.getInEdges(i),
+                    neighborhoods.hasAllInEdges(i));
+        }
+    }
+}
+
 TEST_F(IteratorsTest, ScanNodePropertiesIteratorTest) {
     const FrozenCommitTx transaction = _graph->openTransaction();
     const GraphReader reader = transaction.readGraph();
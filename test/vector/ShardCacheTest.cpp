@@ -0,0 +1,118 @@
+#include <gtest/gtest.h>
+
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "ShardCache.h"
+#include "StorageManager.h"
+#include "VecLibMetadata.h"
+#include "VecLibShard.h"
+
+#include "TuringTest.h"
+
+using namespace turing::test;
+
+class ShardCacheTest : public TuringTest {
+public:
+    void initialize() override {
+        auto storage = vec::StorageManager::create(fs::Path {_outDir} / "vectors");
+        ASSERT_TRUE(storage);
+        _storage = std::move(storage.value());
+
+        _meta._id = 1;
+        _meta._name = "lib";
+        _meta._dimension = DIM;
+        _meta._metric = vec::DistanceMetric::EUCLIDEAN_DIST;
+        _meta._indexType = vec::IndexType::BRUTE_FORCE;
+
+        ASSERT_TRUE(_storage->getLibraryPath(_meta._id).mkdir());
+    }
+
+protected:
+    static constexpr vec::Dimension DIM = 4;
+
+    std::unique_ptr<vec::StorageManager> _storage;
+    vec::VecLibMetadata _meta;
+
+    void addVectors(vec::VecLibShard& shard, size_t count) {
+        std::unique_lock lock {shard._mutex};
+
+        std::vector<float> vectors(count * DIM);
+        for (size_t i = 0; i < vectors.size(); i++) {
+            vectors[i] = (float)i;
+        }
+
+        for (size_t i = 0; i < count; i++) {
+            shard._ids.push_back(shard._ids.size());
+        }
+
+        shard.addVectors(_meta, count, vectors.data());
+    }
+};
+
+TEST_F(ShardCacheTest, heldShardsAreNotEvicted) {
+    {
+        vec::ShardCache cache {*_storage};
+
+        // Every shard is above the limit
+        cache.setMemLimit(1);
+
+        std::shared_ptr<vec::VecLibShard> held = cache.getShard(_meta, 0);
+        addVectors(*held, 10);
+
+        // The other shard is accessed more often, the held one would be evicted first
+        std::shared_ptr<vec::VecLibShard> other = cache.getShard(_meta, 1);
+        for (size_t i = 0; i < 3; i++) {
+            EXPECT_EQ(cache.getShard(_meta, 1), other);
+        }
+        addVectors(*other, 10);
+        other.reset();
+
+        // Only the released shard is saved and dropped
+        cache.updateMemUsage();
+        EXPECT_EQ(cache.getEvictionCount(), 1);
+        EXPECT_EQ(cache.getShard(_meta, 0), held);
+
+        // Vectors added after the eviction are saved with the shard
+        addVectors(*held, 5);
+        held.reset();
+    }
+
+    vec::ShardCache cache {*_storage};
+
+    const std::shared_ptr<vec::VecLibShard> shard = cache.getShard(_meta, 0);
+    EXPECT_EQ(shard->_ids.size(), 15);
+    EXPECT_EQ(shard->_index->ntotal, 15);
+
+    const std::shared_ptr<vec::VecLibShard> other = cache.getShard(_meta, 1);
+    EXPECT_EQ(other->_ids.size(), 10);
+    EXPECT_EQ(other->_index->ntotal, 10);
+}
+
+TEST_F(ShardCacheTest, allShardsHeld) {
+    vec::ShardCache cache {*_storage};
+    cache.setMemLimit(1);
+
+    // The cache goes above its limit rather than dropping held shards
+    std::vector<std::shared_ptr<vec::VecLibShard>> shards;
+    for (vec::LSHSignature sig = 0; sig < 4; sig++) {
+        addVectors(*shards.emplace_back(cache.getShard(_meta, sig)), 10);
+        cache.updateMemUsage();
+    }
+
+    EXPECT_EQ(cache.getEvictionCount(), 0);
+    EXPECT_EQ(cache.getMissCount(), 4);
+
+    for (vec::LSHSignature sig = 0; sig < 4; sig++) {
+        EXPECT_EQ(cache.getShard(_meta, sig), shards[sig]);
+    }
+
+    EXPECT_EQ(cache.getHitCount(), 4);
+}
+
+int main(int argc, char** argv) {
+    return turing::test::turingTestMain(argc, argv, [] {
+        testing::GTEST_FLAG(repeat) = 1;
+    });
+}
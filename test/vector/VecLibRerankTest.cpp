@@ -0,0 +1,339 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <string>
+#include <vector>
+
+#include "VectorDatabase.h"
+#include "VecLibAccessor.h"
+#include "VecLibMetadata.h"
+#include "VecLibMetadataLoader.h"
+#include "VecLibMetadataWriter.h"
+#include "BatchVectorCreate.h"
+#include "VectorSearchQuery.h"
+#include "VectorSearchResult.h"
+
+#include "TuringTest.h"
+
+using namespace turing::test;
+
+// The vectors have a single dimension and all lie on the positive side,
+// so they share the same shard. The vector of ID i is i + 1
+class VecLibRerankTest : public TuringTest {
+public:
+    void initialize() override {
+        _dbPath = fs::Path {_outDir} / "vectors";
+    }
+
+protected:
+    static constexpr vec::Dimension DIM = 1;
+
+    // Enough vectors to train the SQ8 and IVF-PQ shards
+    static constexpr size_t VECTOR_COUNT = 1200;
+
+    fs::Path _dbPath;
+
+    std::unique_ptr<vec::VectorDatabase> openDatabase() {
+        auto vectorDB = vec::VectorDatabase::create(_dbPath);
+        EXPECT_TRUE(vectorDB);
+        return vectorDB ? std::move(vectorDB.value()) : nullptr;
+    }
+
+    static float getVector(uint64_t id) {
+        return (float)(id + 1);
+    }
+
+    static float getExactDistance(float query, uint64_t id) {
+        const float diff = query - getVector(id);
+        return diff * diff;
+    }
+
+    static void addVectors(vec::VecLibAccessor& lib) {
+        vec::BatchVectorCreate batch = lib.prepareCreateBatch();
+        for (uint64_t id = 0; id < VECTOR_COUNT; id++) {
+            const float vector = getVector(id);
+            batch.addPoint(id, std::span {&vector, 1});
+        }
+        ASSERT_TRUE(lib.addEmbeddings(batch));
+    }
+
+    // Searches the @param k nearest vectors of @param query
+    static void search(vec::VecLibAccessor& lib,
+                       float query,
+                       size_t k,
+                       size_t probeCount,
+                       vec::VectorSearchResult& result) {
+        vec::VectorSearchQuery searchQuery {DIM};
+        searchQuery.setVector(std::span {&query, 1});
+        searchQuery.setMaxResultCount(k);
+        searchQuery.setProbeCount(probeCount);
+
+        ASSERT_TRUE(lib.search(searchQuery, result));
+    }
+
+    // The results must be the exact nearest neighbors, with their exact distances
+    static void checkExactResults(vec::VecLibAccessor& lib, size_t probeCount) {
+        constexpr size_t k = 3;
+
+        for (const float query : {3.3f, 250.3f, 500.3f, 777.7f, 1100.6f}) {
+            std::vector<uint64_t> expected(VECTOR_COUNT);
+            for (uint64_t id = 0; id < VECTOR_COUNT; id++) {
+                expected[id] = id;
+            }
+            std::partial_sort(expected.begin(), expected.begin() + k, expected.end(),
+                              [&](uint64_t lhs, uint64_t rhs) {
+                return getExactDistance(query, lhs) < getExactDistance(query, rhs);
+            });
+
+            vec::VectorSearchResult result;
+            search(lib, query, k, probeCount, result);
+            ASSERT_EQ(result.count(), k);
+
+            for (size_t i = 0; i < k; i++) {
+                EXPECT_EQ(result.ids()[i], expected[i]) << "query " << query;
+                EXPECT_NEAR(result.distances()[i], getExactDistance(query, expected[i]), 1e-3f)
+                    << "query " << query;
+            }
+        }
+    }
+
+    // Sum of the sizes of the exact vectors files of @param libID
+    size_t getExactVectorsSize(vec::VecLibID libID) const {
+        const auto files = (_dbPath / std::to_string(libID)).listDir();
+        EXPECT_TRUE(files);
+        if (!files) {
+            return 0;
+        }
+
+        size_t size = 0;
+        for (const fs::Path& file : files.value()) {
+            if (file.filename().starts_with("exact_vectors-")) {
+                size += file.getFileInfo()->_size;
+            }
+        }
+
+        return size;
+    }
+
+    void writeFile(const fs::Path& path, std::string_view content) {
+        auto file = fs::File::createAndOpen(path);
+        ASSERT_TRUE(file);
+        ASSERT_TRUE(file->clearContent());
+        ASSERT_TRUE(file->write((void*)content.data(), content.size()));
+    }
+
+    vec::VectorResult<void> loadMetadata(const fs::Path& path, vec::VecLibMetadata& meta) {
+        auto file = fs::File::open(path);
+        EXPECT_TRUE(file);
+
+        vec::VecLibMetadataLoader loader;
+        loader.setFile(&file.value());
+        return loader.load(meta);
+    }
+};
+
+TEST_F(VecLibRerankTest, metadataRoundTrip) {
+    const fs::Path path = fs::Path {_outDir} / "metadata.json";
+
+    for (const vec::IndexType indexType : {vec::IndexType::SQ8, vec::IndexType::IVF_PQ}) {
+        vec::VecLibMetadata meta;
+        meta._id = 42;
+        meta._name = "lib";
+        meta._dimension = 8;
+        meta._metric = vec::DistanceMetric::EUCLIDEAN_DIST;
+        meta._indexType = indexType;
+        meta._indexParams._pqBitCount = 6;
+        meta._indexParams._rerankFactor = 3;
+
+        {
+            auto file = fs::File::createAndOpen(path);
+            ASSERT_TRUE(file);
+
+            vec::VecLibMetadataWriter writer;
+            writer.setFile(&file.value());
+            ASSERT_TRUE(writer.write(meta));
+        }
+
+        vec::VecLibMetadata loaded;
+        ASSERT_TRUE(loadMetadata(path, loaded));
+
+        EXPECT_EQ(loaded._indexType, indexType);
+        EXPECT_EQ(loaded.encoding(), meta.encoding());
+        EXPECT_EQ(loaded.precision(), indexType == vec::IndexType::SQ8 ? 8 : 6);
+        EXPECT_EQ(loaded._indexParams._rerankFactor, 3);
+        EXPECT_TRUE(loaded.hasExactVectors());
+    }
+}
+
+TEST_F(VecLibRerankTest, metadataEncodingMismatch) {
+    const fs::Path path = fs::Path {_outDir} / "metadata.json";
+
+    writeFile(path, R"({
+    "id": 1,
+    "name": "lib",
+    "dimension": 8,
+    "metric": "EUCLIDEAN_DIST",
+    "encoding": "PQ",
+    "index_type": "SQ8",
+    "created_at": 0,
+    "modified_at": 0
+})");
+
+    vec::VecLibMetadata meta;
+    const auto res = loadMetadata(path, meta);
+    ASSERT_FALSE(res);
+    EXPECT_EQ(res.error().getType(), vec::VectorErrorCode::InvalidMetadata);
+}
+
+TEST_F(VecLibRerankTest, legacyMetadataDisablesRerank) {
+    const fs::Path path = fs::Path {_outDir} / "metadata.json";
+
+    // Written before the rerank factor was added to the index parameters
+    writeFile(path, R"({
+    "id": 1,
+    "name": "lib",
+    "dimension": 8,
+    "metric": "EUCLIDEAN_DIST",
+    "precision": 32,
+    "index_type": "SQ8",
+    "index_params": {
+        "hnsw_m": 32,
+        "hnsw_ef_construction": 40,
+        "ivf_list_count": 64,
+        "pq_sub_quantizer_count": 8,
+        "pq_bit_count": 8
+    },
+    "created_at": 0,
+    "modified_at": 0
+})");
+
+    vec::VecLibMetadata meta;
+    ASSERT_TRUE(loadMetadata(path, meta));
+    EXPECT_EQ(meta.encoding(), vec::VectorEncoding::SQ8);
+    EXPECT_EQ(meta._indexParams._rerankFactor, 0);
+    EXPECT_FALSE(meta.hasExactVectors());
+
+    // Written before the index parameters were added
+    writeFile(path, R"({
+    "id": 1,
+    "name": "lib",
+    "dimension": 8,
+    "metric": "EUCLIDEAN_DIST",
+    "precision": 32,
+    "index_type": "SQ8",
+    "created_at": 0,
+    "modified_at": 0
+})");
+
+    vec::VecLibMetadata oldMeta;
+    ASSERT_TRUE(loadMetadata(path, oldMeta));
+    EXPECT_EQ(oldMeta._indexParams._rerankFactor, 0);
+    EXPECT_FALSE(oldMeta.hasExactVectors());
+}
+
+TEST_F(VecLibRerankTest, exactVectorsReload) {
+    vec::VecLibID libID {};
+
+    {
+        auto vectorDB = openDatabase();
+        ASSERT_TRUE(vectorDB);
+
+        auto created = vectorDB->createLibrary("sq8", DIM,
+                                               vec::DistanceMetric::EUCLIDEAN_DIST,
+                                               vec::IndexType::SQ8);
+        ASSERT_TRUE(created);
+        libID = created.value();
+
+        vec::VecLibAccessor lib = vectorDB->getLibrary("sq8");
+        ASSERT_TRUE(lib.isValid());
+        addVectors(lib);
+
+        // Not saved yet, the exact vectors are still in memory
+        EXPECT_EQ(getExactVectorsSize(libID), 0);
+        checkExactResults(lib, 0);
+    }
+
+    // The shards are saved when the database is closed
+    EXPECT_EQ(getExactVectorsSize(libID), VECTOR_COUNT * DIM * sizeof(float));
+
+    // The exact vectors are mapped back from the side file
+    auto vectorDB = openDatabase();
+    ASSERT_TRUE(vectorDB);
+
+    vec::VecLibAccessor lib = vectorDB->getLibrary("sq8");
+    ASSERT_TRUE(lib.isValid());
+    checkExactResults(lib, 0);
+}
+
+TEST_F(VecLibRerankTest, rerankSQ8) {
+    auto vectorDB = openDatabase();
+    ASSERT_TRUE(vectorDB);
+
+    // The quantization step is about 4, close vectors share the same code
+    vec::IndexParams params;
+    params._rerankFactor = 16;
+    ASSERT_TRUE(vectorDB->createLibrary("reranked", DIM,
+                                        vec::DistanceMetric::EUCLIDEAN_DIST,
+                                        vec::IndexType::SQ8,
+                                        params));
+
+    params._rerankFactor = 0;
+    ASSERT_TRUE(vectorDB->createLibrary("approximate", DIM,
+                                        vec::DistanceMetric::EUCLIDEAN_DIST,
+                                        vec::IndexType::SQ8,
+                                        params));
+
+    {
+        vec::VecLibAccessor lib = vectorDB->getLibrary("reranked");
+        ASSERT_TRUE(lib.isValid());
+        addVectors(lib);
+        checkExactResults(lib, 0);
+    }
+
+    // Without re-ranking, the distances are the ones of the quantized vectors
+    vec::VecLibAccessor lib = vectorDB->getLibrary("approximate");
+    ASSERT_TRUE(lib.isValid());
+    addVectors(lib);
+
+    size_t approximateCount = 0;
+    for (const float query : {3.3f, 250.3f, 500.3f, 777.7f, 1100.6f}) {
+        vec::VectorSearchResult result;
+        search(lib, query, 3, 0, result);
+
+        for (size_t i = 0; i < result.count(); i++) {
+            const float exact = getExactDistance(query, result.ids()[i]);
+            approximateCount += std::abs(result.distances()[i] - exact) > 0.05f;
+        }
+    }
+
+    EXPECT_GT(approximateCount, 0);
+}
+
+TEST_F(VecLibRerankTest, rerankIVFPQ) {
+    auto vectorDB = openDatabase();
+    ASSERT_TRUE(vectorDB);
+
+    vec::IndexParams params;
+    params._ivfListCount = 4;
+    params._pqSubQuantizerCount = 1;
+    params._pqBitCount = 4;
+    params._rerankFactor = 16;
+    ASSERT_TRUE(vectorDB->createLibrary("ivfpq", DIM,
+                                        vec::DistanceMetric::EUCLIDEAN_DIST,
+                                        vec::IndexType::IVF_PQ,
+                                        params));
+
+    vec::VecLibAccessor lib = vectorDB->getLibrary("ivfpq");
+    ASSERT_TRUE(lib.isValid());
+    addVectors(lib);
+
+    // All the inverted lists are visited, only the codes are approximate
+    checkExactResults(lib, params._ivfListCount);
+}
+
+int main(int argc, char** argv) {
+    return turing::test::turingTestMain(argc, argv, [] {
+        testing::GTEST_FLAG(repeat) = 1;
+    });
+}
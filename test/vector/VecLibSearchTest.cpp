@@ -0,0 +1,255 @@
+#include <gtest/gtest.h>
+
+#include <random>
+#include <thread>
+#include <vector>
+
+#include "VectorDatabase.h"
+#include "VecLibAccessor.h"
+#include "VecLibMetadata.h"
+#include "VecLibShard.h"
+#include "BatchVectorCreate.h"
+#include "VectorSearchQuery.h"
+#include "VectorSearchResult.h"
+
+#include "TuringTest.h"
+
+using namespace turing::test;
+
+// The vectors are spread over many shards, each query vector probes
+// several of them and the shards are probed by several query vectors
+class VecLibSearchTest : public TuringTest {
+public:
+    void initialize() override {
+        auto vectorDB = vec::VectorDatabase::create(fs::Path {_outDir} / "vectors");
+        ASSERT_TRUE(vectorDB);
+        _vectorDB = std::move(vectorDB.value());
+
+        std::mt19937 rng {42};
+        std::normal_distribution<float> dist;
+
+        _vectors.resize(VECTOR_COUNT * DIM);
+        for (float& x : _vectors) {
+            x = dist(rng);
+        }
+
+        _queries.resize(QUERY_COUNT * DIM);
+        for (float& x : _queries) {
+            x = dist(rng);
+        }
+    }
+
+protected:
+    static constexpr vec::Dimension DIM = 8;
+    static constexpr size_t VECTOR_COUNT = 2000;
+    static constexpr size_t QUERY_COUNT = 16;
+    static constexpr size_t K = 5;
+
+    std::unique_ptr<vec::VectorDatabase> _vectorDB;
+    std::vector<float> _vectors;
+    std::vector<float> _queries;
+
+    std::span<const float> getVector(uint64_t id) const {
+        return std::span {_vectors}.subspan(id * DIM, DIM);
+    }
+
+    std::span<const float> getQuery(size_t q) const {
+        return std::span {_queries}.subspan(q * DIM, DIM);
+    }
+
+    void createLibrary(std::string_view name, vec::DistanceMetric metric) {
+        ASSERT_TRUE(_vectorDB->createLibrary(name, DIM, metric));
+
+        vec::VecLibAccessor lib = _vectorDB->getLibrary(name);
+        ASSERT_TRUE(lib.isValid());
+
+        vec::BatchVectorCreate batch = lib.prepareCreateBatch();
+        for (uint64_t id = 0; id < VECTOR_COUNT; id++) {
+            batch.addPoint(id, getVector(id));
+        }
+        ASSERT_TRUE(lib.addEmbeddings(batch));
+    }
+
+    // Searches all the query vectors in a single call
+    void searchBatch(vec::VecLibAccessor& lib, std::span<vec::VectorSearchResult> results) const {
+        vec::VectorSearchQuery query {DIM};
+        for (size_t q = 0; q < QUERY_COUNT; q++) {
+            query.addVector(getQuery(q));
+        }
+        query.setMaxResultCount(K);
+
+        ASSERT_EQ(query.count(), QUERY_COUNT);
+        ASSERT_TRUE(lib.search(query, results));
+    }
+
+    void searchOne(vec::VecLibAccessor& lib, size_t q, vec::VectorSearchResult& result) const {
+        vec::VectorSearchQuery query {DIM};
+        query.setVector(getQuery(q));
+        query.setMaxResultCount(K);
+
+        ASSERT_TRUE(lib.search(query, result));
+    }
+
+    static void expectSameResults(const vec::VectorSearchResult& lhs,
+                                  const vec::VectorSearchResult& rhs) {
+        ASSERT_EQ(lhs.count(), rhs.count());
+
+        for (size_t i = 0; i < lhs.count(); i++) {
+            EXPECT_EQ(lhs.ids()[i], rhs.ids()[i]);
+            EXPECT_NEAR(lhs.distances()[i], rhs.distances()[i], 1e-4f);
+        }
+    }
+};
+
+TEST_F(VecLibSearchTest, batchedEuclidean) {
+    createLibrary("euclidean", vec::DistanceMetric::EUCLIDEAN_DIST);
+    vec::VecLibAccessor lib = _vectorDB->getLibrary("euclidean");
+
+    std::vector<vec::VectorSearchResult> results(QUERY_COUNT);
+    searchBatch(lib, results);
+
+    for (size_t q = 0; q < QUERY_COUNT; q++) {
+        const vec::VectorSearchResult& result = results[q];
+        ASSERT_GT(result.count(), 0);
+        ASSERT_LE(result.count(), K);
+
+        // Exact distances of the flat shards, closest first
+        for (size_t i = 0; i < result.count(); i++) {
+            float expected = 0.0f;
+            for (size_t d = 0; d < DIM; d++) {
+                const float diff = getQuery(q)[d] - getVector(result.ids()[i])[d];
+                expected += diff * diff;
+            }
+
+            EXPECT_NEAR(result.distances()[i], expected, 1e-4f);
+
+            if (i > 0) {
+                EXPECT_LE(result.distances()[i - 1], result.distances()[i]);
+            }
+        }
+
+        // Same results as a search of the query vector alone
+        vec::VectorSearchResult single;
+        searchOne(lib, q, single);
+        expectSameResults(result, single);
+    }
+}
+
+TEST_F(VecLibSearchTest, batchedInnerProduct) {
+    createLibrary("inner", vec::DistanceMetric::INNER_PRODUCT);
+    vec::VecLibAccessor lib = _vectorDB->getLibrary("inner");
+
+    std::vector<vec::VectorSearchResult> results(QUERY_COUNT);
+    searchBatch(lib, results);
+
+    for (size_t q = 0; q < QUERY_COUNT; q++) {
+        const vec::VectorSearchResult& result = results[q];
+        ASSERT_GT(result.count(), 0);
+        ASSERT_LE(result.count(), K);
+
+        // Higher inner products first
+        for (size_t i = 1; i < result.count(); i++) {
+            EXPECT_GE(result.distances()[i - 1], result.distances()[i]);
+        }
+
+        vec::VectorSearchResult single;
+        searchOne(lib, q, single);
+        expectSameResults(result, single);
+    }
+}
+
+TEST_F(VecLibSearchTest, resultCountMismatch) {
+    createLibrary("euclidean", vec::DistanceMetric::EUCLIDEAN_DIST);
+    vec::VecLibAccessor lib = _vectorDB->getLibrary("euclidean");
+
+    vec::VectorSearchQuery query {DIM};
+    query.addVector(getQuery(0));
+    query.addVector(getQuery(1));
+
+    // One result set is expected per query vector
+    vec::VectorSearchResult result;
+    const auto res = lib.search(query, result);
+    ASSERT_FALSE(res);
+    EXPECT_EQ(res.error().getType(), vec::VectorErrorCode::InvalidSearchQuery);
+}
+
+TEST_F(VecLibSearchTest, ivfpqTrainCountIsBounded) {
+    vec::VecLibMetadata meta;
+    meta._dimension = DIM;
+    meta._indexType = vec::IndexType::IVF_PQ;
+    meta._indexParams._pqSubQuantizerCount = 2;
+
+    // 39 vectors per centroid of the largest of the coarse quantizer and the codebooks
+    meta._indexParams._ivfListCount = 4;
+    meta._indexParams._pqBitCount = 8;
+    ASSERT_TRUE(vec::VecLibShard::checkIndexParams(meta));
+    EXPECT_EQ(vec::VecLibShard::getTrainCount(meta), 39 * 256);
+
+    meta._indexParams._ivfListCount = 1024;
+    ASSERT_TRUE(vec::VecLibShard::checkIndexParams(meta));
+    EXPECT_EQ(vec::VecLibShard::getTrainCount(meta), 39 * 1024);
+
+    // Shards would buffer millions of vectors before being trained
+    meta._indexParams._pqBitCount = 16;
+    const auto bitsRes = vec::VecLibShard::checkIndexParams(meta);
+    ASSERT_FALSE(bitsRes);
+    EXPECT_EQ(bitsRes.error().getType(), vec::VectorErrorCode::InvalidIndexParams);
+
+    meta._indexParams._pqBitCount = 8;
+    meta._indexParams._ivfListCount = 65536;
+    const auto listsRes = vec::VecLibShard::checkIndexParams(meta);
+    ASSERT_FALSE(listsRes);
+    EXPECT_EQ(listsRes.error().getType(), vec::VectorErrorCode::InvalidIndexParams);
+
+    // Rejected when the library is created
+    vec::IndexParams params;
+    params._pqSubQuantizerCount = 2;
+    params._pqBitCount = 16;
+    const auto created = _vectorDB->createLibrary("ivfpq", DIM,
+                                                  vec::DistanceMetric::EUCLIDEAN_DIST,
+                                                  vec::IndexType::IVF_PQ,
+                                                  params);
+    ASSERT_FALSE(created);
+    EXPECT_EQ(created.error().getType(), vec::VectorErrorCode::InvalidIndexParams);
+}
+
+TEST_F(VecLibSearchTest, concurrentBatches) {
+    createLibrary("euclidean", vec::DistanceMetric::EUCLIDEAN_DIST);
+
+    std::vector<vec::VectorSearchResult> expected(QUERY_COUNT);
+    {
+        vec::VecLibAccessor lib = _vectorDB->getLibrary("euclidean");
+        searchBatch(lib, expected);
+    }
+
+    // Concurrent searches share the shards and the job system
+    constexpr size_t threadCount = 4;
+    std::vector<std::vector<vec::VectorSearchResult>> results(threadCount);
+    std::vector<std::thread> threads;
+
+    for (size_t t = 0; t < threadCount; t++) {
+        results[t] = std::vector<vec::VectorSearchResult>(QUERY_COUNT);
+        threads.emplace_back([&, t] {
+            for (size_t i = 0; i < 10; i++) {
+                vec::VecLibAccessor lib = _vectorDB->getLibrary("euclidean");
+                searchBatch(lib, results[t]);
+            }
+        });
+    }
+
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+
+    for (size_t t = 0; t < threadCount; t++) {
+        for (size_t q = 0; q < QUERY_COUNT; q++) {
+            expectSameResults(results[t][q], expected[q]);
+        }
+    }
+}
+
+int main(int argc, char** argv) {
+    return turing::test::turingTestMain(argc, argv, [] {
+        testing::GTEST_FLAG(repeat) = 1;
+    });
+}
@@ -22,8 +22,12 @@ int main(int argc, const char** argv) {
 
     bool demonize = false;
     bool inMemory = false;
+    bool walEnabled = false;
+    bool tieredStorage = false;
     bool resetDefault = false;
     unsigned port = 6666;
+    unsigned queryThreadCount = 8;
+    unsigned memoryBudget = 0;
     std::string address {"127.0.0.1"};
     std::string turingDir;
     std::vector<std::string> graphsToLoad;
@@ -36,6 +40,10 @@ int main(int argc, const char** argv) {
              .metavar("addr")
              .help("Server listen address (localhost by default)") 
              .store_into(address);
+    argParser.add_argument("-query-threads")
+             .metavar("count")
+             .help("Number of threads executing queries (8 by default)")
+             .store_into(queryThreadCount);
     argParser.add_argument("-demon")
              .help("Launch TuringDB as a daemon in the background")
              .store_into(demonize);
@@ -49,6 +57,16 @@ int main(int argc, const char** argv) {
     argParser.add_argument("-in-memory")
              .help("Run turingdb in-memory only without writing graphs on disk")
              .store_into(inMemory);
+    argParser.add_argument("-wal")
+             .help("Log submitted changes in a write-ahead log, dumped in the background")
+             .store_into(walEnabled);
+    argParser.add_argument("-tiered")
+             .help("Load the dataparts of the graphs on demand, the least recently used are evicted above the memory budget")
+             .store_into(tieredStorage);
+    argParser.add_argument("-memory-budget")
+             .metavar("MiB")
+             .help("Memory budget of the dataparts in tiered mode (unlimited by default)")
+             .store_into(memoryBudget);
     argParser.add_argument("-turing-dir")
              .metavar("path")
              .store_into(turingDir)
@@ -59,6 +77,9 @@ int main(int argc, const char** argv) {
     // Config
     TuringConfig config;
     config.setSyncedOnDisk(!inMemory);
+    config.setWALEnabled(walEnabled);
+    config.setTieredStorage(tieredStorage);
+    config.setMemoryBudget((size_t)memoryBudget * 1024 * 1024);
 
     if (!turingDir.empty()) {
         fs::Path absTuringDir(turingDir);
@@ -109,6 +130,7 @@ int main(int argc, const char** argv) {
         DBServerConfig serverConfig;
         serverConfig.setPort(port);
         serverConfig.setAddress(address);
+        serverConfig.setQueryThreadCount(queryThreadCount);
 
         TuringServer server(serverConfig, turingDB);
         server.start();
@@ -31,6 +31,7 @@
 
 #include "Panic.h"
 #include "Profiler.h"
+#include "QueryProfile.h"
 
 using namespace db;
 
@@ -270,6 +271,45 @@ void shCommand(const TuringShell::Command::Words& args, TuringShell& shell, std:
     }
 }
 
+std::string formatEstimate(double estimatedRows) {
+    if (estimatedRows < 0) {
+        return "?";
+    }
+
+    return fmt::format("{:.0f}", estimatedRows);
+}
+
+// Operators of EXPLAIN and PROFILE queries, indented by depth in the pipeline
+void printProfile(const QueryProfile& profile) {
+    tabulate::Table table;
+
+    if (profile.isExecuted()) {
+        table.add_row({"Operator", "Est. rows", "Rows in", "Rows out",
+                       "Chunks", "Time (ms)", "Memory (B)", "DataParts"});
+    } else {
+        table.add_row({"Operator", "Est. rows"});
+    }
+
+    for (const QueryProfile::Operator& op : profile.operators()) {
+        const std::string name = std::string(op._depth * 2, ' ') + op._name;
+
+        if (profile.isExecuted()) {
+            table.add_row({name,
+                           formatEstimate(op._estimatedRows),
+                           std::to_string(op._rowsIn),
+                           std::to_string(op._rowsOut),
+                           std::to_string(op._chunks),
+                           fmt::format("{:.3f}", op._time.count()),
+                           std::to_string(op._memoryBytes),
+                           std::to_string(op._dataparts)});
+        } else {
+            table.add_row({name, formatEstimate(op._estimatedRows)});
+        }
+    }
+
+    std::cout << table << "\n";
+}
+
 } // namespace
 
 TuringShell::TuringShell(TuringDB& turingDB, LocalMemory* mem)
@@ -542,6 +582,10 @@ void TuringShell::processLine(std::string& line) {
         std::cout << table << "\n";
     }
 
+    if (const QueryProfile* profile = res.getProfile()) {
+        printProfile(*profile);
+    }
+
     {
         std::string profilerOutput;
         Profiler::dumpAndClear(profilerOutput);
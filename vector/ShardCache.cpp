@@ -26,25 +26,43 @@ ShardCache::~ShardCache() noexcept {
     }
 }
 
-VecLibShard& ShardCache::getShard(const VecLibMetadata& meta, LSHSignature signature) {
-    std::unique_lock lock {_mutex};
-
+std::shared_ptr<VecLibShard> ShardCache::getShard(const VecLibMetadata& meta,
+                                                  LSHSignature signature) {
     const ShardIdentifier id {meta._id, signature};
 
-    auto it = _accessedMap.find(id);
+    // Cached shards are shared between concurrent searches
+    {
+        std::shared_lock lock {_mutex};
+
+        auto it = _accessedMap.find(id);
+        if (it != _accessedMap.end()) {
+            ShardEntry& entry = it->second->second;
+            entry.accessCount.fetch_add(1, std::memory_order_relaxed);
+            _stats.add((size_t)Stat::HITS);
+            return entry.shard;
+        }
+    }
+
+    std::unique_lock lock {_mutex};
 
-    // If already in cache, increment access count and return
+    // The shard may have been loaded while waiting for the lock
+    auto it = _accessedMap.find(id);
     if (it != _accessedMap.end()) {
-        it->second->second.accessCount++;
-        return *it->second->second.shard;
+        ShardEntry& entry = it->second->second;
+        entry.accessCount.fetch_add(1, std::memory_order_relaxed);
+        _stats.add((size_t)Stat::HITS);
+        return entry.shard;
     }
 
+    _stats.add((size_t)Stat::MISSES);
+
     // If not in cache, load/create the shard
     const fs::Path indexPath = _storageManager->getShardPath(meta._id, signature);
     const fs::Path idsPath = _storageManager->getExternalIDsPath(meta._id, signature);
 
-    auto shard = std::make_unique<VecLibShard>();
+    auto shard = std::make_shared<VecLibShard>();
     shard->_indexPath = indexPath;
+    shard->_exactVectorsPath = _storageManager->getExactVectorsPath(meta._id, signature);
 
     if (auto res = fs::File::createAndOpen(idsPath); !res) {
         throw VectorException(fmt::format("Could not open shard ids file '{}'.\n{}",
@@ -66,18 +84,23 @@ VecLibShard& ShardCache::getShard(const VecLibMetadata& meta, LSHSignature signa
     const size_t memUsage = shard->getUsedMem();
     _memUsage += memUsage;
 
-    ShardEntry entry;
-    entry.shard = std::move(shard);
+    // Entries are built in place, the access count is not movable
+    auto& [entryID, entry] = _accessed.emplace_front();
+    entryID = id;
+    entry.shard = shard;
     entry.accessCount = 1;
-
-    _accessed.emplace_front(id, std::move(entry));
     _accessedMap[id] = _accessed.begin();
 
     while (_memUsage > _memLimit && _accessed.size() > 1) {
-        _memUsage -= evictOne();
+        const std::optional<ssize_t> freedMem = evictOne();
+        if (!freedMem) {
+            break;
+        }
+
+        _memUsage -= *freedMem;
     }
 
-    return *_accessed.front().second.shard;
+    return shard;
 }
 
 void ShardCache::updateMemUsage() {
@@ -90,7 +113,12 @@ void ShardCache::updateMemUsage() {
     }
 
     while (memUsage > _memLimit && _accessed.size() > 1) {
-        memUsage -= evictOne();
+        const std::optional<ssize_t> freedMem = evictOne();
+        if (!freedMem) {
+            break;
+        }
+
+        memUsage -= *freedMem;
     }
 
     bioassert(memUsage >= 0, "Shard cache memory usage cannot be negative");
@@ -111,25 +139,36 @@ void ShardCache::evictLibraryShards(VecLibID libID) {
     }
 }
 
-ssize_t ShardCache::evictOne() {
+std::optional<ssize_t> ShardCache::evictOne() {
     bioassert(!_accessed.empty(), "Shard cache is empty");
 
-    // Find shard with lowest access count
-    auto victim = _accessed.begin();
-    size_t minAccessCount = victim->second.accessCount;
+    // Find shard with lowest access count. Shards also held outside of the
+    // cache are skipped, vectors added after the save would be lost
+    auto victim = _accessed.end();
+    size_t minAccessCount = 0;
 
     for (auto it = _accessed.begin(); it != _accessed.end(); ++it) {
-        if (it->second.accessCount < minAccessCount) {
-            minAccessCount = it->second.accessCount;
+        if (it->second.shard.use_count() > 1) {
+            continue;
+        }
+
+        const size_t accessCount = it->second.accessCount.load(std::memory_order_relaxed);
+        if (victim == _accessed.end() || accessCount < minAccessCount) {
+            minAccessCount = accessCount;
             victim = it;
         }
     }
 
+    if (victim == _accessed.end()) {
+        return std::nullopt;
+    }
+
     victim->second.shard->save();
 
-    ssize_t freedMem = victim->second.shard->getUsedMem();
+    const ssize_t freedMem = victim->second.shard->getUsedMem();
     _accessedMap.erase(victim->first);
     _accessed.erase(victim);
+    _stats.add((size_t)Stat::EVICTIONS);
 
     return freedMem;
 }
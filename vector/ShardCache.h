@@ -1,12 +1,15 @@
 #pragma once
 
+#include <atomic>
 #include <list>
 #include <memory>
+#include <optional>
 #include <shared_mutex>
 #include <unordered_map>
 
 #include "LSHSignature.h"
 #include "VecLibMetadata.h"
+#include "ThreadCounters.h"
 
 namespace vec {
 
@@ -45,7 +48,14 @@ public:
     ShardCache& operator=(const ShardCache&) = delete;
     ShardCache& operator=(ShardCache&&) = delete;
 
-    [[nodiscard]] VecLibShard& getShard(const VecLibMetadata& meta, LSHSignature signature);
+    /**
+     * @brief Returns the shard of @param signature, loading it if it is not cached.
+     *
+     * @detail The shard is shared with the cache. It is not evicted while the
+     * caller holds it, so that the vectors added to it are saved on eviction.
+     */
+    [[nodiscard]] std::shared_ptr<VecLibShard> getShard(const VecLibMetadata& meta,
+                                                        LSHSignature signature);
 
     void updateMemUsage();
     void evictLibraryShards(VecLibID libID);
@@ -54,13 +64,25 @@ public:
         _memLimit = memLimit;
     }
 
+    // Lookups of getShard that found the shard in the cache or had to load it
+    uint64_t getHitCount() const { return _stats.get((size_t)Stat::HITS); }
+    uint64_t getMissCount() const { return _stats.get((size_t)Stat::MISSES); }
+    uint64_t getEvictionCount() const { return _stats.get((size_t)Stat::EVICTIONS); }
+
 private:
+    enum class Stat : size_t {
+        HITS = 0,
+        MISSES,
+        EVICTIONS,
+        _SIZE
+    };
+
     mutable std::shared_mutex _mutex;
     StorageManager* _storageManager {nullptr};
 
     struct ShardEntry {
-        std::unique_ptr<VecLibShard> shard;
-        size_t accessCount {0};
+        std::shared_ptr<VecLibShard> shard;
+        std::atomic<size_t> accessCount {0}; // Incremented under shared lock
     };
 
     using AccessedList = std::list<std::pair<ShardIdentifier, ShardEntry>>;
@@ -70,7 +92,11 @@ private:
     ssize_t _memLimit {10ull * 1024 * 1024 * 1024}; // 10 GB
     ssize_t _memUsage {0};
 
-    ssize_t evictOne();
+    // Incremented under the shared lock by concurrent searches
+    db::ThreadCounters<(size_t)Stat::_SIZE> _stats;
+
+    // Returns the memory freed, or nullopt if all the shards are in use
+    std::optional<ssize_t> evictOne();
 };
 
 }
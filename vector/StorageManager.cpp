@@ -141,6 +141,10 @@ fs::Path StorageManager::getExternalIDsPath(const VecLibID& libID, LSHSignature
     return getLibraryPath(libID) / "external_ids-" + std::to_string(sig) + ".bin";
 }
 
+fs::Path StorageManager::getExactVectorsPath(const VecLibID& libID, LSHSignature sig) const {
+    return getLibraryPath(libID) / "exact_vectors-" + std::to_string(sig) + ".bin";
+}
+
 fs::Path StorageManager::getShardRouterPath(const VecLibID& libID) const {
     return getLibraryPath(libID) / "shard_router.bin";
 }
@@ -41,6 +41,7 @@ public:
     [[nodiscard]] fs::Path getMetadataPath(const VecLibID& libID) const;
     [[nodiscard]] fs::Path getShardRouterPath(const VecLibID& libID) const;
     [[nodiscard]] fs::Path getExternalIDsPath(const VecLibID& libID, LSHSignature sig) const;
+    [[nodiscard]] fs::Path getExactVectorsPath(const VecLibID& libID, LSHSignature sig) const;
     [[nodiscard]] fs::Path getShardPath(const VecLibID& libID, LSHSignature sig) const;
 
     [[nodiscard]] StorageMap::const_iterator begin() const {
@@ -1,10 +1,18 @@
 #include "VecLib.h"
 
+#include <algorithm>
+#include <exception>
 #include <mutex>
+#include <unordered_map>
+#include <unordered_set>
 
 #include <faiss/Index.h>
 #include <faiss/IndexFlat.h>
+#include <faiss/IndexIVF.h>
+#include <faiss/impl/HNSW.h>
+#include <faiss/impl/IDSelector.h>
 #include <faiss/index_io.h>
+#include <faiss/utils/distances.h>
 
 #include "ShardCache.h"
 #include "StorageManager.h"
@@ -15,6 +23,8 @@
 #include "LSHShardRouterLoader.h"
 #include "VecLibShard.h"
 #include "VecLibAccessor.h"
+#include "JobGroup.h"
+#include "JobSystem.h"
 
 #include "TuringTime.h"
 #include "BioAssert.h"
@@ -22,6 +32,94 @@
 
 using namespace vec;
 
+namespace {
+
+// Query vectors routed to a shard, searched in a single call. The results of
+// the i-th query vector are stored in the i-th row of k results
+struct ShardProbe {
+    LSHSignature _signature {0};
+    std::vector<size_t> _queries;
+    size_t _k {0};
+    std::vector<float> _distances;
+    std::vector<faiss::idx_t> _labels;
+    std::vector<uint64_t> _ids;
+    std::exception_ptr _exception;
+};
+
+struct SearchCandidate {
+    float _distance {0};
+    uint64_t _id {0};
+    LSHSignature _signature {0};
+};
+
+// Selects the vectors of a shard whose external IDs are candidates of the query
+class CandidateSelector : public faiss::IDSelector {
+public:
+    CandidateSelector(const std::vector<uint64_t>& ids,
+                      const std::unordered_set<uint64_t>& candidates)
+        : _ids(ids),
+        _candidates(candidates)
+    {
+    }
+
+    bool is_member(faiss::idx_t label) const override {
+        return label >= 0
+            && (size_t)label < _ids.size()
+            && _candidates.contains(_ids[label]);
+    }
+
+private:
+    const std::vector<uint64_t>& _ids;
+    const std::unordered_set<uint64_t>& _candidates;
+};
+
+// Search time parameters of a shard, the defaults of the index are kept when not set
+struct ShardSearchParams {
+    faiss::SearchParameters _flatParams;
+    faiss::SearchParametersHNSW _hnswParams;
+    faiss::SearchParametersIVF _ivfParams;
+    const faiss::SearchParameters* _params {nullptr};
+
+    ShardSearchParams(const VecLibMetadata& meta,
+                      const VectorSearchQuery& query,
+                      const faiss::IDSelector* selector) {
+        switch (meta._indexType) {
+            case IndexType::HNSW: {
+                if (query.efSearch() != 0 || selector) {
+                    if (query.efSearch() != 0) {
+                        _hnswParams.efSearch = query.efSearch();
+                    }
+                    _hnswParams.sel = const_cast<faiss::IDSelector*>(selector);
+                    _params = &_hnswParams;
+                }
+            }
+            break;
+            case IndexType::IVF_PQ: {
+                if (query.probeCount() != 0 || selector) {
+                    if (query.probeCount() != 0) {
+                        _ivfParams.nprobe = query.probeCount();
+                    }
+                    _ivfParams.sel = const_cast<faiss::IDSelector*>(selector);
+                    _params = &_ivfParams;
+                }
+            }
+            break;
+            case IndexType::BRUTE_FORCE:
+            case IndexType::SQ8: {
+                if (selector) {
+                    _flatParams.sel = const_cast<faiss::IDSelector*>(selector);
+                    _params = &_flatParams;
+                }
+            }
+            break;
+            case IndexType::_SIZE:
+                break;
+        }
+    }
+};
+
+}
+
 VecLib::~VecLib() {
 }
 
@@ -36,8 +134,13 @@ VectorResult<std::unique_ptr<VecLib>> VecLib::Builder::build() {
 
     bioassert(storageManager, "VecLib storage must be set");
     bioassert(_vecLib->_shardCache, "VecLib shard cache must be set");
+    bioassert(_vecLib->_jobSystem, "VecLib job system must be set");
     bioassert(meta._dimension > 0, "VecLib dimension must be set");
 
+    if (auto res = VecLibShard::checkIndexParams(meta); !res) {
+        return nonstd::make_unexpected(res.error());
+    }
+
     constexpr uint8_t nbits = 10;
     _vecLib->_shardRouter = std::make_unique<LSHShardRouter>(meta._dimension, nbits);
     _vecLib->_shardRouter->initialize();
@@ -66,6 +169,7 @@ VectorResult<std::unique_ptr<VecLib>> VecLib::Loader::load(VecLibStorage& storag
 
     bioassert(_vecLib->_storage, "VecLib storage must be set");
     bioassert(_vecLib->_shardCache, "VecLib shard cache must be set");
+    bioassert(_vecLib->_jobSystem, "VecLib job system must be set");
 
     _vecLib->_shardRouter = std::make_unique<LSHShardRouter>(0, 0);
 
@@ -87,11 +191,15 @@ VectorResult<std::unique_ptr<VecLib>> VecLib::Loader::load(VecLibStorage& storag
 VectorResult<void> VecLib::addEmbeddings(const BatchVectorCreate& batch) {
     LSHSignature signature = 0;
     for (const auto& data : batch) {
+        // Data is indexed by signature, empty entries still take a signature
+        const LSHSignature dataSignature = signature++;
         if (data._externalIDs.empty()) {
             continue;
         }
 
-        auto& shard = _shardCache->getShard(_metadata, signature++);
+        const std::shared_ptr<VecLibShard> shardPtr = _shardCache->getShard(_metadata,
+                                                                            dataSignature);
+        VecLibShard& shard = *shardPtr;
 
         {
             std::unique_lock lock {shard._mutex};
@@ -102,7 +210,7 @@ VectorResult<void> VecLib::addEmbeddings(const BatchVectorCreate& batch) {
                               data._externalIDs.end());
 
             // Add vectors to index
-            shard._index->add(data._externalIDs.size(), data._embeddings.data());
+            shard.addVectors(_metadata, data._externalIDs.size(), data._embeddings.data());
         }
 
         _shardCache->updateMemUsage();
@@ -114,40 +222,190 @@ VectorResult<void> VecLib::addEmbeddings(const BatchVectorCreate& batch) {
 }
 
 VectorResult<void> VecLib::search(const VectorSearchQuery& query, VectorSearchResult& results) {
+    return search(query, std::span {&results, 1});
+}
+
+VectorResult<void> VecLib::search(const VectorSearchQuery& query,
+                                  std::span<VectorSearchResult> results) {
+    const Dimension dim = _metadata._dimension;
+    const size_t queryCount = query.count();
+
+    if (query.dimension() != dim || results.size() != queryCount) {
+        return VectorError::result(VectorErrorCode::InvalidSearchQuery);
+    }
+
     const std::span<const float> embeddings = query.embeddings();
     const size_t maxResultCount = query.resultCount();
 
+    // Group the query vectors by the shards they probe, each query vector
+    // keeps the probes and its row in their results
+    std::vector<ShardProbe> probes;
+    std::unordered_map<LSHSignature, size_t> probeIndices;
+    std::vector<std::vector<std::pair<size_t, size_t>>> queryProbes(queryCount);
     std::vector<LSHSignature> searchSignatures;
 
-    // Compute signature
-    _shardRouter->getSearchSignatures(embeddings, searchSignatures);
+    for (size_t q = 0; q < queryCount; q++) {
+        _shardRouter->getSearchSignatures(embeddings.subspan(q * dim, dim), searchSignatures);
+
+        for (const LSHSignature signature : searchSignatures) {
+            const auto [it, inserted] = probeIndices.try_emplace(signature, probes.size());
+            if (inserted) {
+                probes.emplace_back()._signature = signature;
+            }
+
+            ShardProbe& probe = probes[it->second];
+            queryProbes[q].emplace_back(it->second, probe._queries.size());
+            probe._queries.push_back(q);
+        }
+    }
+
+    // Without candidates, there is nothing to search
+    if (query.hasCandidates() && query.candidates().empty()) {
+        for (VectorSearchResult& result : results) {
+            result.reset();
+        }
 
-    results.reset();
+        return {};
+    }
 
-    std::vector<float> distances(maxResultCount);
-    std::vector<faiss::idx_t> indices(maxResultCount);
+    const bool higherIsBetter = _metadata._metric == DistanceMetric::INNER_PRODUCT;
 
-    for (const LSHSignature& signature : searchSignatures) {
-        auto& shard = _shardCache->getShard(_metadata, signature);
-        std::unique_lock lock {shard._mutex};
+    const auto probeShard = [&](ShardProbe& probe) {
+        const std::shared_ptr<VecLibShard> shard = _shardCache->getShard(_metadata,
+                                                                         probe._signature);
+        std::shared_lock lock {shard->_mutex};
 
-        if (shard._index->ntotal == 0) {
-            continue;
+        const faiss::Index& index = *shard->_index;
+        if (index.ntotal == 0 || maxResultCount == 0) {
+            return;
         }
 
-        const size_t k = std::min(maxResultCount, (size_t)shard._index->ntotal);
-        shard._index->search(1, embeddings.data(), k, distances.data(), indices.data());
+        // The candidates are filtered by the index while it scans the
+        // shard, the k results are only taken among the candidates
+        const CandidateSelector selector {shard->_ids, query.candidates()};
+        const ShardSearchParams params {_metadata,
+                                        query,
+                                        query.hasCandidates() ? &selector : nullptr};
+        const faiss::SearchParameters* searchParams = params._params;
+
+        // Query vectors are gathered to search them in a single call
+        const size_t nq = probe._queries.size();
+        std::vector<float> vectors(nq * dim);
+        for (size_t i = 0; i < nq; i++) {
+            std::copy_n(embeddings.data() + probe._queries[i] * dim,
+                        dim,
+                        vectors.data() + i * dim);
+        }
 
-        for (size_t i = 0; i < k; i++) {
-            if (indices[i] == std::numeric_limits<faiss::idx_t>::max()) {
-                break;
+        // Compressed shards fetch more candidates, re-ranked on the exact vectors
+        const size_t rerankFactor = shard->_hasExactVectors
+                                      ? _metadata._indexParams._rerankFactor
+                                      : 1;
+        probe._k = std::min(maxResultCount * rerankFactor, (size_t)index.ntotal);
+        probe._distances.resize(nq * probe._k);
+        probe._labels.resize(nq * probe._k);
+        probe._ids.resize(nq * probe._k);
+
+        index.search(nq, vectors.data(), probe._k,
+                     probe._distances.data(), probe._labels.data(), searchParams);
+
+        // External IDs are resolved while the shard is locked, approximate
+        // indexes return -1 when fewer than k vectors were found
+        for (size_t i = 0; i < probe._labels.size(); i++) {
+            faiss::idx_t& label = probe._labels[i];
+            if (label < 0 || (size_t)label >= shard->_ids.size()) {
+                label = -1;
+                continue;
+            }
+
+            probe._ids[i] = shard->_ids[label];
+
+            // The approximate distance is kept if the exact vector is missing
+            const float* exactVector = shard->getExactVector(label);
+            if (exactVector) {
+                const float* queryVector = vectors.data() + (i / probe._k) * dim;
+                probe._distances[i] = higherIsBetter
+                                        ? faiss::fvec_inner_product(queryVector, exactVector, dim)
+                                        : faiss::fvec_L2sqr(queryVector, exactVector, dim);
             }
+        }
+    };
 
-            results.addResult(signature, shard._ids.at(indices[i]), distances[i]);
+    if (probes.size() == 1) {
+        for (ShardProbe& probe : probes) {
+            probeShard(probe);
+        }
+    } else {
+        db::JobGroup group = _jobSystem->newGroup();
+
+        for (ShardProbe& probe : probes) {
+            group.submit<void>([&probeShard, &probe](db::Promise*) {
+                try {
+                    probeShard(probe);
+                } catch (...) {
+                    probe._exception = std::current_exception();
+                }
+            });
+        }
+
+        group.wait();
+
+        for (const ShardProbe& probe : probes) {
+            if (probe._exception) {
+                std::rethrow_exception(probe._exception);
+            }
         }
     }
 
-    results.finishSearch(maxResultCount);
+    // Merge the results of the probes of each query vector. The heap keeps the
+    // best candidates found so far, with the worst one on top
+    const auto isBetter = [higherIsBetter](const SearchCandidate& lhs,
+                                           const SearchCandidate& rhs) {
+        return higherIsBetter ? lhs._distance > rhs._distance
+                              : lhs._distance < rhs._distance;
+    };
+
+    std::vector<SearchCandidate> heap;
+    heap.reserve(maxResultCount);
+
+    for (size_t q = 0; q < queryCount; q++) {
+        heap.clear();
+
+        for (const auto& [probeIndex, row] : queryProbes[q]) {
+            const ShardProbe& probe = probes[probeIndex];
+
+            for (size_t i = row * probe._k; i < (row + 1) * probe._k; i++) {
+                if (probe._labels[i] < 0) {
+                    continue;
+                }
+
+                const SearchCandidate candidate {
+                    ._distance = probe._distances[i],
+                    ._id = probe._ids[i],
+                    ._signature = probe._signature,
+                };
+
+                if (heap.size() < maxResultCount) {
+                    heap.push_back(candidate);
+                    std::push_heap(heap.begin(), heap.end(), isBetter);
+                } else if (isBetter(candidate, heap.front())) {
+                    std::pop_heap(heap.begin(), heap.end(), isBetter);
+                    heap.back() = candidate;
+                    std::push_heap(heap.begin(), heap.end(), isBetter);
+                }
+            }
+        }
+
+        // Best candidates first
+        std::sort_heap(heap.begin(), heap.end(), isBetter);
+
+        VectorSearchResult& result = results[q];
+        result.reset();
+
+        for (const SearchCandidate& candidate : heap) {
+            result.addResult(candidate._signature, candidate._id, candidate._distance);
+        }
+    }
 
     return {};
 }
@@ -2,6 +2,7 @@
 
 #include <memory>
 #include <shared_mutex>
+#include <span>
 
 #include "VecLibMetadata.h"
 #include "VectorResult.h"
@@ -10,6 +11,10 @@ namespace faiss {
 struct Index;
 }
 
+namespace db {
+class JobSystem;
+}
+
 namespace vec {
 
 struct VecLibShard;
@@ -46,6 +51,11 @@ public:
             return *this;
         }
 
+        Builder& setJobSystem(db::JobSystem* jobSystem) {
+            _vecLib->_jobSystem = jobSystem;
+            return *this;
+        }
+
         Builder& setID(VecLibID id) {
             _vecLib->_metadata._id = id;
             return *this;
@@ -66,6 +76,16 @@ public:
             return *this;
         }
 
+        Builder& setIndexType(IndexType indexType) {
+            _vecLib->_metadata._indexType = indexType;
+            return *this;
+        }
+
+        Builder& setIndexParams(const IndexParams& params) {
+            _vecLib->_metadata._indexParams = params;
+            return *this;
+        }
+
         [[nodiscard]] VectorResult<std::unique_ptr<VecLib>> build();
 
     private:
@@ -86,6 +106,11 @@ public:
             return *this;
         }
 
+        Loader& setJobSystem(db::JobSystem* jobSystem) {
+            _vecLib->_jobSystem = jobSystem;
+            return *this;
+        }
+
         [[nodiscard]] VectorResult<std::unique_ptr<VecLib>> load(VecLibStorage& storage);
 
     private:
@@ -94,6 +119,16 @@ public:
 
     [[nodiscard]] VectorResult<void> addEmbeddings(const BatchVectorCreate& batch);
     [[nodiscard]] VectorResult<void> search(const VectorSearchQuery& query, VectorSearchResult& results);
+
+    /**
+     * @brief Searches all the vectors of @param query, the results of the i-th vector
+     * are written to the i-th element of @param results.
+     *
+     * @detail Each shard is probed by a single job searching all the query vectors
+     * routed to it, the per-shard results are then merged for each query vector.
+     */
+    [[nodiscard]] VectorResult<void> search(const VectorSearchQuery& query,
+                                            std::span<VectorSearchResult> results);
     [[nodiscard]] BatchVectorCreate prepareCreateBatch();
 
     [[nodiscard]] VecLibID id() const {
@@ -128,6 +163,7 @@ private:
 
     StorageManager* _storage {nullptr};
     ShardCache* _shardCache {nullptr};
+    db::JobSystem* _jobSystem {nullptr};
 
     VecLibMetadata _metadata;
     std::unique_ptr<LSHShardRouter> _shardRouter;
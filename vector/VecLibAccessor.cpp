@@ -36,3 +36,9 @@ VectorResult<void> VecLibAccessor::search(const VectorSearchQuery& query, Vector
     bioassert(_vecLib, "Invalid VecLib accessor");
     return _vecLib->search(query, results);
 }
+
+VectorResult<void> VecLibAccessor::search(const VectorSearchQuery& query,
+                                          std::span<VectorSearchResult> results) {
+    bioassert(_vecLib, "Invalid VecLib accessor");
+    return _vecLib->search(query, results);
+}
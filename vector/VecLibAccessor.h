@@ -1,6 +1,7 @@
 #pragma once
 
 #include <shared_mutex>
+#include <span>
 
 #include "VectorResult.h"
 
@@ -30,6 +31,8 @@ public:
     [[nodiscard]] BatchVectorCreate prepareCreateBatch();
     [[nodiscard]] VectorResult<void> addEmbeddings(const BatchVectorCreate& batch);
     [[nodiscard]] VectorResult<void> search(const VectorSearchQuery& query, VectorSearchResult& results);
+    [[nodiscard]] VectorResult<void> search(const VectorSearchQuery& query,
+                                            std::span<VectorSearchResult> results);
 
 private:
     std::shared_lock<std::shared_mutex> _lock;
@@ -23,15 +23,52 @@ using DistanceMetricName = EnumToString<DistanceMetric>::Create<
     EnumStringPair<DistanceMetric::INNER_PRODUCT, "INNER_PRODUCT">>;
 
 enum class IndexType : uint8_t {
-    BRUTE_FORCE = 0,
-    HNSW,
+    BRUTE_FORCE = 0, // Exact search on the raw vectors
+    HNSW,            // Hierarchical navigable small world graph
+    IVF_PQ,          // Inverted lists of product quantized vectors
+    SQ8,             // Exact search on 8-bit scalar quantized vectors
 
     _SIZE
 };
 
 using IndexTypeName = EnumToString<IndexType>::Create<
     EnumStringPair<IndexType::BRUTE_FORCE, "BRUTE_FORCE">,
-    EnumStringPair<IndexType::HNSW, "HNSW">>;
+    EnumStringPair<IndexType::HNSW, "HNSW">,
+    EnumStringPair<IndexType::IVF_PQ, "IVF_PQ">,
+    EnumStringPair<IndexType::SQ8, "SQ8">>;
+
+// Encoding of the vectors held in memory by the shard indexes
+enum class VectorEncoding : uint8_t {
+    FLOAT32 = 0, // Raw vectors
+    SQ8,         // 8-bit scalar quantized vectors
+    PQ,          // Product quantization codes
+
+    _SIZE
+};
+
+using VectorEncodingName = EnumToString<VectorEncoding>::Create<
+    EnumStringPair<VectorEncoding::FLOAT32, "FLOAT32">,
+    EnumStringPair<VectorEncoding::SQ8, "SQ8">,
+    EnumStringPair<VectorEncoding::PQ, "PQ">>;
+
+// Build parameters of the shard indexes, only the ones of the index type
+// of the library are used
+struct IndexParams {
+    // HNSW
+    uint32_t _hnswM {32};
+    uint32_t _hnswEfConstruction {40};
+
+    // IVF-PQ, the dimension must be a multiple of the sub-quantizer count.
+    // At most 1024 lists and 8 bits per code, the shards are trained once
+    // they hold 39 vectors per centroid
+    uint32_t _ivfListCount {64};
+    uint32_t _pqSubQuantizerCount {8};
+    uint32_t _pqBitCount {8};
+
+    // Compressed encodings, the search fetches k * factor candidates and
+    // re-ranks them on the exact vectors kept on disk. 0 disables re-ranking
+    uint32_t _rerankFactor {4};
+};
 
 struct VecLibMetadata {
     VecLibID _id;
@@ -39,8 +76,45 @@ struct VecLibMetadata {
     Dimension _dimension {0};
     DistanceMetric _metric {DistanceMetric::EUCLIDEAN_DIST};
     IndexType _indexType {IndexType::BRUTE_FORCE};
+    IndexParams _indexParams;
     std::atomic<uint64_t> _createdAt {0};
     std::atomic<uint64_t> _modifiedAt {0};
+
+    [[nodiscard]] VectorEncoding encoding() const {
+        switch (_indexType) {
+            case IndexType::SQ8:
+                return VectorEncoding::SQ8;
+            case IndexType::IVF_PQ:
+                return VectorEncoding::PQ;
+            case IndexType::BRUTE_FORCE:
+            case IndexType::HNSW:
+            case IndexType::_SIZE:
+                break;
+        }
+
+        return VectorEncoding::FLOAT32;
+    }
+
+    // Bits per component of the encoded vectors
+    [[nodiscard]] uint32_t precision() const {
+        switch (encoding()) {
+            case VectorEncoding::SQ8:
+                return 8;
+            case VectorEncoding::PQ:
+                return _indexParams._pqBitCount;
+            case VectorEncoding::FLOAT32:
+            case VectorEncoding::_SIZE:
+                break;
+        }
+
+        return 32;
+    }
+
+    // The exact vectors of compressed encodings are stored next to the
+    // shards to re-rank the search candidates
+    [[nodiscard]] bool hasExactVectors() const {
+        return encoding() != VectorEncoding::FLOAT32 && _indexParams._rerankFactor != 0;
+    }
 };
 
 }
@@ -61,10 +61,38 @@ VectorResult<void> VecLibMetadataLoader::load(VecLibMetadata& metadata) {
             metadata._indexType = IndexType::BRUTE_FORCE;
         } else if (indexType == "HNSW") {
             metadata._indexType = IndexType::HNSW;
+        } else if (indexType == "IVF_PQ") {
+            metadata._indexType = IndexType::IVF_PQ;
+        } else if (indexType == "SQ8") {
+            metadata._indexType = IndexType::SQ8;
         } else {
             return VectorError::result<void>(VectorErrorCode::InvalidIndexType);
         }
 
+        // Library index parameters, absent from libraries created before
+        // index types could be chosen
+        if (json.contains("index_params")) {
+            const nlohmann::json& params = json["index_params"];
+            IndexParams& out = metadata._indexParams;
+
+            out._hnswM = params["hnsw_m"].get<uint32_t>();
+            out._hnswEfConstruction = params["hnsw_ef_construction"].get<uint32_t>();
+            out._ivfListCount = params["ivf_list_count"].get<uint32_t>();
+            out._pqSubQuantizerCount = params["pq_sub_quantizer_count"].get<uint32_t>();
+            out._pqBitCount = params["pq_bit_count"].get<uint32_t>();
+
+            // Libraries created before re-ranking have no exact vectors
+            out._rerankFactor = params.value("rerank_factor", 0u);
+        } else {
+            metadata._indexParams._rerankFactor = 0;
+        }
+
+        // The encoding follows the index type
+        if (json.contains("encoding")
+            && json["encoding"].get<std::string>() != VectorEncodingName::value(metadata.encoding())) {
+            return VectorError::result<void>(VectorErrorCode::InvalidMetadata);
+        }
+
         // Library timestamps
         metadata._createdAt = json["created_at"].get<uint64_t>();
         metadata._modifiedAt = json["modified_at"].get<uint64_t>();
@@ -41,14 +41,38 @@ VectorResult<void> VecLibMetadataWriter::write(const VecLibMetadata& metadata) {
     _writer.write(DistanceMetricName::value(metadata._metric));
     _writer.write("\",\n");
 
+    // Encoding of the vectors in memory
+    _writer.write("    \"encoding\": \"");
+    _writer.write(VectorEncodingName::value(metadata.encoding()));
+    _writer.write("\",\n");
+
     // Precision
-    _writer.write("    \"precision\": 32,\n");
+    _writer.write("    \"precision\": ");
+    _writer.write(std::to_string(metadata.precision()));
+    _writer.write(",\n");
 
     // Index type
     _writer.write("    \"index_type\": \"");
     _writer.write(IndexTypeName::value(metadata._indexType));
     _writer.write("\",\n");
 
+    // Index parameters
+    const IndexParams& params = metadata._indexParams;
+    _writer.write("    \"index_params\": {\n");
+    _writer.write("        \"hnsw_m\": ");
+    _writer.write(std::to_string(params._hnswM));
+    _writer.write(",\n        \"hnsw_ef_construction\": ");
+    _writer.write(std::to_string(params._hnswEfConstruction));
+    _writer.write(",\n        \"ivf_list_count\": ");
+    _writer.write(std::to_string(params._ivfListCount));
+    _writer.write(",\n        \"pq_sub_quantizer_count\": ");
+    _writer.write(std::to_string(params._pqSubQuantizerCount));
+    _writer.write(",\n        \"pq_bit_count\": ");
+    _writer.write(std::to_string(params._pqBitCount));
+    _writer.write(",\n        \"rerank_factor\": ");
+    _writer.write(std::to_string(params._rerankFactor));
+    _writer.write("\n    },\n");
+
     // Created timestamp
     _writer.write("    \"created_at\": ");
     _writer.write(std::to_string(metadata._createdAt));
@@ -1,6 +1,10 @@
 #include "VecLibShard.h"
 
+#include <algorithm>
 #include <faiss/IndexFlat.h>
+#include <faiss/IndexHNSW.h>
+#include <faiss/IndexIVFPQ.h>
+#include <faiss/IndexScalarQuantizer.h>
 #include <faiss/index_io.h>
 #include <mutex>
 
@@ -11,6 +15,269 @@
 
 using namespace vec;
 
+namespace {
+
+faiss::MetricType getFaissMetric(DistanceMetric metric) {
+    switch (metric) {
+        case DistanceMetric::EUCLIDEAN_DIST:
+            return faiss::METRIC_L2;
+        case DistanceMetric::INNER_PRODUCT:
+            return faiss::METRIC_INNER_PRODUCT;
+        case DistanceMetric::_SIZE:
+            break;
+    }
+
+    panic("VecLibShard: invalid distance metric");
+}
+
+bool isQuantized(IndexType indexType) {
+    return indexType == IndexType::IVF_PQ || indexType == IndexType::SQ8;
+}
+
+// Faiss warns below 39 training vectors per centroid
+constexpr size_t TRAIN_VECTORS_PER_CENTROID = 39;
+
+// Scalar quantizers learn the range of each dimension
+constexpr size_t SQ8_TRAIN_COUNT = 1024;
+
+// A shard buffers TRAIN_VECTORS_PER_CENTROID times its largest centroid count
+// before being trained, at most about 40k vectors with these limits
+constexpr uint32_t MAX_IVF_LIST_COUNT = 1024;
+constexpr uint32_t MAX_PQ_BIT_COUNT = 8;
+
+void createFlatIndex(VecLibShard& shard, const VecLibMetadata& meta) {
+    const size_t dim = meta._dimension;
+
+    if (getFaissMetric(meta._metric) == faiss::METRIC_L2) {
+        shard._index = std::make_unique<faiss::IndexFlatL2>(dim);
+    } else {
+        shard._index = std::make_unique<faiss::IndexFlatIP>(dim);
+    }
+
+    shard._bytesPerVector = dim * sizeof(float);
+}
+
+void createIndex(VecLibShard& shard, const VecLibMetadata& meta) {
+    const IndexParams& params = meta._indexParams;
+    const faiss::MetricType metric = getFaissMetric(meta._metric);
+    const size_t dim = meta._dimension;
+
+    switch (meta._indexType) {
+        case IndexType::BRUTE_FORCE: {
+            createFlatIndex(shard, meta);
+        }
+        break;
+        case IndexType::HNSW: {
+            auto index = std::make_unique<faiss::IndexHNSWFlat>(dim, params._hnswM, metric);
+            index->hnsw.efConstruction = params._hnswEfConstruction;
+            shard._index = std::move(index);
+
+            // Vectors and the neighbors of the base level of the graph
+            shard._bytesPerVector = dim * sizeof(float) + 2 * params._hnswM * sizeof(int32_t);
+        }
+        break;
+        case IndexType::IVF_PQ: {
+            auto* quantizer = metric == faiss::METRIC_L2
+                                ? (faiss::IndexFlat*)new faiss::IndexFlatL2(dim)
+                                : (faiss::IndexFlat*)new faiss::IndexFlatIP(dim);
+
+            auto index = std::make_unique<faiss::IndexIVFPQ>(quantizer,
+                                                             dim,
+                                                             params._ivfListCount,
+                                                             params._pqSubQuantizerCount,
+                                                             params._pqBitCount,
+                                                             metric);
+            index->own_fields = true;
+            shard._index = std::move(index);
+
+            shard._bytesPerVector = (params._pqSubQuantizerCount * params._pqBitCount + 7) / 8
+                                  + sizeof(faiss::idx_t);
+        }
+        break;
+        case IndexType::SQ8: {
+            shard._index = std::make_unique<faiss::IndexScalarQuantizer>(
+                dim, faiss::ScalarQuantizer::QT_8bit, metric);
+
+            shard._bytesPerVector = dim;
+        }
+        break;
+        case IndexType::_SIZE:
+            panic("VecLibShard: invalid index type");
+            break;
+    }
+}
+
+void train(VecLibShard& shard, const VecLibMetadata& meta) {
+    const std::unique_ptr<faiss::Index> buffer = std::move(shard._index);
+    const auto& flatIndex = static_cast<const faiss::IndexFlat&>(*buffer);
+    const size_t count = flatIndex.ntotal;
+    const float* data = flatIndex.get_xb();
+
+    // The buffered vectors are added in the same order, their labels
+    // still match the external IDs and the exact vectors
+    createIndex(shard, meta);
+    shard._index->train(count, data);
+    shard._index->add(count, data);
+
+    shard._buffering = false;
+}
+
+VectorResult<void> mapExactVectors(VecLibShard& shard) {
+    shard._exactVectorsRegion = fs::FileRegion {};
+
+    if (shard._savedExactVectorCount == 0) {
+        return {};
+    }
+
+    const size_t byteCount = shard._savedExactVectorCount * shard._dimension * sizeof(float);
+    if (auto res = shard._exactVectorsFile.map(byteCount); !res) {
+        return VectorError::result(VectorErrorCode::CouldNotMapExactVectorsFile, res.error());
+    } else {
+        shard._exactVectorsRegion = std::move(res.value());
+    }
+
+    return {};
+}
+
+VectorResult<void> saveExactVectors(VecLibShard& shard) {
+    if (!shard._hasExactVectors || shard._unsavedExactVectors.empty()) {
+        return {};
+    }
+
+    // Exact vectors are only appended, the file keeps the order of the labels
+    const size_t byteCount = shard._unsavedExactVectors.size() * sizeof(float);
+    if (auto res = shard._exactVectorsFile.write(shard._unsavedExactVectors.data(), byteCount); !res) {
+        return VectorError::result(VectorErrorCode::CouldNotWriteExactVectorsFile, res.error());
+    }
+
+    shard._savedExactVectorCount += shard._unsavedExactVectors.size() / shard._dimension;
+    shard._unsavedExactVectors.clear();
+    shard._unsavedExactVectors.shrink_to_fit();
+
+    return mapExactVectors(shard);
+}
+
+VectorResult<void> loadExactVectors(VecLibShard& shard) {
+    shard._savedExactVectorCount = 0;
+    shard._unsavedExactVectors.clear();
+    shard._exactVectorsRegion = fs::FileRegion {};
+
+    if (!shard._hasExactVectors) {
+        return {};
+    }
+
+    if (auto res = fs::File::createAndOpen(shard._exactVectorsPath); !res) {
+        return VectorError::result(VectorErrorCode::CouldNotOpenExactVectorsFile, res.error());
+    } else {
+        shard._exactVectorsFile = std::move(res.value());
+    }
+
+    const size_t fileSize = shard._exactVectorsFile.getInfo()._size;
+    const size_t vectorSize = shard._dimension * sizeof(float);
+
+    if (fileSize % vectorSize != 0) {
+        return VectorError::result(VectorErrorCode::ExactVectorsFileInvalid);
+    }
+
+    shard._savedExactVectorCount = fileSize / vectorSize;
+
+    return mapExactVectors(shard);
+}
+
+}
+
+VectorResult<void> VecLibShard::checkIndexParams(const VecLibMetadata& meta) {
+    const IndexParams& params = meta._indexParams;
+
+    switch (meta._indexType) {
+        case IndexType::BRUTE_FORCE:
+        case IndexType::SQ8:
+            return {};
+        case IndexType::HNSW: {
+            if (params._hnswM == 0 || params._hnswEfConstruction == 0) {
+                return VectorError::result(VectorErrorCode::InvalidIndexParams);
+            }
+        }
+        return {};
+        case IndexType::IVF_PQ: {
+            if (params._ivfListCount == 0
+                || params._ivfListCount > MAX_IVF_LIST_COUNT
+                || params._pqSubQuantizerCount == 0
+                || meta._dimension % params._pqSubQuantizerCount != 0
+                || params._pqBitCount == 0
+                || params._pqBitCount > MAX_PQ_BIT_COUNT) {
+                return VectorError::result(VectorErrorCode::InvalidIndexParams);
+            }
+        }
+        return {};
+        case IndexType::_SIZE:
+            break;
+    }
+
+    return VectorError::result(VectorErrorCode::InvalidIndexType);
+}
+
+size_t VecLibShard::getTrainCount(const VecLibMetadata& meta) {
+    const IndexParams& params = meta._indexParams;
+
+    switch (meta._indexType) {
+        case IndexType::IVF_PQ: {
+            // Enough vectors for the coarse centroids and for the codebooks
+            const size_t centroidCount = std::max<size_t>(params._ivfListCount,
+                                                          1ull << params._pqBitCount);
+            return TRAIN_VECTORS_PER_CENTROID * centroidCount;
+        }
+        case IndexType::SQ8:
+            return SQ8_TRAIN_COUNT;
+        case IndexType::BRUTE_FORCE:
+        case IndexType::HNSW:
+        case IndexType::_SIZE:
+            break;
+    }
+
+    return 0;
+}
+
+void VecLibShard::addVectors(const VecLibMetadata& meta, size_t count, const float* data) {
+    if (count == 0) {
+        return;
+    }
+
+    _index->add(count, data);
+    addExactVectors(count, data);
+
+    if (_buffering && (size_t)_index->ntotal >= getTrainCount(meta)) {
+        train(*this, meta);
+    }
+}
+
+void VecLibShard::addExactVectors(size_t count, const float* data) {
+    if (!_hasExactVectors) {
+        return;
+    }
+
+    _unsavedExactVectors.insert(_unsavedExactVectors.end(), data, data + count * _dimension);
+}
+
+const float* VecLibShard::getExactVector(faiss::idx_t label) const {
+    if (!_hasExactVectors || label < 0) {
+        return nullptr;
+    }
+
+    const size_t index = label;
+    if (index < _savedExactVectorCount) {
+        const auto* vectors = reinterpret_cast<const float*>(_exactVectorsRegion.view().data());
+        return vectors + index * _dimension;
+    }
+
+    const size_t unsavedIndex = index - _savedExactVectorCount;
+    if ((unsavedIndex + 1) * _dimension > _unsavedExactVectors.size()) {
+        return nullptr;
+    }
+
+    return _unsavedExactVectors.data() + unsavedIndex * _dimension;
+}
+
 VectorResult<void> VecLibShard::save() {
     std::unique_lock lock {_mutex};
 
@@ -27,27 +294,31 @@ VectorResult<void> VecLibShard::save() {
         return VectorError::result(VectorErrorCode::CouldNotWriteExternalIDsFile);
     }
 
-    return {};
+    return saveExactVectors(*this);
 }
 
 VectorResult<void> VecLibShard::load(const VecLibMetadata& meta) {
     std::unique_lock lock {_mutex};
 
-    switch (meta._metric) {
-        case DistanceMetric::EUCLIDEAN_DIST:
-            _index = std::make_unique<faiss::IndexFlatL2>(meta._dimension);
-            break;
-        case DistanceMetric::INNER_PRODUCT:
-            _index = std::make_unique<faiss::IndexFlatIP>(meta._dimension);
-            break;
-        case DistanceMetric::_SIZE:
-            panic("VecLibShard: invalid distance metric");
-            break;
-    }
+    createIndex(*this, meta);
 
     if (_indexPath.exists()) {
-        // Load shard
-        _index.reset(faiss::read_index(_indexPath.c_str(), faiss::IO_FLAG_MMAP));
+        // Load shard, the inverted lists of IVF indexes can not be mapped
+        // since vectors are still added to loaded shards
+        const int ioFlags = meta._indexType == IndexType::IVF_PQ
+                              ? 0
+                              : faiss::IO_FLAG_MMAP;
+
+        _index.reset(faiss::read_index(_indexPath.c_str(), ioFlags));
+    } else if (isQuantized(meta._indexType)) {
+        createFlatIndex(*this, meta);
+    }
+
+    // Quantized shards saved before being trained hold their flat buffer
+    _buffering = isQuantized(meta._indexType)
+              && dynamic_cast<const faiss::IndexFlat*>(_index.get()) != nullptr;
+    if (_buffering) {
+        _bytesPerVector = meta._dimension * sizeof(float);
     }
 
     fs::File& file = _idsReader.file();
@@ -72,6 +343,9 @@ VectorResult<void> VecLibShard::load(const VecLibMetadata& meta) {
     _ids.resize(nodeCount);
     std::memcpy(_ids.data(), buf.data(), buf.size());
 
-    return {};
+    _dimension = meta._dimension;
+    _hasExactVectors = meta.hasExactVectors();
+
+    return loadExactVectors(*this);
 }
 
@@ -1,25 +1,23 @@
 #pragma once
 
-#include <mutex>
+#include <shared_mutex>
 
 #include <faiss/Index.h>
 #include <faiss/index_io.h>
 
 #include "FileReader.h"
+#include "FileRegion.h"
 #include "FileWriter.h"
 #include "Path.h"
 #include "VectorResult.h"
 
-namespace faiss {
-struct HNSWIndex;
-}
-
 namespace vec {
 
 struct VecLibMetadata;
 
 struct VecLibShard {
-    mutable std::mutex _mutex;
+    // Searches share the lock, adding vectors and saving take it exclusively
+    mutable std::shared_mutex _mutex;
 
     fs::Path _indexPath;
 
@@ -29,14 +27,50 @@ struct VecLibShard {
 
     std::unique_ptr<faiss::Index> _index;
     std::vector<uint64_t> _ids;
+    size_t _bytesPerVector {0};
+
+    // Exact vectors of compressed indexes, the saved ones are mapped from
+    // the disk and the others are kept in memory until the next save
+    fs::Path _exactVectorsPath;
+    fs::File _exactVectorsFile;
+    fs::FileRegion _exactVectorsRegion;
+    size_t _savedExactVectorCount {0};
+    std::vector<float> _unsavedExactVectors;
+    size_t _dimension {0};
+    bool _hasExactVectors {false};
+
+    // True while the vectors of a quantized index are kept in a flat index,
+    // until enough of them are available to train the quantizers
+    bool _buffering {false};
 
     [[nodiscard]] size_t getUsedMem() const {
-        return _index->ntotal * sizeof(float) * _index->d
-             + _ids.size() * sizeof(uint64_t);
+        return _index->ntotal * _bytesPerVector
+             + _ids.size() * sizeof(uint64_t)
+             + _unsavedExactVectors.size() * sizeof(float);
     }
 
+    void addExactVectors(size_t count, const float* data);
+
+    // Returns nullptr if the exact vector of @param label is not stored
+    [[nodiscard]] const float* getExactVector(faiss::idx_t label) const;
+
     VectorResult<void> save();
     VectorResult<void> load(const VecLibMetadata& meta);
+
+    /**
+     * @brief Adds the @param count vectors of @param data to the index.
+     *
+     * @detail Quantized indexes buffer their first vectors in a flat index. Once
+     * getTrainCount() vectors are buffered, the quantizers are trained on all of
+     * them and the buffered vectors are moved to the quantized index, so that
+     * the codebooks do not depend on the first batch only.
+     */
+    void addVectors(const VecLibMetadata& meta, size_t count, const float* data);
+
+    // Number of vectors buffered before training a quantized index
+    [[nodiscard]] static size_t getTrainCount(const VecLibMetadata& meta);
+
+    [[nodiscard]] static VectorResult<void> checkIndexParams(const VecLibMetadata& meta);
 };
 
 }
@@ -2,6 +2,7 @@
 
 #include <mutex>
 
+#include "JobSystem.h"
 #include "RandomGenerator.h"
 #include "ShardCache.h"
 #include "StorageManager.h"
@@ -29,6 +30,7 @@ VectorResult<std::unique_ptr<VectorDatabase>> VectorDatabase::create(const fs::P
         return nonstd::make_unexpected(storage.error());
     }
 
+    database->_jobSystem = db::JobSystem::create();
     database->_storageManager = std::move(storage.value());
     database->_shardCache = std::make_unique<ShardCache>(*database->_storageManager);
 
@@ -42,7 +44,9 @@ VectorResult<std::unique_ptr<VectorDatabase>> VectorDatabase::create(const fs::P
 
 VectorResult<VecLibID> VectorDatabase::createLibrary(std::string_view libName,
                                                      Dimension dim,
-                                                     DistanceMetric metric) {
+                                                     DistanceMetric metric,
+                                                     IndexType indexType,
+                                                     const IndexParams& indexParams) {
     if (libName.empty()) {
         return VectorError::result(VectorErrorCode::EmptyLibName);
     }
@@ -60,10 +64,13 @@ VectorResult<VecLibID> VectorDatabase::createLibrary(std::string_view libName,
     auto lib = VecLib::Builder()
                    .setStorage(_storageManager.get())
                    .setShardCache(_shardCache.get())
+                   .setJobSystem(_jobSystem.get())
                    .setID(id)
                    .setName(libName)
                    .setDimension(dim)
                    .setMetric(metric)
+                   .setIndexType(indexType)
+                   .setIndexParams(indexParams)
                    .build();
 
     if (!lib) {
@@ -162,6 +169,7 @@ VectorResult<void> VectorDatabase::load() {
         auto lib = VecLib::Loader()
                        .setStorageManager(_storageManager.get())
                        .setShardCache(_shardCache.get())
+                       .setJobSystem(_jobSystem.get())
                        .load(*storage);
 
         if (!lib) {
@@ -8,6 +8,10 @@
 #include "VecLibMetadata.h"
 #include "VectorResult.h"
 
+namespace db {
+class JobSystem;
+}
+
 namespace vec {
 
 class VecLib;
@@ -31,7 +35,9 @@ public:
 
     [[nodiscard]] VectorResult<VecLibID> createLibrary(std::string_view libName,
                                                        Dimension dim,
-                                                       DistanceMetric metric = DistanceMetric::INNER_PRODUCT);
+                                                       DistanceMetric metric = DistanceMetric::INNER_PRODUCT,
+                                                       IndexType indexType = IndexType::BRUTE_FORCE,
+                                                       const IndexParams& indexParams = {});
     [[nodiscard]] VectorResult<void> deleteLibrary(std::string_view libName);
 
     void listLibraries(std::vector<VecLibID>& out) const;
@@ -42,8 +48,11 @@ public:
     [[nodiscard]] VecLibAccessor getLibrary(const VecLibID& libID);
     [[nodiscard]] VecLibAccessor getLibrary(std::string_view libName);
 
+    [[nodiscard]] const ShardCache& getShardCache() const { return *_shardCache; }
+
 private:
     mutable std::shared_mutex _mutex;
+    std::unique_ptr<db::JobSystem> _jobSystem;
     std::unique_ptr<StorageManager> _storageManager;
     std::unique_ptr<ShardCache> _shardCache;
     VecLibMap _vecLibs;
@@ -17,6 +17,8 @@ enum class VectorErrorCode : uint8_t {
     InvalidDimension,
     InvalidMetric,
     InvalidIndexType,
+    InvalidIndexParams,
+    InvalidSearchQuery,
     InvalidMetadata,
     ReaderNotInitialized,
     WriterNotInitialized,
@@ -51,6 +53,11 @@ enum class VectorErrorCode : uint8_t {
     CouldNotReadExternalIDsFile,
     ExternalIDsFileInvalid,
 
+    CouldNotOpenExactVectorsFile,
+    CouldNotWriteExactVectorsFile,
+    CouldNotMapExactVectorsFile,
+    ExactVectorsFileInvalid,
+
     CouldNotLoadShardRouterFile,
     ShardRouterFileEmpty,
     ShardRouterInvalidDimension,
@@ -72,6 +79,8 @@ using VectorErrorTypeDescription = EnumToString<VectorErrorCode>::Create<
     EnumStringPair<VectorErrorCode::InvalidDimension, "Invalid dimension">,
     EnumStringPair<VectorErrorCode::InvalidMetric, "Invalid metric">,
     EnumStringPair<VectorErrorCode::InvalidIndexType, "Invalid index type">,
+    EnumStringPair<VectorErrorCode::InvalidIndexParams, "Invalid index parameters">,
+    EnumStringPair<VectorErrorCode::InvalidSearchQuery, "Search query does not match the library">,
     EnumStringPair<VectorErrorCode::InvalidMetadata, "Invalid metadata file">,
     EnumStringPair<VectorErrorCode::ReaderNotInitialized, "Reader not initialized">,
     EnumStringPair<VectorErrorCode::WriterNotInitialized, "Writer not initialized">,
@@ -106,6 +115,11 @@ using VectorErrorTypeDescription = EnumToString<VectorErrorCode>::Create<
     EnumStringPair<VectorErrorCode::CouldNotReadExternalIDsFile, "Could not read node IDs file">,
     EnumStringPair<VectorErrorCode::ExternalIDsFileInvalid, "Node IDs file has invalid format">,
 
+    EnumStringPair<VectorErrorCode::CouldNotOpenExactVectorsFile, "Could not open exact vectors file">,
+    EnumStringPair<VectorErrorCode::CouldNotWriteExactVectorsFile, "Could not write exact vectors file">,
+    EnumStringPair<VectorErrorCode::CouldNotMapExactVectorsFile, "Could not map exact vectors file">,
+    EnumStringPair<VectorErrorCode::ExactVectorsFileInvalid, "Exact vectors file has invalid format">,
+
     EnumStringPair<VectorErrorCode::CouldNotLoadShardRouterFile, "Could not load shard router file">,
     EnumStringPair<VectorErrorCode::ShardRouterFileEmpty, "Shard router file is empty">,
     EnumStringPair<VectorErrorCode::ShardRouterInvalidDimension, "Shard router file has invalid dimension">,
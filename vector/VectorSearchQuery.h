@@ -1,6 +1,7 @@
 #pragma once
 
 #include <span>
+#include <unordered_set>
 #include <vector>
 
 #include "VecLibMetadata.h"
@@ -26,10 +27,33 @@ public:
         _embeddings.insert(_embeddings.end(), newPoint.begin(), newPoint.end());
     }
 
+    // Query vectors are searched together, each one gets its own results
+    void addVector(std::span<const float> newPoint) {
+        _embeddings.insert(_embeddings.end(), newPoint.begin(), newPoint.end());
+    }
+
     void setMaxResultCount(size_t count) {
         _maxResultCount = count;
     }
 
+    // Size of the candidate list explored in HNSW indexes, 0 keeps the default
+    void setEfSearch(size_t efSearch) {
+        _efSearch = efSearch;
+    }
+
+    // Number of inverted lists visited in IVF indexes, 0 keeps the default
+    void setProbeCount(size_t probeCount) {
+        _probeCount = probeCount;
+    }
+
+    // Restricts the search to the vectors of the given external IDs,
+    // they are filtered while scanning the shards
+    void setCandidates(std::span<const uint64_t> ids) {
+        _candidates.clear();
+        _candidates.insert(ids.begin(), ids.end());
+        _hasCandidates = true;
+    }
+
     [[nodiscard]] Dimension dimension() const {
         return _dimension;
     }
@@ -46,10 +70,30 @@ public:
         return _maxResultCount;
     }
 
+    [[nodiscard]] size_t efSearch() const {
+        return _efSearch;
+    }
+
+    [[nodiscard]] size_t probeCount() const {
+        return _probeCount;
+    }
+
+    [[nodiscard]] bool hasCandidates() const {
+        return _hasCandidates;
+    }
+
+    [[nodiscard]] const std::unordered_set<uint64_t>& candidates() const {
+        return _candidates;
+    }
+
 private:
     const Dimension _dimension;
     std::vector<float> _embeddings;
     size_t _maxResultCount {1};
+    size_t _efSearch {0};
+    size_t _probeCount {0};
+    std::unordered_set<uint64_t> _candidates;
+    bool _hasCandidates {false};
 };
 
 }